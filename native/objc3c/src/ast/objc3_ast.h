@@ -418,6 +418,8 @@ struct Expr {
   std::vector<std::string> typed_keypath_components;
   std::string typed_keypath_literal_profile;
   bool typed_keypath_literal_is_normalized = false;
+  bool protocol_literal_enabled = false;
+  std::string protocol_literal_name;
   bool try_expression_enabled = false;
   TryOperatorKind try_operator_kind = TryOperatorKind::None;
   bool try_expression_requires_throwing_context = false;
@@ -155,7 +155,9 @@ std::string Objc3CliUsage() {
          "[--llvm-capabilities-summary <path>] [--objc3-route-backend-from-capabilities] "
          "[--objc3-max-message-args <0-" +
          std::to_string(kMaxMessageSendArgs) +
-         ">] [--objc3-runtime-dispatch-symbol <symbol>]";
+         ">] [--objc3-runtime-dispatch-symbol <symbol>] "
+         "[--objc3-dispatch-site-caches] [--objc3-selector-handles] "
+         "[--objc3-sealed-dispatch-tables]";
 }
 
 std::string ConformanceProfileName(Objc3ConformanceProfile profile) {
@@ -291,6 +293,12 @@ bool ParseObjc3CliOptions(int argc, char **argv, Objc3CliOptions &options, std::
         return false;
       }
       options.runtime_dispatch_symbol = symbol;
+    } else if (flag == "--objc3-dispatch-site-caches") {
+      options.dispatch_site_caches = true;
+    } else if (flag == "--objc3-selector-handles") {
+      options.selector_handles = true;
+    } else if (flag == "--objc3-sealed-dispatch-tables") {
+      options.sealed_dispatch_tables = true;
     } else {
       error = "unknown arg: " + flag;
       return false;
@@ -58,6 +58,9 @@ struct Objc3CliOptions {
   std::vector<std::filesystem::path> imported_runtime_surface_paths;
   std::size_t max_message_send_args = 4;
   std::string runtime_dispatch_symbol = "objc3_runtime_dispatch_i32";
+  bool dispatch_site_caches = false;
+  bool selector_handles = false;
+  bool sealed_dispatch_tables = false;
 };
 
 std::string Objc3CliUsage();
@@ -20,5 +20,8 @@ Objc3FrontendOptions BuildObjc3FrontendOptions(const Objc3CliOptions &cli_option
   }
   options.lowering.max_message_send_args = cli_options.max_message_send_args;
   options.lowering.runtime_dispatch_symbol = cli_options.runtime_dispatch_symbol;
+  options.lowering.dispatch_site_caches = cli_options.dispatch_site_caches;
+  options.lowering.selector_handles = cli_options.selector_handles;
+  options.lowering.sealed_dispatch_tables = cli_options.sealed_dispatch_tables;
   return options;
 }
@@ -44,6 +44,105 @@ static bool ParseOwnershipResourceInvalidLiteral(const std::string &text, int &v
   return true;
 }
 
+// Seeded FNV-1a over one selector spelling. The runtime's adopted selector
+// table hashes lookups with the same function, so the two must stay in step.
+static std::uint64_t PrebuiltImageSelectorHash(const std::string &selector,
+                                               std::uint32_t seed) {
+  std::uint64_t hash = 14695981039346656037ull ^ seed;
+  for (unsigned char ch : selector) {
+    hash ^= ch;
+    hash *= 1099511628211ull;
+  }
+  return hash;
+}
+
+static std::uint32_t PrebuiltImageSelectorSlot(std::uint64_t hash,
+                                               std::uint32_t displacement,
+                                               std::uint32_t bucket_mask) {
+  const std::uint32_t step = static_cast<std::uint32_t>(hash >> 32) | 1u;
+  return (static_cast<std::uint32_t>(hash) + displacement * step) & bucket_mask;
+}
+
+static std::uint32_t PrebuiltImagePowerOfTwoAtLeast(std::size_t value) {
+  std::uint32_t result = 1u;
+  while (result < value) {
+    result <<= 1u;
+  }
+  return result;
+}
+
+// Places `selectors` (pool order) into a hash-and-displace perfect hash:
+// each group of selectors sharing the high hash bits gets one displacement
+// that lands all of them on empty buckets. Largest groups are placed first;
+// a seed that cannot place every group is replaced by the next one.
+static bool BuildPrebuiltImageSelectorHash(
+    const std::vector<std::string> &selectors, std::uint32_t &seed,
+    std::vector<std::uint32_t> &displacements,
+    std::vector<std::uint32_t> &buckets) {
+  const std::uint32_t bucket_count =
+      PrebuiltImagePowerOfTwoAtLeast(std::max<std::size_t>(selectors.size() * 2u, 1u));
+  const std::uint32_t group_count = PrebuiltImagePowerOfTwoAtLeast(
+      std::max<std::size_t>((selectors.size() + 3u) / 4u, 1u));
+  constexpr std::uint32_t kMaxSeedAttempts = 64u;
+  std::vector<std::uint64_t> hashes(selectors.size());
+  for (seed = 0; seed < kMaxSeedAttempts; ++seed) {
+    std::vector<std::vector<std::size_t>> groups(group_count);
+    for (std::size_t i = 0; i < selectors.size(); ++i) {
+      hashes[i] = PrebuiltImageSelectorHash(selectors[i], seed);
+      groups[static_cast<std::uint32_t>(hashes[i] >> 32) & (group_count - 1u)]
+          .push_back(i);
+    }
+    std::vector<std::uint32_t> group_order(group_count);
+    for (std::uint32_t g = 0; g < group_count; ++g) {
+      group_order[g] = g;
+    }
+    std::stable_sort(group_order.begin(), group_order.end(),
+                     [&groups](std::uint32_t lhs, std::uint32_t rhs) {
+                       return groups[lhs].size() > groups[rhs].size();
+                     });
+    displacements.assign(group_count, 0u);
+    buckets.assign(bucket_count, 0u);
+    bool placed_all = true;
+    std::vector<std::uint32_t> slots;
+    for (const std::uint32_t g : group_order) {
+      const std::vector<std::size_t> &members = groups[g];
+      if (members.empty()) {
+        break;
+      }
+      bool placed = false;
+      for (std::uint32_t displacement = 0; displacement < bucket_count && !placed;
+           ++displacement) {
+        slots.clear();
+        placed = true;
+        for (const std::size_t member : members) {
+          const std::uint32_t slot = PrebuiltImageSelectorSlot(
+              hashes[member], displacement, bucket_count - 1u);
+          if (buckets[slot] != 0u ||
+              std::find(slots.begin(), slots.end(), slot) != slots.end()) {
+            placed = false;
+            break;
+          }
+          slots.push_back(slot);
+        }
+        if (placed) {
+          displacements[g] = displacement;
+          for (std::size_t m = 0; m < members.size(); ++m) {
+            buckets[slots[m]] = static_cast<std::uint32_t>(members[m] + 1u);
+          }
+        }
+      }
+      if (!placed) {
+        placed_all = false;
+        break;
+      }
+    }
+    if (placed_all) {
+      return true;
+    }
+  }
+  return false;
+}
+
 class Objc3IREmitter {
  public:
   enum class SyntheticMethodKind {
@@ -74,6 +173,15 @@ class Objc3IREmitter {
     std::string payload;
   };
 
+  // One dense class-method table for an objc_final/objc_sealed class; slots
+  // follow the lexicographic order of its hierarchy's class-method selectors.
+  struct SealedDispatchTable {
+    std::string class_name;
+    std::string class_name_global;
+    std::vector<std::string> selectors;
+    std::unordered_map<std::string, std::size_t> slot_by_selector;
+  };
+
   static bool IsImplementationOwnedPropertyBundle(
       const Objc3IRRuntimeMetadataPropertyBundle &bundle) {
     return bundle.synthesizes_executable_accessors;
@@ -362,6 +470,9 @@ class Objc3IREmitter {
     function_signatures_ = BuildLoweredFunctionSignatures(program_);
     CollectKnownClassReceiverConstants();
     CollectCanonicalPoolLiterals();
+    if (lowering_ir_boundary_.sealed_dispatch_tables) {
+      CollectSealedDispatchTables();
+    }
     CollectMutableGlobalSymbols();
     CollectFunctionEffects();
   }
@@ -382,6 +493,9 @@ class Objc3IREmitter {
     release_helper_call_count_ = 0;
     autorelease_helper_call_count_ = 0;
     runtime_dispatch_symbols_used_.clear();
+    dispatch_site_cache_count_ = 0;
+    selector_reference_globals_used_.clear();
+    sealed_dispatch_tables_used_.clear();
     fail_open_fallback_triggered_ = false;
     fail_open_fallback_reason_.clear();
     block_function_definitions_.clear();
@@ -3025,6 +3139,11 @@ class Objc3IREmitter {
     std::string dispatch_surface_entrypoint_family;
     std::string dispatch_symbol = kObjc3RuntimeDispatchSymbol;
     std::string direct_call_symbol;
+    std::string sealed_dispatch_class;
+    std::size_t sealed_dispatch_slot = 0;
+    int sealed_dispatch_receiver_identity = 0;
+    std::string keypath_symbol;
+    std::string conformance_protocol_global;
   };
 
   struct ControlLabels {
@@ -3109,6 +3228,9 @@ class Objc3IREmitter {
     bool current_method_is_class_method = false;
     int async_resume_entry_tag = 0;
     int async_executor_tag = 0;
+    // Set when the body lowers to a resume function over `%async.frame`.
+    bool async_state_machine_enabled = false;
+    int async_resume_point_count = 0;
     int temp_counter = 0;
     int label_counter = 0;
     bool terminated = false;
@@ -3193,6 +3315,183 @@ class Objc3IREmitter {
     return StablePositiveAsyncTag("resume-entry:method:" + method_def.symbol);
   }
 
+  // async state-machine anchor: an async body whose awaits are all direct
+  // calls at the root of a return, let, plain assignment, or expression
+  // statement lowers to a resume function over a runtime-pooled frame. Only
+  // the awaited value crosses a suspension point in SSA form; every other
+  // local already lives in an alloca, which becomes a frame slot. Awaits
+  // anywhere else, block literals, defer, and awaits inside autoreleasepool
+  // or do/catch scopes keep the direct-call lowering.
+  static bool IsAsyncStateMachineAwaitSite(const Expr *expr) {
+    return expr != nullptr && expr->await_expression_enabled &&
+           expr->kind == Expr::Kind::Call;
+  }
+
+  static bool ExprBlocksAsyncStateMachine(const Expr *expr) {
+    if (expr == nullptr) {
+      return false;
+    }
+    if (IsAsyncStateMachineAwaitSite(expr) ||
+        expr->kind == Expr::Kind::BlockLiteral) {
+      return true;
+    }
+    if (ExprBlocksAsyncStateMachine(expr->receiver.get()) ||
+        ExprBlocksAsyncStateMachine(expr->left.get()) ||
+        ExprBlocksAsyncStateMachine(expr->right.get()) ||
+        ExprBlocksAsyncStateMachine(expr->third.get())) {
+      return true;
+    }
+    for (const auto &arg : expr->args) {
+      if (ExprBlocksAsyncStateMachine(arg.get())) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  static bool RootExprAllowsAsyncStateMachine(const Expr *expr,
+                                              std::size_t &await_sites) {
+    if (!IsAsyncStateMachineAwaitSite(expr)) {
+      return !ExprBlocksAsyncStateMachine(expr);
+    }
+    for (const auto &arg : expr->args) {
+      if (ExprBlocksAsyncStateMachine(arg.get())) {
+        return false;
+      }
+    }
+    ++await_sites;
+    return true;
+  }
+
+  static bool StmtsAllowAsyncStateMachine(
+      const std::vector<std::unique_ptr<Stmt>> &body, bool awaits_allowed,
+      std::size_t &await_sites) {
+    for (const auto &stmt : body) {
+      if (!StmtAllowsAsyncStateMachine(stmt.get(), awaits_allowed,
+                                       await_sites)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  static bool StmtAllowsAsyncStateMachine(const Stmt *stmt,
+                                          bool awaits_allowed,
+                                          std::size_t &await_sites) {
+    if (stmt == nullptr) {
+      return true;
+    }
+    const std::size_t sites_before = await_sites;
+    bool allowed = true;
+    switch (stmt->kind) {
+      case Stmt::Kind::Let:
+        allowed = stmt->let_stmt == nullptr ||
+                  RootExprAllowsAsyncStateMachine(stmt->let_stmt->value.get(),
+                                                  await_sites);
+        break;
+      case Stmt::Kind::Assign:
+        allowed =
+            stmt->assign_stmt == nullptr ||
+            (stmt->assign_stmt->op == "="
+                 ? RootExprAllowsAsyncStateMachine(
+                       stmt->assign_stmt->value.get(), await_sites)
+                 : !ExprBlocksAsyncStateMachine(
+                       stmt->assign_stmt->value.get()));
+        break;
+      case Stmt::Kind::Return:
+        allowed = stmt->return_stmt == nullptr ||
+                  RootExprAllowsAsyncStateMachine(
+                      stmt->return_stmt->value.get(), await_sites);
+        break;
+      case Stmt::Kind::Expr:
+        allowed = stmt->expr_stmt == nullptr ||
+                  RootExprAllowsAsyncStateMachine(stmt->expr_stmt->value.get(),
+                                                  await_sites);
+        break;
+      case Stmt::Kind::If:
+        if (stmt->if_stmt != nullptr) {
+          allowed =
+              !ExprBlocksAsyncStateMachine(stmt->if_stmt->condition.get()) &&
+              StmtsAllowAsyncStateMachine(stmt->if_stmt->then_body,
+                                          awaits_allowed, await_sites) &&
+              StmtsAllowAsyncStateMachine(stmt->if_stmt->else_body,
+                                          awaits_allowed, await_sites);
+          for (const auto &guard : stmt->if_stmt->guard_condition_exprs) {
+            allowed = allowed && !ExprBlocksAsyncStateMachine(guard.get());
+          }
+        }
+        break;
+      case Stmt::Kind::DoWhile:
+        allowed = stmt->do_while_stmt == nullptr ||
+                  (!ExprBlocksAsyncStateMachine(
+                       stmt->do_while_stmt->condition.get()) &&
+                   StmtsAllowAsyncStateMachine(stmt->do_while_stmt->body,
+                                               awaits_allowed, await_sites));
+        break;
+      case Stmt::Kind::For:
+        allowed = stmt->for_stmt == nullptr ||
+                  (!ExprBlocksAsyncStateMachine(
+                       stmt->for_stmt->init.value.get()) &&
+                   !ExprBlocksAsyncStateMachine(
+                       stmt->for_stmt->condition.get()) &&
+                   !ExprBlocksAsyncStateMachine(
+                       stmt->for_stmt->step.value.get()) &&
+                   StmtsAllowAsyncStateMachine(stmt->for_stmt->body,
+                                               awaits_allowed, await_sites));
+        break;
+      case Stmt::Kind::Switch:
+        if (stmt->switch_stmt != nullptr) {
+          allowed = !ExprBlocksAsyncStateMachine(
+              stmt->switch_stmt->condition.get());
+          for (const auto &case_stmt : stmt->switch_stmt->cases) {
+            allowed = allowed &&
+                      StmtsAllowAsyncStateMachine(case_stmt.body,
+                                                  awaits_allowed, await_sites);
+          }
+        }
+        break;
+      case Stmt::Kind::While:
+        allowed = stmt->while_stmt == nullptr ||
+                  (!ExprBlocksAsyncStateMachine(
+                       stmt->while_stmt->condition.get()) &&
+                   StmtsAllowAsyncStateMachine(stmt->while_stmt->body,
+                                               awaits_allowed, await_sites));
+        break;
+      case Stmt::Kind::Block:
+        if (stmt->block_stmt != nullptr) {
+          // Autoreleasepool scopes and error handlers are per-thread state
+          // that a suspension must not straddle.
+          const bool nested_awaits_allowed =
+              awaits_allowed && !stmt->block_stmt->is_autoreleasepool_scope &&
+              !stmt->block_stmt->is_do_catch_scope;
+          allowed = StmtsAllowAsyncStateMachine(
+              stmt->block_stmt->body, nested_awaits_allowed, await_sites);
+          for (const auto &clause : stmt->block_stmt->catch_clauses) {
+            allowed = allowed &&
+                      StmtsAllowAsyncStateMachine(clause.body, false,
+                                                  await_sites);
+          }
+        }
+        break;
+      case Stmt::Kind::Defer:
+        allowed = false;
+        break;
+      case Stmt::Kind::Break:
+      case Stmt::Kind::Continue:
+      case Stmt::Kind::Empty:
+        break;
+    }
+    return allowed && (awaits_allowed || await_sites == sites_before);
+  }
+
+  static bool AllowsAsyncStateMachine(
+      const std::vector<std::unique_ptr<Stmt>> &body, bool throws_declared) {
+    std::size_t await_sites = 0;
+    return !throws_declared &&
+           StmtsAllowAsyncStateMachine(body, true, await_sites) &&
+           await_sites != 0u;
+  }
+
   bool IsActorImplementation(const std::string &name) const {
     if (name.empty()) {
       return false;
@@ -3205,8 +3504,9 @@ class Objc3IREmitter {
     return false;
   }
 
-  bool TryEmitConcurrencyTaskRuntimeLoweringCall(const Expr *expr, FunctionContext &ctx,
-                                           std::string &result_out) const {
+  bool TryEmitConcurrencyTaskRuntimeLoweringCall(
+      const Expr *expr, const std::vector<std::string> &lowered_args,
+      FunctionContext &ctx, std::string &result_out) const {
     if (expr == nullptr || !ctx.async_runtime_helper_enabled) {
       return false;
     }
@@ -3221,6 +3521,41 @@ class Objc3IREmitter {
       result_out = out;
     };
 
+    // A call that passes a task body lowers onto the block task executor: the
+    // promoted body runs on the pool, child and group bodies in the caller's
+    // lowered task group. Body-less calls keep the symbol-profile helpers.
+    const auto emit_block_task_call = [&](bool detached) {
+      const std::string body = lowered_args.front();
+      const std::string argument =
+          lowered_args.size() > 1u ? lowered_args[1] : std::string("i32 0");
+      const std::string out = NewTemp(ctx);
+      if (detached) {
+        ctx.code_lines.push_back(
+            "  " + out + " = call i32 @" +
+            std::string(kObjc3RuntimeSpawnBlockTaskI32Symbol) + "(i32 2, " +
+            body + ", " + argument + ", i32 " +
+            std::to_string(ctx.async_executor_tag) + ")");
+      } else {
+        const std::string group = NewTemp(ctx);
+        ctx.code_lines.push_back(
+            "  " + group + " = call i32 @" +
+            std::string(kObjc3RuntimeOpenLoweredTaskGroupI32Symbol) + "()");
+        ctx.code_lines.push_back(
+            "  " + out + " = call i32 @" +
+            std::string(kObjc3RuntimeTaskGroupSpawnBlockI32Symbol) + "(i32 " +
+            group + ", " + body + ", " + argument + ")");
+      }
+      InvalidateGlobalProofState(ctx);
+      result_out = out;
+    };
+    if (!lowered_args.empty() &&
+        (lowered == "task_spawn_child" || lowered == "spawn_task" ||
+         lowered == "task_group_add_task" ||
+         lowered == "detached_task_create")) {
+      emit_block_task_call(lowered == "detached_task_create");
+      return true;
+    }
+
     if (lowered == "task_spawn_child" || lowered == "spawn_task") {
       const std::string out = NewTemp(ctx);
       ctx.code_lines.push_back("  " + out + " = call i32 @" +
@@ -3745,6 +4080,11 @@ class Objc3IREmitter {
            RuntimeBootstrapSafeSuffix();
   }
 
+  std::string RuntimeBootstrapPrebuiltImageSymbol() const {
+    return kObjc3RuntimeBootstrapPrebuiltImageSymbolPrefix +
+           RuntimeBootstrapSafeSuffix();
+  }
+
   std::string RuntimeBootstrapImageLocalInitStateSymbol() const {
     return frontend_metadata_
                .runtime_bootstrap_lowering_image_local_init_state_symbol_prefix +
@@ -7454,6 +7794,10 @@ class Objc3IREmitter {
     if (expr->typed_keypath_literal_enabled) {
       RegisterTypedKeyPathLiteral(*expr);
     }
+    if (expr->protocol_literal_enabled) {
+      RegisterRuntimeStringLiteral(expr->protocol_literal_name);
+      protocol_literal_queries_emitted_ = true;
+    }
     switch (expr->kind) {
       case Expr::Kind::MessageSend:
         RegisterSelectorLiteral(expr->selector);
@@ -7644,6 +7988,81 @@ class Objc3IREmitter {
     CollectRuntimeMetadataPoolLiterals();
     AssignCanonicalPoolGlobalNames();
     AssignTypedKeyPathArtifactOrdinals();
+    if (ShouldEmitRuntimeBootstrapLowering()) {
+      BuildPrebuiltMetadataImage();
+    }
+  }
+
+  // prebuilt-metadata-image anchor: the image's words are fixed once the
+  // selector pool is final. Selectors keep their pool order (pool index =
+  // position + 1) and classes keep the class-descriptor aggregate order, so
+  // every entry is an index or offset and the blob never needs relocating.
+  void BuildPrebuiltMetadataImage() {
+    prebuilt_image_words_.clear();
+    std::vector<std::string> selectors;
+    selectors.reserve(selector_pool_globals_.size());
+    for (const auto &entry : selector_pool_globals_) {
+      selectors.push_back(entry.first);
+    }
+    std::uint32_t seed = 0;
+    std::vector<std::uint32_t> displacements;
+    std::vector<std::uint32_t> buckets;
+    if (!BuildPrebuiltImageSelectorHash(selectors, seed, displacements,
+                                        buckets)) {
+      return;
+    }
+    const auto &bundles =
+        frontend_metadata_.runtime_metadata_class_metaclass_bundles_lexicographic;
+    std::vector<std::uint32_t> class_ordinals;
+    std::size_t class_ordinal_count = 0;
+    if (bundles.size() ==
+        frontend_metadata_
+            .runtime_metadata_section_publication_class_descriptor_count) {
+      std::vector<std::string> class_names;
+      class_names.reserve(bundles.size());
+      for (const auto &bundle : bundles) {
+        class_names.push_back(bundle.class_name);
+      }
+      std::sort(class_names.begin(), class_names.end());
+      class_names.erase(std::unique(class_names.begin(), class_names.end()),
+                        class_names.end());
+      class_ordinal_count = class_names.size();
+      class_ordinals.reserve(bundles.size());
+      for (const auto &bundle : bundles) {
+        class_ordinals.push_back(static_cast<std::uint32_t>(
+            std::lower_bound(class_names.begin(), class_names.end(),
+                             bundle.class_name) -
+            class_names.begin()));
+      }
+    }
+    const std::uint32_t group_offset =
+        kObjc3RuntimeBootstrapPrebuiltImageHeaderWordCount;
+    const std::uint32_t bucket_offset =
+        group_offset + static_cast<std::uint32_t>(displacements.size());
+    const std::uint32_t class_ordinal_offset =
+        bucket_offset + static_cast<std::uint32_t>(buckets.size());
+    const std::uint32_t word_count =
+        class_ordinal_offset + static_cast<std::uint32_t>(class_ordinals.size());
+    prebuilt_image_words_ = {
+        kObjc3RuntimeBootstrapPrebuiltImageMagic,
+        kObjc3RuntimeBootstrapPrebuiltImageVersion,
+        word_count,
+        static_cast<std::uint32_t>(selectors.size()),
+        static_cast<std::uint32_t>(class_ordinals.size()),
+        static_cast<std::uint32_t>(class_ordinal_count),
+        seed,
+        static_cast<std::uint32_t>(displacements.size()),
+        static_cast<std::uint32_t>(buckets.size()),
+        group_offset,
+        bucket_offset,
+        class_ordinal_offset,
+    };
+    prebuilt_image_words_.insert(prebuilt_image_words_.end(),
+                                 displacements.begin(), displacements.end());
+    prebuilt_image_words_.insert(prebuilt_image_words_.end(), buckets.begin(),
+                                 buckets.end());
+    prebuilt_image_words_.insert(prebuilt_image_words_.end(),
+                                 class_ordinals.begin(), class_ordinals.end());
   }
 
   static bool IsNameBoundInScopes(const std::vector<std::unordered_set<std::string>> &scopes,
@@ -10497,6 +10916,21 @@ class Objc3IREmitter {
           << ", ptr " << string_pool_symbol << ", ptr "
           << keypath_descriptor_root_symbol << ", ptr "
           << image_local_init_state_symbol << " }, align 8\n";
+      if (!prebuilt_image_words_.empty()) {
+        out << "@" << RuntimeBootstrapPrebuiltImageSymbol()
+            << " = internal constant [" << prebuilt_image_words_.size()
+            << " x i32] [";
+        for (std::size_t i = 0; i < prebuilt_image_words_.size(); ++i) {
+          if (i != 0) {
+            out << ", ";
+          }
+          out << "i32 " << prebuilt_image_words_[i];
+        }
+        out << "], section \""
+            << Objc3RuntimeMetadataHostSectionForLogicalName(
+                   kObjc3RuntimeBootstrapPrebuiltImageLogicalSection)
+            << "\", align 4\n";
+      }
       if (ShouldEmitRuntimeBootstrapRegistrationDescriptorImageRootLowering()) {
         // emits first-class image-root/registration-descriptor
         // globals into dedicated sections, keyed by the authoritative source
@@ -11677,7 +12111,8 @@ class Objc3IREmitter {
       // lowering anchor: actor helper spellings inside actor methods
       // now lower through the private runtime helper slice rather than staying
       // as ordinary direct-call placeholders.
-    } else if (TryEmitConcurrencyTaskRuntimeLoweringCall(expr, ctx, out)) {
+    } else if (TryEmitConcurrencyTaskRuntimeLoweringCall(expr, args, ctx,
+                                                         out)) {
       // lowering anchor: supported task/executor/cancellation
       // symbols now route through the private Part 7 runtime helper cluster
       // rather than remaining ordinary extern-call placeholders.
@@ -11788,6 +12223,9 @@ class Objc3IREmitter {
           std::string(kObjc3RuntimeResumeAsyncContinuationI32Symbol) +
           "(i32 " + handed_off_handle + ", i32 " + out + ")");
       InvalidateGlobalProofState(ctx);
+      if (ctx.async_state_machine_enabled) {
+        return EmitAsyncStateMachineSuspensionPoint(resumed_value, ctx);
+      }
       return resumed_value;
     }
     if (signature != nullptr && signature->return_insert_retain) {
@@ -11860,7 +12298,7 @@ class Objc3IREmitter {
       EmitPendingBlockDisposeTerminalCleanupToDepth(ctx, 0u, ctx.code_lines);
       EmitArcOwnedTerminalCleanupToDepth(
           ctx, 0u, ctx.code_lines, ctx.temp_counter);
-      ctx.code_lines.push_back("  ret void");
+      EmitReturnInstruction("", ctx);
       return;
     }
     std::string returned_value = i32_value;
@@ -11885,11 +12323,64 @@ class Objc3IREmitter {
     EmitArcOwnedTerminalCleanupToDepth(
         ctx, 0u, ctx.code_lines, ctx.temp_counter);
     if (ctx.return_type == ValueType::Bool) {
-      const std::string bool_i1 = CoerceI32ToBoolI1(returned_value, ctx);
-      ctx.code_lines.push_back("  ret i1 " + bool_i1);
+      EmitReturnInstruction(CoerceI32ToBoolI1(returned_value, ctx), ctx);
+      return;
+    }
+    EmitReturnInstruction(returned_value, ctx);
+  }
+
+  // Emits the function's final `ret`. A state-machine body instead stores the
+  // result in the frame's value slot and reports completion to the runtime.
+  void EmitReturnInstruction(const std::string &value,
+                             FunctionContext &ctx) const {
+    const std::string llvm_type = LLVMScalarType(ctx.return_type);
+    if (!ctx.async_state_machine_enabled) {
+      ctx.code_lines.push_back(
+          "  ret " + llvm_type +
+          (value.empty() ? "" : " " + value));
       return;
     }
-    ctx.code_lines.push_back("  ret i32 " + returned_value);
+    if (ctx.return_type != ValueType::Void) {
+      std::string stored_value = value;
+      if (ctx.return_type == ValueType::Bool) {
+        stored_value = NewTemp(ctx);
+        ctx.code_lines.push_back("  " + stored_value + " = zext i1 " + value +
+                                 " to i32");
+      }
+      ctx.code_lines.push_back("  store i32 " + stored_value +
+                               ", ptr %async.value.ptr, align 4");
+    }
+    ctx.code_lines.push_back("  ret i32 1");
+  }
+
+  // Stores the awaited value and resume point in the frame, then lets the
+  // runtime either continue inline or take the frame, in which case the
+  // step returns and a later step re-enters at the resume label.
+  std::string EmitAsyncStateMachineSuspensionPoint(
+      const std::string &awaited_value, FunctionContext &ctx) const {
+    const int resume_point = ++ctx.async_resume_point_count;
+    const std::string resume_label =
+        "async.resume." + std::to_string(resume_point);
+    ctx.code_lines.push_back("  store i32 " + std::to_string(resume_point) +
+                             ", ptr %async.resume_point.ptr, align 4");
+    ctx.code_lines.push_back("  store i32 " + awaited_value +
+                             ", ptr %async.value.ptr, align 4");
+    const std::string suspended = NewTemp(ctx);
+    ctx.code_lines.push_back(
+        "  " + suspended + " = call i32 @" +
+        std::string(kObjc3RuntimeAwaitAsyncFrameI32Symbol) +
+        "(ptr %async.frame, i32 " + std::to_string(ctx.async_executor_tag) +
+        ")");
+    const std::string yields = NewTemp(ctx);
+    ctx.code_lines.push_back("  " + yields + " = icmp ne i32 " + suspended +
+                             ", 0");
+    ctx.code_lines.push_back("  br i1 " + yields +
+                             ", label %async.suspend, label %" + resume_label);
+    ctx.code_lines.push_back(resume_label + ":");
+    const std::string resumed_value = NewTemp(ctx);
+    ctx.code_lines.push_back("  " + resumed_value +
+                             " = load i32, ptr %async.value.ptr, align 4");
+    return resumed_value;
   }
 
   void EmitTypedParamStore(const FuncParam &param, std::size_t index, const std::string &ptr, FunctionContext &ctx) const {
@@ -12665,16 +13156,67 @@ class Objc3IREmitter {
             ? lowering_ir_boundary_.runtime_dispatch_symbol
             : Objc3DispatchSurfaceRuntimeEntrypointSymbol(
                   lowered.dispatch_surface_family);
+    lowered.keypath_symbol = ResolveKeyPathEvaluationSymbol(*expr);
+    if (!lowered.keypath_symbol.empty()) {
+      return lowered;
+    }
+    lowered.conformance_protocol_global =
+        ResolveConformanceQueryProtocolGlobal(*expr);
+    if (!lowered.conformance_protocol_global.empty()) {
+      return lowered;
+    }
     lowered.direct_call_symbol = TryResolveDirectDispatchSymbol(expr, ctx);
+    if (lowered.direct_call_symbol.empty() &&
+        lowering_ir_boundary_.sealed_dispatch_tables &&
+        lowered.dispatch_symbol == lowering_ir_boundary_.runtime_dispatch_symbol) {
+      TryResolveSealedDispatchSlot(expr, ctx, lowered);
+    }
     return lowered;
   }
 
+  // key-path evaluation anchor: `valueForKeyPath:` and
+  // `setValue:forKeyPath:` sends whose key path is a typed `@keypath` literal
+  // evaluate through the runtime's compiled accessor chains instead of
+  // dispatching a selector no class implements.
+  static std::string ResolveKeyPathEvaluationSymbol(const Expr &expr) {
+    const auto is_keypath_literal = [](const std::unique_ptr<Expr> &arg) {
+      return arg != nullptr && arg->kind == Expr::Kind::Identifier &&
+             arg->typed_keypath_literal_enabled;
+    };
+    if (expr.selector == "valueForKeyPath:" && expr.args.size() == 1u &&
+        is_keypath_literal(expr.args[0])) {
+      return kObjc3RuntimeKeyPathGetI32Symbol;
+    }
+    if (expr.selector == "setValue:forKeyPath:" && expr.args.size() == 2u &&
+        is_keypath_literal(expr.args[1])) {
+      return kObjc3RuntimeKeyPathSetI32Symbol;
+    }
+    return {};
+  }
+
+  // conformance query anchor: `conformsToProtocol:` sends whose argument is an
+  // `@protocol` literal ask the runtime's realized-class conformance bitset by
+  // protocol name instead of dispatching a selector no class implements.
+  std::string ResolveConformanceQueryProtocolGlobal(const Expr &expr) const {
+    if (expr.selector != "conformsToProtocol:" || expr.args.size() != 1u ||
+        expr.args[0] == nullptr || !expr.args[0]->protocol_literal_enabled) {
+      return {};
+    }
+    const auto name_it =
+        runtime_string_pool_globals_.find(expr.args[0]->protocol_literal_name);
+    return name_it == runtime_string_pool_globals_.end() ? std::string()
+                                                         : name_it->second;
+  }
+
   void MaterializeMessageSendArgs(const Expr *expr, LoweredMessageSend &lowered,
                                   FunctionContext &ctx) const {
     if (expr == nullptr) {
       return;
     }
     lowered.explicit_arg_count = expr->args.size();
+    if (!lowered.conformance_protocol_global.empty()) {
+      return;
+    }
     for (std::size_t i = 0; i < expr->args.size() && i < lowered.args.size(); ++i) {
       lowered.args[i] = EmitExpr(expr->args[i].get(), ctx);
     }
@@ -12711,6 +13253,204 @@ class Objc3IREmitter {
     return symbol_it->second;
   }
 
+  // sealed-dispatch-table anchor: only sends whose receiver is statically one
+  // exact class object qualify: a known-class receiver, or self inside a class
+  // method. objc_final/objc_sealed rule out subclasses in the module, so the
+  // hierarchy's class-method set is closed and each selector keeps one slot.
+  void CollectSealedDispatchTables() {
+    struct ClassMethodSurface {
+      std::string super_name;
+      bool closed = false;
+      std::set<std::string> selectors;
+      std::set<std::string> dynamic_selectors;
+    };
+    std::map<std::string, ClassMethodSurface> surfaces;
+    const auto record_methods = [&](const std::string &class_name,
+                                    const std::vector<Objc3MethodDecl> &methods) {
+      ClassMethodSurface &surface = surfaces[class_name];
+      for (const auto &method : methods) {
+        if (!method.is_class_method || method.selector.empty()) {
+          continue;
+        }
+        surface.selectors.insert(method.selector);
+        if (method.objc_dynamic_declared) {
+          surface.dynamic_selectors.insert(method.selector);
+        }
+      }
+    };
+    for (const auto &interface_decl : program_.interfaces) {
+      if (interface_decl.name.empty()) {
+        continue;
+      }
+      if (!interface_decl.has_category) {
+        ClassMethodSurface &surface = surfaces[interface_decl.name];
+        surface.super_name = interface_decl.super_name;
+        surface.closed = interface_decl.objc_final_declared ||
+                         interface_decl.objc_sealed_declared;
+      }
+      record_methods(interface_decl.name, interface_decl.methods);
+    }
+    for (const auto &implementation : program_.implementations) {
+      if (!implementation.name.empty()) {
+        record_methods(implementation.name, implementation.methods);
+      }
+    }
+    for (const auto &entry : surfaces) {
+      const ClassMethodSurface &leaf = entry.second;
+      const auto class_name_it = runtime_string_pool_globals_.find(entry.first);
+      if (!leaf.closed ||
+          class_receiver_constants_.find(entry.first) ==
+              class_receiver_constants_.end() ||
+          class_name_it == runtime_string_pool_globals_.end()) {
+        continue;
+      }
+      std::set<std::string> selectors;
+      std::set<std::string> dynamic_selectors;
+      std::set<std::string> visited;
+      for (std::string class_name = entry.first;
+           !class_name.empty() && visited.insert(class_name).second;) {
+        const auto surface_it = surfaces.find(class_name);
+        if (surface_it == surfaces.end()) {
+          break;
+        }
+        selectors.insert(surface_it->second.selectors.begin(),
+                         surface_it->second.selectors.end());
+        dynamic_selectors.insert(surface_it->second.dynamic_selectors.begin(),
+                                 surface_it->second.dynamic_selectors.end());
+        class_name = surface_it->second.super_name;
+      }
+      SealedDispatchTable table;
+      table.class_name = entry.first;
+      table.class_name_global = class_name_it->second;
+      for (const std::string &selector : selectors) {
+        if (dynamic_selectors.find(selector) != dynamic_selectors.end() ||
+            selector_pool_globals_.find(selector) == selector_pool_globals_.end()) {
+          continue;
+        }
+        table.slot_by_selector.emplace(selector, table.selectors.size());
+        table.selectors.push_back(selector);
+      }
+      if (!table.selectors.empty()) {
+        sealed_dispatch_tables_.emplace(entry.first, std::move(table));
+      }
+    }
+  }
+
+  void TryResolveSealedDispatchSlot(const Expr *expr, const FunctionContext &ctx,
+                                    LoweredMessageSend &lowered) const {
+    if (expr == nullptr || expr->receiver == nullptr ||
+        expr->receiver->kind != Expr::Kind::Identifier) {
+      return;
+    }
+    std::string class_name;
+    if (expr->receiver->ident == "self") {
+      if (!ctx.current_method_is_class_method) {
+        return;
+      }
+      class_name = ctx.current_implementation_name;
+    } else if (class_receiver_constants_.find(expr->receiver->ident) !=
+               class_receiver_constants_.end()) {
+      class_name = expr->receiver->ident;
+    }
+    const auto table_it = sealed_dispatch_tables_.find(class_name);
+    if (table_it == sealed_dispatch_tables_.end()) {
+      return;
+    }
+    const auto slot_it = table_it->second.slot_by_selector.find(expr->selector);
+    if (slot_it == table_it->second.slot_by_selector.end()) {
+      return;
+    }
+    lowered.sealed_dispatch_class = class_name;
+    lowered.sealed_dispatch_slot = slot_it->second;
+    lowered.sealed_dispatch_receiver_identity = BuildClassReceiverIdentityValue(
+        LookupClassReceiverIdentityValue(class_name));
+  }
+
+  static std::string SealedDispatchTableGlobalName(const std::string &class_name) {
+    return "@__objc3_sealed_dispatch_table_" + class_name;
+  }
+
+  // sealed-dispatch-table anchor: a bound table answers the send with one
+  // atomic receiver compare, one indexed entry load, and an indirect call to
+  // the emitted method body. An unbound table or empty slot takes
+  // objc3_runtime_dispatch_sealed_i32, which binds the table and dispatches
+  // through the canonical runtime path.
+  std::string EmitSealedDispatchTableCall(const LoweredMessageSend &lowered,
+                                          const std::string &selector_ptr,
+                                          FunctionContext &ctx) const {
+    const SealedDispatchTable &table =
+        sealed_dispatch_tables_.at(lowered.sealed_dispatch_class);
+    sealed_dispatch_tables_used_.insert(table.class_name);
+    const std::string table_global = SealedDispatchTableGlobalName(table.class_name);
+    const std::string entries_global =
+        "@__objc3_sealed_dispatch_entries_" + table.class_name;
+    const std::string slot = std::to_string(lowered.sealed_dispatch_slot);
+    const std::string bound_ptr = NewTemp(ctx);
+    const std::string bound_receiver = NewTemp(ctx);
+    const std::string is_bound = NewTemp(ctx);
+    const std::string entry_ptr = NewTemp(ctx);
+    const std::string entry = NewTemp(ctx);
+    const std::string has_entry = NewTemp(ctx);
+    const std::string table_value = NewTemp(ctx);
+    const std::string runtime_value = NewTemp(ctx);
+    const std::string out = NewTemp(ctx);
+    const std::string bound_label = NewLabel(ctx, "sealed_bound_");
+    const std::string call_label = NewLabel(ctx, "sealed_call_");
+    const std::string miss_label = NewLabel(ctx, "sealed_miss_");
+    const std::string merge_label = NewLabel(ctx, "sealed_merge_");
+    ctx.code_lines.push_back("  " + bound_ptr +
+                             " = getelementptr inbounds { ptr, ptr, ptr, i64, i32, i32 }, ptr " +
+                             table_global + ", i32 0, i32 4");
+    ctx.code_lines.push_back("  " + bound_receiver + " = load atomic i32, ptr " +
+                             bound_ptr + " acquire, align 4");
+    ctx.code_lines.push_back(
+        "  " + is_bound + " = icmp eq i32 " + bound_receiver + ", " +
+        std::to_string(lowered.sealed_dispatch_receiver_identity));
+    ctx.code_lines.push_back("  br i1 " + is_bound + ", label %" + bound_label +
+                             ", label %" + miss_label);
+    ctx.code_lines.push_back(bound_label + ":");
+    ctx.code_lines.push_back("  " + entry_ptr + " = getelementptr inbounds [" +
+                             std::to_string(table.selectors.size()) + " x ptr], ptr " +
+                             entries_global + ", i32 0, i32 " + slot);
+    ctx.code_lines.push_back("  " + entry + " = load atomic ptr, ptr " + entry_ptr +
+                             " monotonic, align 8");
+    ctx.code_lines.push_back("  " + has_entry + " = icmp ne ptr " + entry + ", null");
+    ctx.code_lines.push_back("  br i1 " + has_entry + ", label %" + call_label +
+                             ", label %" + miss_label);
+    ctx.code_lines.push_back(call_label + ":");
+    std::ostringstream table_call;
+    table_call << "  " << table_value << " = call i32 " << entry << "(";
+    for (std::size_t i = 0; i < lowered.explicit_arg_count; ++i) {
+      if (i != 0) {
+        table_call << ", ";
+      }
+      table_call << "i32 " << lowered.args[i];
+    }
+    table_call << ")";
+    ctx.code_lines.push_back(table_call.str());
+    ctx.code_lines.push_back("  br label %" + merge_label);
+    ctx.code_lines.push_back(miss_label + ":");
+    std::ostringstream runtime_call;
+    runtime_call << "  " << runtime_value << " = call i32 @"
+                 << kObjc3RuntimeDispatchSealedTableSymbol << "(ptr "
+                 << table_global << ", i64 " << slot << ", i32 "
+                 << lowered.receiver << ", ptr " << selector_ptr;
+    for (const std::string &arg : lowered.args) {
+      runtime_call << ", i32 " << arg;
+    }
+    runtime_call << ")";
+    ctx.code_lines.push_back(runtime_call.str());
+    ctx.code_lines.push_back("  br label %" + merge_label);
+    ctx.code_lines.push_back(merge_label + ":");
+    ctx.code_lines.push_back("  " + out + " = phi i32 [" + table_value + ", %" +
+                             call_label + "], [" + runtime_value + ", %" +
+                             miss_label + "]");
+    runtime_dispatch_call_emitted_ = true;
+    ++runtime_dispatch_call_sites_emitted_;
+    InvalidateGlobalProofState(ctx);
+    return out;
+  }
+
   LoweredMessageSend LowerMessageSendExpr(const Expr *expr, FunctionContext &ctx) const {
     LoweredMessageSend lowered = LowerMessageSendHeader(expr, ctx);
     MaterializeMessageSendArgs(expr, lowered, ctx);
@@ -12718,6 +13458,25 @@ class Objc3IREmitter {
   }
 
   std::string EmitRuntimeDispatch(const LoweredMessageSend &lowered, FunctionContext &ctx) const {
+    if (!lowered.keypath_symbol.empty()) {
+      const bool is_set = lowered.keypath_symbol == kObjc3RuntimeKeyPathSetI32Symbol;
+      const std::string value = NewTemp(ctx);
+      ctx.code_lines.push_back(
+          "  " + value + " = call i32 @" + lowered.keypath_symbol + "(i32 " +
+          lowered.args[is_set ? 1u : 0u] + ", i32 " + lowered.receiver +
+          (is_set ? ", i32 " + lowered.args[0] : std::string()) + ")");
+      InvalidateGlobalProofState(ctx);
+      return value;
+    }
+    if (!lowered.conformance_protocol_global.empty()) {
+      const std::string value = NewTemp(ctx);
+      ctx.code_lines.push_back(
+          "  " + value + " = call i32 @" +
+          kObjc3RuntimeReceiverConformsToProtocolI32Symbol + "(i32 " +
+          lowered.receiver + ", ptr " + lowered.conformance_protocol_global +
+          ")");
+      return value;
+    }
     if (!lowered.direct_call_symbol.empty()) {
       // dispatch-control lowering anchor: concrete self/known-class
       // sends that target effective objc_direct methods now lower as exact LLVM
@@ -12763,6 +13522,10 @@ class Objc3IREmitter {
                              " x i8], ptr " + selector_it->second + ", i32 0, i32 0");
     ++selector_pool_gep_sites_emitted_;
 
+    if (!lowered.sealed_dispatch_class.empty()) {
+      return EmitSealedDispatchTableCall(lowered, selector_ptr, ctx);
+    }
+
     const auto emit_dispatch_call = [&](const std::string &dispatch_value) {
       // dispatch-surface classification anchor: instance/class/super/dynamic
       // message sends that survive folding all route through the live runtime family;
@@ -12806,16 +13569,50 @@ class Objc3IREmitter {
       // symbols. Those runtime-owned details stay behind the frozen
       // objc3_runtime_lookup_selector / objc3_runtime_dispatch_i32 surface
       // until later lane-D issues extend them explicitly.
+      // dispatch-site-cache anchor: when site caches are enabled, canonical
+      // sends pass one module-private cache cell ahead of the usual operands so
+      // the runtime can bind that site to a per-thread slot once and answer
+      // monomorphic repeats without selector hashing or the runtime mutex.
+      // selector-handle-dispatch anchor: when selector handles are enabled,
+      // canonical sends that are not site-cached pass the selector's emitted
+      // reference cell instead of its spelling, so the runtime binds the
+      // canonical handle once rather than hashing the spelling per send.
+      const bool uses_site_cache =
+          lowering_ir_boundary_.dispatch_site_caches &&
+          lowered.dispatch_symbol == lowering_ir_boundary_.runtime_dispatch_symbol;
+      const bool uses_selector_handle =
+          !uses_site_cache && lowering_ir_boundary_.selector_handles &&
+          lowered.dispatch_symbol == lowering_ir_boundary_.runtime_dispatch_symbol;
       std::ostringstream call;
-      call << "  " << dispatch_value << " = call i32 @" << lowered.dispatch_symbol << "(i32 "
-           << lowered.receiver << ", ptr " << selector_ptr;
+      if (uses_selector_handle) {
+        const std::string selector_reference_global =
+            SelectorReferenceGlobalName(selector_it->second);
+        selector_reference_globals_used_.emplace(selector_reference_global,
+                                                 selector_it->second);
+        call << "  " << dispatch_value << " = call i32 @"
+             << kObjc3RuntimeDispatchSelectorHandleSymbol << "(i32 "
+             << lowered.receiver << ", ptr " << selector_reference_global;
+      } else if (uses_site_cache) {
+        const std::string site_cache_global =
+            "@__objc3_dispatch_site_cache_" +
+            std::to_string(dispatch_site_cache_count_++);
+        call << "  " << dispatch_value << " = call i32 @"
+             << kObjc3RuntimeDispatchSiteCacheSymbol << "(ptr "
+             << site_cache_global << ", i32 " << lowered.receiver << ", ptr "
+             << selector_ptr;
+      } else {
+        call << "  " << dispatch_value << " = call i32 @" << lowered.dispatch_symbol
+             << "(i32 " << lowered.receiver << ", ptr " << selector_ptr;
+      }
       for (const std::string &arg : lowered.args) {
         call << ", i32 " << arg;
       }
       call << ")";
       runtime_dispatch_call_emitted_ = true;
       ++runtime_dispatch_call_sites_emitted_;
-      runtime_dispatch_symbols_used_.insert(lowered.dispatch_symbol);
+      if (!uses_site_cache && !uses_selector_handle) {
+        runtime_dispatch_symbols_used_.insert(lowered.dispatch_symbol);
+      }
       ctx.code_lines.push_back(call.str());
     };
 
@@ -12911,6 +13708,10 @@ class Objc3IREmitter {
         if (expr->typed_keypath_literal_enabled) {
           return EmitTypedKeyPathLiteralValue(*expr);
         }
+        if (expr->protocol_literal_enabled) {
+          return EmitUnsupportedI32Value(
+              "protocol literals lower only as the argument of conformsToProtocol:");
+        }
         return EmitIdentifierValue(expr->ident, ctx);
       }
       case Expr::Kind::Binary: {
@@ -13301,7 +14102,7 @@ class Objc3IREmitter {
       case Stmt::Kind::Break: {
         if (ctx.control_stack.empty()) {
           EmitTerminalCleanupToDepth(ctx, 0u, 0u, 0u, 0u, 0u);
-          ctx.code_lines.push_back("  ret " + std::string(LLVMScalarType(ctx.return_type)) + " 0");
+          EmitReturnInstruction("0", ctx);
         } else {
           EmitTerminalCleanupToDepth(
               ctx, ctx.control_stack.back().scope_depth,
@@ -13327,7 +14128,7 @@ class Objc3IREmitter {
         }
         if (continue_label.empty()) {
           EmitTerminalCleanupToDepth(ctx, 0u, 0u, 0u, 0u, 0u);
-          ctx.code_lines.push_back("  ret " + std::string(LLVMScalarType(ctx.return_type)) + " 0");
+          EmitReturnInstruction("0", ctx);
         } else {
           const ControlLabels &target = *std::find_if(
               ctx.control_stack.rbegin(), ctx.control_stack.rend(),
@@ -13919,7 +14720,31 @@ class Objc3IREmitter {
           return true;
         };
     emit_declaration_once("abort", "declare void @abort()\n");
+    if (!typed_keypath_artifacts_.empty()) {
+      emit_declaration_once(kObjc3RuntimeKeyPathGetI32Symbol,
+                            "declare i32 @" +
+                                std::string(kObjc3RuntimeKeyPathGetI32Symbol) +
+                                "(i32, i32)\n");
+      emit_declaration_once(kObjc3RuntimeKeyPathSetI32Symbol,
+                            "declare i32 @" +
+                                std::string(kObjc3RuntimeKeyPathSetI32Symbol) +
+                                "(i32, i32, i32)\n");
+    }
+    if (protocol_literal_queries_emitted_) {
+      emit_declaration_once(
+          kObjc3RuntimeReceiverConformsToProtocolI32Symbol,
+          "declare i32 @" +
+              std::string(kObjc3RuntimeReceiverConformsToProtocolI32Symbol) +
+              "(i32, ptr)\n");
+    }
     if (ShouldEmitRuntimeBootstrapLowering()) {
+      if (!prebuilt_image_words_.empty()) {
+        emit_declaration_once(
+            kObjc3RuntimeBootstrapStagePrebuiltImageSymbol,
+            "declare void @" +
+                std::string(kObjc3RuntimeBootstrapStagePrebuiltImageSymbol) +
+                "(ptr, i64)\n");
+      }
       emit_declaration_once(
           kObjc3RuntimeBootstrapStageRegistrationTableSymbol,
           "declare void @" +
@@ -14001,6 +14826,21 @@ class Objc3IREmitter {
                                 std::string(
                                     kObjc3RuntimeResumeAsyncContinuationI32Symbol) +
                                 "(i32, i32)\n");
+      emit_declaration_once(kObjc3RuntimeAllocateAsyncFrameSymbol,
+                            "declare ptr @" +
+                                std::string(
+                                    kObjc3RuntimeAllocateAsyncFrameSymbol) +
+                                "(ptr, i64)\n");
+      emit_declaration_once(kObjc3RuntimeRunAsyncFrameI32Symbol,
+                            "declare i32 @" +
+                                std::string(
+                                    kObjc3RuntimeRunAsyncFrameI32Symbol) +
+                                "(ptr)\n");
+      emit_declaration_once(kObjc3RuntimeAwaitAsyncFrameI32Symbol,
+                            "declare i32 @" +
+                                std::string(
+                                    kObjc3RuntimeAwaitAsyncFrameI32Symbol) +
+                                "(ptr, i32)\n");
       emit_declaration_once(kObjc3RuntimeSpawnTaskI32Symbol,
                             "declare i32 @" +
                                 std::string(kObjc3RuntimeSpawnTaskI32Symbol) +
@@ -14036,6 +14876,21 @@ class Objc3IREmitter {
                             "declare i32 @" +
                                 std::string(kObjc3RuntimeExecutorHopI32Symbol) +
                                 "(i32, i32)\n");
+      emit_declaration_once(kObjc3RuntimeSpawnBlockTaskI32Symbol,
+                            "declare i32 @" +
+                                std::string(
+                                    kObjc3RuntimeSpawnBlockTaskI32Symbol) +
+                                "(i32, i32, i32, i32)\n");
+      emit_declaration_once(kObjc3RuntimeOpenLoweredTaskGroupI32Symbol,
+                            "declare i32 @" +
+                                std::string(
+                                    kObjc3RuntimeOpenLoweredTaskGroupI32Symbol) +
+                                "()\n");
+      emit_declaration_once(kObjc3RuntimeTaskGroupSpawnBlockI32Symbol,
+                            "declare i32 @" +
+                                std::string(
+                                    kObjc3RuntimeTaskGroupSpawnBlockI32Symbol) +
+                                "(i32, i32, i32)\n");
       emit_declaration_once(kObjc3RuntimeActorEnterIsolationThunkI32Symbol,
                             "declare i32 @" +
                                 std::string(
@@ -14173,6 +15028,11 @@ class Objc3IREmitter {
     out << "  %bootstrap_already_initialized = icmp ne i8 %bootstrap_state, 0\n";
     out << "  br i1 %bootstrap_already_initialized, label %bootstrap_success, label %bootstrap_register\n";
     out << "bootstrap_register:\n";
+    if (!prebuilt_image_words_.empty()) {
+      out << "  call void @" << kObjc3RuntimeBootstrapStagePrebuiltImageSymbol
+          << "(ptr @" << RuntimeBootstrapPrebuiltImageSymbol() << ", i64 "
+          << prebuilt_image_words_.size() * sizeof(std::uint32_t) << ")\n";
+    }
     out << "  call void @" << kObjc3RuntimeBootstrapStageRegistrationTableSymbol
         << "(ptr " << registration_table_symbol << ")\n";
     out << "  %bootstrap_image_slot = getelementptr inbounds "
@@ -14198,7 +15058,82 @@ class Objc3IREmitter {
     out << "}\n\n";
   }
 
+  static std::string SelectorReferenceGlobalName(
+      const std::string &selector_pool_global) {
+    static const std::string kSelectorPoolPrefix = "@__objc3_sel_pool_";
+    return "@__objc3_sel_ref_" +
+           selector_pool_global.substr(kSelectorPoolPrefix.size());
+  }
+
   void EmitRuntimeDispatchDeclarations(std::ostringstream &out) const {
+    if (!sealed_dispatch_tables_used_.empty()) {
+      for (const std::string &class_name : sealed_dispatch_tables_used_) {
+        const SealedDispatchTable &table = sealed_dispatch_tables_.at(class_name);
+        const std::string slot_type =
+            "[" + std::to_string(table.selectors.size()) + " x ptr]";
+        out << "@__objc3_sealed_dispatch_selectors_" << class_name
+            << " = private constant " << slot_type << " [";
+        for (std::size_t i = 0; i < table.selectors.size(); ++i) {
+          out << (i == 0 ? "" : ", ") << "ptr "
+              << selector_pool_globals_.at(table.selectors[i]);
+        }
+        out << "], align 8\n";
+        out << "@__objc3_sealed_dispatch_entries_" << class_name
+            << " = internal global " << slot_type
+            << " zeroinitializer, align 8\n";
+        out << SealedDispatchTableGlobalName(class_name)
+            << " = internal global { ptr, ptr, ptr, i64, i32, i32 } { ptr "
+            << table.class_name_global
+            << ", ptr @__objc3_sealed_dispatch_selectors_" << class_name
+            << ", ptr @__objc3_sealed_dispatch_entries_" << class_name
+            << ", i64 " << table.selectors.size() << ", i32 0, i32 0 }, align 8\n";
+      }
+      out << "declare i32 @" << kObjc3RuntimeDispatchSealedTableSymbol
+          << "(ptr, i64, i32, ptr";
+      for (std::size_t i = 0; i < lowering_ir_boundary_.runtime_dispatch_arg_slots;
+           ++i) {
+        out << ", i32";
+      }
+      out << ")\n";
+      if (selector_reference_globals_used_.empty() &&
+          dispatch_site_cache_count_ == 0 &&
+          runtime_dispatch_symbols_used_.empty()) {
+        out << "\n";
+      }
+    }
+    if (!selector_reference_globals_used_.empty()) {
+      for (const auto &entry : selector_reference_globals_used_) {
+        out << entry.first << " = internal global { ptr, ptr, i64 } { ptr "
+            << entry.second << ", ptr null, i64 0 }, align 8\n";
+      }
+      out << "declare i32 @" << kObjc3RuntimeDispatchSelectorHandleSymbol
+          << "(i32, ptr";
+      for (std::size_t i = 0; i < lowering_ir_boundary_.runtime_dispatch_arg_slots;
+           ++i) {
+        out << ", i32";
+      }
+      out << ")\n";
+      if (dispatch_site_cache_count_ == 0 &&
+          runtime_dispatch_symbols_used_.empty()) {
+        out << "\n";
+      }
+    }
+    if (dispatch_site_cache_count_ != 0) {
+      for (std::size_t i = 0; i < dispatch_site_cache_count_; ++i) {
+        out << "@__objc3_dispatch_site_cache_" << i
+            << " = internal global { i64, ptr } zeroinitializer, align 8\n";
+      }
+      out << "declare i32 @" << kObjc3RuntimeDispatchSiteCacheSymbol
+          << "(ptr, i32, ptr";
+      for (std::size_t i = 0; i < lowering_ir_boundary_.runtime_dispatch_arg_slots;
+           ++i) {
+        out << ", i32";
+      }
+      out << ")\n";
+      if (runtime_dispatch_symbols_used_.empty()) {
+        out << "\n";
+      }
+    }
     if (runtime_dispatch_symbols_used_.empty()) {
       return;
     }
@@ -14231,13 +15166,17 @@ class Objc3IREmitter {
       signature << "ptr %error_out";
     }
 
-    out << "define " << LLVMScalarType(fn.return_type) << " @" << fn.name << "(" << signature.str() << ") {\n";
-    out << "entry:\n";
-
     FunctionContext ctx;
     ctx.return_type = fn.return_type;
     ctx.async_runtime_helper_enabled =
         fn.async_declared && ExecutorAffinityTag(fn) != 0;
+    ctx.async_state_machine_enabled =
+        ctx.async_runtime_helper_enabled &&
+        AllowsAsyncStateMachine(fn.body, fn.throws_declared);
+    if (!ctx.async_state_machine_enabled) {
+      out << "define " << LLVMScalarType(fn.return_type) << " @" << fn.name << "(" << signature.str() << ") {\n";
+      out << "entry:\n";
+    }
     ctx.async_resume_entry_tag = AsyncResumeEntryTag(fn);
     ctx.async_executor_tag = ExecutorAffinityTag(fn);
     if (fn.throws_declared) {
@@ -14270,13 +15209,118 @@ class Objc3IREmitter {
       EmitTypedReturn("0", ctx);
     }
 
+    if (ctx.async_state_machine_enabled) {
+      EmitAsyncStateMachineFunction(fn.name, fn.return_type, fn.params,
+                                    signature.str(), ctx, out);
+      return;
+    }
+    for (const auto &line : ctx.entry_lines) {
+      out << line << "\n";
+    }
+    for (const auto &line : ctx.code_lines) {
+      out << line << "\n";
+    }
+
+    out << "}\n";
+  }
+
+  // Writes a state-machine body as `<symbol>.async_resume`, which switches
+  // on the frame's resume point, plus an entry wrapper under the original
+  // symbol and signature that allocates the frame and runs it to completion.
+  // Every entry alloca becomes a frame slot after the resume point, the
+  // awaited value, and the parameters.
+  void EmitAsyncStateMachineFunction(const std::string &symbol,
+                                     ValueType return_type,
+                                     const std::vector<FuncParam> &params,
+                                     const std::string &signature,
+                                     const FunctionContext &ctx,
+                                     std::ostringstream &out) const {
+    const std::string frame_type = "%objc3.async_frame." + symbol;
+    const auto frame_slot = [&frame_type](const std::string &name,
+                                          std::size_t index) {
+      return "  " + name + " = getelementptr inbounds " + frame_type +
+             ", ptr %async.frame, i32 0, i32 " + std::to_string(index);
+    };
+    std::vector<std::string> field_types = {"i32", "i32"};
+    for (const auto &param : params) {
+      field_types.push_back(LLVMScalarType(param.type));
+    }
+    std::vector<std::string> slot_lines;
+    std::vector<std::string> start_lines;
     for (const auto &line : ctx.entry_lines) {
+      const std::size_t alloca_pos = line.find(" = alloca ");
+      const std::size_t align_pos = line.rfind(", align ");
+      if (line.rfind("  %", 0) != 0 || alloca_pos == std::string::npos ||
+          align_pos == std::string::npos || align_pos < alloca_pos) {
+        start_lines.push_back(line);
+        continue;
+      }
+      const std::size_t type_pos = alloca_pos + std::string(" = alloca ").size();
+      slot_lines.push_back(
+          frame_slot(line.substr(2, alloca_pos - 2), field_types.size()));
+      field_types.push_back(line.substr(type_pos, align_pos - type_pos));
+    }
+
+    out << frame_type << " = type { ";
+    for (std::size_t i = 0; i < field_types.size(); ++i) {
+      out << (i == 0 ? "" : ", ") << field_types[i];
+    }
+    out << " }\n";
+    out << "define internal i32 @" << symbol
+        << ".async_resume(ptr %async.frame) {\n";
+    out << "entry:\n";
+    out << frame_slot("%async.resume_point.ptr", 0u) << "\n";
+    out << frame_slot("%async.value.ptr", 1u) << "\n";
+    for (const auto &line : slot_lines) {
+      out << line << "\n";
+    }
+    out << "  %async.resume_point = load i32, ptr %async.resume_point.ptr, "
+           "align 4\n";
+    out << "  switch i32 %async.resume_point, label %async.start [";
+    for (int point = 1; point <= ctx.async_resume_point_count; ++point) {
+      out << "\n    i32 " << point << ", label %async.resume." << point;
+    }
+    out << "\n  ]\n";
+    out << "async.start:\n";
+    for (std::size_t i = 0; i < params.size(); ++i) {
+      const std::string param_ptr = "%async.param." + std::to_string(i);
+      out << frame_slot(param_ptr, 2u + i) << "\n";
+      out << "  %arg" << i << " = load " << LLVMScalarType(params[i].type)
+          << ", ptr " << param_ptr << "\n";
+    }
+    for (const auto &line : start_lines) {
       out << line << "\n";
     }
     for (const auto &line : ctx.code_lines) {
       out << line << "\n";
     }
+    out << "async.suspend:\n";
+    out << "  ret i32 0\n";
+    out << "}\n";
 
+    out << "define " << LLVMScalarType(return_type) << " @" << symbol << "("
+        << signature << ") {\n";
+    out << "entry:\n";
+    out << "  %async.frame = call ptr @" << kObjc3RuntimeAllocateAsyncFrameSymbol
+        << "(ptr @" << symbol
+        << ".async_resume, i64 ptrtoint (ptr getelementptr (" << frame_type
+        << ", ptr null, i32 1) to i64))\n";
+    for (std::size_t i = 0; i < params.size(); ++i) {
+      const std::string param_ptr = "%async.param." + std::to_string(i);
+      out << frame_slot(param_ptr, 2u + i) << "\n";
+      out << "  store " << LLVMScalarType(params[i].type) << " %arg" << i
+          << ", ptr " << param_ptr << "\n";
+    }
+    out << "  %async.result = call i32 @" << kObjc3RuntimeRunAsyncFrameI32Symbol
+        << "(ptr %async.frame)\n";
+    if (return_type == ValueType::Void) {
+      out << "  ret void\n";
+    } else if (return_type == ValueType::Bool) {
+      out << "  %async.result.i1 = icmp ne i32 %async.result, 0\n";
+      out << "  ret i1 %async.result.i1\n";
+    } else {
+      out << "  ret i32 %async.result\n";
+    }
     out << "}\n";
   }
 
@@ -14301,14 +15345,18 @@ class Objc3IREmitter {
       signature << "ptr %error_out";
     }
 
-    out << "define " << LLVMScalarType(method.return_type) << " @"
-        << method_def.symbol << "(" << signature.str() << ") {\n";
-    out << "entry:\n";
-
     FunctionContext ctx;
     ctx.return_type = method.return_type;
     ctx.async_runtime_helper_enabled =
         method.async_declared && ExecutorAffinityTag(method) != 0;
+    ctx.async_state_machine_enabled =
+        ctx.async_runtime_helper_enabled &&
+        AllowsAsyncStateMachine(method.body, method.throws_declared);
+    if (!ctx.async_state_machine_enabled) {
+      out << "define " << LLVMScalarType(method.return_type) << " @"
+          << method_def.symbol << "(" << signature.str() << ") {\n";
+      out << "entry:\n";
+    }
     ctx.actor_runtime_helper_enabled =
         IsActorImplementation(method_def.implementation_name);
     ctx.actor_nonisolated_entry_enabled =
@@ -14366,6 +15414,11 @@ class Objc3IREmitter {
       EmitTypedReturn("0", ctx);
     }
 
+    if (ctx.async_state_machine_enabled) {
+      EmitAsyncStateMachineFunction(method_def.symbol, method.return_type,
+                                    method.params, signature.str(), ctx, out);
+      return;
+    }
     for (const auto &line : ctx.entry_lines) {
       out << line << "\n";
     }
@@ -14597,13 +15650,19 @@ class Objc3IREmitter {
   std::map<std::string, std::string> selector_pool_globals_;
   std::map<std::string, std::string> runtime_string_pool_globals_;
   std::map<std::string, TypedKeyPathArtifact> typed_keypath_artifacts_;
+  bool protocol_literal_queries_emitted_ = false;
+  std::vector<std::uint32_t> prebuilt_image_words_;
   std::unordered_map<std::string, int> class_receiver_constants_;
+  std::map<std::string, SealedDispatchTable> sealed_dispatch_tables_;
   std::size_t vector_signature_function_count_ = 0;
   mutable std::vector<std::string> block_function_definitions_;
   mutable std::unordered_set<std::string> emitted_block_invoke_symbols_;
   mutable std::unordered_set<std::string> emitted_block_copy_helper_symbols_;
   mutable std::unordered_set<std::string> emitted_block_dispose_helper_symbols_;
   mutable std::set<std::string> runtime_dispatch_symbols_used_;
+  mutable std::size_t dispatch_site_cache_count_ = 0;
+  mutable std::map<std::string, std::string> selector_reference_globals_used_;
+  mutable std::set<std::string> sealed_dispatch_tables_used_;
   mutable bool runtime_dispatch_call_emitted_ = false;
   mutable std::size_t direct_dispatch_call_sites_emitted_ = 0;
   mutable std::size_t runtime_dispatch_call_sites_emitted_ = 0;
@@ -152,6 +152,12 @@ typedef struct objc3c_frontend_stage_summary {
  * - language_version uses Objective-C version 3 by default when set to 0.
  * - compatibility_mode values: canonical (0), legacy (1). Default: canonical.
  * - migration_assist toggles migration guidance paths when non-zero.
+ * - dispatch_site_caches lowers canonical runtime sends through per-call-site
+ *   dispatch caches when non-zero.
+ * - selector_handles lowers canonical runtime sends through emitted selector
+ *   references and objc3_runtime_dispatch_sel_i32 when non-zero.
+ * - sealed_dispatch_tables lowers class-method sends on objc_final/objc_sealed
+ *   classes through emitted dense dispatch tables when non-zero.
  * - Set unused pointers to NULL and reserved fields to 0.
  */
 typedef struct objc3c_frontend_compile_options {
@@ -170,7 +176,9 @@ typedef struct objc3c_frontend_compile_options {
   uint8_t language_version;
   uint8_t compatibility_mode;
   uint8_t migration_assist;
-  uint8_t reserved0;
+  uint8_t dispatch_site_caches;
+  uint8_t selector_handles;
+  uint8_t sealed_dispatch_tables;
   uint64_t translation_unit_registration_order_ordinal;
 } objc3c_frontend_compile_options_t;
 
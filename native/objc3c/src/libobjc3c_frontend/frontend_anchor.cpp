@@ -480,6 +480,10 @@ static Objc3FrontendOptions BuildFrontendOptions(const objc3c_frontend_compile_o
   if (!IsNullOrEmpty(options.runtime_dispatch_symbol)) {
     frontend_options.lowering.runtime_dispatch_symbol = options.runtime_dispatch_symbol;
   }
+  frontend_options.lowering.dispatch_site_caches = options.dispatch_site_caches != 0;
+  frontend_options.lowering.selector_handles = options.selector_handles != 0;
+  frontend_options.lowering.sealed_dispatch_tables =
+      options.sealed_dispatch_tables != 0;
   return frontend_options;
 }
 
@@ -167,6 +167,9 @@ bool TryNormalizeObjc3LoweringContract(const Objc3LoweringContract &input,
   }
   normalized.max_message_send_args = input.max_message_send_args;
   normalized.runtime_dispatch_symbol = input.runtime_dispatch_symbol;
+  normalized.dispatch_site_caches = input.dispatch_site_caches;
+  normalized.selector_handles = input.selector_handles;
+  normalized.sealed_dispatch_tables = input.sealed_dispatch_tables;
   return true;
 }
 
@@ -180,6 +183,18 @@ bool TryBuildObjc3LoweringIRBoundary(const Objc3LoweringContract &input,
   boundary.runtime_dispatch_arg_slots = normalized.max_message_send_args;
   boundary.runtime_dispatch_symbol = normalized.runtime_dispatch_symbol;
   boundary.selector_global_ordering = kObjc3SelectorGlobalOrdering;
+  boundary.dispatch_site_caches =
+      normalized.dispatch_site_caches &&
+      normalized.runtime_dispatch_symbol == kObjc3RuntimeDispatchSymbol &&
+      normalized.max_message_send_args == kObjc3RuntimeDispatchDefaultArgs;
+  boundary.selector_handles =
+      normalized.selector_handles &&
+      normalized.runtime_dispatch_symbol == kObjc3RuntimeDispatchSymbol &&
+      normalized.max_message_send_args == kObjc3RuntimeDispatchDefaultArgs;
+  boundary.sealed_dispatch_tables =
+      normalized.sealed_dispatch_tables &&
+      normalized.runtime_dispatch_symbol == kObjc3RuntimeDispatchSymbol &&
+      normalized.max_message_send_args == kObjc3RuntimeDispatchDefaultArgs;
   return true;
 }
 
@@ -196,9 +211,23 @@ std::string Objc3LoweringIRBoundaryReplayKey(const Objc3LoweringIRBoundary &boun
   // explicit visibility spelling policy, or llvm.used retention order. Those
   // remain one frozen emitted policy surface until the next runtime step and the later object-format policy step
   // extend them explicitly.
-  return "runtime_dispatch_symbol=" + boundary.runtime_dispatch_symbol +
-         ";runtime_dispatch_arg_slots=" + std::to_string(boundary.runtime_dispatch_arg_slots) +
-         ";selector_global_ordering=" + boundary.selector_global_ordering;
+  std::string key =
+      "runtime_dispatch_symbol=" + boundary.runtime_dispatch_symbol +
+      ";runtime_dispatch_arg_slots=" + std::to_string(boundary.runtime_dispatch_arg_slots) +
+      ";selector_global_ordering=" + boundary.selector_global_ordering;
+  if (boundary.dispatch_site_caches) {
+    key += ";dispatch_site_cache_symbol=";
+    key += kObjc3RuntimeDispatchSiteCacheSymbol;
+  }
+  if (boundary.selector_handles) {
+    key += ";selector_handle_dispatch_symbol=";
+    key += kObjc3RuntimeDispatchSelectorHandleSymbol;
+  }
+  if (boundary.sealed_dispatch_tables) {
+    key += ";sealed_dispatch_table_symbol=";
+    key += kObjc3RuntimeDispatchSealedTableSymbol;
+  }
+  return key;
 }
 
 bool UsesCanonicalObjc3RuntimeDispatchEntrypoint(
@@ -9,6 +9,12 @@ inline constexpr std::size_t kObjc3RuntimeDispatchDefaultArgs = 4;
 inline constexpr std::size_t kObjc3RuntimeDispatchMaxArgs = 16;
 inline constexpr const char *kObjc3RuntimeDispatchSymbol =
     "objc3_runtime_dispatch_i32";
+inline constexpr const char *kObjc3RuntimeDispatchSiteCacheSymbol =
+    "objc3_runtime_dispatch_site_cached_i32";
+inline constexpr const char *kObjc3RuntimeDispatchSelectorHandleSymbol =
+    "objc3_runtime_dispatch_sel_i32";
+inline constexpr const char *kObjc3RuntimeDispatchSealedTableSymbol =
+    "objc3_runtime_dispatch_sealed_i32";
 inline constexpr const char *kObjc3DispatchSurfaceClassificationContractId =
     "objc3c.dispatch.surface.classification.v1";
 inline constexpr const char *kObjc3DispatchSurfaceInstanceFamily = "instance";
@@ -647,6 +653,12 @@ inline constexpr const char
         "objc3_runtime_handoff_async_continuation_to_executor_i32";
 inline constexpr const char *kObjc3RuntimeResumeAsyncContinuationI32Symbol =
     "objc3_runtime_resume_async_continuation_i32";
+inline constexpr const char *kObjc3RuntimeAllocateAsyncFrameSymbol =
+    "objc3_runtime_allocate_async_frame";
+inline constexpr const char *kObjc3RuntimeRunAsyncFrameI32Symbol =
+    "objc3_runtime_run_async_frame_i32";
+inline constexpr const char *kObjc3RuntimeAwaitAsyncFrameI32Symbol =
+    "objc3_runtime_await_async_frame_i32";
 inline constexpr const char *kObjc3RuntimeSpawnTaskI32Symbol =
     "objc3_runtime_spawn_task_i32";
 inline constexpr const char *kObjc3RuntimeEnterTaskGroupScopeI32Symbol =
@@ -663,6 +675,12 @@ inline constexpr const char *kObjc3RuntimeTaskOnCancelI32Symbol =
     "objc3_runtime_task_on_cancel_i32";
 inline constexpr const char *kObjc3RuntimeExecutorHopI32Symbol =
     "objc3_runtime_executor_hop_i32";
+inline constexpr const char *kObjc3RuntimeSpawnBlockTaskI32Symbol =
+    "objc3_runtime_spawn_block_task_i32";
+inline constexpr const char *kObjc3RuntimeOpenLoweredTaskGroupI32Symbol =
+    "objc3_runtime_open_lowered_task_group_i32";
+inline constexpr const char *kObjc3RuntimeTaskGroupSpawnBlockI32Symbol =
+    "objc3_runtime_task_group_spawn_block_i32";
 inline constexpr const char *kObjc3RuntimeActorEnterIsolationThunkI32Symbol =
     "objc3_runtime_actor_enter_isolation_thunk_i32";
 inline constexpr const char *kObjc3RuntimeActorEnterNonisolatedI32Symbol =
@@ -683,6 +701,12 @@ inline constexpr const char *kObjc3RuntimeLoadWeakCurrentPropertyI32Symbol =
     "objc3_runtime_load_weak_current_property_i32";
 inline constexpr const char *kObjc3RuntimeStoreWeakCurrentPropertyI32Symbol =
     "objc3_runtime_store_weak_current_property_i32";
+inline constexpr const char *kObjc3RuntimeKeyPathGetI32Symbol =
+    "objc3_runtime_keypath_get_i32";
+inline constexpr const char *kObjc3RuntimeKeyPathSetI32Symbol =
+    "objc3_runtime_keypath_set_i32";
+inline constexpr const char *kObjc3RuntimeReceiverConformsToProtocolI32Symbol =
+    "objc3_runtime_receiver_conforms_to_protocol_i32";
 inline constexpr const char *kObjc3RuntimeRetainI32Symbol =
     "objc3_runtime_retain_i32";
 inline constexpr const char *kObjc3RuntimeReleaseI32Symbol =
@@ -1275,6 +1299,22 @@ inline constexpr std::uint64_t kObjc3RuntimeBootstrapRegistrationTableAbiVersion
     2u;
 inline constexpr std::uint64_t
     kObjc3RuntimeBootstrapRegistrationTablePointerFieldCount = 12u;
+// prebuilt-metadata-image anchor: next to the v2/12 registration table, each
+// image also carries one position-independent word blob (a perfect hash over
+// its selector pool plus each class descriptor's name-sorted receiver
+// ordinal). The constructor stages it before the table; the runtime adopts it
+// on a cold selector table and otherwise walks the table as before.
+inline constexpr const char *kObjc3RuntimeBootstrapStagePrebuiltImageSymbol =
+    "objc3_runtime_stage_prebuilt_image_for_bootstrap";
+inline constexpr const char *kObjc3RuntimeBootstrapPrebuiltImageLogicalSection =
+    "objc3.runtime.prebuilt_image";
+inline constexpr const char *kObjc3RuntimeBootstrapPrebuiltImageSymbolPrefix =
+    "__objc3_runtime_prebuilt_image_";
+inline constexpr std::uint32_t kObjc3RuntimeBootstrapPrebuiltImageMagic =
+    0x4950334Fu;
+inline constexpr std::uint32_t kObjc3RuntimeBootstrapPrebuiltImageVersion = 1u;
+inline constexpr std::uint32_t kObjc3RuntimeBootstrapPrebuiltImageHeaderWordCount =
+    12u;
 // versioned conformance-report lowering freeze anchor: lane-C
 // lowers the truthful runnable/source-only/unsupported claim packets into one
 // emitted machine-readable sidecar artifact. Later runtime capability and
@@ -1907,12 +1947,29 @@ enum class Objc3AtomicMemoryOrder : std::uint8_t {
 struct Objc3LoweringContract {
   std::size_t max_message_send_args = kObjc3RuntimeDispatchDefaultArgs;
   std::string runtime_dispatch_symbol = kObjc3RuntimeDispatchSymbol;
+  bool dispatch_site_caches = false;
+  bool selector_handles = false;
+  bool sealed_dispatch_tables = false;
 };
 
 struct Objc3LoweringIRBoundary {
   std::size_t runtime_dispatch_arg_slots = kObjc3RuntimeDispatchDefaultArgs;
   std::string runtime_dispatch_symbol = kObjc3RuntimeDispatchSymbol;
   std::string selector_global_ordering = kObjc3SelectorGlobalOrdering;
+  // dispatch-site-cache anchor: opt-in lowering that routes canonical runtime
+  // sends through objc3_runtime_dispatch_site_cached_i32 with one emitted
+  // per-call-site cache cell. Only honored on the default four-slot canonical
+  // dispatch ABI.
+  bool dispatch_site_caches = false;
+  // selector-handle-dispatch anchor: opt-in lowering that passes one emitted
+  // selector reference to objc3_runtime_dispatch_sel_i32 instead of the
+  // selector spelling. Site-cached sends keep their own entrypoint.
+  bool selector_handles = false;
+  // sealed-dispatch-table anchor: opt-in lowering that turns class-method
+  // sends on objc_final/objc_sealed classes into an indexed load from one
+  // emitted per-class table plus an indirect call, falling back to
+  // objc3_runtime_dispatch_sealed_i32 while the table is unbound.
+  bool sealed_dispatch_tables = false;
 };
 
 struct Objc3RuntimeMetadataLayoutPolicyFamilyInput {
@@ -13168,6 +13168,33 @@ class Objc3Parser {
       expr->typed_keypath_literal_is_normalized = !expr->typed_keypath_components.empty();
       return expr;
     }
+    if (Match(TokenKind::KwAtProtocol)) {
+      const Token protocol_token = Previous();
+      if (!Match(TokenKind::LParen)) {
+        const Token &token = Peek();
+        diagnostics_.push_back(MakeDiag(token.line, token.column, "O3P106", "missing '(' after @protocol"));
+        return nullptr;
+      }
+      if (!At(TokenKind::Identifier)) {
+        const Token &token = Peek();
+        diagnostics_.push_back(MakeDiag(token.line, token.column, "O3P103", "expected protocol name"));
+        return nullptr;
+      }
+      const Token name = Advance();
+      if (!Match(TokenKind::RParen)) {
+        const Token &token = Peek();
+        diagnostics_.push_back(MakeDiag(token.line, token.column, "O3P109", "missing ')' after @protocol"));
+        return nullptr;
+      }
+      auto expr = std::make_unique<Expr>();
+      expr->kind = Expr::Kind::Identifier;
+      expr->ident = "__objc3_protocol_literal";
+      expr->line = protocol_token.line;
+      expr->column = protocol_token.column;
+      expr->protocol_literal_enabled = true;
+      expr->protocol_literal_name = name.text;
+      return expr;
+    }
     if (Match(TokenKind::Identifier)) {
       auto expr = std::make_unique<Expr>();
       expr->kind = Expr::Kind::Identifier;
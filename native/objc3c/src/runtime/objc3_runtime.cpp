@@ -1,15 +1,28 @@
 #include "runtime/objc3_runtime_bootstrap_internal.h"
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
 #include <cstring>
 #include <cstdint>
 #include <deque>
+#include <limits>
 #include <memory>
 #include <mutex>
+#include <new>
 #include <string>
+#include <string_view>
+#include <thread>
 #include <tuple>
+#include <type_traits>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 namespace {
@@ -17,6 +30,45 @@ namespace {
 constexpr std::int64_t kDispatchModulus = 2147483629LL;
 constexpr std::uint64_t kReceiverIdentityBase = 1024;
 constexpr std::uint64_t kReceiverIdentityStride = 17;
+// Receiver handles are tagged by their top bits: bit 30 marks an instance,
+// bits 30..29 == 01 mark a promoted block, and everything below bit 29 is a
+// static class/instance identity decoded arithmetically against
+// kReceiverIdentityBase. Instance and block handles then carry their slab slot
+// in the low bits and the slot's reuse generation above them, so a handle
+// resolves by indexing and a stale handle to a recycled slot never matches the
+// new occupant.
+constexpr int kRuntimeHandleKindShift = 29;
+constexpr int kRuntimeInstanceReceiverBase = 1 << 30;
+constexpr int kRuntimeBlockHandleBase = 1 << kRuntimeHandleKindShift;
+constexpr int kRuntimeInstanceSlotBits = 20;
+constexpr std::uint32_t kRuntimeInstanceSlotMask =
+    (1u << kRuntimeInstanceSlotBits) - 1u;
+constexpr std::uint32_t kRuntimeInstanceMaxGeneration =
+    (1u << (31 - kRuntimeInstanceSlotBits - 1)) - 1u;
+constexpr std::uint32_t kRuntimeBlockMaxGeneration =
+    (1u << (kRuntimeHandleKindShift - kRuntimeInstanceSlotBits)) - 1u;
+constexpr int kRuntimeInstanceSlotSegmentBits = 10;
+constexpr std::size_t kRuntimeInstanceSlotSegmentSize =
+    std::size_t{1} << kRuntimeInstanceSlotSegmentBits;
+constexpr std::size_t kRuntimeInstanceSlotSegmentCount =
+    (std::size_t{kRuntimeInstanceSlotMask} + 1u) >>
+    kRuntimeInstanceSlotSegmentBits;
+// A slot whose generation runs out wraps to generation zero and waits behind
+// this many later exhausted slots before it is handed out again, so capacity
+// stays bounded by the live working set plus the quarantine.
+constexpr std::size_t kRuntimeSlotQuarantineLength = 32;
+constexpr int kRuntimeInstanceRetainGenerationShift = 48;
+constexpr std::uint64_t kRuntimeInstanceRetainCountMask =
+    (std::uint64_t{1} << kRuntimeInstanceRetainGenerationShift) - 1u;
+constexpr std::size_t kRuntimeInstanceSizeClassCount = 9;
+constexpr std::size_t kRuntimeWeakSideTableStripeCount = 64;
+constexpr std::size_t kRuntimeInstanceMinSizeClassBytes = 16;
+constexpr std::size_t kRuntimeInstanceSlabChunkBytes = 16384;
+constexpr std::size_t kRuntimeBlockRetainedStorageWordCount = 32;
+// Default bounds on slow-path method-cache fills; registration seeds are
+// bounded by the emitted method lists and sit outside both.
+constexpr std::size_t kMethodCacheResolvedCapacity = 8192;
+constexpr std::size_t kMethodCacheNegativeCapacity = 1024;
 [[maybe_unused]] constexpr const char *kObjc3ConformancePublicationContractId =
     "objc3c.driver.conformance.report.publication.v1";
 [[maybe_unused]] constexpr const char *kObjc3ConformanceClaimOperationsContractId =
@@ -51,6 +103,8 @@ constexpr std::uint64_t kReceiverIdentityStride = 17;
         "objc3c.tooling.dashboard.status.publication.v1";
 
 struct SelectorSlot {
+  // Empty for slots adopted from a prebuilt image; their handle points at
+  // the image's own selector pool string instead.
   std::string spelling_storage;
   objc3_runtime_selector_handle handle{};
   bool metadata_backed = false;
@@ -61,6 +115,10 @@ struct SelectorSlot {
   std::uint64_t last_selector_pool_index = 0;
 };
 
+// Index into RuntimeState::symbol_names plus one; 0 names nothing.
+using RuntimeSymbolId = std::uint32_t;
+constexpr RuntimeSymbolId kNoRuntimeSymbol = 0;
+
 struct KeyPathSlot {
   std::uint64_t stable_id = 0;
   std::string root_name_storage;
@@ -70,6 +128,10 @@ struct KeyPathSlot {
   bool root_is_self = false;
   bool ambiguous = false;
   std::uint64_t component_count = 0;
+  // The root class and each component, interned once at materialization so
+  // evaluation never splits the path or hashes a name.
+  RuntimeSymbolId root_class_id = kNoRuntimeSymbol;
+  std::vector<RuntimeSymbolId> component_ids;
   std::uint64_t metadata_provider_count = 0;
   std::uint64_t first_registration_order_ordinal = 0;
   std::uint64_t last_registration_order_ordinal = 0;
@@ -100,14 +162,52 @@ struct RegisteredImageMetadata {
   std::uint64_t keypath_descriptor_count = 0;
   bool linker_anchor_matches_discovery_root = false;
   bool used_staged_registration_table = false;
+  // The prebuilt metadata image staged with the table, kept so replay adopts
+  // it again, and its per-descriptor receiver ordinals when this
+  // registration adopted the image and they cover its class descriptors.
+  const std::uint32_t *prebuilt_image_words = nullptr;
+  std::uint64_t prebuilt_image_byte_count = 0;
+  const std::uint32_t *prebuilt_class_ordinals = nullptr;
+  std::uint64_t prebuilt_class_ordinal_count = 0;
+};
+
+// prebuilt-metadata-image anchor: a selector table adopted from an emitted
+// image. Its slots are the first `selector_count` selector slots and point at
+// the image's own pool strings; lookups go through the image's perfect hash
+// and reach the name map only on a miss.
+struct AdoptedSelectorTable {
+  const std::uint32_t *group_displacements = nullptr;
+  const std::uint32_t *buckets = nullptr;
+  std::uint32_t group_mask = 0;
+  std::uint32_t bucket_mask = 0;
+  std::uint32_t hash_seed = 0;
+  std::uint32_t selector_count = 0;
 };
 
+// Word layout and status codes of the prebuilt metadata image; the lowering
+// contract's kObjc3RuntimeBootstrapPrebuiltImage* constants emit the same.
+constexpr std::uint32_t kPrebuiltImageMagic = 0x4950334Fu;
+constexpr std::uint32_t kPrebuiltImageVersion = 1u;
+constexpr std::uint64_t kPrebuiltImageHeaderWordCount = 12u;
+constexpr int kPrebuiltImageStatusNone = 0;
+constexpr int kPrebuiltImageStatusAdopted = 1;
+constexpr int kPrebuiltImageStatusHeaderMismatch = 2;
+constexpr int kPrebuiltImageStatusShapeMismatch = 3;
+constexpr int kPrebuiltImageStatusSelectorsPresent = 4;
+constexpr int kPrebuiltImageStatusHashMismatch = 5;
+
 enum class DispatchFamily {
   Invalid = 0,
   Instance = 1,
   Class = 2,
 };
 
+enum class RuntimeHandleKind {
+  StaticIdentity = 0,
+  Block = 1,
+  Instance = 2,
+};
+
 enum class RuntimeBuiltinKind {
   None = 0,
   Alloc = 1,
@@ -128,18 +228,20 @@ struct RealizedPropertyAccessor;
 
 struct PropertyLookupCacheKey {
   std::uint64_t start_base_identity = 0;
-  std::string property_name;
+  RuntimeSymbolId property_id = kNoRuntimeSymbol;
 
   bool operator==(const PropertyLookupCacheKey &other) const {
     return start_base_identity == other.start_base_identity &&
-           property_name == other.property_name;
+           property_id == other.property_id;
   }
 };
 
 struct PropertyLookupCacheKeyHash {
   std::size_t operator()(const PropertyLookupCacheKey &key) const {
-    return std::hash<std::uint64_t>{}(key.start_base_identity) ^
-           (std::hash<std::string>{}(key.property_name) << 1u);
+    return std::hash<std::uint64_t>{}(key.start_base_identity ^
+                                      (static_cast<std::uint64_t>(
+                                           key.property_id)
+                                       << 32u));
   }
 };
 
@@ -150,6 +252,48 @@ struct PropertyLookupCacheEntry {
   std::size_t accessor_index = 0;
 };
 
+struct KeyPathChainKey {
+  std::uint64_t keypath_handle = 0;
+  std::uint64_t root_base_identity = 0;
+
+  bool operator==(const KeyPathChainKey &other) const {
+    return keypath_handle == other.keypath_handle &&
+           root_base_identity == other.root_base_identity;
+  }
+};
+
+struct KeyPathChainKeyHash {
+  std::size_t operator()(const KeyPathChainKey &key) const {
+    return std::hash<std::uint64_t>{}(key.root_base_identity ^
+                                      (key.keypath_handle << 32u));
+  }
+};
+
+// One component of a compiled key path: the accessor it resolved to, the
+// slot that accessor reads, and the ownership handling fixed at compile time
+// so evaluation never re-reads the descriptor profiles.
+struct KeyPathChainStep {
+  // Class the step was resolved against. An intermediate value of any other
+  // class resolves that one step by name instead.
+  std::uint64_t base_identity = 0;
+  const RealizedPropertyAccessor *accessor = nullptr;
+  std::uint32_t offset = 0;
+  std::uint32_t size = 0;
+  bool strong = false;
+  bool weak = false;
+  bool unowned_safe = false;
+  bool settable = false;
+};
+
+struct KeyPathChain {
+  const KeyPathSlot *slot = nullptr;
+  // False when the root class does not match the key path's root; the entry
+  // is kept so a repeated mismatch stays a single lookup.
+  bool resolved = false;
+  // Extended one step at a time as evaluation first reaches each depth.
+  std::vector<KeyPathChainStep> steps;
+};
+
 struct MethodCacheKey {
   std::uint64_t normalized_receiver_identity = 0;
   std::uint64_t selector_stable_id = 0;
@@ -167,6 +311,8 @@ struct MethodCacheKeyHash {
   }
 };
 
+enum class MethodCacheRing : std::uint8_t { None, Resolved, Negative };
+
 struct MethodCacheEntry {
   bool resolved = false;
   bool dispatch_family_is_class = false;
@@ -176,7 +322,7 @@ struct MethodCacheEntry {
   bool objc_sealed_declared = false;
   std::string selector_storage;
   std::string fast_path_reason;
-  std::string class_name;
+  RuntimeSymbolId class_id = kNoRuntimeSymbol;
   std::string owner_identity;
   std::uint64_t normalized_receiver_identity = 0;
   std::uint64_t selector_stable_id = 0;
@@ -187,6 +333,25 @@ struct MethodCacheEntry {
   const void *implementation = nullptr;
   RuntimeBuiltinKind builtin_kind = RuntimeBuiltinKind::None;
   const RealizedPropertyAccessor *runtime_property_accessor = nullptr;
+  // Slow-path fills only; seeds stay outside both rings and never expire.
+  // The entry is current while `class_generation` is at or past its receiver
+  // binding's retired generation.
+  MethodCacheRing ring = MethodCacheRing::None;
+  bool ring_referenced = false;
+  std::size_t ring_slot = 0;
+  std::uint64_t base_identity = 0;
+  std::uint64_t class_generation = 0;
+};
+
+// bounded-method-cache anchor: resolved and negative slow-path fills each
+// live in their own CLOCK ring, so fallback sends with arbitrary selectors
+// can only recycle negative slots and never push out a warm resolution.
+// A slot is live while its key's entry still names this ring and slot.
+struct MethodCacheClockRing {
+  std::vector<MethodCacheKey> keys;
+  std::size_t hand = 0;
+  std::size_t live_count = 0;
+  std::size_t capacity = 0;
 };
 
 struct SlowPathResolution {
@@ -198,7 +363,7 @@ struct SlowPathResolution {
   bool objc_sealed_declared = false;
   std::string selector_storage;
   std::string fast_path_reason;
-  std::string class_name;
+  RuntimeSymbolId class_id = kNoRuntimeSymbol;
   std::string owner_identity;
   std::uint64_t normalized_receiver_identity = 0;
   std::uint64_t selector_stable_id = 0;
@@ -339,27 +504,93 @@ struct EmittedIvarDescriptor {
   std::uint64_t alignment_bytes;
 };
 
+// How a synthesized accessor may touch its slot without the runtime mutex;
+// see ClassifyDirectPropertyAccess.
+enum class RuntimeDirectPropertyAccess : std::uint8_t {
+  None,
+  Scalar,
+  StrongNonatomic,
+};
+
 struct RealizedPropertyAccessor {
   const EmittedPropertyDescriptor *property_descriptor = nullptr;
   const EmittedIvarDescriptor *ivar_descriptor = nullptr;
   RuntimeMethodReturnKind getter_return_kind = RuntimeMethodReturnKind::Unsupported;
+  RuntimeSymbolId property_id = kNoRuntimeSymbol;
+  RuntimeDirectPropertyAccess direct_access = RuntimeDirectPropertyAccess::None;
+  // Slot offset and size fixed at realization for direct access.
+  std::uint32_t direct_offset = 0;
+  std::uint32_t direct_size = 0;
   std::string getter_owner_identity;
   std::string setter_owner_identity;
 };
 
 struct RuntimeWeakSlotRef {
   int owner_receiver = 0;
-  std::size_t offset = 0;
-  std::size_t size = 0;
+  std::uint32_t offset = 0;
+  std::uint32_t size = 0;
+};
+
+// Weak referrers are sharded by target across independently locked stripes.
+// Each stripe keeps its targets' referrer lists plus a (owner, offset) index
+// into them, so registering or unregistering one slot is O(1) and zeroing a
+// target only touches that target's referrers. Weak loads take only the
+// target's stripe, never the runtime mutex; anything that also holds the
+// runtime mutex takes it first.
+struct alignas(64) RuntimeWeakSideTableStripe {
+  std::mutex mutex;
+  std::unordered_map<int, std::vector<RuntimeWeakSlotRef>> referrers_by_target;
+  std::unordered_map<std::uint64_t, std::uint32_t> referrer_index_by_slot;
 };
 
+struct RuntimeWeakSideTable {
+  std::array<RuntimeWeakSideTableStripe, kRuntimeWeakSideTableStripeCount>
+      stripes;
+};
+
+// One slab slot. Storage comes from the size-class slabs below (or a
+// dedicated block past the largest class); the slot itself is recycled through
+// the slab free list with its generation bumped. retain_state packs the slot
+// generation above the retain count so retain/release can validate a handle
+// and adjust the count in one CAS without the runtime mutex; a zero count
+// means the slot is free. Every other field is only touched under the mutex.
 struct RuntimeInstanceRecord {
+  std::atomic<std::uint64_t> retain_state{0};
+  std::uint32_t slot_index = 0;
+  std::uint32_t size_class = 0;
   std::uint64_t receiver_identity = 0;
   std::uint64_t base_identity = 0;
-  std::string class_name;
   std::size_t instance_size_bytes = 0;
-  std::vector<unsigned char> storage_bytes;
-  std::uint64_t retain_count = 1;
+  unsigned char *storage_bytes = nullptr;
+  std::unique_ptr<unsigned char[]> oversize_storage;
+};
+
+// Slots are carved in fixed segments that never move, so lock-free
+// retain/release can index a published segment while an allocation under the
+// mutex publishes the next one.
+struct RuntimeInstanceSlotSegment {
+  std::array<RuntimeInstanceRecord, kRuntimeInstanceSlotSegmentSize> records;
+};
+
+struct RuntimeInstanceSizeClassSlab {
+  std::vector<std::unique_ptr<unsigned char[]>> chunks;
+  std::vector<unsigned char *> free_blocks;
+};
+
+struct RuntimeInstanceSlab {
+  std::array<std::atomic<RuntimeInstanceSlotSegment *>,
+             kRuntimeInstanceSlotSegmentCount>
+      segments{};
+  std::vector<std::unique_ptr<RuntimeInstanceSlotSegment>> owned_segments;
+  std::uint32_t slot_count = 0;
+  std::vector<std::uint32_t> free_slots;
+  std::deque<std::uint32_t> quarantined_slots;
+  std::array<RuntimeInstanceSizeClassSlab, kRuntimeInstanceSizeClassCount>
+      size_classes;
+  std::uint64_t reused_slot_count = 0;
+  std::uint64_t wrapped_slot_count = 0;
+  std::uint64_t reserved_storage_bytes = 0;
+  std::uint64_t oversize_allocation_count = 0;
 };
 
 using RuntimeBlockInvokeFn = int (*)(void *, int, int, int, int);
@@ -374,7 +605,14 @@ using RuntimeBlockDisposeHelperFn = void (*)(void *);
 // records now preserve aligned copied storage plus optional helper pointers so
 // promotion/invoke/final-dispose behavior for pointer-capture blocks executes
 // inside the private runtime model.
+// Block records live in slab slots like instances, with the same packed
+// generation/retain-count word. Storage is allocated once at promotion and
+// never moves while the count is nonzero, so invoke pins the record with a
+// retain instead of copying the storage out under the mutex. Every other field
+// is written only under the mutex while the count is zero.
 struct RuntimeBlockRecord {
+  std::atomic<std::uint64_t> retain_state{0};
+  std::uint32_t slot_index = 0;
   int block_handle = 0;
   bool has_pointer_capture_storage = false;
   std::size_t storage_size_bytes = 0;
@@ -383,7 +621,23 @@ struct RuntimeBlockRecord {
   RuntimeBlockInvokeFn invoke = nullptr;
   RuntimeBlockCopyHelperFn copy_helper = nullptr;
   RuntimeBlockDisposeHelperFn dispose_helper = nullptr;
-  std::uint64_t retain_count = 1;
+};
+
+struct RuntimeBlockSlotSegment {
+  std::array<RuntimeBlockRecord, kRuntimeInstanceSlotSegmentSize> records;
+};
+
+struct RuntimeBlockSlab {
+  std::array<std::atomic<RuntimeBlockSlotSegment *>,
+             kRuntimeInstanceSlotSegmentCount>
+      segments{};
+  std::vector<std::unique_ptr<RuntimeBlockSlotSegment>> owned_segments;
+  std::uint32_t slot_count = 0;
+  std::vector<std::uint32_t> free_slots;
+  std::deque<std::uint32_t> quarantined_slots;
+  std::uint64_t live_block_count = 0;
+  std::uint64_t reused_slot_count = 0;
+  std::uint64_t wrapped_slot_count = 0;
 };
 
 constexpr std::size_t kRuntimeBlockPointerCaptureHeaderSlotCount = 3u;
@@ -450,10 +704,58 @@ bool PromotePointerCaptureCellsIntoRuntimeOwnedStorage(RuntimeBlockRecord &recor
   return true;
 }
 
+struct RealizedMethodTableSlot {
+  std::uint64_t selector_stable_id = 0;
+  const EmittedMethodListEntry *entry = nullptr;
+  RuntimeMethodReturnKind return_kind = RuntimeMethodReturnKind::Unsupported;
+  bool ambiguous = false;
+};
+
+// Open-addressed selector-id index over one emitted method list, built when
+// the class is realized so a slow-path miss costs one probe per list instead
+// of a selector-spelling hash per entry. Lists that name a selector the
+// selector table has not interned yet stay unindexed and keep the linear walk.
+struct RealizedMethodTable {
+  const EmittedMethodListRef *method_list_ref = nullptr;
+  bool indexed = false;
+  bool malformed = false;
+  std::vector<RealizedMethodTableSlot> slots;
+};
+
+struct RealizedMethodTables {
+  RealizedMethodTable class_methods;
+  // Parallel to RealizedClassNode::attached_category_records.
+  std::vector<RealizedMethodTable> category_methods;
+};
+
+// One protocol the conformance walk reaches from a class, in visit order.
+struct RealizedConformanceEntry {
+  RuntimeSymbolId protocol_id = kNoRuntimeSymbol;
+  const char *protocol_owner_identity = nullptr;
+  // The adopting category's owner identity; null for class-record adoptions.
+  const char *attachment_owner_identity = nullptr;
+};
+
+// conformance-bitset anchor: a class's protocol closure is walked once, on
+// the first conformance query that reaches it, and kept as a bitset over
+// protocol symbol ids plus the walk order that query snapshots report.
+// Attaching categories or relinking the class's super chain drops it.
+struct RealizedClassConformance {
+  bool built = false;
+  // False when the walk hit malformed protocol metadata; such classes keep
+  // answering through the name walk so its fail-closed results stay exact.
+  bool walkable = false;
+  std::vector<std::uint64_t> protocol_bits;
+  std::vector<RealizedConformanceEntry> closure;
+};
+
 struct RealizedClassNode {
   std::string module_name;
   std::string translation_unit_identity_key;
-  std::string class_name;
+  RuntimeSymbolId class_id = kNoRuntimeSymbol;
+  // The metaclass record carries its own class name pointer; it is interned
+  // separately so metaclass resolutions report exactly what was emitted.
+  RuntimeSymbolId metaclass_record_class_id = kNoRuntimeSymbol;
   std::string bundle_owner_identity;
   std::string interface_owner_identity;
   std::string class_owner_identity;
@@ -473,8 +775,65 @@ struct RealizedClassNode {
   const EmittedClassBundle *bundle = nullptr;
   std::vector<const EmittedCategoryRecord *> attached_category_records;
   std::vector<RealizedPropertyAccessor> runtime_property_accessors;
+  RealizedMethodTables instance_method_tables;
+  RealizedMethodTables class_method_tables;
   std::size_t super_node_index = 0;
   bool has_super_node = false;
+  // Memoized by const queries, hence mutable.
+  mutable RealizedClassConformance conformance;
+};
+
+// One receiver ordinal's binding across every registered image. Images that
+// agree on the class name at an ordinal share the binding; a disagreement
+// leaves it ambiguous for the rest of the process lifetime, as before.
+struct RealizedReceiverBinding {
+  RuntimeSymbolId class_id = kNoRuntimeSymbol;
+  std::size_t first_node_index = 0;
+  bool bound = false;
+  bool ambiguous = false;
+  bool has_node = false;
+  // Slow-path cache entries tagged below this generation are stale; a
+  // registration that touches the ordinal retires them all by raising it.
+  std::uint64_t method_cache_retired_generation = 0;
+  // Current slow-path entries decoded to this ordinal.
+  std::uint64_t method_cache_entry_count = 0;
+};
+
+// Cache entries retained across registrations point into node-owned accessor
+// storage, so appending nodes must move them rather than copy them.
+static_assert(std::is_nothrow_move_constructible<RealizedClassNode>::value,
+              "realized class nodes must relocate without copying accessors");
+
+// dispatch-trace-ring anchor: OBJC3_RUNTIME_DISPATCH_TRACE=1 opts a process
+// into full trace-ring retention from startup; testing probes can also toggle
+// the mode through the private trace surface.
+bool DispatchTraceRequestedByEnvironment() {
+  const char *value = std::getenv("OBJC3_RUNTIME_DISPATCH_TRACE");
+  return value != nullptr && value[0] != '\0' && std::strcmp(value, "0") != 0;
+}
+
+// dispatch-profile anchor: OBJC3_RUNTIME_DISPATCH_PROFILE=<n> samples every
+// nth send on each thread from startup; 0 or unset leaves the profiler off.
+std::uint64_t DispatchProfilePeriodFromEnvironment() {
+  const char *value = std::getenv("OBJC3_RUNTIME_DISPATCH_PROFILE");
+  if (value == nullptr || value[0] == '\0') {
+    return 0;
+  }
+  return static_cast<std::uint64_t>(std::strtoull(value, nullptr, 10));
+}
+
+// lock-free-dispatch-cache anchor: cache-hit statistics are only bumped in the
+// calling thread's metrics block. Each method-cache statistics window records
+// their process totals when it opens, and testing snapshots add the growth
+// since then to the fill counts kept under the mutex, so a hit never writes a
+// cache line another thread reads.
+struct RuntimeDispatchSiteBinding;
+
+struct RuntimeHitStatistics {
+  std::uint64_t live_hit_count = 0;
+  std::uint64_t fallback_hit_count = 0;
+  std::uint64_t fast_path_hit_count = 0;
+  std::uint64_t site_cache_hit_count = 0;
 };
 
 struct RuntimeState {
@@ -498,15 +857,36 @@ struct RuntimeState {
       retained_bootstrap_metadata_by_identity_key;
   std::unordered_map<std::string, std::size_t> selector_index_by_name;
   std::deque<SelectorSlot> selector_slots;
+  // class-symbol-table anchor: class and property names are interned once,
+  // when an image is realized, and every later cross-reference (receiver
+  // bindings, node lookup, category attachment, resolved method-cache
+  // entries, the property lookup cache) carries the 32-bit id instead of a
+  // string. The deque keeps each name's storage put, so the map's views stay
+  // valid; both are dropped only with the realized class graph on reset.
+  std::deque<std::string> symbol_names;
+  std::unordered_map<std::string_view, RuntimeSymbolId> symbol_id_by_name;
   std::unordered_map<std::uint64_t, KeyPathSlot> keypath_slots;
+  // Chains point into keypath_slots and node-owned accessor storage, so any
+  // class realization or reset drops them all.
+  std::unordered_map<KeyPathChainKey, KeyPathChain, KeyPathChainKeyHash>
+      keypath_chain_cache;
   std::unordered_map<PropertyLookupCacheKey, PropertyLookupCacheEntry,
                      PropertyLookupCacheKeyHash>
       property_lookup_cache;
   std::uint64_t metadata_backed_selector_count = 0;
   std::uint64_t dynamic_selector_count = 0;
+  // Advanced whenever selector slots are discarded, so emitted selector
+  // references bound to an older table rebind instead of reusing a dangling
+  // handle.
+  std::atomic<std::uint64_t> selector_table_generation{1};
+  std::uint64_t selector_spelling_lookup_count = 0;
+  std::uint64_t bound_selector_reference_count = 0;
   std::uint64_t metadata_provider_edge_count = 0;
   std::uint64_t image_backed_keypath_count = 0;
   std::uint64_t ambiguous_keypath_handle_count = 0;
+  std::uint64_t keypath_chain_build_count = 0;
+  std::uint64_t keypath_chain_hit_count = 0;
+  std::uint64_t keypath_chain_step_miss_count = 0;
   std::string last_materialized_selector;
   std::uint64_t last_materialized_stable_id = 0;
   std::uint64_t last_materialized_registration_order_ordinal = 0;
@@ -519,36 +899,63 @@ struct RuntimeState {
   bool last_keypath_query_found = false;
   bool last_keypath_query_ambiguous = false;
   std::string last_resolved_keypath_profile;
-  std::unordered_map<MethodCacheKey, MethodCacheEntry, MethodCacheKeyHash>
+  // Entries are shared so a thread hit slot or call-site binding keeps the
+  // entry it adopted alive after a refill or eviction drops it from here.
+  std::unordered_map<MethodCacheKey, std::shared_ptr<MethodCacheEntry>,
+                     MethodCacheKeyHash>
       method_cache;
-  std::uint64_t method_cache_hit_count = 0;
+  // Live and fallback counts here cover fills under the mutex; hits come
+  // from the per-thread totals past hit_statistics_window_base.
   std::uint64_t method_cache_miss_count = 0;
   std::uint64_t slow_path_lookup_count = 0;
   std::uint64_t live_dispatch_count = 0;
   std::uint64_t fallback_dispatch_count = 0;
   std::uint64_t fast_path_seed_count = 0;
-  std::uint64_t fast_path_hit_count = 0;
-  std::string last_dispatch_selector;
-  std::uint64_t last_dispatch_selector_stable_id = 0;
-  std::uint64_t last_dispatch_normalized_receiver_identity = 0;
-  std::uint64_t last_category_probe_count = 0;
-  std::uint64_t last_protocol_probe_count = 0;
-  bool last_dispatch_used_cache = false;
-  bool last_dispatch_used_fast_path = false;
-  bool last_dispatch_resolved_live_method = false;
-  bool last_dispatch_fell_back = false;
-  bool last_dispatch_effective_direct_dispatch = false;
-  bool last_dispatch_used_builtin = false;
-  std::string last_fast_path_reason;
-  std::string last_dispatch_path;
-  std::string last_dispatch_implementation_kind;
-  std::string last_dispatch_property_name;
-  std::string last_resolved_class_name;
-  std::string last_resolved_owner_identity;
-  std::uint64_t last_dispatch_parameter_count = 0;
-  std::uint64_t last_dispatch_property_base_identity = 0;
-  std::uint64_t last_dispatch_property_slot_index = 0;
+  RuntimeHitStatistics hit_statistics_window_base;
+  // Advanced under the mutex whenever a published cache binding may go stale:
+  // method-cache flushes, an instance slot wrapping its generations, and
+  // live-state reset.
+  std::atomic<std::uint64_t> dispatch_cache_epoch{1};
+  // Advanced only when cached entries and selector slots are discarded, so
+  // dispatch trace events can tell whether their cache key still resolves.
+  std::uint64_t method_cache_generation = 1;
+  std::atomic<bool> dispatch_trace_enabled{
+      DispatchTraceRequestedByEnvironment()};
+  // Sends between dispatch-profile samples on each thread; 0 is off. Every
+  // period change advances the generation, which tells each thread to clear
+  // its profile table before its next sample.
+  std::atomic<std::uint64_t> dispatch_profile_period{
+      DispatchProfilePeriodFromEnvironment()};
+  std::atomic<std::uint64_t> dispatch_profile_generation{1};
+  // Emitted call-site cache cells keep their bound index for the life of the
+  // image, so the site count survives resets; only the hit/miss counters clear.
+  // Bindings the cells point at, one per bound site, are owned here and
+  // dropped by a testing reset.
+  std::uint64_t bound_dispatch_site_count = 0;
+  std::uint64_t dispatch_site_cache_miss_count = 0;
+  std::vector<objc3_runtime_dispatch_site_cache *> bound_dispatch_sites;
+  std::vector<std::unique_ptr<RuntimeDispatchSiteBinding>>
+      dispatch_site_bindings;
+  std::uint64_t megamorphic_dispatch_site_count = 0;
+  // Emitted sealed dispatch tables whose entries are currently bound. Every
+  // method-cache statistics window retires them, so a registration that may
+  // change a sealed class's resolution forces the next send to rebind.
+  std::vector<objc3_runtime_sealed_dispatch_table *>
+      bound_sealed_dispatch_tables;
+  std::uint64_t bound_sealed_dispatch_slot_count = 0;
+  std::uint64_t sealed_dispatch_table_bind_count = 0;
+  std::uint64_t sealed_dispatch_table_unbind_count = 0;
+  std::atomic<std::uint64_t> sealed_dispatch_table_miss_count{0};
   const objc3_runtime_registration_table *staged_registration_table = nullptr;
+  const std::uint32_t *staged_prebuilt_image_words = nullptr;
+  std::uint64_t staged_prebuilt_image_byte_count = 0;
+  AdoptedSelectorTable adopted_selector_table;
+  std::uint64_t prebuilt_image_adopted_count = 0;
+  std::uint64_t prebuilt_image_fallback_count = 0;
+  std::uint64_t prebuilt_image_adopted_selector_count = 0;
+  std::uint64_t prebuilt_class_ordinal_image_count = 0;
+  std::uint64_t last_prebuilt_image_byte_count = 0;
+  int last_prebuilt_image_status = 0;
   std::uint64_t walked_image_count = 0;
   std::uint64_t last_discovery_root_entry_count = 0;
   std::uint64_t last_walked_class_descriptor_count = 0;
@@ -570,17 +977,52 @@ struct RuntimeState {
   int last_replay_status = OBJC3_RUNTIME_REGISTRATION_STATUS_OK;
   std::string last_replayed_module_name;
   std::string last_replayed_translation_unit_identity_key;
-  std::unordered_map<std::uint64_t, std::string>
-      realized_class_name_by_base_identity;
-  std::unordered_set<std::uint64_t> ambiguous_realized_base_identities;
-  std::unordered_map<std::string, std::vector<std::size_t>>
-      realized_class_node_indices_by_name;
+  // Indexed by receiver ordinal, so decoding a class or instance receiver to
+  // its realized node is arithmetic plus two array loads.
+  std::vector<RealizedReceiverBinding> realized_receiver_bindings;
+  // Indexed by class symbol id.
+  std::vector<std::vector<std::size_t>> realized_class_node_indices_by_class_id;
   std::vector<RealizedClassNode> realized_class_nodes;
+  // Kept across registrations so a new image links its super edges against
+  // earlier images, and earlier nodes waiting on a later image's bundle link
+  // once that image arrives, without rebuilding the graph.
+  std::unordered_map<const EmittedClassBundle *, std::size_t>
+      realized_class_node_index_by_bundle;
+  std::unordered_map<const EmittedClassBundle *, std::vector<std::size_t>>
+      pending_super_node_indices_by_bundle;
+  // Slow-path fills are tagged with this generation; a new image raises it
+  // and retires only the receiver bindings it may have changed.
+  std::uint64_t method_cache_class_generation = 0;
+  // Current slow-path entry counts for static receivers whose ordinal has no
+  // binding yet; folded into the binding once an image reaches the ordinal.
+  std::unordered_map<std::uint64_t, std::uint64_t>
+      unbound_method_cache_entry_counts;
+  MethodCacheClockRing resolved_method_cache_ring{
+      {}, 0, 0, kMethodCacheResolvedCapacity};
+  MethodCacheClockRing negative_method_cache_ring{
+      {}, 0, 0, kMethodCacheNegativeCapacity};
+  // Retired entries still occupying a ring slot until the hand or a repeat
+  // lookup reclaims them.
+  std::uint64_t stale_method_cache_entry_count = 0;
+  std::uint64_t method_cache_eviction_count = 0;
+  std::uint64_t negative_method_cache_eviction_count = 0;
+  std::uint64_t stale_method_cache_reclaim_count = 0;
+  std::uint64_t last_registration_realized_class_count = 0;
+  std::uint64_t last_registration_invalidated_cache_entry_count = 0;
+  std::uint64_t full_class_graph_invalidation_count = 0;
+  std::uint64_t conformance_bitset_build_count = 0;
+  std::uint64_t conformance_bitset_test_count = 0;
   std::uint64_t realized_root_class_count = 0;
   std::uint64_t realized_metaclass_edge_count = 0;
   std::uint64_t receiver_class_binding_count = 0;
   std::uint64_t realized_attached_category_count = 0;
   std::uint64_t realized_protocol_conformance_edge_count = 0;
+  std::uint64_t indexed_method_list_count = 0;
+  std::uint64_t indexed_method_entry_count = 0;
+  std::uint64_t unindexed_method_list_count = 0;
+  std::uint64_t method_table_slot_count = 0;
+  std::uint64_t method_table_probe_count = 0;
+  std::uint64_t method_list_scan_count = 0;
   std::string last_realized_class_name;
   std::string last_realized_class_owner_identity;
   std::string last_realized_metaclass_owner_identity;
@@ -597,17 +1039,21 @@ struct RuntimeState {
   bool last_protocol_query_class_found = false;
   bool last_protocol_query_protocol_found = false;
   bool last_protocol_query_conforms = false;
-  std::unordered_map<int, RuntimeInstanceRecord> runtime_instances_by_receiver;
-  std::unordered_map<int, RuntimeBlockRecord> runtime_blocks_by_handle;
-  std::unordered_map<int, std::vector<RuntimeWeakSlotRef>>
-      weak_slot_refs_by_target_receiver;
-  int next_runtime_instance_receiver = 0x100000;
-  int next_runtime_block_handle = 0x200000;
+  RuntimeInstanceSlab runtime_instance_slab;
+  RuntimeBlockSlab runtime_block_slab;
+  RuntimeWeakSideTable weak_side_table;
   std::uint64_t live_runtime_instance_count = 0;
   std::uint64_t last_allocated_runtime_instance_receiver = 0;
   std::uint64_t last_allocated_runtime_instance_base_identity = 0;
   std::uint64_t last_allocated_runtime_instance_size_bytes = 0;
-  std::string last_allocated_runtime_instance_class_name;
+  // Final releases push the values their strong ivars held onto this worklist
+  // instead of recursing, so a long ownership chain tears down in flat stack.
+  std::vector<int> pending_releases;
+  std::uint64_t release_batch_count = 0;
+  std::uint64_t batched_release_value_count = 0;
+  std::uint64_t coalesced_release_value_count = 0;
+  std::uint64_t cascade_release_count = 0;
+  std::uint64_t max_pending_release_count = 0;
   std::string last_queried_property_class_name;
   std::string last_queried_property_name;
   std::string last_reflected_property_class_name;
@@ -617,38 +1063,180 @@ struct RuntimeState {
   bool last_property_query_used_cache = false;
   std::uint64_t property_lookup_cache_hit_count = 0;
   std::uint64_t property_lookup_cache_miss_count = 0;
+  std::atomic<std::uint64_t> direct_property_get_count{0};
+  std::atomic<std::uint64_t> direct_property_set_count{0};
 };
 
+// Leaked like the task executor: detached tasks may still be running on pool
+// workers while static destructors run at exit.
 RuntimeState &State() {
-  static RuntimeState state;
-  return state;
+  static RuntimeState *state = new RuntimeState();
+  return *state;
+}
+
+RuntimeSymbolId FindRuntimeSymbolUnlocked(const RuntimeState &state,
+                                          const char *name) {
+  if (name == nullptr || name[0] == '\0') {
+    return kNoRuntimeSymbol;
+  }
+  const auto found = state.symbol_id_by_name.find(std::string_view(name));
+  return found != state.symbol_id_by_name.end() ? found->second
+                                                : kNoRuntimeSymbol;
+}
+
+RuntimeSymbolId InternRuntimeSymbolUnlocked(RuntimeState &state,
+                                            const char *name) {
+  if (name == nullptr || name[0] == '\0') {
+    return kNoRuntimeSymbol;
+  }
+  const auto found = state.symbol_id_by_name.find(std::string_view(name));
+  if (found != state.symbol_id_by_name.end()) {
+    return found->second;
+  }
+  state.symbol_names.emplace_back(name);
+  const auto symbol_id = static_cast<RuntimeSymbolId>(state.symbol_names.size());
+  state.symbol_id_by_name.emplace(state.symbol_names.back(), symbol_id);
+  return symbol_id;
+}
+
+const std::string &RuntimeSymbolName(const RuntimeState &state,
+                                     RuntimeSymbolId symbol_id) {
+  static const std::string kEmpty;
+  return symbol_id != kNoRuntimeSymbol && symbol_id <= state.symbol_names.size()
+             ? state.symbol_names[symbol_id - 1u]
+             : kEmpty;
+}
+
+// Seeded FNV-1a and displaced slot of the prebuilt image's selector hash;
+// both must match the emitter's PrebuiltImageSelectorHash/Slot.
+std::uint64_t PrebuiltImageSelectorHash(const char *selector,
+                                        std::uint32_t seed) {
+  std::uint64_t hash = 14695981039346656037ull ^ seed;
+  for (const unsigned char *cursor =
+           reinterpret_cast<const unsigned char *>(selector);
+       *cursor != 0U; ++cursor) {
+    hash ^= *cursor;
+    hash *= 1099511628211ull;
+  }
+  return hash;
+}
+
+std::uint32_t PrebuiltImageSelectorBucket(const AdoptedSelectorTable &table,
+                                          std::uint64_t hash) {
+  const std::uint32_t high = static_cast<std::uint32_t>(hash >> 32);
+  const std::uint32_t displacement =
+      table.group_displacements[high & table.group_mask];
+  return (static_cast<std::uint32_t>(hash) + displacement * (high | 1u)) &
+         table.bucket_mask;
+}
+
+constexpr std::size_t kNoSelectorSlot = static_cast<std::size_t>(-1);
+
+// Index of `selector` in selector_slots, or kNoSelectorSlot. Adopted
+// selectors live only in the adopted table; everything materialized after
+// adoption lives only in the name map.
+std::size_t FindSelectorSlotIndexUnlocked(const RuntimeState &state,
+                                          const char *selector) {
+  const AdoptedSelectorTable &adopted = state.adopted_selector_table;
+  if (adopted.selector_count != 0) {
+    const std::uint32_t entry = adopted.buckets[PrebuiltImageSelectorBucket(
+        adopted, PrebuiltImageSelectorHash(selector, adopted.hash_seed))];
+    if (entry != 0u) {
+      const char *candidate = state.selector_slots[entry - 1u].handle.selector;
+      if (candidate == selector || std::strcmp(candidate, selector) == 0) {
+        return entry - 1u;
+      }
+    }
+  }
+  const auto found = state.selector_index_by_name.find(selector);
+  return found == state.selector_index_by_name.end() ? kNoSelectorSlot
+                                                     : found->second;
 }
 
 const objc3_runtime_selector_handle *LookupSelectorUnlocked(const char *selector);
+const char *StableCString(const std::string &text);
+void ReleaseRuntimeValueBatchUnlocked(RuntimeState &state,
+                                      std::vector<int> &values);
+
+// Autoreleased values live on a thread-local stack of 4KB pages, as in the
+// classic objc runtime. A pool push writes a zero boundary entry and a pool
+// pop drains back to it; a dispatch frame records its mark and, on pop,
+// releases the entries it owns in one forward walk from that mark.
+struct RuntimeAutoreleaseEntry {
+  int value = 0;
+  // 0 for pool-owned values and pool boundaries, otherwise the 1-based
+  // dispatch-frame depth that releases the value when it pops.
+  std::uint32_t owner = 0;
+};
+
+constexpr std::uint32_t kRuntimeAutoreleasePoolOwner = 0;
+constexpr std::size_t kRuntimeAutoreleasePageBytes = 4096;
+// Empty pages kept linked above the top after a pop, so pools that repeatedly
+// cross the same page edges reuse pages instead of reallocating them.
+constexpr std::size_t kRuntimeAutoreleaseSparePageLimit = 4;
+
+struct RuntimeAutoreleasePage {
+  static constexpr std::size_t kEntryCapacity =
+      (kRuntimeAutoreleasePageBytes - 3u * sizeof(void *)) /
+      sizeof(RuntimeAutoreleaseEntry);
+
+  RuntimeAutoreleasePage *parent = nullptr;
+  RuntimeAutoreleasePage *child = nullptr;
+  std::size_t used = 0;
+  RuntimeAutoreleaseEntry entries[kEntryCapacity];
+};
+
+static_assert(sizeof(RuntimeAutoreleasePage) <= kRuntimeAutoreleasePageBytes,
+              "autorelease pages must fit one 4KB page");
+
+struct RuntimeAutoreleaseMark {
+  RuntimeAutoreleasePage *page = nullptr;
+  std::size_t index = 0;
+  std::uint64_t position = 0;
+};
+
+struct RuntimeAutoreleasePageStack {
+  RuntimeAutoreleasePage *first = nullptr;
+  // Page holding the top entry. Pages below it are full; up to
+  // kRuntimeAutoreleaseSparePageLimit empty pages stay linked above it.
+  RuntimeAutoreleasePage *hot = nullptr;
+  std::uint64_t position = 0;
+  std::uint64_t high_water_position = 0;
+  std::uint64_t pool_depth = 0;
+  std::uint64_t queued_pool_value_count = 0;
+  std::uint64_t allocated_page_count = 0;
+  std::uint64_t page_allocation_count = 0;
+
+  RuntimeAutoreleasePageStack() = default;
+  RuntimeAutoreleasePageStack(const RuntimeAutoreleasePageStack &) = delete;
+  RuntimeAutoreleasePageStack &operator=(const RuntimeAutoreleasePageStack &) =
+      delete;
+  ~RuntimeAutoreleasePageStack() {
+    RuntimeAutoreleasePage *page = first;
+    while (page != nullptr) {
+      RuntimeAutoreleasePage *child = page->child;
+      delete page;
+      page = child;
+    }
+  }
+};
 
 struct RuntimeDispatchFrame {
   int receiver = 0;
   std::uint64_t base_identity = 0;
   const RealizedPropertyAccessor *runtime_property_accessor = nullptr;
-  std::vector<int> autorelease_values;
-};
-
-struct RuntimeAutoreleasePoolFrame {
-  std::vector<int> values;
+  RuntimeAutoreleaseMark autorelease_mark;
 };
 
 thread_local std::vector<RuntimeDispatchFrame> g_runtime_dispatch_frames;
 thread_local RuntimeDispatchFrame g_runtime_testing_dispatch_frame;
 thread_local bool g_runtime_has_testing_dispatch_frame = false;
-thread_local std::vector<RuntimeAutoreleasePoolFrame>
-    g_runtime_autoreleasepool_frames;
+thread_local RuntimeAutoreleasePageStack g_runtime_autorelease_pages;
+// Values a pool or frame pop drained, released together once the page stack
+// is truncated.
+thread_local std::vector<int> g_runtime_autorelease_drain_batch;
 thread_local std::uint64_t g_runtime_autoreleasepool_max_depth = 0;
 thread_local std::uint64_t g_runtime_autoreleasepool_drained_value_count = 0;
-thread_local std::uint64_t g_runtime_arc_debug_retain_call_count = 0;
-thread_local std::uint64_t g_runtime_arc_debug_release_call_count = 0;
-thread_local std::uint64_t g_runtime_arc_debug_autorelease_call_count = 0;
-thread_local std::uint64_t g_runtime_arc_debug_autoreleasepool_push_count = 0;
-thread_local std::uint64_t g_runtime_arc_debug_autoreleasepool_pop_count = 0;
 thread_local std::uint64_t g_runtime_arc_debug_current_property_read_count = 0;
 thread_local std::uint64_t g_runtime_arc_debug_current_property_write_count = 0;
 thread_local std::uint64_t g_runtime_arc_debug_current_property_exchange_count = 0;
@@ -668,8 +1256,6 @@ thread_local int g_runtime_arc_debug_last_weak_stored_value = 0;
 thread_local int g_runtime_arc_debug_last_property_receiver = 0;
 thread_local std::string g_runtime_arc_debug_last_property_name;
 thread_local std::string g_runtime_arc_debug_last_property_owner_identity;
-thread_local std::uint64_t g_runtime_block_promote_call_count = 0;
-thread_local std::uint64_t g_runtime_block_invoke_call_count = 0;
 thread_local int g_runtime_last_promoted_block_handle = 0;
 thread_local int g_runtime_last_promote_has_pointer_capture_storage = 0;
 thread_local int g_runtime_last_invoked_block_handle = 0;
@@ -689,19 +1275,6 @@ thread_local int g_runtime_error_bridge_last_catch_match_kind = 0;
 thread_local int g_runtime_error_bridge_last_catch_match_is_catch_all = 0;
 thread_local int g_runtime_error_bridge_last_catch_match_result = 0;
 thread_local std::string g_runtime_error_bridge_last_catch_kind_name;
-thread_local std::uint64_t g_runtime_async_continuation_allocation_call_count = 0;
-thread_local std::uint64_t g_runtime_async_continuation_handoff_call_count = 0;
-thread_local std::uint64_t g_runtime_async_continuation_resume_call_count = 0;
-thread_local int g_runtime_async_continuation_next_handle = 1;
-thread_local int g_runtime_async_continuation_last_allocated_handle = 0;
-thread_local int g_runtime_async_continuation_last_allocated_resume_entry_tag = 0;
-thread_local int g_runtime_async_continuation_last_allocated_executor_tag = 0;
-thread_local int g_runtime_async_continuation_last_handoff_handle = 0;
-thread_local int g_runtime_async_continuation_last_handoff_executor_tag = 0;
-thread_local int g_runtime_async_continuation_last_resume_handle = 0;
-thread_local int g_runtime_async_continuation_last_resume_result_value = 0;
-thread_local int g_runtime_async_continuation_last_resume_return_value = 0;
-thread_local std::unordered_set<int> g_runtime_async_live_continuation_handles;
 thread_local std::uint64_t g_runtime_task_spawn_call_count = 0;
 thread_local std::uint64_t g_runtime_task_scope_call_count = 0;
 thread_local std::uint64_t g_runtime_task_add_task_call_count = 0;
@@ -730,6 +1303,9 @@ thread_local int g_runtime_task_last_executor_hop_executor_tag = 0;
 thread_local int g_runtime_task_last_executor_hop_value = 0;
 thread_local int g_runtime_task_last_wait_next_result = 0;
 thread_local int g_runtime_task_last_cancel_all_result = 0;
+// Task group opened by block-bodied lowered task helpers called outside any
+// async frame; frames keep their own.
+thread_local int g_runtime_lowered_task_group_handle = 0;
 thread_local int g_runtime_task_last_cancellation_poll_result = 0;
 thread_local int g_runtime_actor_last_isolation_executor_tag = 0;
 thread_local int g_runtime_actor_last_nonisolated_value = 0;
@@ -746,63 +1322,621 @@ thread_local int g_runtime_actor_last_mailbox_enqueued_value = 0;
 thread_local int g_runtime_actor_last_mailbox_executor_tag = 0;
 thread_local int g_runtime_actor_last_mailbox_depth = 0;
 thread_local int g_runtime_actor_last_mailbox_drained_value = 0;
-thread_local std::unordered_map<int, std::deque<int>> g_runtime_actor_mailboxes;
+
+// runtime-metrics anchor: process-wide hot-path counters live in one
+// cache-line-aligned block per thread. Only the owning thread writes its
+// block, with a relaxed load and store rather than a locked increment, and
+// `objc3_runtime_copy_metrics` sums every block ever handed out. A block
+// outlives its thread and goes back on a free list with its counts intact,
+// so totals never drop and the list stays as long as the peak thread count.
+enum class RuntimeMetric : std::size_t {
+  DispatchSend,
+  DispatchCacheHit,
+  DispatchSiteCacheHit,
+  DispatchLockedResolve,
+  SlowPathLookup,
+  FallbackDispatch,
+  NilDispatch,
+  SealedTableMiss,
+  Retain,
+  Release,
+  Autorelease,
+  AutoreleasePoolPush,
+  AutoreleasePoolPop,
+  InstanceAlloc,
+  InstanceDealloc,
+  BlockPromote,
+  BlockInvoke,
+  // Method-cache hits by kind, read back through RuntimeHitStatistics.
+  MethodCacheLiveHit,
+  MethodCacheFallbackHit,
+  FastPathHit,
+  Count,
+};
+
+constexpr std::size_t kRuntimeMetricCount =
+    static_cast<std::size_t>(RuntimeMetric::Count);
+constexpr std::size_t kRuntimeMetricsBlockAlignment = 64;
+
+struct RuntimeDispatchProfileTable;
+
+struct alignas(kRuntimeMetricsBlockAlignment) RuntimeMetricsBlock {
+  std::array<std::atomic<std::uint64_t>, kRuntimeMetricCount> counters{};
+  // Allocated by the owning thread on its first profiled send and kept with
+  // the block, so a recycled block carries its samples to the next thread.
+  std::atomic<RuntimeDispatchProfileTable *> dispatch_profile{nullptr};
+  RuntimeMetricsBlock *next = nullptr;
+  RuntimeMetricsBlock *next_free = nullptr;
+};
+
+struct RuntimeMetricsRegistry {
+  std::mutex mutex;
+  RuntimeMetricsBlock *blocks = nullptr;
+  RuntimeMetricsBlock *free_blocks = nullptr;
+  std::uint64_t block_count = 0;
+  std::uint64_t active_block_count = 0;
+  std::once_flag dump_started;
+  std::mutex dump_mutex;
+  std::string dump_path;
+  std::uint64_t dump_interval_ms = 1000;
+  std::uint64_t dump_count = 0;
+  std::chrono::steady_clock::time_point started_at =
+      std::chrono::steady_clock::now();
+};
+
+// Leaked, like the task executor, so exiting threads and the dump thread
+// never observe it being destroyed.
+RuntimeMetricsRegistry &MetricsRegistry() {
+  static RuntimeMetricsRegistry *registry = new RuntimeMetricsRegistry();
+  return *registry;
+}
+
+thread_local RuntimeMetricsBlock *g_runtime_metrics_block = nullptr;
+// Set once the thread has handed its block back at exit; counters bumped by
+// later thread_local destructors on that thread are dropped.
+thread_local bool g_runtime_metrics_block_released = false;
+// Counter values of this thread's block at its last reset; see
+// RuntimeMetricSinceThreadReset.
+thread_local std::array<std::uint64_t, kRuntimeMetricCount>
+    g_runtime_metrics_thread_baseline{};
+
+void ReleaseRuntimeMetricsBlock(RuntimeMetricsBlock *block) {
+  RuntimeMetricsRegistry &registry = MetricsRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  block->next_free = registry.free_blocks;
+  registry.free_blocks = block;
+  --registry.active_block_count;
+}
+
+// Hands the block back when its thread exits. Kept apart from the block
+// pointer so the increment path reads a plain thread_local with no guard.
+struct RuntimeMetricsThreadRelease {
+  RuntimeMetricsBlock *block = nullptr;
+  ~RuntimeMetricsThreadRelease() {
+    if (block != nullptr) {
+      g_runtime_metrics_block = nullptr;
+      g_runtime_metrics_block_released = true;
+      ReleaseRuntimeMetricsBlock(block);
+    }
+  }
+};
+
+void EnsureRuntimeMetricsDump(RuntimeMetricsRegistry &registry);
+void ResetRuntimeMetricsThreadBaseline();
+
+RuntimeMetricsBlock *AcquireRuntimeMetricsBlock() {
+  if (g_runtime_metrics_block_released) {
+    return nullptr;
+  }
+  RuntimeMetricsRegistry &registry = MetricsRegistry();
+  EnsureRuntimeMetricsDump(registry);
+  RuntimeMetricsBlock *block = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    block = registry.free_blocks;
+    if (block != nullptr) {
+      registry.free_blocks = block->next_free;
+      block->next_free = nullptr;
+    } else {
+      block = new RuntimeMetricsBlock();
+      block->next = registry.blocks;
+      registry.blocks = block;
+      ++registry.block_count;
+    }
+    ++registry.active_block_count;
+  }
+  static thread_local RuntimeMetricsThreadRelease release;
+  release.block = block;
+  g_runtime_metrics_block = block;
+  // A recycled block arrives with an exited thread's counts.
+  ResetRuntimeMetricsThreadBaseline();
+  return block;
+}
+
+inline void BumpRuntimeMetric(RuntimeMetric metric) {
+  RuntimeMetricsBlock *block = g_runtime_metrics_block;
+  if (block == nullptr && (block = AcquireRuntimeMetricsBlock()) == nullptr) {
+    return;
+  }
+  std::atomic<std::uint64_t> &counter =
+      block->counters[static_cast<std::size_t>(metric)];
+  counter.store(counter.load(std::memory_order_relaxed) + 1u,
+                std::memory_order_relaxed);
+}
+
+// The per-thread call counts in the testing snapshots are this thread's block
+// counters less a baseline taken at the last reset, so the hot paths bump one
+// counter rather than a metric and a separate thread_local.
+std::uint64_t RuntimeMetricSinceThreadReset(RuntimeMetric metric) {
+  const RuntimeMetricsBlock *block = g_runtime_metrics_block;
+  if (block == nullptr) {
+    return 0;
+  }
+  const std::size_t index = static_cast<std::size_t>(metric);
+  return block->counters[index].load(std::memory_order_relaxed) -
+         g_runtime_metrics_thread_baseline[index];
+}
+
+void ResetRuntimeMetricsThreadBaseline() {
+  const RuntimeMetricsBlock *block = g_runtime_metrics_block;
+  for (std::size_t index = 0; index < kRuntimeMetricCount; ++index) {
+    g_runtime_metrics_thread_baseline[index] =
+        block != nullptr ? block->counters[index].load(std::memory_order_relaxed)
+                         : 0u;
+  }
+}
+
+void SumRuntimeMetricsUnlocked(
+    const RuntimeMetricsRegistry &registry,
+    std::array<std::uint64_t, kRuntimeMetricCount> &totals) {
+  totals.fill(0);
+  for (const RuntimeMetricsBlock *block = registry.blocks; block != nullptr;
+       block = block->next) {
+    for (std::size_t index = 0; index < kRuntimeMetricCount; ++index) {
+      totals[index] += block->counters[index].load(std::memory_order_relaxed);
+    }
+  }
+}
+
+RuntimeHitStatistics SumRuntimeHitStatistics() {
+  RuntimeMetricsRegistry &registry = MetricsRegistry();
+  std::array<std::uint64_t, kRuntimeMetricCount> totals{};
+  {
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    SumRuntimeMetricsUnlocked(registry, totals);
+  }
+  const auto total = [&totals](RuntimeMetric metric) {
+    return totals[static_cast<std::size_t>(metric)];
+  };
+  RuntimeHitStatistics statistics;
+  statistics.live_hit_count = total(RuntimeMetric::MethodCacheLiveHit);
+  statistics.fallback_hit_count = total(RuntimeMetric::MethodCacheFallbackHit);
+  statistics.fast_path_hit_count = total(RuntimeMetric::FastPathHit);
+  statistics.site_cache_hit_count = total(RuntimeMetric::DispatchSiteCacheHit);
+  return statistics;
+}
+
+// Hits since the current method-cache statistics window opened.
+RuntimeHitStatistics RuntimeHitStatisticsSinceWindowUnlocked(
+    const RuntimeState &state) {
+  const RuntimeHitStatistics totals = SumRuntimeHitStatistics();
+  const RuntimeHitStatistics &base = state.hit_statistics_window_base;
+  RuntimeHitStatistics statistics;
+  statistics.live_hit_count = totals.live_hit_count - base.live_hit_count;
+  statistics.fallback_hit_count =
+      totals.fallback_hit_count - base.fallback_hit_count;
+  statistics.fast_path_hit_count =
+      totals.fast_path_hit_count - base.fast_path_hit_count;
+  statistics.site_cache_hit_count =
+      totals.site_cache_hit_count - base.site_cache_hit_count;
+  return statistics;
+}
+
+void FillRuntimeMetricsSnapshot(
+    const std::array<std::uint64_t, kRuntimeMetricCount> &totals,
+    std::uint64_t block_count, std::uint64_t active_block_count,
+    objc3_runtime_metrics_snapshot &snapshot) {
+  const auto total = [&totals](RuntimeMetric metric) {
+    return totals[static_cast<std::size_t>(metric)];
+  };
+  snapshot.thread_block_count = block_count;
+  snapshot.active_thread_block_count = active_block_count;
+  snapshot.dispatch_count = total(RuntimeMetric::DispatchSend);
+  snapshot.dispatch_cache_hit_count = total(RuntimeMetric::DispatchCacheHit);
+  snapshot.dispatch_site_cache_hit_count =
+      total(RuntimeMetric::DispatchSiteCacheHit);
+  snapshot.dispatch_locked_resolve_count =
+      total(RuntimeMetric::DispatchLockedResolve);
+  snapshot.slow_path_lookup_count = total(RuntimeMetric::SlowPathLookup);
+  snapshot.fallback_dispatch_count = total(RuntimeMetric::FallbackDispatch);
+  snapshot.nil_dispatch_count = total(RuntimeMetric::NilDispatch);
+  snapshot.sealed_table_miss_count = total(RuntimeMetric::SealedTableMiss);
+  snapshot.retain_count = total(RuntimeMetric::Retain);
+  snapshot.release_count = total(RuntimeMetric::Release);
+  snapshot.autorelease_count = total(RuntimeMetric::Autorelease);
+  snapshot.autoreleasepool_push_count =
+      total(RuntimeMetric::AutoreleasePoolPush);
+  snapshot.autoreleasepool_pop_count = total(RuntimeMetric::AutoreleasePoolPop);
+  snapshot.instance_alloc_count = total(RuntimeMetric::InstanceAlloc);
+  snapshot.instance_dealloc_count = total(RuntimeMetric::InstanceDealloc);
+  snapshot.block_promote_count = total(RuntimeMetric::BlockPromote);
+  snapshot.block_invoke_count = total(RuntimeMetric::BlockInvoke);
+}
+
+void CopyRuntimeMetrics(objc3_runtime_metrics_snapshot &snapshot) {
+  RuntimeMetricsRegistry &registry = MetricsRegistry();
+  std::array<std::uint64_t, kRuntimeMetricCount> totals{};
+  std::uint64_t block_count = 0;
+  std::uint64_t active_block_count = 0;
+  {
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    SumRuntimeMetricsUnlocked(registry, totals);
+    block_count = registry.block_count;
+    active_block_count = registry.active_block_count;
+  }
+  FillRuntimeMetricsSnapshot(totals, block_count, active_block_count,
+                             snapshot);
+}
+
+// Writes the current totals as one JSON object, replacing the previous dump
+// through a rename so a reader never sees a partial file.
+void WriteRuntimeMetricsDump(RuntimeMetricsRegistry &registry) {
+  objc3_runtime_metrics_snapshot snapshot{};
+  CopyRuntimeMetrics(snapshot);
+  std::lock_guard<std::mutex> lock(registry.dump_mutex);
+  const std::string staging_path = registry.dump_path + ".tmp";
+  std::FILE *file = std::fopen(staging_path.c_str(), "w");
+  if (file == nullptr) {
+    return;
+  }
+  const auto uptime_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                             std::chrono::steady_clock::now() -
+                             registry.started_at)
+                             .count();
+  const std::pair<const char *, std::uint64_t> fields[] = {
+      {"dump_sequence", ++registry.dump_count},
+      {"uptime_ms", static_cast<std::uint64_t>(uptime_ms)},
+      {"thread_block_count", snapshot.thread_block_count},
+      {"active_thread_block_count", snapshot.active_thread_block_count},
+      {"dispatch_count", snapshot.dispatch_count},
+      {"dispatch_cache_hit_count", snapshot.dispatch_cache_hit_count},
+      {"dispatch_site_cache_hit_count", snapshot.dispatch_site_cache_hit_count},
+      {"dispatch_locked_resolve_count", snapshot.dispatch_locked_resolve_count},
+      {"slow_path_lookup_count", snapshot.slow_path_lookup_count},
+      {"fallback_dispatch_count", snapshot.fallback_dispatch_count},
+      {"nil_dispatch_count", snapshot.nil_dispatch_count},
+      {"sealed_table_miss_count", snapshot.sealed_table_miss_count},
+      {"retain_count", snapshot.retain_count},
+      {"release_count", snapshot.release_count},
+      {"autorelease_count", snapshot.autorelease_count},
+      {"autoreleasepool_push_count", snapshot.autoreleasepool_push_count},
+      {"autoreleasepool_pop_count", snapshot.autoreleasepool_pop_count},
+      {"instance_alloc_count", snapshot.instance_alloc_count},
+      {"instance_dealloc_count", snapshot.instance_dealloc_count},
+      {"block_promote_count", snapshot.block_promote_count},
+      {"block_invoke_count", snapshot.block_invoke_count},
+  };
+  std::fputc('{', file);
+  for (std::size_t index = 0; index < std::size(fields); ++index) {
+    std::fprintf(file, "%s\"%s\":%llu", index == 0 ? "" : ",",
+                 fields[index].first,
+                 static_cast<unsigned long long>(fields[index].second));
+  }
+  std::fputs("}\n", file);
+  const bool written = std::fclose(file) == 0;
+  if (written) {
+    (void)std::rename(staging_path.c_str(), registry.dump_path.c_str());
+  }
+}
+
+void RunRuntimeMetricsDump(RuntimeMetricsRegistry &registry) {
+  for (;;) {
+    std::this_thread::sleep_for(
+        std::chrono::milliseconds(registry.dump_interval_ms));
+    WriteRuntimeMetricsDump(registry);
+  }
+}
+
+// OBJC3_RUNTIME_METRICS_DUMP=<path> starts a detached thread on first use
+// that rewrites <path> with the aggregated counters every
+// OBJC3_RUNTIME_METRICS_DUMP_INTERVAL_MS milliseconds (default 1000), plus
+// once more at exit.
+void EnsureRuntimeMetricsDump(RuntimeMetricsRegistry &registry) {
+  std::call_once(registry.dump_started, [&registry]() {
+    const char *path = std::getenv("OBJC3_RUNTIME_METRICS_DUMP");
+    if (path == nullptr || path[0] == '\0') {
+      return;
+    }
+    registry.dump_path = path;
+    const char *interval = std::getenv("OBJC3_RUNTIME_METRICS_DUMP_INTERVAL_MS");
+    if (interval != nullptr && interval[0] != '\0') {
+      const unsigned long long requested = std::strtoull(interval, nullptr, 10);
+      if (requested > 0ull) {
+        registry.dump_interval_ms = static_cast<std::uint64_t>(requested);
+      }
+    }
+    std::thread(RunRuntimeMetricsDump, std::ref(registry)).detach();
+    std::atexit([]() { WriteRuntimeMetricsDump(MetricsRegistry()); });
+  });
+}
+
+// dispatch-trace-ring anchor: last-dispatch evidence is recorded per thread
+// as fixed-size binary events. Events carry ids, flags, and the method-cache
+// key only; selector spellings, class/owner names, and property names are
+// reconstructed from the selector table and the shared method cache when a
+// snapshot is copied, so sends never assign std::string state. The ring only
+// advances while dispatch tracing is enabled; otherwise the head slot is
+// rewritten in place so the last-dispatch snapshots keep their contract.
+enum class RuntimeDispatchTracePath : std::uint8_t {
+  None,
+  SlowPathLive,
+  CacheHitFastPath,
+  CacheHitLive,
+  CacheHitFallback,
+  SlowPathFallback,
+  InvalidReceiverFallback,
+  NilShortCircuit,
+};
+
+struct RuntimeDispatchTraceEvent {
+  std::uint64_t sequence = 0;
+  std::uint64_t method_cache_generation = 0;
+  std::uint64_t selector_stable_id = 0;
+  std::uint64_t normalized_receiver_identity = 0;
+  std::uint64_t category_probe_count = 0;
+  std::uint64_t protocol_probe_count = 0;
+  std::uint64_t parameter_count = 0;
+  std::uint64_t property_base_identity = 0;
+  std::uint64_t property_slot_index = 0;
+  const void *implementation = nullptr;
+  RuntimeBuiltinKind builtin_kind = RuntimeBuiltinKind::None;
+  RuntimeDispatchTracePath path = RuntimeDispatchTracePath::None;
+  bool has_cache_entry = false;
+  bool used_cache = false;
+  bool used_fast_path = false;
+  bool resolved_live_method = false;
+  bool fell_back = false;
+  bool effective_direct_dispatch = false;
+  bool used_builtin = false;
+};
+
+constexpr std::size_t kRuntimeDispatchTraceCapacity = 128u;
+
+struct RuntimeDispatchTraceRing {
+  std::array<RuntimeDispatchTraceEvent, kRuntimeDispatchTraceCapacity> events;
+  std::size_t head = 0;
+  std::uint64_t recorded_event_count = 0;
+  std::uint64_t retained_event_count = 0;
+};
+
+// lock-free-dispatch-cache anchor: each thread keeps a small direct-mapped
+// cache of (receiver, selector pointer) bindings that point at entries of the
+// shared method cache. A slot is only trusted while its epoch matches
+// RuntimeState::dispatch_cache_epoch, so cache hits need one acquire load and
+// no mutex. Publishing a slot shares the entry rather than copying it; the
+// entry is never written again once filled, and the slot's reference keeps it
+// alive after the shared cache refills or evicts its key. Instance handles are only published while live, and a hit
+// re-checks the handle against its slot's retain word, so a freed instance
+// never flushes other threads' bindings.
+struct RuntimeDispatchHitCacheSlot {
+  std::uint64_t epoch = 0;
+  int receiver = 0;
+  const char *selector = nullptr;
+  const objc3_runtime_selector_handle *selector_handle = nullptr;
+  std::uint64_t base_identity = 0;
+  std::uint64_t method_cache_generation = 0;
+  std::shared_ptr<const MethodCacheEntry> entry;
+};
+
+constexpr std::size_t kRuntimeDispatchHitCacheSlotCount = 64u;
+
+thread_local RuntimeDispatchTraceRing g_runtime_dispatch_trace;
+thread_local std::array<RuntimeDispatchHitCacheSlot,
+                        kRuntimeDispatchHitCacheSlotCount>
+    g_runtime_dispatch_hit_cache;
+
+// dispatch-profile anchor: a sampled send adds one count to its thread's
+// profile table under its method-cache key (normalized receiver identity,
+// selector stable id) and the trace path it took, so the profile aggregates
+// the classification the last-dispatch event overwrites on every send. Only
+// the owning thread writes a table; readers load slots with relaxed atomics
+// and skip tables still tagged with an older profile generation.
+constexpr std::size_t kRuntimeDispatchTracePathCount =
+    static_cast<std::size_t>(RuntimeDispatchTracePath::NilShortCircuit) + 1u;
+constexpr std::size_t kRuntimeDispatchProfileSlotCount = 1024u;
+constexpr std::size_t kRuntimeDispatchProfileProbeLimit = 16u;
+
+struct RuntimeDispatchProfileSlot {
+  std::atomic<bool> occupied{false};
+  std::atomic<std::uint64_t> normalized_receiver_identity{0};
+  std::atomic<std::uint64_t> selector_stable_id{0};
+  std::array<std::atomic<std::uint64_t>, kRuntimeDispatchTracePathCount>
+      path_counts{};
+  std::atomic<std::uint64_t> slow_path_ns{0};
+};
+
+struct RuntimeDispatchProfileTable {
+  std::atomic<std::uint64_t> generation{0};
+  std::atomic<std::uint64_t> dropped_sample_count{0};
+  std::array<RuntimeDispatchProfileSlot, kRuntimeDispatchProfileSlotCount>
+      slots;
+};
+
+// Sends since the calling thread's last sample.
+thread_local std::uint64_t g_runtime_dispatch_profile_tick = 0;
+// Slow-path resolution time of the send about to be sampled, if it missed.
+thread_local std::uint64_t g_runtime_dispatch_profile_slow_path_ns = 0;
+
+bool DispatchProfileSamplePending(const RuntimeState &state) {
+  const std::uint64_t period =
+      state.dispatch_profile_period.load(std::memory_order_relaxed);
+  return period != 0 && g_runtime_dispatch_profile_tick + 1u >= period;
+}
+
+bool IsSlowDispatchTracePath(RuntimeDispatchTracePath path) {
+  return path == RuntimeDispatchTracePath::SlowPathLive ||
+         path == RuntimeDispatchTracePath::SlowPathFallback;
+}
+
+void AddDispatchProfileCount(std::atomic<std::uint64_t> &counter,
+                             std::uint64_t amount) {
+  counter.store(counter.load(std::memory_order_relaxed) + amount,
+                std::memory_order_relaxed);
+}
+
+void EnsureDispatchProfileOutput();
+
+// Returns the calling thread's table for the current profile generation,
+// allocating it on first use and clearing it in place after a period change.
+RuntimeDispatchProfileTable *CurrentDispatchProfileTable(
+    const RuntimeState &state) {
+  RuntimeMetricsBlock *block = g_runtime_metrics_block;
+  if (block == nullptr) {
+    return nullptr;
+  }
+  const std::uint64_t generation =
+      state.dispatch_profile_generation.load(std::memory_order_relaxed);
+  RuntimeDispatchProfileTable *table =
+      block->dispatch_profile.load(std::memory_order_relaxed);
+  if (table == nullptr) {
+    table = new RuntimeDispatchProfileTable();
+    table->generation.store(generation, std::memory_order_relaxed);
+    block->dispatch_profile.store(table, std::memory_order_release);
+    EnsureDispatchProfileOutput();
+    return table;
+  }
+  if (table->generation.load(std::memory_order_relaxed) != generation) {
+    table->generation.store(0, std::memory_order_release);
+    for (RuntimeDispatchProfileSlot &slot : table->slots) {
+      slot.occupied.store(false, std::memory_order_relaxed);
+      for (std::atomic<std::uint64_t> &count : slot.path_counts) {
+        count.store(0, std::memory_order_relaxed);
+      }
+      slot.slow_path_ns.store(0, std::memory_order_relaxed);
+    }
+    table->dropped_sample_count.store(0, std::memory_order_relaxed);
+    table->generation.store(generation, std::memory_order_release);
+  }
+  return table;
+}
+
+void RecordDispatchProfileSample(const RuntimeState &state,
+                                 const RuntimeDispatchTraceEvent &event) {
+  const std::uint64_t slow_path_ns =
+      std::exchange(g_runtime_dispatch_profile_slow_path_ns, 0u);
+  RuntimeDispatchProfileTable *table = CurrentDispatchProfileTable(state);
+  if (table == nullptr) {
+    return;
+  }
+  const std::uint64_t mixed =
+      event.normalized_receiver_identity * 0x9E3779B97F4A7C15ull ^
+      event.selector_stable_id;
+  std::size_t index =
+      static_cast<std::size_t>(mixed ^ (mixed >> 29u)) &
+      (kRuntimeDispatchProfileSlotCount - 1u);
+  for (std::size_t probe = 0; probe < kRuntimeDispatchProfileProbeLimit;
+       ++probe, index = (index + 1u) & (kRuntimeDispatchProfileSlotCount - 1u)) {
+    RuntimeDispatchProfileSlot &slot = table->slots[index];
+    if (!slot.occupied.load(std::memory_order_relaxed)) {
+      slot.normalized_receiver_identity.store(
+          event.normalized_receiver_identity, std::memory_order_relaxed);
+      slot.selector_stable_id.store(event.selector_stable_id,
+                                    std::memory_order_relaxed);
+      slot.occupied.store(true, std::memory_order_release);
+    } else if (slot.normalized_receiver_identity.load(
+                   std::memory_order_relaxed) !=
+                   event.normalized_receiver_identity ||
+               slot.selector_stable_id.load(std::memory_order_relaxed) !=
+                   event.selector_stable_id) {
+      continue;
+    }
+    AddDispatchProfileCount(
+        slot.path_counts[static_cast<std::size_t>(event.path)], 1u);
+    if (IsSlowDispatchTracePath(event.path)) {
+      AddDispatchProfileCount(slot.slow_path_ns, slow_path_ns);
+    }
+    return;
+  }
+  AddDispatchProfileCount(table->dropped_sample_count, 1u);
+}
 
 const void *AggregateEntry(const objc3_runtime_pointer_aggregate *aggregate,
                            std::uint64_t index);
 RuntimeMethodReturnKind ClassifyRuntimeReturnType(const char *return_type_name);
 std::vector<const EmittedClassBundle *> CollectPreferredClassBundlesForImage(
-    const RegisteredImageMetadata &record, const std::string &class_name);
+    const RegisteredImageMetadata &record,
+    const std::vector<std::size_t> &descriptor_indices);
+
+// sealed-dispatch-table anchor: unbinding publishes the zero receiver first
+// so lowered sends stop trusting the table, then clears each entry so a send
+// that already passed the receiver check falls back instead of calling an
+// entry bound under the previous class graph.
+void UnbindSealedDispatchTablesUnlocked(RuntimeState &state) {
+  for (objc3_runtime_sealed_dispatch_table *table :
+       state.bound_sealed_dispatch_tables) {
+    std::atomic_ref<std::int32_t>(table->bound_receiver)
+        .store(0, std::memory_order_release);
+    for (std::uint64_t slot = 0; slot < table->slot_count; ++slot) {
+      std::atomic_ref<const void *>(table->entries[slot])
+          .store(nullptr, std::memory_order_relaxed);
+    }
+  }
+  state.sealed_dispatch_table_unbind_count +=
+      static_cast<std::uint64_t>(state.bound_sealed_dispatch_tables.size());
+  state.bound_sealed_dispatch_tables.clear();
+  state.bound_sealed_dispatch_slot_count = 0;
+}
 
-void ClearMethodCacheStateUnlocked(RuntimeState &state) {
-  state.method_cache.clear();
-  state.method_cache_hit_count = 0;
+// Opens a fresh counter window and retires every published thread-local
+// binding and sealed dispatch table without discarding the shared
+// method-cache entries themselves.
+void ResetMethodCacheStatisticsUnlocked(RuntimeState &state) {
   state.method_cache_miss_count = 0;
   state.slow_path_lookup_count = 0;
   state.live_dispatch_count = 0;
   state.fallback_dispatch_count = 0;
   state.fast_path_seed_count = 0;
-  state.fast_path_hit_count = 0;
-  state.last_dispatch_selector.clear();
-  state.last_dispatch_selector_stable_id = 0;
-  state.last_dispatch_normalized_receiver_identity = 0;
-  state.last_category_probe_count = 0;
-  state.last_protocol_probe_count = 0;
-  state.last_dispatch_used_cache = false;
-  state.last_dispatch_used_fast_path = false;
-  state.last_dispatch_resolved_live_method = false;
-  state.last_dispatch_fell_back = false;
-  state.last_dispatch_effective_direct_dispatch = false;
-  state.last_dispatch_used_builtin = false;
-  state.last_fast_path_reason.clear();
-  state.last_dispatch_path.clear();
-  state.last_dispatch_implementation_kind.clear();
-  state.last_dispatch_property_name.clear();
-  state.last_resolved_class_name.clear();
-  state.last_resolved_owner_identity.clear();
-  state.last_dispatch_parameter_count = 0;
-  state.last_dispatch_property_base_identity = 0;
-  state.last_dispatch_property_slot_index = 0;
+  state.hit_statistics_window_base = SumRuntimeHitStatistics();
+  state.dispatch_site_cache_miss_count = 0;
+  ++state.method_cache_generation;
+  state.dispatch_cache_epoch.fetch_add(1u, std::memory_order_release);
+  UnbindSealedDispatchTablesUnlocked(state);
+  g_runtime_dispatch_trace.head = 0;
+  g_runtime_dispatch_trace.recorded_event_count = 0;
+  g_runtime_dispatch_trace.retained_event_count = 0;
 }
 
-void ClearRealizedClassGraphUnlocked(RuntimeState &state) {
-  state.realized_class_name_by_base_identity.clear();
-  state.ambiguous_realized_base_identities.clear();
-  state.realized_class_node_indices_by_name.clear();
-  state.realized_class_nodes.clear();
-  state.property_lookup_cache.clear();
+void ClearMethodCacheClockRing(MethodCacheClockRing &ring) {
+  ring.keys.clear();
+  ring.hand = 0;
+  ring.live_count = 0;
+}
+
+// Forgets slow-path fill bookkeeping once the fills themselves are gone.
+void ClearMethodCacheRingStateUnlocked(RuntimeState &state) {
+  for (RealizedReceiverBinding &binding : state.realized_receiver_bindings) {
+    binding.method_cache_entry_count = 0;
+  }
+  state.unbound_method_cache_entry_counts.clear();
+  ClearMethodCacheClockRing(state.resolved_method_cache_ring);
+  ClearMethodCacheClockRing(state.negative_method_cache_ring);
+  state.stale_method_cache_entry_count = 0;
+}
+
+void ClearMethodCacheStateUnlocked(RuntimeState &state) {
+  state.method_cache.clear();
+  ClearMethodCacheRingStateUnlocked(state);
+  state.method_cache_eviction_count = 0;
+  state.negative_method_cache_eviction_count = 0;
+  state.stale_method_cache_reclaim_count = 0;
+  ResetMethodCacheStatisticsUnlocked(state);
+}
+
+void ClearRealizedClassQueryStateUnlocked(RuntimeState &state) {
   state.property_lookup_cache_hit_count = 0;
   state.property_lookup_cache_miss_count = 0;
-  state.realized_root_class_count = 0;
-  state.realized_metaclass_edge_count = 0;
-  state.receiver_class_binding_count = 0;
-  state.realized_attached_category_count = 0;
-  state.realized_protocol_conformance_edge_count = 0;
-  state.last_realized_class_name.clear();
-  state.last_realized_class_owner_identity.clear();
-  state.last_realized_metaclass_owner_identity.clear();
-  state.last_attached_category_owner_identity.clear();
-  state.last_attached_category_name.clear();
+  state.direct_property_get_count = 0;
+  state.direct_property_set_count = 0;
   state.last_queried_class_name.clear();
   state.last_resolved_class_query_name.clear();
   state.last_resolved_class_query_owner_identity.clear();
@@ -824,22 +1958,530 @@ void ClearRealizedClassGraphUnlocked(RuntimeState &state) {
   state.last_property_query_used_cache = false;
 }
 
-void ClearRuntimeInstanceStateUnlocked(RuntimeState &state) {
-  state.runtime_instances_by_receiver.clear();
-  state.runtime_blocks_by_handle.clear();
-  state.weak_slot_refs_by_target_receiver.clear();
-  state.next_runtime_instance_receiver = 0x100000;
-  state.next_runtime_block_handle = 0x200000;
-  state.live_runtime_instance_count = 0;
-  state.last_allocated_runtime_instance_receiver = 0;
-  state.last_allocated_runtime_instance_base_identity = 0;
-  state.last_allocated_runtime_instance_size_bytes = 0;
-  state.last_allocated_runtime_instance_class_name.clear();
+void ClearRealizedClassGraphUnlocked(RuntimeState &state) {
+  state.realized_receiver_bindings.clear();
+  state.realized_class_node_indices_by_class_id.clear();
+  state.realized_class_nodes.clear();
+  state.realized_class_node_index_by_bundle.clear();
+  state.pending_super_node_indices_by_bundle.clear();
+  state.property_lookup_cache.clear();
+  state.keypath_chain_cache.clear();
+  state.keypath_chain_build_count = 0;
+  state.keypath_chain_hit_count = 0;
+  state.keypath_chain_step_miss_count = 0;
+  state.symbol_id_by_name.clear();
+  state.symbol_names.clear();
+  state.realized_root_class_count = 0;
+  state.realized_metaclass_edge_count = 0;
+  state.receiver_class_binding_count = 0;
+  state.realized_attached_category_count = 0;
+  state.realized_protocol_conformance_edge_count = 0;
+  state.indexed_method_list_count = 0;
+  state.indexed_method_entry_count = 0;
+  state.unindexed_method_list_count = 0;
+  state.method_table_slot_count = 0;
+  state.method_table_probe_count = 0;
+  state.method_list_scan_count = 0;
+  state.last_registration_realized_class_count = 0;
+  state.last_registration_invalidated_cache_entry_count = 0;
+  state.full_class_graph_invalidation_count = 0;
+  state.conformance_bitset_build_count = 0;
+  state.conformance_bitset_test_count = 0;
+  state.last_realized_class_name.clear();
+  state.last_realized_class_owner_identity.clear();
+  state.last_realized_metaclass_owner_identity.clear();
+  state.last_attached_category_owner_identity.clear();
+  state.last_attached_category_name.clear();
+  ClearRealizedClassQueryStateUnlocked(state);
 }
 
-std::size_t AlignTo(std::size_t value, std::size_t alignment) {
-  const std::size_t effective_alignment = std::max<std::size_t>(alignment, 1u);
-  const std::size_t remainder = value % effective_alignment;
+void ResetRuntimeInstanceSlabUnlocked(RuntimeInstanceSlab &slab) {
+  for (std::atomic<RuntimeInstanceSlotSegment *> &segment : slab.segments) {
+    segment.store(nullptr, std::memory_order_relaxed);
+  }
+  slab.owned_segments.clear();
+  slab.slot_count = 0;
+  slab.free_slots.clear();
+  slab.quarantined_slots.clear();
+  slab.size_classes = {};
+  slab.reused_slot_count = 0;
+  slab.wrapped_slot_count = 0;
+  slab.reserved_storage_bytes = 0;
+  slab.oversize_allocation_count = 0;
+}
+
+void ResetRuntimeBlockSlabUnlocked(RuntimeBlockSlab &slab) {
+  for (std::atomic<RuntimeBlockSlotSegment *> &segment : slab.segments) {
+    segment.store(nullptr, std::memory_order_relaxed);
+  }
+  slab.owned_segments.clear();
+  slab.slot_count = 0;
+  slab.free_slots.clear();
+  slab.quarantined_slots.clear();
+  slab.live_block_count = 0;
+  slab.reused_slot_count = 0;
+  slab.wrapped_slot_count = 0;
+}
+
+void ClearRuntimeInstanceStateUnlocked(RuntimeState &state) {
+  ResetRuntimeInstanceSlabUnlocked(state.runtime_instance_slab);
+  ResetRuntimeBlockSlabUnlocked(state.runtime_block_slab);
+  for (RuntimeWeakSideTableStripe &stripe : state.weak_side_table.stripes) {
+    std::lock_guard<std::mutex> stripe_lock(stripe.mutex);
+    stripe.referrers_by_target.clear();
+    stripe.referrer_index_by_slot.clear();
+  }
+  state.live_runtime_instance_count = 0;
+  state.pending_releases.clear();
+  state.release_batch_count = 0;
+  state.batched_release_value_count = 0;
+  state.coalesced_release_value_count = 0;
+  state.cascade_release_count = 0;
+  state.max_pending_release_count = 0;
+  state.last_allocated_runtime_instance_receiver = 0;
+  state.last_allocated_runtime_instance_base_identity = 0;
+  state.last_allocated_runtime_instance_size_bytes = 0;
+  state.dispatch_cache_epoch.fetch_add(1u, std::memory_order_release);
+}
+
+RuntimeHandleKind RuntimeHandleKindOf(int handle) {
+  const std::uint32_t tag =
+      static_cast<std::uint32_t>(handle) >> kRuntimeHandleKindShift;
+  return tag == 0u   ? RuntimeHandleKind::StaticIdentity
+         : tag == 1u ? RuntimeHandleKind::Block
+                     : RuntimeHandleKind::Instance;
+}
+
+int RuntimeInstanceHandle(std::uint32_t slot_index, std::uint32_t generation) {
+  return kRuntimeInstanceReceiverBase + static_cast<int>(slot_index) +
+         static_cast<int>(generation << kRuntimeInstanceSlotBits);
+}
+
+std::uint64_t RuntimeInstanceRetainState(std::uint32_t generation,
+                                         std::uint64_t retain_count) {
+  return (std::uint64_t{generation} << kRuntimeInstanceRetainGenerationShift) |
+         retain_count;
+}
+
+std::uint32_t RuntimeInstanceRetainGeneration(std::uint64_t retain_state) {
+  return static_cast<std::uint32_t>(retain_state >>
+                                    kRuntimeInstanceRetainGenerationShift);
+}
+
+std::uint64_t RuntimeInstanceRetainCount(std::uint64_t retain_state) {
+  return retain_state & kRuntimeInstanceRetainCountMask;
+}
+
+RuntimeInstanceRecord *RuntimeInstanceSlotAt(RuntimeInstanceSlab &slab,
+                                             std::uint32_t slot_index) {
+  RuntimeInstanceSlotSegment *const segment =
+      slab.segments[slot_index >> kRuntimeInstanceSlotSegmentBits].load(
+          std::memory_order_acquire);
+  return segment != nullptr
+             ? &segment->records[slot_index &
+                                 (kRuntimeInstanceSlotSegmentSize - 1u)]
+             : nullptr;
+}
+
+// Safe without the mutex: published segments never move and are only freed by
+// a testing reset. The caller still has to check the slot's retain state
+// against |generation| before trusting the record.
+RuntimeInstanceRecord *RuntimeInstanceSlotForHandle(RuntimeState &state,
+                                                    int receiver,
+                                                    std::uint32_t &generation) {
+  if (receiver < kRuntimeInstanceReceiverBase) {
+    return nullptr;
+  }
+  const std::uint32_t offset =
+      static_cast<std::uint32_t>(receiver - kRuntimeInstanceReceiverBase);
+  generation = offset >> kRuntimeInstanceSlotBits;
+  return RuntimeInstanceSlotAt(state.runtime_instance_slab,
+                               offset & kRuntimeInstanceSlotMask);
+}
+
+RuntimeInstanceRecord *FindRuntimeInstanceUnlocked(RuntimeState &state,
+                                                   int receiver) {
+  std::uint32_t generation = 0;
+  RuntimeInstanceRecord *const record =
+      RuntimeInstanceSlotForHandle(state, receiver, generation);
+  if (record == nullptr) {
+    return nullptr;
+  }
+  const std::uint64_t retain_state =
+      record->retain_state.load(std::memory_order_relaxed);
+  return RuntimeInstanceRetainGeneration(retain_state) == generation &&
+                 RuntimeInstanceRetainCount(retain_state) != 0u
+             ? record
+             : nullptr;
+}
+
+const RuntimeInstanceRecord *FindRuntimeInstanceUnlocked(
+    const RuntimeState &state, int receiver) {
+  return FindRuntimeInstanceUnlocked(const_cast<RuntimeState &>(state),
+                                     receiver);
+}
+
+// Instance and block slots share the packed retain word. A retain or release
+// only succeeds while the word still carries |generation| and a nonzero count,
+// so a handle to a freed or recycled slot never moves the new occupant.
+bool TryRetainRuntimeSlot(std::atomic<std::uint64_t> &retain_state_word,
+                          std::uint32_t generation,
+                          std::memory_order success_order) {
+  std::uint64_t retain_state =
+      retain_state_word.load(std::memory_order_relaxed);
+  do {
+    if (RuntimeInstanceRetainGeneration(retain_state) != generation ||
+        RuntimeInstanceRetainCount(retain_state) == 0u) {
+      return false;
+    }
+  } while (!retain_state_word.compare_exchange_weak(
+      retain_state, retain_state + 1u, success_order,
+      std::memory_order_relaxed));
+  return true;
+}
+
+enum class RuntimeRetainReleaseResult : std::uint8_t {
+  NotLive,
+  Released,
+  FinalRelease,
+};
+
+// Lock-free release for every count above one. The final release is left to
+// the caller so it can destroy the record under the mutex.
+RuntimeRetainReleaseResult TryReleaseRuntimeSlot(
+    std::atomic<std::uint64_t> &retain_state_word, std::uint32_t generation) {
+  std::uint64_t retain_state =
+      retain_state_word.load(std::memory_order_relaxed);
+  do {
+    if (RuntimeInstanceRetainGeneration(retain_state) != generation ||
+        RuntimeInstanceRetainCount(retain_state) == 0u) {
+      return RuntimeRetainReleaseResult::NotLive;
+    }
+    if (RuntimeInstanceRetainCount(retain_state) == 1u) {
+      return RuntimeRetainReleaseResult::FinalRelease;
+    }
+  } while (!retain_state_word.compare_exchange_weak(
+      retain_state, retain_state - 1u, std::memory_order_release,
+      std::memory_order_relaxed));
+  return RuntimeRetainReleaseResult::Released;
+}
+
+// Locked release of |release_count| references in one CAS, still by CAS
+// because lock-free callers may move the same word. Returns NotLive, Released,
+// or FinalRelease once the count hit zero; releases past zero are dropped.
+RuntimeRetainReleaseResult ReleaseRuntimeSlotUnlocked(
+    std::atomic<std::uint64_t> &retain_state_word, std::uint32_t generation,
+    std::uint64_t release_count) {
+  std::uint64_t retain_state =
+      retain_state_word.load(std::memory_order_acquire);
+  while (true) {
+    const std::uint64_t retain_count = RuntimeInstanceRetainCount(retain_state);
+    if (RuntimeInstanceRetainGeneration(retain_state) != generation ||
+        retain_count == 0u) {
+      return RuntimeRetainReleaseResult::NotLive;
+    }
+    const bool final_release = retain_count <= release_count;
+    const std::uint64_t next_retain_state =
+        final_release ? RuntimeInstanceRetainState(generation, 0u)
+                      : retain_state - release_count;
+    if (retain_state_word.compare_exchange_weak(
+            retain_state, next_retain_state, std::memory_order_acq_rel,
+            std::memory_order_acquire)) {
+      return final_release ? RuntimeRetainReleaseResult::FinalRelease
+                           : RuntimeRetainReleaseResult::Released;
+    }
+  }
+}
+
+bool TryRetainRuntimeInstance(RuntimeState &state, int value) {
+  std::uint32_t generation = 0;
+  RuntimeInstanceRecord *const record =
+      RuntimeInstanceSlotForHandle(state, value, generation);
+  return record != nullptr &&
+         TryRetainRuntimeSlot(record->retain_state, generation,
+                              std::memory_order_relaxed);
+}
+
+RuntimeRetainReleaseResult TryReleaseRuntimeInstance(RuntimeState &state,
+                                                     int value) {
+  std::uint32_t generation = 0;
+  RuntimeInstanceRecord *const record =
+      RuntimeInstanceSlotForHandle(state, value, generation);
+  return record != nullptr
+             ? TryReleaseRuntimeSlot(record->retain_state, generation)
+             : RuntimeRetainReleaseResult::NotLive;
+}
+
+int RuntimeBlockHandle(std::uint32_t slot_index, std::uint32_t generation) {
+  return kRuntimeBlockHandleBase + static_cast<int>(slot_index) +
+         static_cast<int>(generation << kRuntimeInstanceSlotBits);
+}
+
+RuntimeBlockRecord *RuntimeBlockSlotAt(RuntimeBlockSlab &slab,
+                                       std::uint32_t slot_index) {
+  RuntimeBlockSlotSegment *const segment =
+      slab.segments[slot_index >> kRuntimeInstanceSlotSegmentBits].load(
+          std::memory_order_acquire);
+  return segment != nullptr
+             ? &segment->records[slot_index &
+                                 (kRuntimeInstanceSlotSegmentSize - 1u)]
+             : nullptr;
+}
+
+// Safe without the mutex for the same reason as RuntimeInstanceSlotForHandle.
+RuntimeBlockRecord *RuntimeBlockSlotForHandle(RuntimeState &state,
+                                              int block_handle,
+                                              std::uint32_t &generation) {
+  if (RuntimeHandleKindOf(block_handle) != RuntimeHandleKind::Block) {
+    return nullptr;
+  }
+  const std::uint32_t offset =
+      static_cast<std::uint32_t>(block_handle - kRuntimeBlockHandleBase);
+  generation = offset >> kRuntimeInstanceSlotBits;
+  return RuntimeBlockSlotAt(state.runtime_block_slab,
+                            offset & kRuntimeInstanceSlotMask);
+}
+
+// Acquire on success so a lock-free invoke sees the fields promotion wrote
+// before publishing the count.
+RuntimeBlockRecord *TryRetainRuntimeBlock(RuntimeState &state,
+                                          int block_handle) {
+  std::uint32_t generation = 0;
+  RuntimeBlockRecord *const record =
+      RuntimeBlockSlotForHandle(state, block_handle, generation);
+  return record != nullptr &&
+                 TryRetainRuntimeSlot(record->retain_state, generation,
+                                      std::memory_order_acquire)
+             ? record
+             : nullptr;
+}
+
+RuntimeRetainReleaseResult TryReleaseRuntimeBlock(RuntimeState &state,
+                                                  int block_handle) {
+  std::uint32_t generation = 0;
+  RuntimeBlockRecord *const record =
+      RuntimeBlockSlotForHandle(state, block_handle, generation);
+  return record != nullptr
+             ? TryReleaseRuntimeSlot(record->retain_state, generation)
+             : RuntimeRetainReleaseResult::NotLive;
+}
+
+std::size_t RuntimeInstanceSizeClassIndex(std::size_t size_bytes) {
+  std::size_t index = 0;
+  std::size_t block_bytes = kRuntimeInstanceMinSizeClassBytes;
+  while (block_bytes < size_bytes && index < kRuntimeInstanceSizeClassCount) {
+    block_bytes <<= 1u;
+    ++index;
+  }
+  return index;
+}
+
+// Hands out zeroed storage from the record's size class, carving a new chunk
+// only when that class's free list is empty. Sizes past the largest class get
+// a dedicated block owned by the record.
+unsigned char *AcquireRuntimeInstanceStorageUnlocked(
+    RuntimeInstanceSlab &slab, RuntimeInstanceRecord &record) {
+  const std::size_t class_index =
+      RuntimeInstanceSizeClassIndex(record.instance_size_bytes);
+  record.size_class = static_cast<std::uint32_t>(class_index);
+  if (class_index == kRuntimeInstanceSizeClassCount) {
+    record.oversize_storage =
+        std::make_unique<unsigned char[]>(record.instance_size_bytes);
+    ++slab.oversize_allocation_count;
+    return record.oversize_storage.get();
+  }
+  RuntimeInstanceSizeClassSlab &size_class = slab.size_classes[class_index];
+  if (size_class.free_blocks.empty()) {
+    const std::size_t block_bytes = kRuntimeInstanceMinSizeClassBytes
+                                    << class_index;
+    size_class.chunks.push_back(
+        std::make_unique<unsigned char[]>(kRuntimeInstanceSlabChunkBytes));
+    unsigned char *const chunk = size_class.chunks.back().get();
+    for (std::size_t offset = kRuntimeInstanceSlabChunkBytes;
+         offset >= block_bytes; offset -= block_bytes) {
+      size_class.free_blocks.push_back(chunk + offset - block_bytes);
+    }
+    slab.reserved_storage_bytes += kRuntimeInstanceSlabChunkBytes;
+  }
+  unsigned char *const storage = size_class.free_blocks.back();
+  size_class.free_blocks.pop_back();
+  std::memset(storage, 0, record.instance_size_bytes);
+  return storage;
+}
+
+RuntimeInstanceRecord &AppendRuntimeInstanceSlotUnlocked(
+    RuntimeInstanceSlab &slab) {
+  const std::uint32_t slot_index = slab.slot_count++;
+  const std::size_t segment_index = slot_index >> kRuntimeInstanceSlotSegmentBits;
+  RuntimeInstanceSlotSegment *segment =
+      slab.segments[segment_index].load(std::memory_order_relaxed);
+  if (segment == nullptr) {
+    slab.owned_segments.push_back(
+        std::make_unique<RuntimeInstanceSlotSegment>());
+    segment = slab.owned_segments.back().get();
+    for (std::size_t index = 0; index < kRuntimeInstanceSlotSegmentSize;
+         ++index) {
+      segment->records[index].slot_index = static_cast<std::uint32_t>(
+          (segment_index << kRuntimeInstanceSlotSegmentBits) + index);
+    }
+    slab.segments[segment_index].store(segment, std::memory_order_release);
+  }
+  return segment->records[slot_index & (kRuntimeInstanceSlotSegmentSize - 1u)];
+}
+
+// Returns 0 only once every slot handle is exhausted.
+int AllocateRuntimeInstanceUnlocked(RuntimeState &state,
+                                    std::uint64_t base_identity,
+                                    std::size_t instance_size_bytes) {
+  RuntimeInstanceSlab &slab = state.runtime_instance_slab;
+  RuntimeInstanceRecord *record = nullptr;
+  if (!slab.free_slots.empty()) {
+    record = RuntimeInstanceSlotAt(slab, slab.free_slots.back());
+    slab.free_slots.pop_back();
+    ++slab.reused_slot_count;
+  } else if (slab.slot_count <= kRuntimeInstanceSlotMask) {
+    record = &AppendRuntimeInstanceSlotUnlocked(slab);
+  } else {
+    return 0;
+  }
+  const std::uint32_t generation = RuntimeInstanceRetainGeneration(
+      record->retain_state.load(std::memory_order_relaxed));
+  const int receiver = RuntimeInstanceHandle(record->slot_index, generation);
+  record->receiver_identity = static_cast<std::uint64_t>(receiver);
+  record->base_identity = base_identity;
+  record->instance_size_bytes = instance_size_bytes;
+  record->storage_bytes = AcquireRuntimeInstanceStorageUnlocked(slab, *record);
+  record->retain_state.store(RuntimeInstanceRetainState(generation, 1u),
+                             std::memory_order_release);
+  ++state.live_runtime_instance_count;
+  BumpRuntimeMetric(RuntimeMetric::InstanceAlloc);
+  return receiver;
+}
+
+// A slot that exhausted its generations restarts at generation zero, so one of
+// its oldest handles becomes live again once it is reused. Holding it back
+// until kRuntimeSlotQuarantineLength later slots have also wrapped keeps that
+// reuse at least a full generation range of other slots' churn away.
+template <typename Slab>
+void QuarantineWrappedSlotUnlocked(Slab &slab, std::uint32_t slot_index) {
+  ++slab.wrapped_slot_count;
+  slab.quarantined_slots.push_back(slot_index);
+  if (slab.quarantined_slots.size() > kRuntimeSlotQuarantineLength) {
+    slab.free_slots.push_back(slab.quarantined_slots.front());
+    slab.quarantined_slots.pop_front();
+  }
+}
+
+// The caller has already dropped the retain count to zero and collected
+// anything it needs from the storage. A slot whose generation would overflow
+// the handle encoding wraps and goes to quarantine instead of the free list.
+void FreeRuntimeInstanceSlotUnlocked(RuntimeState &state,
+                                     RuntimeInstanceRecord &record) {
+  RuntimeInstanceSlab &slab = state.runtime_instance_slab;
+  if (record.size_class < kRuntimeInstanceSizeClassCount) {
+    slab.size_classes[record.size_class].free_blocks.push_back(
+        record.storage_bytes);
+  }
+  record.oversize_storage.reset();
+  record.storage_bytes = nullptr;
+  const std::uint32_t next_generation =
+      RuntimeInstanceRetainGeneration(
+          record.retain_state.load(std::memory_order_relaxed)) +
+      1u;
+  if (next_generation > kRuntimeInstanceMaxGeneration) {
+    record.retain_state.store(RuntimeInstanceRetainState(0u, 0u),
+                              std::memory_order_relaxed);
+    QuarantineWrappedSlotUnlocked(slab, record.slot_index);
+    // Handles from the slot's first generations will be issued again, so
+    // hit-cache bindings that may name one of them are retired here.
+    state.dispatch_cache_epoch.fetch_add(1u, std::memory_order_release);
+    return;
+  }
+  record.retain_state.store(RuntimeInstanceRetainState(next_generation, 0u),
+                            std::memory_order_relaxed);
+  slab.free_slots.push_back(record.slot_index);
+}
+
+RuntimeBlockRecord &AppendRuntimeBlockSlotUnlocked(RuntimeBlockSlab &slab) {
+  const std::uint32_t slot_index = slab.slot_count++;
+  const std::size_t segment_index = slot_index >> kRuntimeInstanceSlotSegmentBits;
+  RuntimeBlockSlotSegment *segment =
+      slab.segments[segment_index].load(std::memory_order_relaxed);
+  if (segment == nullptr) {
+    slab.owned_segments.push_back(std::make_unique<RuntimeBlockSlotSegment>());
+    segment = slab.owned_segments.back().get();
+    for (std::size_t index = 0; index < kRuntimeInstanceSlotSegmentSize;
+         ++index) {
+      segment->records[index].slot_index = static_cast<std::uint32_t>(
+          (segment_index << kRuntimeInstanceSlotSegmentBits) + index);
+    }
+    slab.segments[segment_index].store(segment, std::memory_order_release);
+  }
+  return segment->records[slot_index & (kRuntimeInstanceSlotSegmentSize - 1u)];
+}
+
+// Picks a free block slot. The record is not live until the caller publishes
+// a nonzero count; returns nullptr once every block handle is exhausted.
+RuntimeBlockRecord *AcquireRuntimeBlockSlotUnlocked(RuntimeState &state,
+                                                    std::uint32_t &generation) {
+  RuntimeBlockSlab &slab = state.runtime_block_slab;
+  RuntimeBlockRecord *record = nullptr;
+  if (!slab.free_slots.empty()) {
+    record = RuntimeBlockSlotAt(slab, slab.free_slots.back());
+    slab.free_slots.pop_back();
+    ++slab.reused_slot_count;
+  } else if (slab.slot_count <= kRuntimeInstanceSlotMask) {
+    record = &AppendRuntimeBlockSlotUnlocked(slab);
+  } else {
+    return nullptr;
+  }
+  generation = RuntimeInstanceRetainGeneration(
+      record->retain_state.load(std::memory_order_relaxed));
+  return record;
+}
+
+// Returns a slot whose count is already zero to the free list. A slot that
+// was published moves to its next generation so its old handle stays dead, or
+// wraps into the quarantine once its generations run out; small storage keeps
+// its capacity for the next promotion.
+void FreeRuntimeBlockSlotUnlocked(RuntimeState &state,
+                                  RuntimeBlockRecord &record, bool published) {
+  RuntimeBlockSlab &slab = state.runtime_block_slab;
+  record.block_handle = 0;
+  record.has_pointer_capture_storage = false;
+  record.storage_size_bytes = 0;
+  if (record.storage_words.capacity() > kRuntimeBlockRetainedStorageWordCount) {
+    std::vector<std::uint64_t>().swap(record.storage_words);
+  } else {
+    record.storage_words.clear();
+  }
+  record.promoted_capture_cells.clear();
+  record.invoke = nullptr;
+  record.copy_helper = nullptr;
+  record.dispose_helper = nullptr;
+  if (!published) {
+    slab.free_slots.push_back(record.slot_index);
+    return;
+  }
+  --slab.live_block_count;
+  const std::uint32_t next_generation =
+      RuntimeInstanceRetainGeneration(
+          record.retain_state.load(std::memory_order_relaxed)) +
+      1u;
+  if (next_generation > kRuntimeBlockMaxGeneration) {
+    record.retain_state.store(RuntimeInstanceRetainState(0u, 0u),
+                              std::memory_order_relaxed);
+    QuarantineWrappedSlotUnlocked(slab, record.slot_index);
+    return;
+  }
+  record.retain_state.store(RuntimeInstanceRetainState(next_generation, 0u),
+                            std::memory_order_relaxed);
+  slab.free_slots.push_back(record.slot_index);
+}
+
+std::size_t AlignTo(std::size_t value, std::size_t alignment) {
+  const std::size_t effective_alignment = std::max<std::size_t>(alignment, 1u);
+  const std::size_t remainder = value % effective_alignment;
   return remainder == 0u ? value : value + (effective_alignment - remainder);
 }
 
@@ -851,38 +2493,141 @@ RuntimeDispatchFrame *CurrentRuntimeDispatchFrame() {
                                               : nullptr;
 }
 
+RuntimeAutoreleasePage *HotAutoreleasePage() {
+  RuntimeAutoreleasePageStack &stack = g_runtime_autorelease_pages;
+  if (stack.hot == nullptr) {
+    stack.first = new RuntimeAutoreleasePage();
+    stack.hot = stack.first;
+    ++stack.allocated_page_count;
+    ++stack.page_allocation_count;
+  }
+  return stack.hot;
+}
+
+RuntimeAutoreleaseMark CurrentAutoreleaseMark() {
+  RuntimeAutoreleasePage *page = HotAutoreleasePage();
+  return {page, page->used, g_runtime_autorelease_pages.position};
+}
+
+void PushAutoreleaseEntry(int value, std::uint32_t owner) {
+  RuntimeAutoreleasePageStack &stack = g_runtime_autorelease_pages;
+  RuntimeAutoreleasePage *page = HotAutoreleasePage();
+  if (page->used == RuntimeAutoreleasePage::kEntryCapacity) {
+    if (page->child == nullptr) {
+      page->child = new RuntimeAutoreleasePage();
+      page->child->parent = page;
+      ++stack.allocated_page_count;
+      ++stack.page_allocation_count;
+    }
+    page = page->child;
+    page->used = 0;
+    stack.hot = page;
+  }
+  page->entries[page->used++] = {value, owner};
+  ++stack.position;
+  stack.high_water_position =
+      std::max(stack.high_water_position, stack.position);
+}
+
+// Makes `mark` the top of the stack and frees spare pages past the limit.
+void TruncateAutoreleasePages(const RuntimeAutoreleaseMark &mark) {
+  RuntimeAutoreleasePageStack &stack = g_runtime_autorelease_pages;
+  stack.hot = mark.page;
+  stack.hot->used = mark.index;
+  stack.position = mark.position;
+  RuntimeAutoreleasePage *last_kept = stack.hot;
+  for (std::size_t spare = 0; spare < kRuntimeAutoreleaseSparePageLimit &&
+                              last_kept->child != nullptr;
+       ++spare) {
+    last_kept = last_kept->child;
+  }
+  RuntimeAutoreleasePage *page = last_kept->child;
+  last_kept->child = nullptr;
+  while (page != nullptr) {
+    RuntimeAutoreleasePage *child = page->child;
+    delete page;
+    --stack.allocated_page_count;
+    page = child;
+  }
+}
+
 void PushRuntimeDispatchFrame(int receiver, std::uint64_t base_identity,
                               const RealizedPropertyAccessor *accessor) {
   RuntimeDispatchFrame frame;
   frame.receiver = receiver;
   frame.base_identity = base_identity;
   frame.runtime_property_accessor = accessor;
-  g_runtime_dispatch_frames.push_back(std::move(frame));
+  frame.autorelease_mark = CurrentAutoreleaseMark();
+  g_runtime_dispatch_frames.push_back(frame);
 }
 
-std::vector<int> PopRuntimeDispatchFrameAutoreleaseValues() {
+// Collects the values owned by the popped frame and compacts the entries it
+// does not own (its own autoreleased results, which belong to the caller's
+// frame, and any pool entries) down to its mark, then releases the batch.
+void PopRuntimeDispatchFrame(RuntimeState &state) {
   if (g_runtime_dispatch_frames.empty()) {
-    return {};
+    return;
   }
-  RuntimeDispatchFrame frame = std::move(g_runtime_dispatch_frames.back());
+  const RuntimeAutoreleaseMark mark =
+      g_runtime_dispatch_frames.back().autorelease_mark;
+  const auto depth =
+      static_cast<std::uint32_t>(g_runtime_dispatch_frames.size());
   g_runtime_dispatch_frames.pop_back();
-  return std::move(frame.autorelease_values);
+  RuntimeAutoreleasePageStack &stack = g_runtime_autorelease_pages;
+  if (stack.position <= mark.position) {
+    return;
+  }
+
+  std::vector<int> &batch = g_runtime_autorelease_drain_batch;
+  RuntimeAutoreleaseMark write = mark;
+  RuntimeAutoreleasePage *read_page = mark.page;
+  std::size_t read_index = mark.index;
+  for (;;) {
+    if (read_index == read_page->used) {
+      if (read_page == stack.hot) {
+        break;
+      }
+      read_page = read_page->child;
+      read_index = 0;
+      continue;
+    }
+    const RuntimeAutoreleaseEntry entry = read_page->entries[read_index++];
+    if (entry.owner == depth) {
+      batch.push_back(entry.value);
+      continue;
+    }
+    if (write.index == RuntimeAutoreleasePage::kEntryCapacity) {
+      write.page = write.page->child;
+      write.index = 0;
+    }
+    write.page->entries[write.index++] = entry;
+    ++write.position;
+  }
+  TruncateAutoreleasePages(write);
+  if (!batch.empty()) {
+    std::lock_guard<std::mutex> lock(state.mutex);
+    ReleaseRuntimeValueBatchUnlocked(state, batch);
+  }
 }
 
 void ResetRuntimeAutoreleasepoolStateForTesting() {
   g_runtime_dispatch_frames.clear();
   g_runtime_testing_dispatch_frame = RuntimeDispatchFrame{};
   g_runtime_has_testing_dispatch_frame = false;
-  g_runtime_autoreleasepool_frames.clear();
+  {
+    RuntimeAutoreleasePageStack &stack = g_runtime_autorelease_pages;
+    if (stack.first != nullptr) {
+      TruncateAutoreleasePages({stack.first, 0, 0});
+    }
+    stack.high_water_position = 0;
+    stack.pool_depth = 0;
+    stack.queued_pool_value_count = 0;
+  }
+  ResetRuntimeMetricsThreadBaseline();
   g_runtime_autoreleasepool_max_depth = 0;
   g_runtime_autoreleasepool_drained_value_count = 0;
   g_runtime_last_autoreleased_value = 0;
   g_runtime_last_drained_autorelease_value = 0;
-  g_runtime_arc_debug_retain_call_count = 0;
-  g_runtime_arc_debug_release_call_count = 0;
-  g_runtime_arc_debug_autorelease_call_count = 0;
-  g_runtime_arc_debug_autoreleasepool_push_count = 0;
-  g_runtime_arc_debug_autoreleasepool_pop_count = 0;
   g_runtime_arc_debug_current_property_read_count = 0;
   g_runtime_arc_debug_current_property_write_count = 0;
   g_runtime_arc_debug_current_property_exchange_count = 0;
@@ -900,8 +2645,6 @@ void ResetRuntimeAutoreleasepoolStateForTesting() {
   g_runtime_arc_debug_last_property_receiver = 0;
   g_runtime_arc_debug_last_property_name.clear();
   g_runtime_arc_debug_last_property_owner_identity.clear();
-  g_runtime_block_promote_call_count = 0;
-  g_runtime_block_invoke_call_count = 0;
   g_runtime_last_promoted_block_handle = 0;
   g_runtime_last_promote_has_pointer_capture_storage = 0;
   g_runtime_last_invoked_block_handle = 0;
@@ -921,19 +2664,6 @@ void ResetRuntimeAutoreleasepoolStateForTesting() {
   g_runtime_error_bridge_last_catch_match_is_catch_all = 0;
   g_runtime_error_bridge_last_catch_match_result = 0;
   g_runtime_error_bridge_last_catch_kind_name.clear();
-  g_runtime_async_continuation_allocation_call_count = 0;
-  g_runtime_async_continuation_handoff_call_count = 0;
-  g_runtime_async_continuation_resume_call_count = 0;
-  g_runtime_async_continuation_next_handle = 1;
-  g_runtime_async_continuation_last_allocated_handle = 0;
-  g_runtime_async_continuation_last_allocated_resume_entry_tag = 0;
-  g_runtime_async_continuation_last_allocated_executor_tag = 0;
-  g_runtime_async_continuation_last_handoff_handle = 0;
-  g_runtime_async_continuation_last_handoff_executor_tag = 0;
-  g_runtime_async_continuation_last_resume_handle = 0;
-  g_runtime_async_continuation_last_resume_result_value = 0;
-  g_runtime_async_continuation_last_resume_return_value = 0;
-  g_runtime_async_live_continuation_handles.clear();
   g_runtime_task_spawn_call_count = 0;
   g_runtime_task_scope_call_count = 0;
   g_runtime_task_add_task_call_count = 0;
@@ -962,6 +2692,7 @@ void ResetRuntimeAutoreleasepoolStateForTesting() {
   g_runtime_task_last_executor_hop_value = 0;
   g_runtime_task_last_wait_next_result = 0;
   g_runtime_task_last_cancel_all_result = 0;
+  g_runtime_lowered_task_group_handle = 0;
   g_runtime_task_last_cancellation_poll_result = 0;
   g_runtime_actor_last_isolation_executor_tag = 0;
   g_runtime_actor_last_nonisolated_value = 0;
@@ -978,7 +2709,6 @@ void ResetRuntimeAutoreleasepoolStateForTesting() {
   g_runtime_actor_last_mailbox_executor_tag = 0;
   g_runtime_actor_last_mailbox_depth = 0;
   g_runtime_actor_last_mailbox_drained_value = 0;
-  g_runtime_actor_mailboxes.clear();
 }
 
 void RecordArcDebugPropertyContext(const RuntimeDispatchFrame *frame) {
@@ -1028,29 +2758,47 @@ bool RuntimeErrorCatchKindMatches(int catch_kind) {
 }
 
 void PushRuntimeAutoreleasePoolFrame() {
-  g_runtime_autoreleasepool_frames.push_back({});
-  ++g_runtime_arc_debug_autoreleasepool_push_count;
-  g_runtime_autoreleasepool_max_depth = std::max<std::uint64_t>(
-      g_runtime_autoreleasepool_max_depth,
-      static_cast<std::uint64_t>(g_runtime_autoreleasepool_frames.size()));
-}
-
-std::vector<int> PopRuntimeAutoreleasePoolFrameValues() {
-  if (g_runtime_autoreleasepool_frames.empty()) {
-    return {};
+  RuntimeAutoreleasePageStack &stack = g_runtime_autorelease_pages;
+  PushAutoreleaseEntry(0, kRuntimeAutoreleasePoolOwner);
+  ++stack.pool_depth;
+  BumpRuntimeMetric(RuntimeMetric::AutoreleasePoolPush);
+  g_runtime_autoreleasepool_max_depth =
+      std::max(g_runtime_autoreleasepool_max_depth, stack.pool_depth);
+}
+
+// Drains the innermost pool by walking down to its boundary; the last value
+// reached is the pool's oldest, matching a LIFO drain.
+void PopRuntimeAutoreleasePoolFrame(RuntimeState &state) {
+  RuntimeAutoreleasePageStack &stack = g_runtime_autorelease_pages;
+  if (stack.pool_depth == 0) {
+    return;
   }
-  RuntimeAutoreleasePoolFrame frame =
-      std::move(g_runtime_autoreleasepool_frames.back());
-  g_runtime_autoreleasepool_frames.pop_back();
-  return std::move(frame.values);
-}
-
-std::uint64_t CountQueuedAutoreleaseValues() {
-  std::uint64_t total = 0;
-  for (const RuntimeAutoreleasePoolFrame &frame : g_runtime_autoreleasepool_frames) {
-    total += static_cast<std::uint64_t>(frame.values.size());
+  --stack.pool_depth;
+  std::vector<int> &batch = g_runtime_autorelease_drain_batch;
+  RuntimeAutoreleasePage *page = stack.hot;
+  std::size_t index = page->used;
+  std::uint64_t position = stack.position;
+  for (;;) {
+    if (index == 0) {
+      page = page->parent;
+      index = page->used;
+    }
+    const int value = page->entries[--index].value;
+    --position;
+    if (value == 0) {
+      break;
+    }
+    batch.push_back(value);
+  }
+  TruncateAutoreleasePages({page, index, position});
+  if (batch.empty()) {
+    return;
   }
-  return total;
+  stack.queued_pool_value_count -= batch.size();
+  g_runtime_last_drained_autorelease_value = batch.back();
+  g_runtime_autoreleasepool_drained_value_count += batch.size();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  ReleaseRuntimeValueBatchUnlocked(state, batch);
 }
 
 void EnqueueAutoreleaseValue(int value) {
@@ -1058,106 +2806,151 @@ void EnqueueAutoreleaseValue(int value) {
     return;
   }
   g_runtime_last_autoreleased_value = value;
-  if (!g_runtime_autoreleasepool_frames.empty()) {
-    g_runtime_autoreleasepool_frames.back().values.push_back(value);
-    return;
-  }
-  if (g_runtime_dispatch_frames.size() >= 2u) {
-    g_runtime_dispatch_frames[g_runtime_dispatch_frames.size() - 2u]
-        .autorelease_values.push_back(value);
+  RuntimeAutoreleasePageStack &stack = g_runtime_autorelease_pages;
+  if (stack.pool_depth != 0) {
+    PushAutoreleaseEntry(value, kRuntimeAutoreleasePoolOwner);
+    ++stack.queued_pool_value_count;
     return;
   }
-  if (RuntimeDispatchFrame *frame = CurrentRuntimeDispatchFrame()) {
-    frame->autorelease_values.push_back(value);
+  // Outside any pool a value belongs to the caller's frame, so a callee's
+  // autoreleased result survives its return. Values autoreleased with no
+  // live dispatch frame are never drained, so they are not recorded.
+  const std::size_t depth = g_runtime_dispatch_frames.size();
+  if (depth != 0) {
+    PushAutoreleaseEntry(value,
+                         static_cast<std::uint32_t>(depth >= 2u ? depth - 1u : 1u));
   }
 }
 
 bool IsRuntimeManagedReceiverValueUnlocked(const RuntimeState &state, int value) {
-  return value != 0 &&
-         state.runtime_instances_by_receiver.find(value) !=
-             state.runtime_instances_by_receiver.end();
+  return value != 0 && FindRuntimeInstanceUnlocked(state, value) != nullptr;
 }
 
-void RemoveWeakSlotRefUnlocked(RuntimeState &state, int target_receiver,
-                               int owner_receiver, std::size_t offset,
-                               std::size_t size) {
-  if (target_receiver == 0) {
+RuntimeWeakSideTableStripe &WeakSideTableStripe(RuntimeState &state,
+                                                int target_receiver) {
+  const std::uint32_t mixed =
+      static_cast<std::uint32_t>(target_receiver) * 0x9e3779b1u;
+  return state.weak_side_table
+      .stripes[(mixed >> 16u) % kRuntimeWeakSideTableStripeCount];
+}
+
+std::uint64_t WeakSlotKey(int owner_receiver, std::size_t offset) {
+  return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(owner_receiver))
+          << 32u) |
+         static_cast<std::uint64_t>(offset);
+}
+
+// Weak slots are read by lock-free weak loads while stores and zeroing run
+// under the target stripe, so their value word is accessed atomically whenever
+// the layout allows it. The word is the slot's low 32 bits, which is what the
+// raw property helpers read and write on little-endian targets.
+bool WeakSlotWordIsAtomic(const unsigned char *slot, std::size_t size) {
+  return std::endian::native == std::endian::little &&
+         size >= sizeof(std::uint32_t) &&
+         reinterpret_cast<std::uintptr_t>(slot) % alignof(std::uint32_t) == 0u;
+}
+
+std::uint32_t LoadWeakSlotWord(const unsigned char *slot, std::size_t size) {
+  if (WeakSlotWordIsAtomic(slot, size)) {
+    return std::atomic_ref<std::uint32_t>(
+               *reinterpret_cast<std::uint32_t *>(
+                   const_cast<unsigned char *>(slot)))
+        .load(std::memory_order_acquire);
+  }
+  std::uint64_t raw = 0;
+  std::memcpy(&raw, slot, std::min<std::size_t>(size, sizeof(raw)));
+  return static_cast<std::uint32_t>(raw & 0xffffffffu);
+}
+
+void StoreWeakSlotWord(unsigned char *slot, std::size_t size,
+                       std::uint32_t word) {
+  if (WeakSlotWordIsAtomic(slot, size)) {
+    std::atomic_ref<std::uint32_t>(*reinterpret_cast<std::uint32_t *>(slot))
+        .store(word, std::memory_order_release);
     return;
   }
-  const auto found = state.weak_slot_refs_by_target_receiver.find(target_receiver);
-  if (found == state.weak_slot_refs_by_target_receiver.end()) {
+  const std::uint64_t raw = word;
+  std::memcpy(slot, &raw, std::min<std::size_t>(size, sizeof(raw)));
+  if (size > sizeof(raw)) {
+    std::fill(slot + sizeof(raw), slot + size, 0);
+  }
+}
+
+// Caller holds the stripe for |target_receiver|.
+void UnregisterWeakSlotRefLocked(RuntimeWeakSideTableStripe &stripe,
+                                 int target_receiver, int owner_receiver,
+                                 std::size_t offset) {
+  const auto index_it =
+      stripe.referrer_index_by_slot.find(WeakSlotKey(owner_receiver, offset));
+  const auto target_it = stripe.referrers_by_target.find(target_receiver);
+  if (index_it == stripe.referrer_index_by_slot.end() ||
+      target_it == stripe.referrers_by_target.end()) {
     return;
   }
-  auto &refs = found->second;
-  refs.erase(
-      std::remove_if(
-          refs.begin(), refs.end(),
-          [&](const RuntimeWeakSlotRef &ref) {
-            return ref.owner_receiver == owner_receiver && ref.offset == offset &&
-                   ref.size == size;
-          }),
-      refs.end());
+  std::vector<RuntimeWeakSlotRef> &refs = target_it->second;
+  const std::uint32_t index = index_it->second;
+  stripe.referrer_index_by_slot.erase(index_it);
+  if (index + 1u != refs.size()) {
+    refs[index] = refs.back();
+    stripe.referrer_index_by_slot[WeakSlotKey(refs[index].owner_receiver,
+                                              refs[index].offset)] = index;
+  }
+  refs.pop_back();
   if (refs.empty()) {
-    state.weak_slot_refs_by_target_receiver.erase(found);
+    stripe.referrers_by_target.erase(target_it);
   }
 }
 
-void RegisterWeakSlotRefUnlocked(RuntimeState &state, int target_receiver,
-                                 int owner_receiver, std::size_t offset,
-                                 std::size_t size) {
+// Caller holds the stripe for |target_receiver|.
+void RegisterWeakSlotRefLocked(RuntimeWeakSideTableStripe &stripe,
+                               int target_receiver, int owner_receiver,
+                               std::size_t offset, std::size_t size) {
+  std::vector<RuntimeWeakSlotRef> &refs =
+      stripe.referrers_by_target[target_receiver];
+  const auto inserted = stripe.referrer_index_by_slot.emplace(
+      WeakSlotKey(owner_receiver, offset),
+      static_cast<std::uint32_t>(refs.size()));
+  if (inserted.second) {
+    refs.push_back(RuntimeWeakSlotRef{owner_receiver,
+                                      static_cast<std::uint32_t>(offset),
+                                      static_cast<std::uint32_t>(size)});
+  }
+}
+
+void RemoveWeakSlotRefUnlocked(RuntimeState &state, int target_receiver,
+                               int owner_receiver, std::size_t offset) {
   if (target_receiver == 0) {
     return;
   }
-  std::vector<RuntimeWeakSlotRef> &refs =
-      state.weak_slot_refs_by_target_receiver[target_receiver];
-  const auto duplicate =
-      std::find_if(refs.begin(), refs.end(), [&](const RuntimeWeakSlotRef &ref) {
-        return ref.owner_receiver == owner_receiver && ref.offset == offset &&
-               ref.size == size;
-      });
-  if (duplicate == refs.end()) {
-    refs.push_back(RuntimeWeakSlotRef{owner_receiver, offset, size});
-  }
-}
-
-void RemoveWeakSlotRefsOwnedByReceiverUnlocked(RuntimeState &state,
-                                               int owner_receiver) {
-  for (auto it = state.weak_slot_refs_by_target_receiver.begin();
-       it != state.weak_slot_refs_by_target_receiver.end();) {
-    auto &refs = it->second;
-    refs.erase(std::remove_if(refs.begin(), refs.end(),
-                              [&](const RuntimeWeakSlotRef &ref) {
-                                return ref.owner_receiver == owner_receiver;
-                              }),
-               refs.end());
-    if (refs.empty()) {
-      it = state.weak_slot_refs_by_target_receiver.erase(it);
-    } else {
-      ++it;
-    }
-  }
+  RuntimeWeakSideTableStripe &stripe =
+      WeakSideTableStripe(state, target_receiver);
+  std::lock_guard<std::mutex> stripe_lock(stripe.mutex);
+  UnregisterWeakSlotRefLocked(stripe, target_receiver, owner_receiver, offset);
 }
 
 void ZeroWeakSlotRefsForTargetUnlocked(RuntimeState &state, int target_receiver) {
-  const auto found = state.weak_slot_refs_by_target_receiver.find(target_receiver);
-  if (found == state.weak_slot_refs_by_target_receiver.end()) {
+  RuntimeWeakSideTableStripe &stripe =
+      WeakSideTableStripe(state, target_receiver);
+  std::lock_guard<std::mutex> stripe_lock(stripe.mutex);
+  const auto found = stripe.referrers_by_target.find(target_receiver);
+  if (found == stripe.referrers_by_target.end()) {
     return;
   }
   for (const RuntimeWeakSlotRef &ref : found->second) {
-    const auto owner_it = state.runtime_instances_by_receiver.find(ref.owner_receiver);
-    if (owner_it == state.runtime_instances_by_receiver.end()) {
+    stripe.referrer_index_by_slot.erase(
+        WeakSlotKey(ref.owner_receiver, ref.offset));
+    RuntimeInstanceRecord *owner =
+        FindRuntimeInstanceUnlocked(state, ref.owner_receiver);
+    if (owner == nullptr) {
       continue;
     }
-    RuntimeInstanceRecord &owner = owner_it->second;
-    if (ref.size == 0u || ref.offset + ref.size > owner.storage_bytes.size()) {
+    if (ref.size == 0u ||
+        std::size_t{ref.offset} + ref.size > owner->instance_size_bytes) {
       continue;
     }
-    std::fill(owner.storage_bytes.begin() + static_cast<std::ptrdiff_t>(ref.offset),
-              owner.storage_bytes.begin() +
-                  static_cast<std::ptrdiff_t>(ref.offset + ref.size),
-              0);
+    StoreWeakSlotWord(owner->storage_bytes + ref.offset, ref.size, 0u);
   }
-  state.weak_slot_refs_by_target_receiver.erase(found);
+  stripe.referrers_by_target.erase(found);
 }
 
 std::string BuildSynthesizedInstanceMethodOwnerIdentity(
@@ -1214,9 +3007,48 @@ bool SelectorMatchesMethodEntryUnlocked(RuntimeState &state,
          entry_handle->stable_id == selector_stable_id;
 }
 
+bool IsCallableMethodListEntry(const EmittedMethodListEntry &entry,
+                               RuntimeMethodReturnKind return_kind) {
+  return entry.has_body != 0 && entry.implementation != nullptr &&
+         return_kind != RuntimeMethodReturnKind::Unsupported &&
+         entry.parameter_count <= 4;
+}
+
+// Returns false when an earlier match in the same walk disagrees with entry.
+bool RecordMethodListEntryResolution(const EmittedMethodListEntry &entry,
+                                     RuntimeMethodReturnKind return_kind,
+                                     RuntimeSymbolId resolved_class_id,
+                                     DispatchFamily family,
+                                     std::uint64_t normalized_receiver_identity,
+                                     std::uint64_t selector_stable_id,
+                                     const char *selector_spelling,
+                                     SlowPathResolution &resolution) {
+  if (resolution.resolved &&
+      (resolution.implementation != entry.implementation ||
+       resolution.parameter_count != entry.parameter_count ||
+       resolution.return_kind != return_kind ||
+       resolution.owner_identity != entry.owner_identity ||
+       resolution.class_id != resolved_class_id)) {
+    return false;
+  }
+  resolution.resolved = true;
+  resolution.dispatch_family_is_class = family == DispatchFamily::Class;
+  resolution.selector_storage = selector_spelling != nullptr ? selector_spelling : "";
+  resolution.class_id = resolved_class_id;
+  resolution.owner_identity = entry.owner_identity;
+  resolution.normalized_receiver_identity = normalized_receiver_identity;
+  resolution.selector_stable_id = selector_stable_id;
+  resolution.parameter_count = entry.parameter_count;
+  resolution.return_kind = return_kind;
+  resolution.implementation = entry.implementation;
+  resolution.effective_direct_dispatch = entry.effective_direct_dispatch;
+  resolution.objc_final_declared = entry.objc_final_declared;
+  return true;
+}
+
 bool TryResolveMethodFromMethodListRefUnlocked(
     RuntimeState &state, const EmittedMethodListRef *method_list_ref,
-    const char *resolved_class_name, DispatchFamily family,
+    RuntimeSymbolId resolved_class_id, DispatchFamily family,
     std::uint64_t normalized_receiver_identity, std::uint64_t selector_stable_id,
     const char *selector_spelling, SlowPathResolution &resolution,
     bool &ambiguous) {
@@ -1241,34 +3073,194 @@ bool TryResolveMethodFromMethodListRefUnlocked(
     if (!SelectorMatchesMethodEntryUnlocked(state, entry.selector,
                                             selector_stable_id,
                                             selector_spelling) ||
-        entry.has_body == 0 || entry.implementation == nullptr ||
-        entry_return_kind == RuntimeMethodReturnKind::Unsupported ||
-        entry.parameter_count > 4) {
+        !IsCallableMethodListEntry(entry, entry_return_kind)) {
       continue;
     }
-    if (resolution.resolved &&
-        (resolution.implementation != entry.implementation ||
-         resolution.parameter_count != entry.parameter_count ||
-         resolution.return_kind != entry_return_kind ||
-         resolution.owner_identity != entry.owner_identity ||
-         resolution.class_name !=
-             (resolved_class_name != nullptr ? resolved_class_name : ""))) {
+    if (!RecordMethodListEntryResolution(
+            entry, entry_return_kind, resolved_class_id, family,
+            normalized_receiver_identity, selector_stable_id, selector_spelling,
+            resolution)) {
       ambiguous = true;
       return true;
     }
-    resolution.resolved = true;
-    resolution.dispatch_family_is_class = family == DispatchFamily::Class;
-    resolution.selector_storage = selector_spelling != nullptr ? selector_spelling : "";
-    resolution.class_name =
-        resolved_class_name != nullptr ? resolved_class_name : "";
-    resolution.owner_identity = entry.owner_identity;
-    resolution.normalized_receiver_identity = normalized_receiver_identity;
-    resolution.selector_stable_id = selector_stable_id;
-    resolution.parameter_count = entry.parameter_count;
-    resolution.return_kind = entry_return_kind;
-    resolution.implementation = entry.implementation;
-    resolution.effective_direct_dispatch = entry.effective_direct_dispatch;
-    resolution.objc_final_declared = entry.objc_final_declared;
+  }
+  return true;
+}
+
+std::size_t FindRealizedMethodTableSlot(const RealizedMethodTable &table,
+                                        std::uint64_t selector_stable_id) {
+  const std::size_t mask = table.slots.size() - 1u;
+  std::size_t index = static_cast<std::size_t>(
+                          selector_stable_id * 0x9E3779B97F4A7C15ull) &
+                      mask;
+  while (table.slots[index].selector_stable_id != 0 &&
+         table.slots[index].selector_stable_id != selector_stable_id) {
+    index = (index + 1u) & mask;
+  }
+  return index;
+}
+
+void BuildRealizedMethodTableUnlocked(RuntimeState &state,
+                                      const EmittedMethodListRef *method_list_ref,
+                                      RealizedMethodTable &table) {
+  table = RealizedMethodTable{};
+  table.method_list_ref = method_list_ref;
+  table.indexed = true;
+  if (method_list_ref == nullptr || method_list_ref->count == 0 ||
+      method_list_ref->method_list == nullptr) {
+    ++state.indexed_method_list_count;
+    return;
+  }
+  const auto *header =
+      static_cast<const EmittedMethodListHeader *>(method_list_ref->method_list);
+  if (header == nullptr || header->count != method_list_ref->count) {
+    table.malformed = true;
+    ++state.indexed_method_list_count;
+    return;
+  }
+  // Entries are classified and their selectors resolved against the interned
+  // table without materializing anything, so building the index leaves
+  // selector-table counters exactly as the linear walk would have.
+  const EmittedMethodListEntry *entries = MethodListEntries(header);
+  std::vector<RealizedMethodTableSlot> callable_entries;
+  for (std::uint64_t index = 0; index < header->count; ++index) {
+    const EmittedMethodListEntry &entry = entries[index];
+    if (entry.selector == nullptr || entry.owner_identity == nullptr ||
+        entry.return_type_name == nullptr) {
+      table.malformed = true;
+      break;
+    }
+    const std::size_t selector_index =
+        FindSelectorSlotIndexUnlocked(state, entry.selector);
+    if (selector_index == kNoSelectorSlot ||
+        state.selector_slots[selector_index].handle.stable_id == 0) {
+      table = RealizedMethodTable{};
+      table.method_list_ref = method_list_ref;
+      ++state.unindexed_method_list_count;
+      return;
+    }
+    const RuntimeMethodReturnKind return_kind =
+        ClassifyRuntimeReturnType(entry.return_type_name);
+    if (!IsCallableMethodListEntry(entry, return_kind)) {
+      continue;
+    }
+    RealizedMethodTableSlot slot;
+    slot.selector_stable_id =
+        state.selector_slots[selector_index].handle.stable_id;
+    slot.entry = &entry;
+    slot.return_kind = return_kind;
+    callable_entries.push_back(slot);
+  }
+  ++state.indexed_method_list_count;
+  if (callable_entries.empty()) {
+    return;
+  }
+  std::size_t capacity = 4;
+  while (capacity < callable_entries.size() * 2u) {
+    capacity <<= 1u;
+  }
+  table.slots.resize(capacity);
+  for (const RealizedMethodTableSlot &candidate : callable_entries) {
+    RealizedMethodTableSlot &slot =
+        table.slots[FindRealizedMethodTableSlot(table, candidate.selector_stable_id)];
+    if (slot.selector_stable_id == 0) {
+      slot = candidate;
+      ++state.indexed_method_entry_count;
+      continue;
+    }
+    // Same disagreement test as the linear walk; agreeing duplicates keep
+    // last-wins so direct/final flags still come from the later entry.
+    const EmittedMethodListEntry &previous = *slot.entry;
+    const EmittedMethodListEntry &entry = *candidate.entry;
+    if (previous.implementation != entry.implementation ||
+        previous.parameter_count != entry.parameter_count ||
+        slot.return_kind != candidate.return_kind ||
+        std::strcmp(previous.owner_identity, entry.owner_identity) != 0) {
+      slot.ambiguous = true;
+    }
+    slot.entry = candidate.entry;
+  }
+  state.method_table_slot_count += static_cast<std::uint64_t>(capacity);
+}
+
+void BuildRealizedMethodTablesUnlocked(RuntimeState &state,
+                                       RealizedClassNode &node) {
+  node.instance_method_tables = RealizedMethodTables{};
+  node.class_method_tables = RealizedMethodTables{};
+  if (node.bundle == nullptr) {
+    return;
+  }
+  BuildRealizedMethodTableUnlocked(
+      state, node.bundle->class_record.method_list_ref,
+      node.instance_method_tables.class_methods);
+  BuildRealizedMethodTableUnlocked(
+      state, node.bundle->metaclass_record.method_list_ref,
+      node.class_method_tables.class_methods);
+  node.instance_method_tables.category_methods.resize(
+      node.attached_category_records.size());
+  node.class_method_tables.category_methods.resize(
+      node.attached_category_records.size());
+  for (std::size_t index = 0; index < node.attached_category_records.size();
+       ++index) {
+    const EmittedCategoryRecord &category_record =
+        *node.attached_category_records[index];
+    BuildRealizedMethodTableUnlocked(
+        state, category_record.instance_method_list_ref,
+        node.instance_method_tables.category_methods[index]);
+    BuildRealizedMethodTableUnlocked(
+        state, category_record.class_method_list_ref,
+        node.class_method_tables.category_methods[index]);
+  }
+}
+
+const RealizedMethodTables &SelectMethodTables(const RealizedClassNode &node,
+                                               DispatchFamily family) {
+  return family == DispatchFamily::Class ? node.class_method_tables
+                                         : node.instance_method_tables;
+}
+
+bool TryResolveMethodFromRealizedMethodTableUnlocked(
+    RuntimeState &state, const RealizedMethodTable &table,
+    RuntimeSymbolId resolved_class_id, DispatchFamily family,
+    std::uint64_t normalized_receiver_identity, std::uint64_t selector_stable_id,
+    const char *selector_spelling, SlowPathResolution &resolution,
+    bool &ambiguous) {
+  if (!table.indexed) {
+    ++state.method_list_scan_count;
+    return TryResolveMethodFromMethodListRefUnlocked(
+        state, table.method_list_ref, resolved_class_id, family,
+        normalized_receiver_identity, selector_stable_id, selector_spelling,
+        resolution, ambiguous);
+  }
+  const RealizedMethodTableSlot *slot = nullptr;
+  if (!table.slots.empty()) {
+    std::uint64_t probe_stable_id = selector_stable_id;
+    if (probe_stable_id == 0 && selector_spelling != nullptr &&
+        selector_spelling[0] != '\0') {
+      const objc3_runtime_selector_handle *lookup_handle =
+          LookupSelectorUnlocked(selector_spelling);
+      probe_stable_id = lookup_handle != nullptr ? lookup_handle->stable_id : 0;
+    }
+    if (probe_stable_id != 0) {
+      ++state.method_table_probe_count;
+      const RealizedMethodTableSlot &candidate =
+          table.slots[FindRealizedMethodTableSlot(table, probe_stable_id)];
+      slot = candidate.selector_stable_id != 0 ? &candidate : nullptr;
+    }
+  }
+  if (slot != nullptr && slot->ambiguous) {
+    ambiguous = true;
+    return true;
+  }
+  if (table.malformed) {
+    return false;
+  }
+  if (slot != nullptr &&
+      !RecordMethodListEntryResolution(
+          *slot->entry, slot->return_kind, resolved_class_id, family,
+          normalized_receiver_identity, selector_stable_id, selector_spelling,
+          resolution)) {
+    ambiguous = true;
   }
   return true;
 }
@@ -1339,14 +3331,23 @@ bool ProbeProtocolSelectorDeclarationUnlocked(
   return true;
 }
 
+bool IsImplementationCategoryRecord(const EmittedCategoryRecord &record) {
+  return std::strcmp(record.record_kind, "implementation") == 0;
+}
+
 bool CollectPreferredCategoryRecordsForImage(
-    const RegisteredImageMetadata &record, const std::string &class_name,
+    const RegisteredImageMetadata &record,
+    const std::vector<RuntimeSymbolId> &category_class_ids,
+    RuntimeSymbolId class_id,
     std::vector<const EmittedCategoryRecord *> &preferred_records) {
   // class-realization-runtime freeze anchor: category attachment is
   // resolved from emitted category records only after one concrete class name
   // has been selected. Runtime prefers implementation records over interface
   // records per category name and fails closed on conflicting attachments.
-  std::unordered_map<std::string, const EmittedCategoryRecord *> grouped_records;
+  // Each record's target class was interned once for the whole image, so
+  // matching it against the class is an id compare.
+  std::unordered_map<std::string_view, const EmittedCategoryRecord *>
+      grouped_records;
   grouped_records.reserve(static_cast<std::size_t>(record.category_descriptor_count));
   for (std::uint64_t index = 0; index < record.category_descriptor_count; ++index) {
     const auto *category_record = static_cast<const EmittedCategoryRecord *>(
@@ -1357,22 +3358,23 @@ bool CollectPreferredCategoryRecordsForImage(
         category_record->owner_identity == nullptr) {
       return false;
     }
-    if (class_name != category_record->class_name) {
+    if (index >= category_class_ids.size() ||
+        category_class_ids[static_cast<std::size_t>(index)] != class_id) {
       continue;
     }
-    const std::string key = category_record->category_name;
+    const std::string_view key = category_record->category_name;
     const bool is_implementation =
-        std::string(category_record->record_kind) == "implementation";
+        IsImplementationCategoryRecord(*category_record);
     auto existing = grouped_records.find(key);
     if (existing == grouped_records.end()) {
       grouped_records.emplace(key, category_record);
       continue;
     }
     const bool existing_is_implementation =
-        std::string(existing->second->record_kind) == "implementation";
+        IsImplementationCategoryRecord(*existing->second);
     if (existing_is_implementation == is_implementation &&
-        std::string(existing->second->owner_identity) !=
-            std::string(category_record->owner_identity)) {
+        std::strcmp(existing->second->owner_identity,
+                    category_record->owner_identity) != 0) {
       return false;
     }
     if (!existing_is_implementation && is_implementation) {
@@ -1386,14 +3388,14 @@ bool CollectPreferredCategoryRecordsForImage(
   }
   std::sort(preferred_records.begin(), preferred_records.end(),
             [](const EmittedCategoryRecord *lhs, const EmittedCategoryRecord *rhs) {
-              return std::make_tuple(std::string(lhs->class_name),
-                                     std::string(lhs->category_name),
-                                     std::string(lhs->record_kind),
-                                     std::string(lhs->owner_identity)) <
-                     std::make_tuple(std::string(rhs->class_name),
-                                     std::string(rhs->category_name),
-                                     std::string(rhs->record_kind),
-                                     std::string(rhs->owner_identity));
+              return std::make_tuple(std::string_view(lhs->class_name),
+                                     std::string_view(lhs->category_name),
+                                     std::string_view(lhs->record_kind),
+                                     std::string_view(lhs->owner_identity)) <
+                     std::make_tuple(std::string_view(rhs->class_name),
+                                     std::string_view(rhs->category_name),
+                                     std::string_view(rhs->record_kind),
+                                     std::string_view(rhs->owner_identity));
             });
   return true;
 }
@@ -1488,20 +3490,22 @@ bool QueryProtocolConformanceFromAggregateUnlocked(
   return false;
 }
 
-bool AttachRealizedCategoryRecordsUnlocked(RuntimeState &state,
-                                           RealizedClassNode &node) {
+bool AttachRealizedCategoryRecordsUnlocked(
+    RuntimeState &state, RealizedClassNode &node,
+    const std::vector<RuntimeSymbolId> &category_class_ids) {
   // category-attachment-protocol-conformance anchor: realized class
   // nodes now own preferred category attachments and direct protocol edges so
   // later dispatch/query paths consume the published graph instead of
   // rediscovering category/protocol relationships on each lookup.
   node.attached_category_records.clear();
+  node.conformance = RealizedClassConformance{};
   node.runtime_attachment_ready = false;
   if (node.image == nullptr) {
     return false;
   }
   std::vector<const EmittedCategoryRecord *> category_records;
-  if (!CollectPreferredCategoryRecordsForImage(*node.image, node.class_name,
-                                               category_records)) {
+  if (!CollectPreferredCategoryRecordsForImage(
+          *node.image, category_class_ids, node.class_id, category_records)) {
     return false;
   }
   for (const EmittedCategoryRecord *category_record : category_records) {
@@ -1548,6 +3552,9 @@ RuntimeMethodReturnKind ClassifySynthesizedPropertyReturnType(
   return RuntimeMethodReturnKind::Unsupported;
 }
 
+void ClassifyDirectPropertyAccess(const RealizedClassNode &node,
+                                  RealizedPropertyAccessor &accessor);
+
 bool AttachRealizedPropertyLayoutRecordsUnlocked(RuntimeState &state,
                                                  RealizedClassNode &node) {
   // instance-allocation-layout-runtime anchor: realized classes now
@@ -1635,6 +3642,8 @@ bool AttachRealizedPropertyLayoutRecordsUnlocked(RuntimeState &state,
     accessor.ivar_descriptor = ivar_descriptor;
     accessor.getter_return_kind =
         ClassifySynthesizedPropertyReturnType(*descriptor);
+    accessor.property_id =
+        InternRuntimeSymbolUnlocked(state, descriptor->property_name);
     accessor.getter_owner_identity = BuildSynthesizedInstanceMethodOwnerIdentity(
         descriptor->declaration_owner_identity,
         descriptor->effective_getter_selector);
@@ -1645,6 +3654,7 @@ bool AttachRealizedPropertyLayoutRecordsUnlocked(RuntimeState &state,
           descriptor->declaration_owner_identity,
           descriptor->effective_setter_selector);
     }
+    ClassifyDirectPropertyAccess(node, accessor);
     node.runtime_property_accessors.push_back(std::move(accessor));
   }
 
@@ -1706,7 +3716,7 @@ bool TryResolveRuntimeManagedPropertyAccessorUnlocked(
           resolution.resolved = true;
           resolution.dispatch_family_is_class = false;
           resolution.selector_storage = selector_spelling;
-          resolution.class_name = node->class_name;
+          resolution.class_id = node->class_id;
           resolution.owner_identity = accessor.getter_owner_identity;
           resolution.normalized_receiver_identity = normalized_receiver_identity;
           resolution.selector_stable_id = selector_stable_id;
@@ -1724,7 +3734,7 @@ bool TryResolveRuntimeManagedPropertyAccessorUnlocked(
           resolution.resolved = true;
           resolution.dispatch_family_is_class = false;
           resolution.selector_storage = selector_spelling;
-          resolution.class_name = node->class_name;
+          resolution.class_id = node->class_id;
           resolution.owner_identity = accessor.setter_owner_identity;
           resolution.normalized_receiver_identity = normalized_receiver_identity;
           resolution.selector_stable_id = selector_stable_id;
@@ -1753,9 +3763,11 @@ const RealizedPropertyAccessor *FindRuntimePropertyAccessorByNameUnlocked(
   if (property_name == nullptr || property_name[0] == '\0') {
     return nullptr;
   }
+  // Queried names are interned even when no accessor declares them, so a
+  // repeated negative lookup is a cache hit like any other.
   PropertyLookupCacheKey cache_key;
   cache_key.start_base_identity = start_node.base_identity;
-  cache_key.property_name = property_name;
+  cache_key.property_id = InternRuntimeSymbolUnlocked(state, property_name);
   const auto cache_it = state.property_lookup_cache.find(cache_key);
   if (cache_it != state.property_lookup_cache.end()) {
     used_cache = true;
@@ -1786,12 +3798,10 @@ const RealizedPropertyAccessor *FindRuntimePropertyAccessorByNameUnlocked(
     if (node->runtime_layout_ready) {
       for (const RealizedPropertyAccessor &accessor :
            node->runtime_property_accessors) {
-        if (accessor.property_descriptor == nullptr ||
-            accessor.property_descriptor->property_name == nullptr) {
+        if (accessor.property_descriptor == nullptr) {
           continue;
         }
-        if (std::strcmp(accessor.property_descriptor->property_name,
-                        property_name) == 0) {
+        if (accessor.property_id == cache_key.property_id) {
           resolved_node = node;
           inherited = node != &start_node;
           const std::size_t resolved_node_index = static_cast<std::size_t>(
@@ -1799,7 +3809,7 @@ const RealizedPropertyAccessor *FindRuntimePropertyAccessorByNameUnlocked(
           const std::size_t accessor_index = static_cast<std::size_t>(
               &accessor - node->runtime_property_accessors.data());
           state.property_lookup_cache.emplace(
-              std::move(cache_key),
+              cache_key,
               PropertyLookupCacheEntry{true, inherited, resolved_node_index,
                                        accessor_index});
           return &accessor;
@@ -1809,8 +3819,7 @@ const RealizedPropertyAccessor *FindRuntimePropertyAccessorByNameUnlocked(
     node = node->has_super_node ? &state.realized_class_nodes[node->super_node_index]
                                 : nullptr;
   }
-  state.property_lookup_cache.emplace(std::move(cache_key),
-                                      PropertyLookupCacheEntry{});
+  state.property_lookup_cache.emplace(cache_key, PropertyLookupCacheEntry{});
   return nullptr;
 }
 
@@ -1824,15 +3833,17 @@ bool TryResolveMethodFromAttachedCategoriesUnlocked(
   // preferred category implementation records become the next live method tier
   // and adopted/inherited protocol records provide declaration-aware negative
   // lookup evidence for unsupported selectors.
-  if (node.class_name.empty() || !node.runtime_attachment_ready) {
+  if (node.class_id == kNoRuntimeSymbol || !node.runtime_attachment_ready) {
     return false;
   }
-  for (const EmittedCategoryRecord *category_record :
-       node.attached_category_records) {
+  const RealizedMethodTables &method_tables = SelectMethodTables(node, family);
+  for (std::size_t index = 0; index < node.attached_category_records.size();
+       ++index) {
+    const EmittedCategoryRecord *category_record =
+        node.attached_category_records[index];
     ++category_probe_count;
-    if (!TryResolveMethodFromMethodListRefUnlocked(
-            state, SelectMethodListRef(*category_record, family),
-            node.class_name.c_str(),
+    if (!TryResolveMethodFromRealizedMethodTableUnlocked(
+            state, method_tables.category_methods[index], node.class_id,
             family, normalized_receiver_identity, selector_stable_id,
             selector_spelling, resolution, ambiguous)) {
       return false;
@@ -1879,8 +3890,9 @@ RuntimeMethodReturnKind ClassifyRuntimeReturnType(const char *return_type_name)
 }
 
 bool TryResolveRuntimeBuiltinObjectSampleMethod(
-    const std::string &class_name, DispatchFamily family,
+    const RuntimeState &state, RuntimeSymbolId class_id, DispatchFamily family,
     const char *selector_spelling, SlowPathResolution &resolution) {
+  const std::string &class_name = RuntimeSymbolName(state, class_id);
   if (class_name.empty() || selector_spelling == nullptr ||
       selector_spelling[0] == '\0') {
     return false;
@@ -1897,7 +3909,7 @@ bool TryResolveRuntimeBuiltinObjectSampleMethod(
       (selector == "alloc" || selector == "new")) {
     resolution.resolved = true;
     resolution.dispatch_family_is_class = true;
-    resolution.class_name = class_name;
+    resolution.class_id = class_id;
     resolution.selector_storage = selector;
     resolution.owner_identity =
         "runtime-builtin:" + class_name + "::class_method:" + selector;
@@ -1910,7 +3922,7 @@ bool TryResolveRuntimeBuiltinObjectSampleMethod(
   if (family == DispatchFamily::Instance && selector == "init") {
     resolution.resolved = true;
     resolution.dispatch_family_is_class = false;
-    resolution.class_name = class_name;
+    resolution.class_id = class_id;
     resolution.selector_storage = selector;
     resolution.owner_identity =
         "runtime-builtin:" + class_name + "::instance_method:init";
@@ -1929,12 +3941,22 @@ bool DecodeReceiverIdentity(const RuntimeState &state, int receiver,
   if (receiver <= 0) {
     return false;
   }
-  const auto runtime_instance_it = state.runtime_instances_by_receiver.find(receiver);
-  if (runtime_instance_it != state.runtime_instances_by_receiver.end()) {
-    base_identity = runtime_instance_it->second.base_identity;
-    family = DispatchFamily::Instance;
-    normalized_receiver_identity = base_identity + 1u;
-    return true;
+  switch (RuntimeHandleKindOf(receiver)) {
+    case RuntimeHandleKind::Instance: {
+      const RuntimeInstanceRecord *runtime_instance =
+          FindRuntimeInstanceUnlocked(state, receiver);
+      if (runtime_instance == nullptr) {
+        return false;
+      }
+      base_identity = runtime_instance->base_identity;
+      family = DispatchFamily::Instance;
+      normalized_receiver_identity = base_identity + 1u;
+      return true;
+    }
+    case RuntimeHandleKind::Block:
+      return false;
+    case RuntimeHandleKind::StaticIdentity:
+      break;
   }
   const std::int64_t signed_receiver = receiver;
   if (signed_receiver < static_cast<std::int64_t>(kReceiverIdentityBase)) {
@@ -1985,10 +4007,59 @@ std::vector<const RegisteredImageMetadata *> OrderedRegisteredImages(
   return ordered;
 }
 
-bool CollectSortedImageClassNames(const RegisteredImageMetadata &record,
-                                  std::vector<std::string> &class_names) {
-  std::unordered_set<std::string> seen;
-  seen.reserve(static_cast<std::size_t>(record.class_descriptor_count));
+// One image's class names, interned once at registration so the rest of its
+// realization matches bundles and category records by id.
+struct ImageClassSymbols {
+  // Parallel to the image's class descriptors and category descriptors.
+  std::vector<RuntimeSymbolId> bundle_class_ids;
+  std::vector<RuntimeSymbolId> category_class_ids;
+  // Distinct class ids in class-name order; the index is the receiver ordinal.
+  std::vector<RuntimeSymbolId> ordinal_class_ids;
+  // Parallel to ordinal_class_ids: that class's descriptor indices in
+  // declaration order, grouped once so realization stays linear in the
+  // image's class count.
+  std::vector<std::vector<std::size_t>> ordinal_descriptor_indices;
+};
+
+// Groups descriptors by the receiver ordinals a prebuilt image carries. The
+// ordinals must cover every class once, in strictly increasing name order,
+// so a stale image falls back to sorting rather than binding wrong classes.
+bool AdoptPrebuiltClassOrdinals(const RuntimeState &state,
+                                const RegisteredImageMetadata &record,
+                                ImageClassSymbols &symbols) {
+  const std::size_t ordinal_count =
+      static_cast<std::size_t>(record.prebuilt_class_ordinal_count);
+  symbols.ordinal_class_ids.assign(ordinal_count, kNoRuntimeSymbol);
+  symbols.ordinal_descriptor_indices.assign(ordinal_count, {});
+  for (std::size_t index = 0; index < symbols.bundle_class_ids.size(); ++index) {
+    const std::uint32_t ordinal = record.prebuilt_class_ordinals[index];
+    if (ordinal >= ordinal_count) {
+      return false;
+    }
+    RuntimeSymbolId &class_id = symbols.ordinal_class_ids[ordinal];
+    if (class_id == kNoRuntimeSymbol) {
+      class_id = symbols.bundle_class_ids[index];
+    } else if (class_id != symbols.bundle_class_ids[index]) {
+      return false;
+    }
+    symbols.ordinal_descriptor_indices[ordinal].push_back(index);
+  }
+  for (std::size_t ordinal = 0; ordinal < ordinal_count; ++ordinal) {
+    if (symbols.ordinal_class_ids[ordinal] == kNoRuntimeSymbol ||
+        (ordinal != 0 &&
+         !(RuntimeSymbolName(state, symbols.ordinal_class_ids[ordinal - 1u]) <
+           RuntimeSymbolName(state, symbols.ordinal_class_ids[ordinal])))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool InternImageClassSymbolsUnlocked(RuntimeState &state,
+                                     const RegisteredImageMetadata &record,
+                                     ImageClassSymbols &symbols) {
+  symbols.bundle_class_ids.assign(
+      static_cast<std::size_t>(record.class_descriptor_count), kNoRuntimeSymbol);
   for (std::uint64_t index = 0; index < record.class_descriptor_count; ++index) {
     const auto *bundle = static_cast<const EmittedClassBundle *>(
         AggregateEntry(record.class_descriptor_root, index));
@@ -1996,223 +4067,426 @@ bool CollectSortedImageClassNames(const RegisteredImageMetadata &record,
         bundle->class_record.class_name[0] == '\0') {
       return false;
     }
-    seen.insert(bundle->class_record.class_name);
+    symbols.bundle_class_ids[static_cast<std::size_t>(index)] =
+        InternRuntimeSymbolUnlocked(state, bundle->class_record.class_name);
   }
-  class_names.assign(seen.begin(), seen.end());
-  std::sort(class_names.begin(), class_names.end());
-  return true;
-}
-
-void RebuildRealizedClassGraphUnlocked(RuntimeState &state) {
+  if (record.prebuilt_class_ordinals != nullptr &&
+      AdoptPrebuiltClassOrdinals(state, record, symbols)) {
+    ++state.prebuilt_class_ordinal_image_count;
+  } else {
+    symbols.ordinal_class_ids = symbols.bundle_class_ids;
+    std::sort(symbols.ordinal_class_ids.begin(),
+              symbols.ordinal_class_ids.end());
+    symbols.ordinal_class_ids.erase(
+        std::unique(symbols.ordinal_class_ids.begin(),
+                    symbols.ordinal_class_ids.end()),
+        symbols.ordinal_class_ids.end());
+    std::sort(symbols.ordinal_class_ids.begin(),
+              symbols.ordinal_class_ids.end(),
+              [&state](RuntimeSymbolId lhs, RuntimeSymbolId rhs) {
+                return RuntimeSymbolName(state, lhs) <
+                       RuntimeSymbolName(state, rhs);
+              });
+    std::unordered_map<RuntimeSymbolId, std::size_t> ordinals_by_class_id;
+    ordinals_by_class_id.reserve(symbols.ordinal_class_ids.size());
+    for (std::size_t ordinal = 0; ordinal < symbols.ordinal_class_ids.size();
+         ++ordinal) {
+      ordinals_by_class_id.emplace(symbols.ordinal_class_ids[ordinal], ordinal);
+    }
+    symbols.ordinal_descriptor_indices.assign(symbols.ordinal_class_ids.size(),
+                                              {});
+    for (std::size_t index = 0; index < symbols.bundle_class_ids.size();
+         ++index) {
+      symbols.ordinal_descriptor_indices[ordinals_by_class_id.at(
+                                             symbols.bundle_class_ids[index])]
+          .push_back(index);
+    }
+  }
+  // A category naming a class no image declares can never attach, so its
+  // target is looked up rather than interned.
+  symbols.category_class_ids.assign(
+      static_cast<std::size_t>(record.category_descriptor_count),
+      kNoRuntimeSymbol);
+  for (std::uint64_t index = 0; index < record.category_descriptor_count;
+       ++index) {
+    const auto *category_record = static_cast<const EmittedCategoryRecord *>(
+        AggregateEntry(record.category_descriptor_root, index));
+    if (category_record != nullptr) {
+      symbols.category_class_ids[static_cast<std::size_t>(index)] =
+          FindRuntimeSymbolUnlocked(state, category_record->class_name);
+    }
+  }
+  return true;
+}
+
+// Describes what one registration changed in the realized graph so cache
+// invalidation can stay scoped to the receivers the new image can reach.
+struct ClassGraphRealizationDelta {
+  std::size_t first_new_node_index = 0;
+  std::unordered_set<std::uint64_t> rebound_base_identities;
+  std::unordered_set<RuntimeSymbolId> extended_class_ids;
+  bool relinked_existing_nodes = false;
+};
+
+void RealizeImageClassGraphUnlocked(RuntimeState &state,
+                                    const RegisteredImageMetadata &record,
+                                    ClassGraphRealizationDelta &delta) {
   // metaclass-graph-root-class anchor: runtime now republishes a
   // realized class/metaclass graph keyed by stable receiver base identities,
   // preserving root classes as explicit graph nodes rather than rediscovering
   // the class family from emitted bundles on every dispatch.
-  ClearRealizedClassGraphUnlocked(state);
-
-  struct ReceiverBinding {
-    std::string class_name;
-    bool ambiguous = false;
-  };
-
-  std::unordered_map<std::size_t, ReceiverBinding> bindings_by_ordinal;
-  std::vector<const RegisteredImageMetadata *> ordered_images =
-      OrderedRegisteredImages(state);
-  std::size_t max_class_name_count = 0;
-  std::size_t estimated_realized_node_count = 0;
-  for (const RegisteredImageMetadata *record : ordered_images) {
-    if (record == nullptr) {
-      continue;
-    }
-    estimated_realized_node_count +=
-        static_cast<std::size_t>(record->class_descriptor_count);
+  // incremental-class-realization anchor: registration ordinals only grow, so
+  // each image appends its own nodes, folds its ordinals into the receiver
+  // bindings, and links super edges against the persisted bundle index
+  // instead of re-realizing every earlier image.
+  delta.first_new_node_index = state.realized_class_nodes.size();
+  ImageClassSymbols symbols;
+  if (!InternImageClassSymbolsUnlocked(state, record, symbols)) {
+    return;
   }
-  for (const RegisteredImageMetadata *record : ordered_images) {
-    std::vector<std::string> class_names;
-    if (!CollectSortedImageClassNames(*record, class_names)) {
-      continue;
-    }
-    max_class_name_count =
-        std::max(max_class_name_count, class_names.size());
-    bindings_by_ordinal.reserve(max_class_name_count);
-    for (std::size_t ordinal = 0; ordinal < class_names.size(); ++ordinal) {
-      ReceiverBinding &binding = bindings_by_ordinal[ordinal];
-      if (binding.class_name.empty() && !binding.ambiguous) {
-        binding.class_name = class_names[ordinal];
+  const std::vector<RuntimeSymbolId> &class_ids = symbols.ordinal_class_ids;
+
+  if (state.realized_receiver_bindings.size() < class_ids.size()) {
+    const std::size_t first_new_ordinal = state.realized_receiver_bindings.size();
+    state.realized_receiver_bindings.resize(class_ids.size());
+    for (std::size_t ordinal = first_new_ordinal; ordinal < class_ids.size();
+         ++ordinal) {
+      const auto count_it = state.unbound_method_cache_entry_counts.find(
+          BuildReceiverBaseIdentity(ordinal));
+      if (count_it == state.unbound_method_cache_entry_counts.end()) {
         continue;
       }
-      if (binding.class_name != class_names[ordinal]) {
-        binding.class_name.clear();
-        binding.ambiguous = true;
-      }
+      state.realized_receiver_bindings[ordinal].method_cache_entry_count =
+          count_it->second;
+      state.unbound_method_cache_entry_counts.erase(count_it);
     }
   }
-  state.realized_class_name_by_base_identity.reserve(bindings_by_ordinal.size());
-  state.ambiguous_realized_base_identities.reserve(bindings_by_ordinal.size());
-  for (const auto &[ordinal, binding] : bindings_by_ordinal) {
-    const std::uint64_t base_identity = BuildReceiverBaseIdentity(ordinal);
+  if (state.realized_class_node_indices_by_class_id.size() <=
+      state.symbol_names.size()) {
+    state.realized_class_node_indices_by_class_id.resize(
+        state.symbol_names.size() + 1u);
+  }
+  for (std::size_t ordinal = 0; ordinal < class_ids.size(); ++ordinal) {
+    delta.rebound_base_identities.insert(BuildReceiverBaseIdentity(ordinal));
+    delta.extended_class_ids.insert(class_ids[ordinal]);
+    RealizedReceiverBinding &binding = state.realized_receiver_bindings[ordinal];
     if (binding.ambiguous) {
-      state.ambiguous_realized_base_identities.insert(base_identity);
       continue;
     }
-    if (!binding.class_name.empty()) {
-      state.realized_class_name_by_base_identity.emplace(base_identity,
-                                                         binding.class_name);
-    }
-  }
-  state.receiver_class_binding_count =
-      static_cast<std::uint64_t>(state.realized_class_name_by_base_identity.size());
-
-  std::unordered_map<const EmittedClassBundle *, std::size_t> node_index_by_bundle;
-  node_index_by_bundle.reserve(estimated_realized_node_count);
-  state.realized_class_nodes.reserve(estimated_realized_node_count);
-  state.realized_class_node_indices_by_name.reserve(max_class_name_count);
-  for (const RegisteredImageMetadata *record : ordered_images) {
-    std::vector<std::string> class_names;
-    if (!CollectSortedImageClassNames(*record, class_names)) {
+    if (!binding.bound) {
+      binding.class_id = class_ids[ordinal];
+      binding.bound = true;
+      ++state.receiver_class_binding_count;
       continue;
     }
-    std::unordered_map<std::string, std::size_t> ordinal_by_class_name;
-    ordinal_by_class_name.reserve(class_names.size());
-    for (std::size_t ordinal = 0; ordinal < class_names.size(); ++ordinal) {
-      ordinal_by_class_name.emplace(class_names[ordinal], ordinal);
+    if (binding.class_id != class_ids[ordinal]) {
+      binding = RealizedReceiverBinding{};
+      binding.ambiguous = true;
+      --state.receiver_class_binding_count;
     }
-    for (const std::string &class_name : class_names) {
-      const auto ordinal_it = ordinal_by_class_name.find(class_name);
-      if (ordinal_it == ordinal_by_class_name.end()) {
+  }
+
+  // No exact reserve here: containers grow geometrically across images,
+  // while reserving size-plus-delta would reallocate on every registration.
+  for (std::size_t ordinal = 0; ordinal < class_ids.size(); ++ordinal) {
+    const RuntimeSymbolId class_id = class_ids[ordinal];
+    const std::vector<std::size_t> &descriptor_indices =
+        symbols.ordinal_descriptor_indices[ordinal];
+    const auto bundles =
+        CollectPreferredClassBundlesForImage(record, descriptor_indices);
+    for (const EmittedClassBundle *bundle : bundles) {
+      if (bundle == nullptr) {
         continue;
       }
-      const auto bundles = CollectPreferredClassBundlesForImage(*record, class_name);
-      for (const EmittedClassBundle *bundle : bundles) {
-        if (bundle == nullptr) {
+      RealizedClassNode node;
+      node.module_name = record.module_name;
+      node.translation_unit_identity_key = record.translation_unit_identity_key;
+      node.class_id = class_id;
+      node.metaclass_record_class_id = InternRuntimeSymbolUnlocked(
+          state, bundle->metaclass_record.class_name);
+      node.bundle_owner_identity =
+          bundle->class_record.bundle_owner_identity != nullptr
+              ? bundle->class_record.bundle_owner_identity
+              : "";
+      node.interface_owner_identity = node.bundle_owner_identity;
+      for (const std::size_t candidate_index : descriptor_indices) {
+        const auto *candidate = static_cast<const EmittedClassBundle *>(
+            AggregateEntry(record.class_descriptor_root, candidate_index));
+        if (candidate == nullptr ||
+            candidate->class_record.bundle_owner_identity == nullptr) {
           continue;
         }
-        RealizedClassNode node;
-        node.module_name = record->module_name;
-        node.translation_unit_identity_key = record->translation_unit_identity_key;
-        node.class_name = class_name;
-        node.bundle_owner_identity =
-            bundle->class_record.bundle_owner_identity != nullptr
-                ? bundle->class_record.bundle_owner_identity
-                : "";
-        node.interface_owner_identity = node.bundle_owner_identity;
-        for (std::uint64_t candidate_index = 0;
-             candidate_index < record->class_descriptor_count; ++candidate_index) {
-          const auto *candidate = static_cast<const EmittedClassBundle *>(
-              AggregateEntry(record->class_descriptor_root, candidate_index));
-          if (candidate == nullptr || candidate->class_record.class_name == nullptr ||
-              candidate->class_record.bundle_owner_identity == nullptr) {
-            continue;
-          }
-          if (class_name != candidate->class_record.class_name) {
-            continue;
-          }
-          if (std::string(candidate->class_record.bundle_owner_identity).rfind(
-                  "interface:", 0) == 0) {
-            node.interface_owner_identity =
-                candidate->class_record.bundle_owner_identity;
-            break;
-          }
+        if (std::string(candidate->class_record.bundle_owner_identity).rfind(
+                "interface:", 0) == 0) {
+          node.interface_owner_identity =
+              candidate->class_record.bundle_owner_identity;
+          break;
         }
-        node.class_owner_identity =
-            bundle->class_record.object_owner_identity != nullptr
-                ? bundle->class_record.object_owner_identity
-                : "";
-        node.metaclass_owner_identity =
-            bundle->metaclass_record.object_owner_identity != nullptr
-                ? bundle->metaclass_record.object_owner_identity
-                : "";
-        node.super_class_owner_identity =
-            bundle->class_record.super_owner_identity != nullptr
-                ? bundle->class_record.super_owner_identity
-                : "";
-        node.super_metaclass_owner_identity =
-            bundle->metaclass_record.super_owner_identity != nullptr
-                ? bundle->metaclass_record.super_owner_identity
-                : "";
-        node.registration_order_ordinal = record->registration_order_ordinal;
-        node.base_identity = BuildReceiverBaseIdentity(ordinal_it->second);
-        node.is_root_class = bundle->class_record.super_bundle == nullptr;
-        node.implementation_backed =
-            (bundle->class_record.method_list_ref != nullptr &&
-             IsImplementationOwnerIdentity(
-                 bundle->class_record.method_list_ref->owner_identity)) ||
-            (bundle->metaclass_record.method_list_ref != nullptr &&
-             IsImplementationOwnerIdentity(
-                 bundle->metaclass_record.method_list_ref->owner_identity));
-        node.objc_final_declared = bundle->class_record.objc_final_declared;
-        node.objc_sealed_declared = bundle->class_record.objc_sealed_declared;
-        node.image = record;
-        node.bundle = bundle;
-        const std::size_t node_index = state.realized_class_nodes.size();
-        state.realized_class_nodes.push_back(std::move(node));
-        node_index_by_bundle.emplace(bundle, node_index);
-        state.realized_class_node_indices_by_name[class_name].push_back(node_index);
+      }
+      node.class_owner_identity =
+          bundle->class_record.object_owner_identity != nullptr
+              ? bundle->class_record.object_owner_identity
+              : "";
+      node.metaclass_owner_identity =
+          bundle->metaclass_record.object_owner_identity != nullptr
+              ? bundle->metaclass_record.object_owner_identity
+              : "";
+      node.super_class_owner_identity =
+          bundle->class_record.super_owner_identity != nullptr
+              ? bundle->class_record.super_owner_identity
+              : "";
+      node.super_metaclass_owner_identity =
+          bundle->metaclass_record.super_owner_identity != nullptr
+              ? bundle->metaclass_record.super_owner_identity
+              : "";
+      node.registration_order_ordinal = record.registration_order_ordinal;
+      node.base_identity = BuildReceiverBaseIdentity(ordinal);
+      node.is_root_class = bundle->class_record.super_bundle == nullptr;
+      node.implementation_backed =
+          (bundle->class_record.method_list_ref != nullptr &&
+           IsImplementationOwnerIdentity(
+               bundle->class_record.method_list_ref->owner_identity)) ||
+          (bundle->metaclass_record.method_list_ref != nullptr &&
+           IsImplementationOwnerIdentity(
+               bundle->metaclass_record.method_list_ref->owner_identity));
+      node.objc_final_declared = bundle->class_record.objc_final_declared;
+      node.objc_sealed_declared = bundle->class_record.objc_sealed_declared;
+      node.image = &record;
+      node.bundle = bundle;
+      const std::size_t node_index = state.realized_class_nodes.size();
+      RealizedReceiverBinding &binding = state.realized_receiver_bindings[ordinal];
+      if (binding.bound && !binding.has_node) {
+        binding.first_node_index = node_index;
+        binding.has_node = true;
+      }
+      state.realized_class_nodes.push_back(std::move(node));
+      state.realized_class_node_index_by_bundle.emplace(bundle, node_index);
+      state.realized_class_node_indices_by_class_id[class_id].push_back(
+          node_index);
+    }
+  }
+
+  for (std::size_t index = delta.first_new_node_index;
+       index < state.realized_class_nodes.size(); ++index) {
+    const auto pending_it = state.pending_super_node_indices_by_bundle.find(
+        state.realized_class_nodes[index].bundle);
+    if (pending_it == state.pending_super_node_indices_by_bundle.end()) {
+      continue;
+    }
+    for (const std::size_t subclass_index : pending_it->second) {
+      RealizedClassNode &subclass_node = state.realized_class_nodes[subclass_index];
+      subclass_node.super_node_index = index;
+      subclass_node.has_super_node = true;
+      ++state.realized_metaclass_edge_count;
+      if (subclass_index < delta.first_new_node_index) {
+        delta.relinked_existing_nodes = true;
       }
     }
+    state.pending_super_node_indices_by_bundle.erase(pending_it);
   }
 
-  for (std::size_t index = 0; index < state.realized_class_nodes.size(); ++index) {
+  for (std::size_t index = delta.first_new_node_index;
+       index < state.realized_class_nodes.size(); ++index) {
     RealizedClassNode &node = state.realized_class_nodes[index];
     if (node.bundle != nullptr && node.bundle->class_record.super_bundle != nullptr) {
-      const auto super_it = node_index_by_bundle.find(
-          static_cast<const EmittedClassBundle *>(node.bundle->class_record.super_bundle));
-      if (super_it != node_index_by_bundle.end()) {
+      const auto *super_bundle = static_cast<const EmittedClassBundle *>(
+          node.bundle->class_record.super_bundle);
+      const auto super_it =
+          state.realized_class_node_index_by_bundle.find(super_bundle);
+      if (super_it != state.realized_class_node_index_by_bundle.end()) {
         node.super_node_index = super_it->second;
         node.has_super_node = true;
         ++state.realized_metaclass_edge_count;
+      } else {
+        state.pending_super_node_indices_by_bundle[super_bundle].push_back(index);
       }
     }
     if (node.is_root_class) {
       ++state.realized_root_class_count;
     }
-    (void)AttachRealizedCategoryRecordsUnlocked(state, node);
+    (void)AttachRealizedCategoryRecordsUnlocked(state, node,
+                                                symbols.category_class_ids);
+    BuildRealizedMethodTablesUnlocked(state, node);
     (void)AttachRealizedPropertyLayoutRecordsUnlocked(state, node);
   }
 
-  if (!state.realized_class_nodes.empty()) {
+  state.last_registration_realized_class_count = static_cast<std::uint64_t>(
+      state.realized_class_nodes.size() - delta.first_new_node_index);
+  if (state.last_registration_realized_class_count != 0) {
     const RealizedClassNode &last_node = state.realized_class_nodes.back();
-    state.last_realized_class_name = last_node.class_name;
+    state.last_realized_class_name = RuntimeSymbolName(state, last_node.class_id);
     state.last_realized_class_owner_identity = last_node.class_owner_identity;
     state.last_realized_metaclass_owner_identity =
         last_node.metaclass_owner_identity;
   }
 }
 
-bool ResolveReceiverClassNameUnlocked(const RuntimeState &state,
-                                      std::uint64_t base_identity,
-                                      std::string &class_name,
-                                      bool &ambiguous) {
-  ambiguous = false;
-  if (base_identity < kReceiverIdentityBase ||
-      ((base_identity - kReceiverIdentityBase) % kReceiverIdentityStride) != 0) {
-    return false;
+const RealizedReceiverBinding *FindRealizedReceiverBindingUnlocked(
+    const RuntimeState &state, std::uint64_t base_identity) {
+  if (base_identity < kReceiverIdentityBase) {
+    return nullptr;
   }
-  if (state.ambiguous_realized_base_identities.find(base_identity) !=
-      state.ambiguous_realized_base_identities.end()) {
-    ambiguous = true;
-    return false;
+  const std::uint64_t delta = base_identity - kReceiverIdentityBase;
+  const std::uint64_t ordinal = delta / kReceiverIdentityStride;
+  if (delta != ordinal * kReceiverIdentityStride ||
+      ordinal >= state.realized_receiver_bindings.size()) {
+    return nullptr;
   }
-  const auto found =
-      state.realized_class_name_by_base_identity.find(base_identity);
-  if (found == state.realized_class_name_by_base_identity.end()) {
+  return &state.realized_receiver_bindings[static_cast<std::size_t>(ordinal)];
+}
+
+RealizedReceiverBinding *FindRealizedReceiverBindingUnlocked(
+    RuntimeState &state, std::uint64_t base_identity) {
+  return const_cast<RealizedReceiverBinding *>(FindRealizedReceiverBindingUnlocked(
+      static_cast<const RuntimeState &>(state), base_identity));
+}
+
+// method-cache-generation anchor: a slow-path fill stays current until an
+// image retires its receiver ordinal; registration seeds never go stale.
+bool IsMethodCacheEntryCurrentUnlocked(const RuntimeState &state,
+                                       const MethodCacheEntry &entry) {
+  if (entry.ring == MethodCacheRing::None) {
+    return true;
+  }
+  const RealizedReceiverBinding *binding =
+      FindRealizedReceiverBindingUnlocked(state, entry.base_identity);
+  return binding == nullptr ||
+         entry.class_generation >= binding->method_cache_retired_generation;
+}
+
+std::uint64_t CurrentMethodCacheEntryCountUnlocked(const RuntimeState &state) {
+  return static_cast<std::uint64_t>(state.method_cache.size()) -
+         state.stale_method_cache_entry_count;
+}
+
+void CountMethodCacheEntryForBaseIdentityUnlocked(RuntimeState &state,
+                                                  std::uint64_t base_identity,
+                                                  bool added) {
+  RealizedReceiverBinding *binding =
+      FindRealizedReceiverBindingUnlocked(state, base_identity);
+  if (binding != nullptr) {
+    if (added) {
+      ++binding->method_cache_entry_count;
+    } else {
+      --binding->method_cache_entry_count;
+    }
+    return;
+  }
+  if (added) {
+    ++state.unbound_method_cache_entry_counts[base_identity];
+    return;
+  }
+  const auto count_it = state.unbound_method_cache_entry_counts.find(base_identity);
+  if (count_it != state.unbound_method_cache_entry_counts.end() &&
+      --count_it->second == 0) {
+    state.unbound_method_cache_entry_counts.erase(count_it);
+  }
+}
+
+MethodCacheClockRing &MethodCacheClockRingFor(RuntimeState &state,
+                                              MethodCacheRing ring) {
+  return ring == MethodCacheRing::Negative ? state.negative_method_cache_ring
+                                           : state.resolved_method_cache_ring;
+}
+
+// Releases a slow-path entry's ring slot and per-class count; the caller
+// erases or overwrites the map entry itself.
+void DetachMethodCacheEntryUnlocked(RuntimeState &state,
+                                    MethodCacheEntry &entry) {
+  if (entry.ring == MethodCacheRing::None) {
+    return;
+  }
+  if (IsMethodCacheEntryCurrentUnlocked(state, entry)) {
+    CountMethodCacheEntryForBaseIdentityUnlocked(state, entry.base_identity,
+                                                 false);
+  } else {
+    --state.stale_method_cache_entry_count;
+  }
+  --MethodCacheClockRingFor(state, entry.ring).live_count;
+  entry.ring = MethodCacheRing::None;
+}
+
+// Gives a fresh slow-path fill a slot in its ring. Once the ring is full the
+// hand clears reference bits until it reaches a dead slot, a stale entry, or
+// an entry no send has hit since the last sweep, and evicts that one.
+void AttachMethodCacheEntryUnlocked(RuntimeState &state,
+                                    const MethodCacheKey &cache_key,
+                                    MethodCacheEntry &entry,
+                                    MethodCacheRing ring_kind) {
+  MethodCacheClockRing &ring = MethodCacheClockRingFor(state, ring_kind);
+  std::size_t slot = ring.keys.size();
+  if (slot < ring.capacity) {
+    ring.keys.push_back(cache_key);
+  } else {
+    for (;;) {
+      slot = ring.hand;
+      ring.hand = (ring.hand + 1u) % ring.keys.size();
+      const auto victim_it = state.method_cache.find(ring.keys[slot]);
+      if (victim_it == state.method_cache.end() ||
+          victim_it->second->ring != ring_kind ||
+          victim_it->second->ring_slot != slot) {
+        break;
+      }
+      MethodCacheEntry &victim = *victim_it->second;
+      if (!IsMethodCacheEntryCurrentUnlocked(state, victim)) {
+        ++state.stale_method_cache_reclaim_count;
+      } else if (victim.ring_referenced) {
+        victim.ring_referenced = false;
+        continue;
+      } else if (ring_kind == MethodCacheRing::Negative) {
+        ++state.negative_method_cache_eviction_count;
+      } else {
+        ++state.method_cache_eviction_count;
+      }
+      DetachMethodCacheEntryUnlocked(state, victim);
+      state.method_cache.erase(victim_it);
+      break;
+    }
+    ring.keys[slot] = cache_key;
+  }
+  entry.ring = ring_kind;
+  entry.ring_referenced = false;
+  entry.ring_slot = slot;
+  entry.class_generation = state.method_cache_class_generation;
+  ++ring.live_count;
+  CountMethodCacheEntryForBaseIdentityUnlocked(state, entry.base_identity, true);
+}
+
+// Drops every slow-path fill, leaving registration seeds in place.
+void DropSlowPathMethodCacheEntriesUnlocked(RuntimeState &state) {
+  for (auto it = state.method_cache.begin(); it != state.method_cache.end();) {
+    if (it->second->ring == MethodCacheRing::None) {
+      ++it;
+    } else {
+      it = state.method_cache.erase(it);
+    }
+  }
+  ClearMethodCacheRingStateUnlocked(state);
+}
+
+bool ResolveReceiverClassIdUnlocked(const RuntimeState &state,
+                                    std::uint64_t base_identity,
+                                    RuntimeSymbolId &class_id,
+                                    bool &ambiguous) {
+  const RealizedReceiverBinding *binding =
+      FindRealizedReceiverBindingUnlocked(state, base_identity);
+  ambiguous = binding != nullptr && binding->ambiguous;
+  if (binding == nullptr || !binding->bound) {
     return false;
   }
-  class_name = found->second;
+  class_id = binding->class_id;
   return true;
 }
 
 std::vector<const EmittedClassBundle *> CollectPreferredClassBundlesForImage(
-    const RegisteredImageMetadata &record, const std::string &class_name) {
+    const RegisteredImageMetadata &record,
+    const std::vector<std::size_t> &descriptor_indices) {
   std::vector<const EmittedClassBundle *> implementation_bundles;
   std::vector<const EmittedClassBundle *> fallback_bundles;
-  implementation_bundles.reserve(static_cast<std::size_t>(record.class_descriptor_count));
-  fallback_bundles.reserve(static_cast<std::size_t>(record.class_descriptor_count));
-  for (std::uint64_t index = 0; index < record.class_descriptor_count; ++index) {
+  for (const std::size_t index : descriptor_indices) {
     const auto *bundle = static_cast<const EmittedClassBundle *>(
         AggregateEntry(record.class_descriptor_root, index));
-    if (bundle == nullptr || bundle->class_record.class_name == nullptr ||
-        class_name != bundle->class_record.class_name) {
+    if (bundle == nullptr) {
       continue;
     }
     const bool implementation_backed =
@@ -2249,8 +4523,11 @@ bool TryResolveMethodFromRealizedClassChainUnlocked(
     const EmittedClassRecord &record =
         family == DispatchFamily::Class ? bundle->metaclass_record
                                         : bundle->class_record;
-    if (!TryResolveMethodFromMethodListRefUnlocked(
-            state, record.method_list_ref, record.class_name, family,
+    if (!TryResolveMethodFromRealizedMethodTableUnlocked(
+            state, SelectMethodTables(*node, family).class_methods,
+            family == DispatchFamily::Class ? node->metaclass_record_class_id
+                                            : node->class_id,
+            family,
             normalized_receiver_identity, selector_stable_id, selector_spelling,
             resolution, ambiguous)) {
       return false;
@@ -2389,9 +4666,12 @@ std::size_t EstimateSeedableMethodEntriesForMethodList(
   return count;
 }
 
-void ReserveMethodCacheForFastPathSeedUnlocked(RuntimeState &state) {
+void ReserveMethodCacheForFastPathSeedUnlocked(RuntimeState &state,
+                                               std::size_t first_node_index) {
   std::size_t reserve_count = state.method_cache.size();
-  for (const RealizedClassNode &node : state.realized_class_nodes) {
+  for (std::size_t index = first_node_index;
+       index < state.realized_class_nodes.size(); ++index) {
+    const RealizedClassNode &node = state.realized_class_nodes[index];
     if (node.bundle == nullptr) {
       continue;
     }
@@ -2438,17 +4718,20 @@ void SeedDispatchIntentFastPathCacheForMethodListUnlocked(
     if (HasAttachedCategorySelectorConflictUnlocked(node, family, entry.selector)) {
       continue;
     }
-    const auto selector_it = state.selector_index_by_name.find(entry.selector);
-    if (selector_it == state.selector_index_by_name.end()) {
+    const std::size_t selector_index =
+        FindSelectorSlotIndexUnlocked(state, entry.selector);
+    if (selector_index == kNoSelectorSlot) {
       continue;
     }
     const std::uint64_t selector_stable_id =
-        state.selector_slots[selector_it->second].handle.stable_id;
+        state.selector_slots[selector_index].handle.stable_id;
     if (selector_stable_id == 0) {
       continue;
     }
     const MethodCacheKey cache_key{normalized_receiver_identity, selector_stable_id};
-    if (state.method_cache.find(cache_key) != state.method_cache.end()) {
+    const auto existing_it = state.method_cache.find(cache_key);
+    if (existing_it != state.method_cache.end() &&
+        IsMethodCacheEntryCurrentUnlocked(state, *existing_it->second)) {
       continue;
     }
     MethodCacheEntry cache_entry;
@@ -2463,26 +4746,54 @@ void SeedDispatchIntentFastPathCacheForMethodListUnlocked(
         record.objc_sealed_declared || node.objc_sealed_declared;
     cache_entry.selector_storage = entry.selector;
     cache_entry.fast_path_reason = fast_path_reason;
-    cache_entry.class_name = node.class_name;
+    cache_entry.class_id = node.class_id;
     cache_entry.owner_identity = entry.owner_identity;
     cache_entry.normalized_receiver_identity = normalized_receiver_identity;
     cache_entry.selector_stable_id = selector_stable_id;
     cache_entry.parameter_count = entry.parameter_count;
     cache_entry.return_kind = return_kind;
     cache_entry.implementation = entry.implementation;
-    if (state.method_cache.emplace(cache_key, std::move(cache_entry)).second) {
-      ++state.fast_path_seed_count;
+    // Synthesized accessor bodies read and write through the dispatch frame's
+    // property accessor, so a seed for one resolves to the same builtin
+    // accessor the slow path picks instead of calling the body bare.
+    SlowPathResolution accessor_resolution;
+    if (family == DispatchFamily::Instance &&
+        TryResolveRuntimeManagedPropertyAccessorUnlocked(
+            state, node, normalized_receiver_identity, selector_stable_id,
+            entry.selector, accessor_resolution)) {
+      cache_entry.class_id = accessor_resolution.class_id;
+      cache_entry.owner_identity = accessor_resolution.owner_identity;
+      cache_entry.parameter_count = accessor_resolution.parameter_count;
+      cache_entry.return_kind = accessor_resolution.return_kind;
+      cache_entry.implementation = nullptr;
+      cache_entry.builtin_kind = accessor_resolution.builtin_kind;
+      cache_entry.runtime_property_accessor =
+          accessor_resolution.runtime_property_accessor;
+    }
+    if (existing_it != state.method_cache.end()) {
+      DetachMethodCacheEntryUnlocked(state, *existing_it->second);
+      existing_it->second =
+          std::make_shared<MethodCacheEntry>(std::move(cache_entry));
+    } else {
+      state.method_cache.emplace(
+          cache_key, std::make_shared<MethodCacheEntry>(std::move(cache_entry)));
     }
+    ++state.fast_path_seed_count;
   }
 }
 
-void SeedDispatchIntentFastPathCacheUnlocked(RuntimeState &state) {
+void SeedDispatchIntentFastPathCacheUnlocked(RuntimeState &state,
+                                             std::size_t first_node_index) {
   // live-dispatch-fast-path anchor: registration-time class-graph
   // rebuild now pre-seeds deterministic cache entries for safe implementation-
   // backed direct/final/sealed methods so the first live dispatch can hit the
   // runtime cache without paying a slow-path lookup.
-  ReserveMethodCacheForFastPathSeedUnlocked(state);
-  for (const RealizedClassNode &node : state.realized_class_nodes) {
+  // Seeds are first-come per cache key and depend only on their own node, so
+  // nodes realized by earlier registrations keep the entries they seeded.
+  ReserveMethodCacheForFastPathSeedUnlocked(state, first_node_index);
+  for (std::size_t index = first_node_index;
+       index < state.realized_class_nodes.size(); ++index) {
+    const RealizedClassNode &node = state.realized_class_nodes[index];
     if (node.bundle == nullptr) {
       continue;
     }
@@ -2495,6 +4806,79 @@ void SeedDispatchIntentFastPathCacheUnlocked(RuntimeState &state) {
   }
 }
 
+bool RealizationDeltaAffectsBaseIdentityUnlocked(
+    const RuntimeState &state, const ClassGraphRealizationDelta &delta,
+    std::uint64_t base_identity) {
+  if (delta.rebound_base_identities.find(base_identity) !=
+      delta.rebound_base_identities.end()) {
+    return true;
+  }
+  const RealizedReceiverBinding *binding =
+      FindRealizedReceiverBindingUnlocked(state, base_identity);
+  return binding != nullptr && binding->bound &&
+         delta.extended_class_ids.find(binding->class_id) !=
+             delta.extended_class_ids.end();
+}
+
+void InvalidateRealizedClassCachesUnlocked(
+    RuntimeState &state, const ClassGraphRealizationDelta &delta) {
+  // A receiver's slow-path resolution reads its ordinal binding, the nodes
+  // realized under the bound class name, and their super chains. A new image
+  // only rebinds its own ordinals and extends its own class names, so every
+  // other resolution stays valid; linking an earlier node to a late super
+  // changes chains the delta cannot see, so that case flushes everything.
+  // Compiled key paths can cross into any class, so they always go.
+  ClearRealizedClassQueryStateUnlocked(state);
+  state.keypath_chain_cache.clear();
+  if (delta.relinked_existing_nodes) {
+    const std::uint64_t flushed_entry_count =
+        CurrentMethodCacheEntryCountUnlocked(state);
+    state.property_lookup_cache.clear();
+    for (RealizedClassNode &node : state.realized_class_nodes) {
+      node.conformance = RealizedClassConformance{};
+    }
+    ClearMethodCacheStateUnlocked(state);
+    SeedDispatchIntentFastPathCacheUnlocked(state, 0);
+    state.last_registration_invalidated_cache_entry_count = flushed_entry_count;
+    ++state.full_class_graph_invalidation_count;
+    return;
+  }
+
+  for (auto it = state.property_lookup_cache.begin();
+       it != state.property_lookup_cache.end();) {
+    if (RealizationDeltaAffectsBaseIdentityUnlocked(
+            state, delta, it->first.start_base_identity)) {
+      it = state.property_lookup_cache.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  // Affected ordinals retire their slow-path fills by generation; the stale
+  // entries stay in their ring slots until the hand or a repeat send reuses
+  // them, so invalidation costs one step per ordinal, not per entry.
+  std::uint64_t invalidated_entry_count = 0;
+  ++state.method_cache_class_generation;
+  for (std::size_t ordinal = 0;
+       ordinal < state.realized_receiver_bindings.size(); ++ordinal) {
+    if (!RealizationDeltaAffectsBaseIdentityUnlocked(
+            state, delta, BuildReceiverBaseIdentity(ordinal))) {
+      continue;
+    }
+    RealizedReceiverBinding &binding = state.realized_receiver_bindings[ordinal];
+    binding.method_cache_retired_generation =
+        state.method_cache_class_generation;
+    invalidated_entry_count += binding.method_cache_entry_count;
+    state.stale_method_cache_entry_count += binding.method_cache_entry_count;
+    binding.method_cache_entry_count = 0;
+  }
+  ResetMethodCacheStatisticsUnlocked(state);
+  state.fast_path_seed_count = static_cast<std::uint64_t>(
+      state.method_cache.size() - state.resolved_method_cache_ring.live_count -
+      state.negative_method_cache_ring.live_count);
+  SeedDispatchIntentFastPathCacheUnlocked(state, delta.first_new_node_index);
+  state.last_registration_invalidated_cache_entry_count = invalidated_entry_count;
+}
+
 SlowPathResolution ResolveMethodSlowPathUnlocked(
     RuntimeState &state, std::uint64_t base_identity,
     std::uint64_t normalized_receiver_identity, DispatchFamily family,
@@ -2510,20 +4894,18 @@ SlowPathResolution ResolveMethodSlowPathUnlocked(
   std::uint64_t protocol_probe_count = 0;
 
   bool receiver_ambiguous = false;
-  std::string resolved_class_name;
-  if (!ResolveReceiverClassNameUnlocked(state, base_identity, resolved_class_name,
-                                        receiver_ambiguous)) {
+  RuntimeSymbolId resolved_class_id = kNoRuntimeSymbol;
+  if (!ResolveReceiverClassIdUnlocked(state, base_identity, resolved_class_id,
+                                      receiver_ambiguous)) {
     resolution.ambiguous = receiver_ambiguous;
     return resolution;
   }
-
-  const auto realized_nodes_it =
-      state.realized_class_node_indices_by_name.find(resolved_class_name);
-  if (realized_nodes_it == state.realized_class_node_indices_by_name.end()) {
+  if (resolved_class_id >= state.realized_class_node_indices_by_class_id.size()) {
     return resolution;
   }
 
-  for (const std::size_t node_index : realized_nodes_it->second) {
+  for (const std::size_t node_index :
+       state.realized_class_node_indices_by_class_id[resolved_class_id]) {
     if (node_index >= state.realized_class_nodes.size()) {
       continue;
     }
@@ -2583,7 +4965,7 @@ SlowPathResolution ResolveMethodSlowPathUnlocked(
           (resolution.implementation != image_resolution.implementation ||
            resolution.parameter_count != image_resolution.parameter_count ||
            resolution.owner_identity != image_resolution.owner_identity ||
-           resolution.class_name != image_resolution.class_name)) {
+           resolution.class_id != image_resolution.class_id)) {
         resolution = SlowPathResolution{};
         resolution.ambiguous = true;
         resolution.selector_storage =
@@ -2602,8 +4984,9 @@ SlowPathResolution ResolveMethodSlowPathUnlocked(
   resolution.category_probe_count = category_probe_count;
   resolution.protocol_probe_count = protocol_probe_count;
   if (!resolution.resolved && !resolution.ambiguous &&
-      TryResolveRuntimeBuiltinObjectSampleMethod(resolved_class_name, family,
-                                                selector_spelling, resolution)) {
+      TryResolveRuntimeBuiltinObjectSampleMethod(state, resolved_class_id,
+                                                family, selector_spelling,
+                                                resolution)) {
     resolution.normalized_receiver_identity = normalized_receiver_identity;
     resolution.selector_stable_id = selector_stable_id;
     resolution.category_probe_count = category_probe_count;
@@ -2699,25 +5082,29 @@ int InvokeResolvedMethod(const void *implementation,
 
 const RealizedClassNode *FindRealizedClassNodeByBaseIdentityUnlocked(
     const RuntimeState &state, std::uint64_t base_identity) {
-  const auto class_name_it = state.realized_class_name_by_base_identity.find(base_identity);
-  if (class_name_it == state.realized_class_name_by_base_identity.end()) {
+  const RealizedReceiverBinding *binding =
+      FindRealizedReceiverBindingUnlocked(state, base_identity);
+  return binding != nullptr && binding->has_node
+             ? &state.realized_class_nodes[binding->first_node_index]
+             : nullptr;
+}
+
+// Name-keyed queries hash the name once, into the symbol table; a name that
+// was never interned cannot name a realized class.
+const RealizedClassNode *FindFirstRealizedClassNodeByNameUnlocked(
+    const RuntimeState &state, const char *class_name) {
+  const RuntimeSymbolId class_id = FindRuntimeSymbolUnlocked(state, class_name);
+  if (class_id == kNoRuntimeSymbol ||
+      class_id >= state.realized_class_node_indices_by_class_id.size()) {
     return nullptr;
   }
-  const auto node_indexes_it =
-      state.realized_class_node_indices_by_name.find(class_name_it->second);
-  if (node_indexes_it == state.realized_class_node_indices_by_name.end()) {
+  const std::vector<std::size_t> &node_indices =
+      state.realized_class_node_indices_by_class_id[class_id];
+  if (node_indices.empty() ||
+      node_indices.front() >= state.realized_class_nodes.size()) {
     return nullptr;
   }
-  for (const std::size_t node_index : node_indexes_it->second) {
-    if (node_index >= state.realized_class_nodes.size()) {
-      continue;
-    }
-    const RealizedClassNode &node = state.realized_class_nodes[node_index];
-    if (node.base_identity == base_identity) {
-      return &node;
-    }
-  }
-  return nullptr;
+  return &state.realized_class_nodes[node_indices.front()];
 }
 
 std::size_t EffectiveIvarOffset(const RealizedPropertyAccessor &accessor) {
@@ -2784,16 +5171,116 @@ bool UsesSafeUnownedRuntimeHooks(const RealizedPropertyAccessor &accessor) {
          std::strcmp(hook_profile, "objc-unowned-safe-guard") == 0;
 }
 
+// direct-property-access anchor: synthesized accessors of objc_final and
+// objc_sealed classes publish their slot's offset and size once, at
+// realization, when the slot needs neither the weak side table nor the
+// unowned liveness guard and is a whole 1-, 4-, or 8-byte word. Their getter
+// and setter then touch the slot in place without the runtime mutex. Strong
+// properties qualify only when nonatomic: the locked path is what makes an
+// atomic getter's read-and-retain indivisible.
+void ClassifyDirectPropertyAccess(const RealizedClassNode &node,
+                                  RealizedPropertyAccessor &accessor) {
+  accessor.direct_access = RuntimeDirectPropertyAccess::None;
+  if ((!node.objc_final_declared && !node.objc_sealed_declared) ||
+      accessor.getter_return_kind == RuntimeMethodReturnKind::Unsupported ||
+      UsesWeakRuntimeHooks(accessor) || UsesSafeUnownedRuntimeHooks(accessor)) {
+    return;
+  }
+  const std::size_t offset = EffectiveIvarOffset(accessor);
+  const std::size_t size = EffectiveIvarSize(accessor);
+  if ((size != 1u && size != 4u && size != 8u) || offset % size != 0u ||
+      offset + size > node.runtime_instance_size_bytes) {
+    return;
+  }
+  if (UsesStrongOwnedRuntimeHooks(accessor)) {
+    if (!AccessorProfileContains(
+            accessor.property_descriptor->property_attribute_profile,
+            "nonatomic=1")) {
+      return;
+    }
+    accessor.direct_access = RuntimeDirectPropertyAccess::StrongNonatomic;
+  } else {
+    accessor.direct_access = RuntimeDirectPropertyAccess::Scalar;
+  }
+  accessor.direct_offset = static_cast<std::uint32_t>(offset);
+  accessor.direct_size = static_cast<std::uint32_t>(size);
+}
+
+// The caller keeps |receiver| alive, so once its slot checks out the storage
+// stays put for the access. Returns null, sending the caller down the locked
+// path, for anything else.
+unsigned char *DirectRuntimePropertySlot(RuntimeState &state, int receiver,
+                                         const RealizedPropertyAccessor &accessor) {
+  std::uint32_t generation = 0;
+  RuntimeInstanceRecord *const instance =
+      RuntimeInstanceSlotForHandle(state, receiver, generation);
+  if (instance == nullptr) {
+    return nullptr;
+  }
+  const std::uint64_t retain_state =
+      instance->retain_state.load(std::memory_order_acquire);
+  if (RuntimeInstanceRetainGeneration(retain_state) != generation ||
+      RuntimeInstanceRetainCount(retain_state) == 0u ||
+      accessor.direct_offset + accessor.direct_size >
+          instance->instance_size_bytes) {
+    return nullptr;
+  }
+  unsigned char *const slot = instance->storage_bytes + accessor.direct_offset;
+  return reinterpret_cast<std::uintptr_t>(slot) % accessor.direct_size == 0u
+             ? slot
+             : nullptr;
+}
+
+// Direct slots are read and written as whole atomic words so concurrent
+// accessors never tear. Values occupy the low 32 bits, zero-extended on
+// store, exactly as the raw property helpers lay them out.
+std::uint32_t LoadDirectPropertySlotWord(unsigned char *slot,
+                                         std::uint32_t size) {
+  switch (size) {
+    case 1u:
+      return std::atomic_ref<std::uint8_t>(*slot).load(
+          std::memory_order_acquire);
+    case 4u:
+      return std::atomic_ref<std::uint32_t>(
+                 *reinterpret_cast<std::uint32_t *>(slot))
+          .load(std::memory_order_acquire);
+    default:
+      return static_cast<std::uint32_t>(
+          std::atomic_ref<std::uint64_t>(
+              *reinterpret_cast<std::uint64_t *>(slot))
+              .load(std::memory_order_acquire));
+  }
+}
+
+std::uint32_t ExchangeDirectPropertySlotWord(unsigned char *slot,
+                                             std::uint32_t size,
+                                             std::uint32_t word) {
+  switch (size) {
+    case 1u:
+      return std::atomic_ref<std::uint8_t>(*slot).exchange(
+          static_cast<std::uint8_t>(word), std::memory_order_acq_rel);
+    case 4u:
+      return std::atomic_ref<std::uint32_t>(
+                 *reinterpret_cast<std::uint32_t *>(slot))
+          .exchange(word, std::memory_order_acq_rel);
+    default:
+      return static_cast<std::uint32_t>(
+          std::atomic_ref<std::uint64_t>(
+              *reinterpret_cast<std::uint64_t *>(slot))
+              .exchange(word, std::memory_order_acq_rel));
+  }
+}
+
 bool ReadRuntimeManagedPropertyValueRaw(const RuntimeInstanceRecord &instance,
                                         const RealizedPropertyAccessor &accessor,
                                         int &value) {
   const std::size_t offset = EffectiveIvarOffset(accessor);
   const std::size_t size = EffectiveIvarSize(accessor);
-  if (size == 0u || offset + size > instance.storage_bytes.size()) {
+  if (size == 0u || offset + size > instance.instance_size_bytes) {
     return false;
   }
   std::uint64_t raw = 0;
-  std::memcpy(&raw, instance.storage_bytes.data() + offset,
+  std::memcpy(&raw, instance.storage_bytes + offset,
               std::min<std::size_t>(size, sizeof(raw)));
   if (accessor.getter_return_kind == RuntimeMethodReturnKind::Bool) {
     value = raw != 0u ? 1 : 0;
@@ -2808,19 +5295,18 @@ bool WriteRuntimeManagedPropertyValueRaw(RuntimeInstanceRecord &instance,
                                          int value) {
   const std::size_t offset = EffectiveIvarOffset(accessor);
   const std::size_t size = EffectiveIvarSize(accessor);
-  if (size == 0u || offset + size > instance.storage_bytes.size()) {
+  if (size == 0u || offset + size > instance.instance_size_bytes) {
     return false;
   }
   std::uint64_t raw = accessor.getter_return_kind == RuntimeMethodReturnKind::Bool
                           ? static_cast<std::uint64_t>(value != 0 ? 1 : 0)
                           : static_cast<std::uint64_t>(
                                 static_cast<std::uint32_t>(value));
-  std::memcpy(instance.storage_bytes.data() + offset, &raw,
+  std::memcpy(instance.storage_bytes + offset, &raw,
               std::min<std::size_t>(size, sizeof(raw)));
   if (size > sizeof(raw)) {
-    std::fill(instance.storage_bytes.begin() + static_cast<std::ptrdiff_t>(offset + sizeof(raw)),
-              instance.storage_bytes.begin() + static_cast<std::ptrdiff_t>(offset + size),
-              0);
+    std::fill(instance.storage_bytes + offset + sizeof(raw),
+              instance.storage_bytes + offset + size, 0);
   }
   return true;
 }
@@ -2846,25 +5332,134 @@ bool WriteWeakRuntimeManagedPropertyValueUnlocked(
     const RealizedPropertyAccessor &accessor, int value) {
   const std::size_t offset = EffectiveIvarOffset(accessor);
   const std::size_t size = EffectiveIvarSize(accessor);
-  if (size == 0u || offset + size > instance.storage_bytes.size()) {
-    return false;
-  }
-  int previous = 0;
-  (void)ReadRuntimeManagedPropertyValueRaw(instance, accessor, previous);
-  RemoveWeakSlotRefUnlocked(state, previous,
-                            static_cast<int>(instance.receiver_identity), offset,
-                            size);
-  if (!WriteRuntimeManagedPropertyValueRaw(instance, accessor, value)) {
+  if (size == 0u || offset + size > instance.instance_size_bytes) {
     return false;
   }
-  if (IsRuntimeManagedReceiverValueUnlocked(state, value)) {
-    RegisterWeakSlotRefUnlocked(state, value,
-                                static_cast<int>(instance.receiver_identity),
-                                offset, size);
+  unsigned char *const slot = instance.storage_bytes + offset;
+  const int owner_receiver = static_cast<int>(instance.receiver_identity);
+  const int previous = static_cast<int>(LoadWeakSlotWord(slot, size));
+  RuntimeWeakSideTableStripe *const previous_stripe =
+      previous != 0 ? &WeakSideTableStripe(state, previous) : nullptr;
+  RuntimeWeakSideTableStripe *const value_stripe =
+      IsRuntimeManagedReceiverValueUnlocked(state, value)
+          ? &WeakSideTableStripe(state, value)
+          : nullptr;
+  // The slot changes under both affected stripes so a concurrent weak load
+  // never observes it between unregistering the old target and registering
+  // the new one.
+  std::unique_lock<std::mutex> previous_lock;
+  std::unique_lock<std::mutex> value_lock;
+  if (previous_stripe != nullptr && value_stripe != nullptr &&
+      previous_stripe != value_stripe) {
+    previous_lock =
+        std::unique_lock<std::mutex>(previous_stripe->mutex, std::defer_lock);
+    value_lock =
+        std::unique_lock<std::mutex>(value_stripe->mutex, std::defer_lock);
+    std::lock(previous_lock, value_lock);
+  } else if (previous_stripe != nullptr) {
+    previous_lock = std::unique_lock<std::mutex>(previous_stripe->mutex);
+  } else if (value_stripe != nullptr) {
+    value_lock = std::unique_lock<std::mutex>(value_stripe->mutex);
+  }
+  if (previous_stripe != nullptr) {
+    UnregisterWeakSlotRefLocked(*previous_stripe, previous, owner_receiver,
+                                offset);
+  }
+  StoreWeakSlotWord(
+      slot, size,
+      accessor.getter_return_kind == RuntimeMethodReturnKind::Bool
+          ? (value != 0 ? 1u : 0u)
+          : static_cast<std::uint32_t>(value));
+  if (value_stripe != nullptr) {
+    RegisterWeakSlotRefLocked(*value_stripe, value, owner_receiver, offset,
+                              size);
   }
   return true;
 }
 
+// Weak loads skip the runtime mutex. The frame's receiver is kept alive by the
+// caller, so its slot and storage stay put; the slot is re-read under the
+// loaded target's stripe so zeroing, which holds that stripe, is never
+// observed half done, and a registered target whose count already reached
+// zero reads as nil.
+int LoadWeakRuntimeManagedPropertyValue(
+    RuntimeState &state, int owner_receiver,
+    const RealizedPropertyAccessor &accessor) {
+  std::uint32_t owner_generation = 0;
+  const RuntimeInstanceRecord *const owner =
+      RuntimeInstanceSlotForHandle(state, owner_receiver, owner_generation);
+  if (owner == nullptr) {
+    return 0;
+  }
+  const std::uint64_t owner_retain_state =
+      owner->retain_state.load(std::memory_order_acquire);
+  if (RuntimeInstanceRetainGeneration(owner_retain_state) != owner_generation ||
+      RuntimeInstanceRetainCount(owner_retain_state) == 0u) {
+    return 0;
+  }
+  const std::size_t offset = EffectiveIvarOffset(accessor);
+  const std::size_t size = EffectiveIvarSize(accessor);
+  if (size == 0u || offset + size > owner->instance_size_bytes) {
+    return 0;
+  }
+  const unsigned char *const slot = owner->storage_bytes + offset;
+  int value = static_cast<int>(LoadWeakSlotWord(slot, size));
+  while (value != 0) {
+    RuntimeWeakSideTableStripe &stripe = WeakSideTableStripe(state, value);
+    std::lock_guard<std::mutex> stripe_lock(stripe.mutex);
+    const int current = static_cast<int>(LoadWeakSlotWord(slot, size));
+    if (current != value) {
+      value = current;
+      continue;
+    }
+    if (stripe.referrer_index_by_slot.find(WeakSlotKey(
+            owner_receiver, offset)) != stripe.referrer_index_by_slot.end()) {
+      std::uint32_t target_generation = 0;
+      const RuntimeInstanceRecord *const target =
+          RuntimeInstanceSlotForHandle(state, value, target_generation);
+      const std::uint64_t target_retain_state =
+          target != nullptr
+              ? target->retain_state.load(std::memory_order_acquire)
+              : 0u;
+      if (target == nullptr ||
+          RuntimeInstanceRetainGeneration(target_retain_state) !=
+              target_generation ||
+          RuntimeInstanceRetainCount(target_retain_state) == 0u) {
+        return 0;
+      }
+    }
+    break;
+  }
+  if (accessor.getter_return_kind == RuntimeMethodReturnKind::Bool) {
+    return value != 0 ? 1 : 0;
+  }
+  return value;
+}
+
+// Drops |owner|'s own registrations by reading its weak ivars, instead of
+// scanning every target's referrers.
+void RemoveWeakSlotRefsOwnedByReceiverUnlocked(
+    RuntimeState &state, const RuntimeInstanceRecord &owner,
+    const RealizedClassNode *node) {
+  if (node == nullptr || !node->runtime_layout_ready) {
+    return;
+  }
+  for (const RealizedPropertyAccessor &accessor :
+       node->runtime_property_accessors) {
+    if (!UsesWeakRuntimeHooks(accessor)) {
+      continue;
+    }
+    const std::size_t offset = EffectiveIvarOffset(accessor);
+    const std::size_t size = EffectiveIvarSize(accessor);
+    if (size == 0u || offset + size > owner.instance_size_bytes) {
+      continue;
+    }
+    RemoveWeakSlotRefUnlocked(
+        state, static_cast<int>(LoadWeakSlotWord(owner.storage_bytes + offset, size)),
+        static_cast<int>(owner.receiver_identity), offset);
+  }
+}
+
 bool WriteRuntimeManagedPropertyValueUnlocked(RuntimeState &state,
                                               RuntimeInstanceRecord &instance,
                                               const RealizedPropertyAccessor &accessor,
@@ -2889,26 +5484,21 @@ bool ExchangeRuntimeManagedPropertyValueUnlocked(
 }
 
 void RetainRuntimeValueUnlocked(RuntimeState &state, int value);
-void ReleaseRuntimeValueUnlocked(RuntimeState &state, int value);
-
-void DestroyRuntimeInstanceUnlocked(RuntimeState &state, int receiver) {
-  const auto instance_it = state.runtime_instances_by_receiver.find(receiver);
-  if (instance_it == state.runtime_instances_by_receiver.end()) {
-    return;
-  }
-  RuntimeInstanceRecord instance = std::move(instance_it->second);
-  state.runtime_instances_by_receiver.erase(instance_it);
-  state.live_runtime_instance_count =
-      static_cast<std::uint64_t>(state.runtime_instances_by_receiver.size());
 
-  ZeroWeakSlotRefsForTargetUnlocked(state, receiver);
-  RemoveWeakSlotRefsOwnedByReceiverUnlocked(state, receiver);
+// |instance| has already had its retain count dropped to zero, so it no
+// longer resolves through FindRuntimeInstanceUnlocked. Values held by its
+// strong ivars go onto the pending-release worklist for the caller to drain.
+void DestroyRuntimeInstanceUnlocked(RuntimeState &state, int receiver,
+                                    RuntimeInstanceRecord &instance) {
+  --state.live_runtime_instance_count;
+  BumpRuntimeMetric(RuntimeMetric::InstanceDealloc);
 
   const RealizedClassNode *node =
       FindRealizedClassNodeByBaseIdentityUnlocked(state, instance.base_identity);
-  std::vector<int> owned_values_to_release;
+  ZeroWeakSlotRefsForTargetUnlocked(state, receiver);
+  RemoveWeakSlotRefsOwnedByReceiverUnlocked(state, instance, node);
+
   if (node != nullptr && node->runtime_layout_ready) {
-    owned_values_to_release.reserve(node->runtime_property_accessors.size());
     for (const RealizedPropertyAccessor &accessor :
          node->runtime_property_accessors) {
       if (!UsesStrongOwnedRuntimeHooks(accessor)) {
@@ -2917,54 +5507,172 @@ void DestroyRuntimeInstanceUnlocked(RuntimeState &state, int receiver) {
       int stored_value = 0;
       if (ReadRuntimeManagedPropertyValueRaw(instance, accessor, stored_value) &&
           stored_value != 0) {
-        owned_values_to_release.push_back(stored_value);
+        state.pending_releases.push_back(stored_value);
+        ++state.cascade_release_count;
       }
     }
+    state.max_pending_release_count =
+        std::max<std::uint64_t>(state.max_pending_release_count,
+                                state.pending_releases.size());
   }
-  for (int stored_value : owned_values_to_release) {
-    ReleaseRuntimeValueUnlocked(state, stored_value);
-  }
+  FreeRuntimeInstanceSlotUnlocked(state, instance);
 }
 
 void RetainRuntimeValueUnlocked(RuntimeState &state, int value) {
-  const auto instance_it = state.runtime_instances_by_receiver.find(value);
-  if (instance_it != state.runtime_instances_by_receiver.end()) {
-    ++instance_it->second.retain_count;
+  if (!TryRetainRuntimeInstance(state, value)) {
+    (void)TryRetainRuntimeBlock(state, value);
+  }
+}
+
+// Instance counts are shared with the lock-free retain/release fast path, so
+// even under the mutex they only move by CAS. Returns false when |value| is not
+// a live instance handle.
+bool ReleaseRuntimeInstanceUnlocked(RuntimeState &state, int value,
+                                    std::uint64_t release_count) {
+  std::uint32_t generation = 0;
+  RuntimeInstanceRecord *const instance =
+      RuntimeInstanceSlotForHandle(state, value, generation);
+  if (instance == nullptr) {
+    return false;
+  }
+  const RuntimeRetainReleaseResult result = ReleaseRuntimeSlotUnlocked(
+      instance->retain_state, generation, release_count);
+  if (result == RuntimeRetainReleaseResult::FinalRelease) {
+    DestroyRuntimeInstanceUnlocked(state, value, *instance);
+  }
+  return result != RuntimeRetainReleaseResult::NotLive;
+}
+
+void ReleaseRuntimeBlockUnlocked(RuntimeState &state, int block_handle,
+                                 std::uint64_t release_count) {
+  std::uint32_t generation = 0;
+  RuntimeBlockRecord *const record =
+      RuntimeBlockSlotForHandle(state, block_handle, generation);
+  if (record == nullptr ||
+      ReleaseRuntimeSlotUnlocked(record->retain_state, generation,
+                                 release_count) !=
+          RuntimeRetainReleaseResult::FinalRelease) {
     return;
   }
-  const auto block_it = state.runtime_blocks_by_handle.find(value);
-  if (block_it == state.runtime_blocks_by_handle.end()) {
+  // block-runtime allocation/copy-dispose/invoke anchor: final
+  // block-handle release now runs the optional dispose helper before erasing
+  // the runtime-owned block record.
+  if (record->dispose_helper != nullptr && !record->storage_words.empty()) {
+    record->dispose_helper(record->storage_words.data());
+  }
+  FreeRuntimeBlockSlotUnlocked(state, *record, true);
+}
+
+// Drops |release_count| references to |value| without draining the cascade.
+void ReleaseRuntimeValueCountUnlocked(RuntimeState &state, int value,
+                                      std::uint64_t release_count) {
+  if (ReleaseRuntimeInstanceUnlocked(state, value, release_count)) {
     return;
   }
-  ++block_it->second.retain_count;
+  ReleaseRuntimeBlockUnlocked(state, value, release_count);
+}
+
+// Runs deallocation cascades iteratively: each final release appends its
+// owned values, and the loop keeps releasing until the worklist is empty.
+void DrainPendingReleasesUnlocked(RuntimeState &state) {
+  while (!state.pending_releases.empty()) {
+    const int value = state.pending_releases.back();
+    state.pending_releases.pop_back();
+    ReleaseRuntimeValueCountUnlocked(state, value, 1u);
+  }
 }
 
 void ReleaseRuntimeValueUnlocked(RuntimeState &state, int value) {
-  const auto instance_it = state.runtime_instances_by_receiver.find(value);
-  if (instance_it != state.runtime_instances_by_receiver.end()) {
-    if (instance_it->second.retain_count > 1u) {
-      --instance_it->second.retain_count;
-      return;
+  ReleaseRuntimeValueCountUnlocked(state, value, 1u);
+  DrainPendingReleasesUnlocked(state);
+}
+
+// Releases a drained pool or dispatch frame as one batch. Sorting groups the
+// handles by slab and slot, equal handles collapse into one decrement, and
+// final releases cascade through the pending worklist. Clears |values|.
+void ReleaseRuntimeValueBatchUnlocked(RuntimeState &state,
+                                      std::vector<int> &values) {
+  std::sort(values.begin(), values.end());
+  ++state.release_batch_count;
+  state.batched_release_value_count += values.size();
+  for (std::size_t index = 0; index < values.size();) {
+    std::size_t run_end = index + 1u;
+    while (run_end < values.size() && values[run_end] == values[index]) {
+      ++run_end;
     }
-    DestroyRuntimeInstanceUnlocked(state, value);
-    return;
+    state.coalesced_release_value_count += run_end - index - 1u;
+    ReleaseRuntimeValueCountUnlocked(state, values[index], run_end - index);
+    index = run_end;
   }
-  const auto block_it = state.runtime_blocks_by_handle.find(value);
-  if (block_it == state.runtime_blocks_by_handle.end()) {
-    return;
+  values.clear();
+  DrainPendingReleasesUnlocked(state);
+}
+
+// Lock-free unless this is the value's final release, which takes the mutex
+// to run the deallocation cascade.
+void ReleaseRuntimeValueOutsideMutex(RuntimeState &state, int value) {
+  RuntimeRetainReleaseResult result = TryReleaseRuntimeInstance(state, value);
+  if (result == RuntimeRetainReleaseResult::NotLive) {
+    result = TryReleaseRuntimeBlock(state, value);
   }
-  if (block_it->second.retain_count > 1u) {
-    --block_it->second.retain_count;
+  if (result != RuntimeRetainReleaseResult::FinalRelease) {
     return;
   }
-  // block-runtime allocation/copy-dispose/invoke anchor: final
-  // block-handle release now runs the optional dispose helper before erasing
-  // the runtime-owned block record.
-  if (block_it->second.dispose_helper != nullptr &&
-      !block_it->second.storage_words.empty()) {
-    block_it->second.dispose_helper(block_it->second.storage_words.data());
+  std::lock_guard<std::mutex> lock(state.mutex);
+  ReleaseRuntimeValueUnlocked(state, value);
+}
+
+// Mirrors the locked builtin getter: strong values come back retained and
+// autoreleased into the current frame.
+bool TryReadDirectRuntimeProperty(RuntimeState &state, int receiver,
+                                  const RealizedPropertyAccessor &accessor,
+                                  int &value) {
+  unsigned char *const slot =
+      DirectRuntimePropertySlot(state, receiver, accessor);
+  if (slot == nullptr) {
+    return false;
+  }
+  const std::uint32_t word = LoadDirectPropertySlotWord(slot, accessor.direct_size);
+  value = accessor.getter_return_kind == RuntimeMethodReturnKind::Bool
+              ? (word != 0u ? 1 : 0)
+              : static_cast<int>(word);
+  if (accessor.direct_access == RuntimeDirectPropertyAccess::StrongNonatomic &&
+      value != 0) {
+    if (!TryRetainRuntimeInstance(state, value)) {
+      (void)TryRetainRuntimeBlock(state, value);
+    }
+    EnqueueAutoreleaseValue(value);
+  }
+  state.direct_property_get_count.fetch_add(1u, std::memory_order_relaxed);
+  return true;
+}
+
+// Mirrors the locked builtin setter: a strong slot retains the new value
+// before publishing it and releases the one it displaced.
+bool TryWriteDirectRuntimeProperty(RuntimeState &state, int receiver,
+                                   const RealizedPropertyAccessor &accessor,
+                                   int value) {
+  unsigned char *const slot =
+      DirectRuntimePropertySlot(state, receiver, accessor);
+  if (slot == nullptr) {
+    return false;
   }
-  state.runtime_blocks_by_handle.erase(block_it);
+  const bool strong =
+      accessor.direct_access == RuntimeDirectPropertyAccess::StrongNonatomic;
+  if (strong && value != 0 && !TryRetainRuntimeInstance(state, value)) {
+    (void)TryRetainRuntimeBlock(state, value);
+  }
+  const std::uint32_t word =
+      accessor.getter_return_kind == RuntimeMethodReturnKind::Bool
+          ? (value != 0 ? 1u : 0u)
+          : static_cast<std::uint32_t>(value);
+  const int previous = static_cast<int>(
+      ExchangeDirectPropertySlotWord(slot, accessor.direct_size, word));
+  if (strong && previous != 0) {
+    ReleaseRuntimeValueOutsideMutex(state, previous);
+  }
+  state.direct_property_set_count.fetch_add(1u, std::memory_order_relaxed);
+  return true;
 }
 
 int InvokeRuntimeBuiltinMethod(RuntimeState &state,
@@ -2984,31 +5692,17 @@ int InvokeRuntimeBuiltinMethod(RuntimeState &state,
       if (node == nullptr) {
         return static_cast<int>(base_identity + 1u);
       }
-      int receiver_identity = state.next_runtime_instance_receiver;
-      while (receiver_identity <= 0 ||
-             state.runtime_instances_by_receiver.find(receiver_identity) !=
-                 state.runtime_instances_by_receiver.end()) {
-        ++receiver_identity;
-      }
-      state.next_runtime_instance_receiver = receiver_identity + 1;
-      RuntimeInstanceRecord instance;
-      instance.receiver_identity = static_cast<std::uint64_t>(receiver_identity);
-      instance.base_identity = base_identity;
-      instance.class_name = node->class_name;
-      instance.instance_size_bytes =
+      const std::size_t instance_size_bytes =
           std::max<std::size_t>(node->runtime_instance_size_bytes, 1u);
-      instance.storage_bytes.assign(instance.instance_size_bytes, 0u);
-      instance.retain_count = 1u;
-      state.runtime_instances_by_receiver.emplace(receiver_identity,
-                                                 std::move(instance));
-      state.live_runtime_instance_count =
-          static_cast<std::uint64_t>(state.runtime_instances_by_receiver.size());
+      const int receiver_identity = AllocateRuntimeInstanceUnlocked(
+          state, base_identity, instance_size_bytes);
+      if (receiver_identity == 0) {
+        return 0;
+      }
       state.last_allocated_runtime_instance_receiver =
           static_cast<std::uint64_t>(receiver_identity);
       state.last_allocated_runtime_instance_base_identity = base_identity;
-      state.last_allocated_runtime_instance_size_bytes =
-          std::max<std::size_t>(node->runtime_instance_size_bytes, 1u);
-      state.last_allocated_runtime_instance_class_name = node->class_name;
+      state.last_allocated_runtime_instance_size_bytes = instance_size_bytes;
       return receiver_identity;
     }
     case RuntimeBuiltinKind::Init:
@@ -3017,13 +5711,22 @@ int InvokeRuntimeBuiltinMethod(RuntimeState &state,
       if (runtime_property_accessor == nullptr) {
         return 0;
       }
+      if (runtime_property_accessor->direct_access !=
+          RuntimeDirectPropertyAccess::None) {
+        int value = 0;
+        if (TryReadDirectRuntimeProperty(state, receiver,
+                                         *runtime_property_accessor, value)) {
+          return value;
+        }
+      }
       std::lock_guard<std::mutex> lock(state.mutex);
-      const auto instance_it = state.runtime_instances_by_receiver.find(receiver);
-      if (instance_it == state.runtime_instances_by_receiver.end()) {
+      const RuntimeInstanceRecord *instance =
+          FindRuntimeInstanceUnlocked(state, receiver);
+      if (instance == nullptr) {
         return 0;
       }
       int value = 0;
-      if (!ReadRuntimeManagedPropertyValueUnlocked(state, instance_it->second,
+      if (!ReadRuntimeManagedPropertyValueUnlocked(state, *instance,
                                                    *runtime_property_accessor,
                                                    value)) {
         return 0;
@@ -3039,9 +5742,16 @@ int InvokeRuntimeBuiltinMethod(RuntimeState &state,
       if (runtime_property_accessor == nullptr) {
         return 0;
       }
+      if (runtime_property_accessor->direct_access !=
+              RuntimeDirectPropertyAccess::None &&
+          TryWriteDirectRuntimeProperty(state, receiver,
+                                        *runtime_property_accessor, a0)) {
+        return 0;
+      }
       std::lock_guard<std::mutex> lock(state.mutex);
-      const auto instance_it = state.runtime_instances_by_receiver.find(receiver);
-      if (instance_it == state.runtime_instances_by_receiver.end()) {
+      RuntimeInstanceRecord *instance =
+          FindRuntimeInstanceUnlocked(state, receiver);
+      if (instance == nullptr) {
         return 0;
       }
       if (UsesStrongOwnedRuntimeHooks(*runtime_property_accessor)) {
@@ -3050,15 +5760,14 @@ int InvokeRuntimeBuiltinMethod(RuntimeState &state,
         }
         int previous_value = 0;
         if (ExchangeRuntimeManagedPropertyValueUnlocked(
-                state, instance_it->second, *runtime_property_accessor, a0,
+                state, *instance, *runtime_property_accessor, a0,
                 previous_value) &&
             previous_value != 0) {
           ReleaseRuntimeValueUnlocked(state, previous_value);
         }
       } else {
-        (void)WriteRuntimeManagedPropertyValueUnlocked(state, instance_it->second,
-                                                       *runtime_property_accessor,
-                                                       a0);
+        (void)WriteRuntimeManagedPropertyValueUnlocked(
+            state, *instance, *runtime_property_accessor, a0);
       }
       return 0;
     }
@@ -3068,23 +5777,232 @@ int InvokeRuntimeBuiltinMethod(RuntimeState &state,
   return 0;
 }
 
-const objc3_runtime_selector_handle *LookupSelectorUnlocked(const char *selector) {
-  // selector-table anchor: metadata-backed selector pools now
-  // materialize the canonical runtime selector table, while direct lookup of
-  // non-emitted selectors remains a dynamic fallback. The later runtime step layers
-  // method-cache and class/metaclass slow-path dispatch on top of the same
-  // preserved public lookup/dispatch surface.
-  if (selector == nullptr) {
-    return nullptr;
+// keypath-chain anchor: a key path handle evaluates against a live root
+// through a chain compiled once per (handle, root class). Each step keeps the
+// accessor its component resolved to plus that accessor's slot, so a warm
+// evaluation is one cache lookup and one slot load per component under a
+// single mutex acquisition, with no path splitting or name hashing. A step is
+// compiled the first time evaluation reaches it, against the class actually
+// found there; a later intermediate of another class resolves that one step
+// by name and leaves the chain alone. Evaluation reads and writes the same
+// realized storage the runtime-managed accessors use.
+bool KeyPathRootMatchesUnlocked(const RuntimeState &state,
+                                const KeyPathSlot &slot,
+                                std::uint64_t base_identity) {
+  if (slot.root_is_self) {
+    return true;
   }
-
-  RuntimeState &state = State();
-  const auto found = state.selector_index_by_name.find(selector);
-  if (found != state.selector_index_by_name.end()) {
-    return &state.selector_slots[found->second].handle;
+  std::unordered_set<const RealizedClassNode *> visited;
+  const RealizedClassNode *node =
+      FindRealizedClassNodeByBaseIdentityUnlocked(state, base_identity);
+  while (node != nullptr && visited.insert(node).second) {
+    if (node->class_id == slot.root_class_id) {
+      return true;
+    }
+    node = node->has_super_node
+               ? &state.realized_class_nodes[node->super_node_index]
+               : nullptr;
   }
+  return false;
+}
 
-  SelectorSlot slot;
+bool CompileKeyPathStepUnlocked(RuntimeState &state, const KeyPathSlot &slot,
+                                std::size_t component_index,
+                                std::uint64_t base_identity,
+                                KeyPathChainStep &step) {
+  const RealizedClassNode *node =
+      FindRealizedClassNodeByBaseIdentityUnlocked(state, base_identity);
+  if (node == nullptr || component_index >= slot.component_ids.size()) {
+    return false;
+  }
+  const RealizedClassNode *resolved_node = nullptr;
+  bool inherited = false;
+  bool used_cache = false;
+  const RealizedPropertyAccessor *accessor =
+      FindRuntimePropertyAccessorByNameUnlocked(
+          state, *node,
+          RuntimeSymbolName(state, slot.component_ids[component_index]).c_str(),
+          resolved_node, inherited, used_cache);
+  if (accessor == nullptr || accessor->ivar_descriptor == nullptr ||
+      accessor->getter_return_kind == RuntimeMethodReturnKind::Unsupported) {
+    return false;
+  }
+  const std::size_t offset = EffectiveIvarOffset(*accessor);
+  const std::size_t size = EffectiveIvarSize(*accessor);
+  if (size == 0u || offset + size > node->runtime_instance_size_bytes) {
+    return false;
+  }
+  step.base_identity = base_identity;
+  step.accessor = accessor;
+  step.offset = static_cast<std::uint32_t>(offset);
+  step.size = static_cast<std::uint32_t>(size);
+  step.strong = UsesStrongOwnedRuntimeHooks(*accessor);
+  step.weak = UsesWeakRuntimeHooks(*accessor);
+  step.unowned_safe = UsesSafeUnownedRuntimeHooks(*accessor);
+  step.settable = accessor->property_descriptor->effective_setter_available;
+  return true;
+}
+
+// A slot a direct accessor may touch without the mutex is only ever accessed
+// as a whole atomic word, even under it.
+bool IsDirectKeyPathSlot(const KeyPathChainStep &step,
+                         const unsigned char *slot) {
+  return step.accessor->direct_access != RuntimeDirectPropertyAccess::None &&
+         reinterpret_cast<std::uintptr_t>(slot) % step.size == 0u;
+}
+
+bool LoadKeyPathStepValueUnlocked(const RuntimeState &state,
+                                  const RuntimeInstanceRecord &instance,
+                                  const KeyPathChainStep &step, int &value) {
+  if (static_cast<std::size_t>(step.offset) + step.size >
+      instance.instance_size_bytes) {
+    return false;
+  }
+  unsigned char *const slot = instance.storage_bytes + step.offset;
+  std::uint64_t raw = 0;
+  if (IsDirectKeyPathSlot(step, slot)) {
+    raw = LoadDirectPropertySlotWord(slot, step.size);
+  } else {
+    std::memcpy(&raw, slot, std::min<std::size_t>(step.size, sizeof(raw)));
+  }
+  value = step.accessor->getter_return_kind == RuntimeMethodReturnKind::Bool
+              ? (raw != 0u ? 1 : 0)
+              : static_cast<int>(raw & 0xffffffffu);
+  if (step.unowned_safe && !IsRuntimeManagedReceiverValueUnlocked(state, value)) {
+    value = 0;
+  }
+  return true;
+}
+
+// Mirrors the locked builtin setter, including its retain of the new strong
+// value and release of the displaced one.
+bool StoreKeyPathStepValueUnlocked(RuntimeState &state,
+                                   RuntimeInstanceRecord &instance,
+                                   const KeyPathChainStep &step, int value) {
+  if (!step.settable || static_cast<std::size_t>(step.offset) + step.size >
+                            instance.instance_size_bytes) {
+    return false;
+  }
+  if (step.weak) {
+    return WriteWeakRuntimeManagedPropertyValueUnlocked(state, instance,
+                                                        *step.accessor, value);
+  }
+  unsigned char *const slot = instance.storage_bytes + step.offset;
+  if (step.strong && value != 0) {
+    RetainRuntimeValueUnlocked(state, value);
+  }
+  int previous = 0;
+  if (IsDirectKeyPathSlot(step, slot)) {
+    const std::uint32_t word =
+        step.accessor->getter_return_kind == RuntimeMethodReturnKind::Bool
+            ? (value != 0 ? 1u : 0u)
+            : static_cast<std::uint32_t>(value);
+    previous = static_cast<int>(
+        ExchangeDirectPropertySlotWord(slot, step.size, word));
+  } else if (step.strong) {
+    (void)ExchangeRuntimeManagedPropertyValueUnlocked(
+        state, instance, *step.accessor, value, previous);
+  } else {
+    return WriteRuntimeManagedPropertyValueRaw(instance, *step.accessor, value);
+  }
+  if (step.strong && previous != 0) {
+    ReleaseRuntimeValueUnlocked(state, previous);
+  }
+  return true;
+}
+
+// Walks |receiver| to the object that owns the key path's last component and
+// returns it with the step to apply there. Returns null when the handle is
+// unknown or ambiguous, the receiver's class is not the key path's root, a
+// component does not resolve, or an intermediate value is nil or dead.
+RuntimeInstanceRecord *ResolveKeyPathTargetUnlocked(RuntimeState &state,
+                                                    int keypath_handle,
+                                                    int receiver,
+                                                    KeyPathChainStep &target) {
+  if (keypath_handle <= 0) {
+    return nullptr;
+  }
+  RuntimeInstanceRecord *instance = FindRuntimeInstanceUnlocked(state, receiver);
+  if (instance == nullptr) {
+    return nullptr;
+  }
+  KeyPathChainKey key;
+  key.keypath_handle = static_cast<std::uint64_t>(keypath_handle);
+  key.root_base_identity = instance->base_identity;
+  auto chain_it = state.keypath_chain_cache.find(key);
+  if (chain_it == state.keypath_chain_cache.end()) {
+    KeyPathChain chain;
+    const auto slot_it = state.keypath_slots.find(key.keypath_handle);
+    if (slot_it != state.keypath_slots.end() && !slot_it->second.ambiguous &&
+        !slot_it->second.component_ids.empty()) {
+      chain.slot = &slot_it->second;
+      chain.resolved =
+          KeyPathRootMatchesUnlocked(state, slot_it->second, key.root_base_identity);
+    }
+    ++state.keypath_chain_build_count;
+    chain_it = state.keypath_chain_cache.emplace(key, std::move(chain)).first;
+  } else {
+    ++state.keypath_chain_hit_count;
+  }
+  KeyPathChain &chain = chain_it->second;
+  if (!chain.resolved) {
+    return nullptr;
+  }
+  const std::size_t component_count = chain.slot->component_ids.size();
+  for (std::size_t index = 0;; ++index) {
+    const KeyPathChainStep *step = nullptr;
+    KeyPathChainStep uncached_step;
+    if (index < chain.steps.size() &&
+        chain.steps[index].base_identity == instance->base_identity) {
+      step = &chain.steps[index];
+    } else if (index == chain.steps.size()) {
+      if (!CompileKeyPathStepUnlocked(state, *chain.slot, index,
+                                      instance->base_identity, uncached_step)) {
+        return nullptr;
+      }
+      chain.steps.push_back(uncached_step);
+      step = &chain.steps.back();
+    } else {
+      ++state.keypath_chain_step_miss_count;
+      if (!CompileKeyPathStepUnlocked(state, *chain.slot, index,
+                                      instance->base_identity, uncached_step)) {
+        return nullptr;
+      }
+      step = &uncached_step;
+    }
+    if (index + 1u == component_count) {
+      target = *step;
+      return instance;
+    }
+    int value = 0;
+    if (!LoadKeyPathStepValueUnlocked(state, *instance, *step, value)) {
+      return nullptr;
+    }
+    instance = FindRuntimeInstanceUnlocked(state, value);
+    if (instance == nullptr) {
+      return nullptr;
+    }
+  }
+}
+
+const objc3_runtime_selector_handle *LookupSelectorUnlocked(const char *selector) {
+  // selector-table anchor: metadata-backed selector pools now
+  // materialize the canonical runtime selector table, while direct lookup of
+  // non-emitted selectors remains a dynamic fallback. The later runtime step layers
+  // method-cache and class/metaclass slow-path dispatch on top of the same
+  // preserved public lookup/dispatch surface.
+  if (selector == nullptr) {
+    return nullptr;
+  }
+
+  RuntimeState &state = State();
+  ++state.selector_spelling_lookup_count;
+  const std::size_t found = FindSelectorSlotIndexUnlocked(state, selector);
+  if (found != kNoSelectorSlot) {
+    return &state.selector_slots[found].handle;
+  }
+
+  SelectorSlot slot;
   slot.spelling_storage = selector;
   state.selector_slots.push_back(std::move(slot));
   SelectorSlot &stored = state.selector_slots.back();
@@ -3109,8 +6027,8 @@ bool MaterializeSelectorLookupEntryUnlocked(RuntimeState &state,
     return false;
   }
 
-  const auto found = state.selector_index_by_name.find(selector);
-  if (found == state.selector_index_by_name.end()) {
+  const std::size_t found = FindSelectorSlotIndexUnlocked(state, selector);
+  if (found == kNoSelectorSlot) {
     SelectorSlot slot;
     slot.spelling_storage = selector;
     slot.metadata_backed = true;
@@ -3137,7 +6055,7 @@ bool MaterializeSelectorLookupEntryUnlocked(RuntimeState &state,
     return true;
   }
 
-  SelectorSlot &stored = state.selector_slots[found->second];
+  SelectorSlot &stored = state.selector_slots[found];
   if (!stored.metadata_backed) {
     stored.metadata_backed = true;
     stored.first_registration_order_ordinal = registration_order_ordinal;
@@ -3151,7 +6069,7 @@ bool MaterializeSelectorLookupEntryUnlocked(RuntimeState &state,
   stored.last_registration_order_ordinal = registration_order_ordinal;
   stored.last_selector_pool_index = selector_pool_index;
   ++state.metadata_provider_edge_count;
-  state.last_materialized_selector = stored.spelling_storage;
+  state.last_materialized_selector = stored.handle.selector;
   state.last_materialized_stable_id = stored.handle.stable_id;
   state.last_materialized_registration_order_ordinal =
       registration_order_ordinal;
@@ -3175,6 +6093,22 @@ std::uint64_t CountKeyPathComponents(const char *component_path) {
   return count;
 }
 
+void InternKeyPathComponentsUnlocked(RuntimeState &state,
+                                     const std::string &component_path,
+                                     std::vector<RuntimeSymbolId> &component_ids) {
+  component_ids.clear();
+  std::size_t begin = 0;
+  while (begin <= component_path.size()) {
+    std::size_t end = component_path.find('.', begin);
+    if (end == std::string::npos) {
+      end = component_path.size();
+    }
+    component_ids.push_back(InternRuntimeSymbolUnlocked(
+        state, component_path.substr(begin, end - begin).c_str()));
+    begin = end + 1u;
+  }
+}
+
 bool KeyPathDescriptorsCompatible(const KeyPathSlot &slot,
                                   const EmittedKeyPathDescriptor &descriptor) {
   const char *generic_metadata_replay_key =
@@ -3212,6 +6146,12 @@ bool MaterializeKeyPathDescriptorUnlocked(
             : descriptor.generic_metadata_replay_key;
     slot.root_is_self = descriptor.root_is_self;
     slot.component_count = CountKeyPathComponents(descriptor.component_path);
+    if (!slot.root_is_self) {
+      slot.root_class_id =
+          InternRuntimeSymbolUnlocked(state, descriptor.root_name);
+    }
+    InternKeyPathComponentsUnlocked(state, slot.component_path_storage,
+                                    slot.component_ids);
     slot.metadata_provider_count = 1;
     slot.first_registration_order_ordinal = registration_order_ordinal;
     slot.last_registration_order_ordinal = registration_order_ordinal;
@@ -3262,20 +6202,16 @@ std::int64_t ComputeSelectorScore(const char *selector) {
   return selector_score;
 }
 
-int ComputeDispatchResult(int receiver, const char *selector, int a0, int a1,
-                          int a2, int a3) {
-  // lookup-dispatch-runtime anchor: live dispatch still preserves the
-  // deterministic formula as the fail-closed fallback. The next runtime step now routes
-  // supported class/metaclass resolutions through emitted method bodies first
-  // and returns to this arithmetic path only for unresolved or unsupported
-  // runtime lookups without changing the canonical dispatch entrypoint.
+int ComputeDispatchResultForSelectorScore(int receiver,
+                                          std::int64_t selector_score, int a0,
+                                          int a1, int a2, int a3) {
   std::int64_t value = 41;
   value += static_cast<std::int64_t>(receiver) * 97;
   value += static_cast<std::int64_t>(a0) * 7;
   value += static_cast<std::int64_t>(a1) * 11;
   value += static_cast<std::int64_t>(a2) * 13;
   value += static_cast<std::int64_t>(a3) * 17;
-  value += ComputeSelectorScore(selector) * 19;
+  value += selector_score * 19;
   value %= kDispatchModulus;
   if (value < 0) {
     value += kDispatchModulus;
@@ -3283,151 +6219,1054 @@ int ComputeDispatchResult(int receiver, const char *selector, int a0, int a1,
   return static_cast<int>(value);
 }
 
-std::uint64_t DescriptorTotal(
-    const objc3_runtime_image_descriptor *image) {
-  return image->class_descriptor_count + image->protocol_descriptor_count +
-         image->category_descriptor_count + image->property_descriptor_count +
-         image->ivar_descriptor_count;
+int ComputeDispatchResult(int receiver, const char *selector, int a0, int a1,
+                          int a2, int a3) {
+  // lookup-dispatch-runtime anchor: live dispatch still preserves the
+  // deterministic formula as the fail-closed fallback. The next runtime step now routes
+  // supported class/metaclass resolutions through emitted method bodies first
+  // and returns to this arithmetic path only for unresolved or unsupported
+  // runtime lookups without changing the canonical dispatch entrypoint.
+  return ComputeDispatchResultForSelectorScore(
+      receiver, ComputeSelectorScore(selector), a0, a1, a2, a3);
 }
 
-std::uint64_t AggregateCount(const objc3_runtime_pointer_aggregate *aggregate) {
-  return aggregate == nullptr ? 0 : aggregate->count;
+struct RuntimeDispatchInvocation {
+  bool resolved_live_method = false;
+  const void *implementation = nullptr;
+  const RealizedPropertyAccessor *runtime_property_accessor = nullptr;
+  std::uint64_t parameter_count = 0;
+  RuntimeMethodReturnKind return_kind = RuntimeMethodReturnKind::Unsupported;
+  RuntimeBuiltinKind builtin_kind = RuntimeBuiltinKind::None;
+  std::uint64_t receiver_base_identity = 0;
+  // Fallback selector score a call-site binding computed once; negative when
+  // the fallback must score the selector spelling itself.
+  std::int64_t selector_score = -1;
+};
+
+void AdoptMethodCacheEntryForInvocation(const MethodCacheEntry &entry,
+                                        std::uint64_t receiver_base_identity,
+                                        RuntimeDispatchInvocation &invocation) {
+  invocation.receiver_base_identity = receiver_base_identity;
+  if (!entry.resolved) {
+    return;
+  }
+  invocation.resolved_live_method = true;
+  invocation.implementation = entry.implementation;
+  invocation.runtime_property_accessor = entry.runtime_property_accessor;
+  invocation.parameter_count = entry.parameter_count;
+  invocation.return_kind = entry.return_kind;
+  invocation.builtin_kind = entry.builtin_kind;
 }
 
-const void *AggregateEntry(const objc3_runtime_pointer_aggregate *aggregate,
-                           std::uint64_t index) {
-  if (aggregate == nullptr || index >= aggregate->count) {
-    return nullptr;
+RuntimeDispatchTraceEvent &BeginDispatchTraceEvent(const RuntimeState &state) {
+  RuntimeDispatchTraceRing &ring = g_runtime_dispatch_trace;
+  if (state.dispatch_trace_enabled.load(std::memory_order_relaxed)) {
+    if (ring.retained_event_count != 0) {
+      ring.head = (ring.head + 1u) % kRuntimeDispatchTraceCapacity;
+    }
+    if (ring.retained_event_count < kRuntimeDispatchTraceCapacity) {
+      ++ring.retained_event_count;
+    }
+  } else {
+    ring.retained_event_count = 1;
+  }
+  RuntimeDispatchTraceEvent &event = ring.events[ring.head];
+  event = RuntimeDispatchTraceEvent{};
+  event.sequence = ++ring.recorded_event_count;
+  return event;
+}
+
+const RuntimeDispatchTraceEvent &LastDispatchTraceEvent() {
+  static const RuntimeDispatchTraceEvent kEmptyEvent{};
+  const RuntimeDispatchTraceRing &ring = g_runtime_dispatch_trace;
+  return ring.retained_event_count == 0 ? kEmptyEvent : ring.events[ring.head];
+}
+
+void RecordMethodCacheDispatchTraceEvent(RuntimeDispatchTraceEvent &event,
+                                         const MethodCacheEntry &entry,
+                                         std::uint64_t receiver_base_identity,
+                                         std::uint64_t method_cache_generation,
+                                         bool used_cache) {
+  event.method_cache_generation = method_cache_generation;
+  event.selector_stable_id = entry.selector_stable_id;
+  event.normalized_receiver_identity = entry.normalized_receiver_identity;
+  event.has_cache_entry = true;
+  event.used_cache = used_cache;
+  event.used_fast_path = used_cache && entry.fast_path_seeded;
+  event.resolved_live_method = entry.resolved;
+  event.fell_back = !entry.resolved;
+  event.effective_direct_dispatch = entry.effective_direct_dispatch;
+  event.category_probe_count = entry.category_probe_count;
+  event.protocol_probe_count = entry.protocol_probe_count;
+  event.parameter_count = entry.parameter_count;
+  event.implementation = entry.implementation;
+  event.builtin_kind = entry.builtin_kind;
+  event.used_builtin =
+      entry.resolved && entry.builtin_kind != RuntimeBuiltinKind::None;
+  if (entry.runtime_property_accessor != nullptr &&
+      entry.runtime_property_accessor->property_descriptor != nullptr) {
+    event.property_base_identity = receiver_base_identity;
+    event.property_slot_index =
+        entry.runtime_property_accessor->ivar_descriptor != nullptr
+            ? entry.runtime_property_accessor->ivar_descriptor->slot_index
+            : entry.runtime_property_accessor->property_descriptor
+                  ->ivar_layout_slot_index;
+  }
+  if (entry.resolved) {
+    event.path = !used_cache ? RuntimeDispatchTracePath::SlowPathLive
+                 : entry.fast_path_seeded
+                     ? RuntimeDispatchTracePath::CacheHitFastPath
+                     : RuntimeDispatchTracePath::CacheHitLive;
+  } else {
+    event.path = used_cache ? RuntimeDispatchTracePath::CacheHitFallback
+                            : RuntimeDispatchTracePath::SlowPathFallback;
+  }
+}
+
+const char *DescribeDispatchTracePath(RuntimeDispatchTracePath path) {
+  switch (path) {
+    case RuntimeDispatchTracePath::SlowPathLive:
+      return "slow-path-live";
+    case RuntimeDispatchTracePath::CacheHitFastPath:
+      return "cache-hit-fast-path";
+    case RuntimeDispatchTracePath::CacheHitLive:
+      return "cache-hit-live";
+    case RuntimeDispatchTracePath::CacheHitFallback:
+      return "cache-hit-fallback";
+    case RuntimeDispatchTracePath::SlowPathFallback:
+      return "slow-path-fallback";
+    case RuntimeDispatchTracePath::InvalidReceiverFallback:
+      return "invalid-receiver-fallback";
+    case RuntimeDispatchTracePath::NilShortCircuit:
+      return "nil-short-circuit";
+    case RuntimeDispatchTracePath::None:
+      break;
   }
-  return aggregate->entries[index];
+  return nullptr;
 }
 
-bool AggregateContainsPointer(const objc3_runtime_pointer_aggregate *aggregate,
-                              const void *target) {
-  if (aggregate == nullptr || target == nullptr) {
-    return false;
+// Materialized string view of one trace event. Every pointer aliases storage
+// owned by the selector table, the method cache, or emitted metadata, so it
+// stays valid until the next method-cache flush.
+struct RuntimeDispatchTraceView {
+  const char *selector = nullptr;
+  const char *fast_path_reason = nullptr;
+  const char *dispatch_path = nullptr;
+  const char *implementation_kind = nullptr;
+  const char *property_name = nullptr;
+  const char *resolved_class_name = nullptr;
+  const char *resolved_owner_identity = nullptr;
+};
+
+RuntimeDispatchTraceView ReconstructDispatchTraceEventUnlocked(
+    const RuntimeState &state, const RuntimeDispatchTraceEvent &event) {
+  RuntimeDispatchTraceView view;
+  view.dispatch_path = DescribeDispatchTracePath(event.path);
+  switch (event.path) {
+    case RuntimeDispatchTracePath::SlowPathLive:
+    case RuntimeDispatchTracePath::CacheHitFastPath:
+    case RuntimeDispatchTracePath::CacheHitLive:
+      view.implementation_kind = DescribeResolvedImplementationKind(
+          event.builtin_kind, event.implementation);
+      break;
+    case RuntimeDispatchTracePath::CacheHitFallback:
+    case RuntimeDispatchTracePath::SlowPathFallback:
+    case RuntimeDispatchTracePath::InvalidReceiverFallback:
+      view.implementation_kind = "fallback-formula";
+      break;
+    case RuntimeDispatchTracePath::NilShortCircuit:
+      view.implementation_kind = "nil-short-circuit";
+      break;
+    case RuntimeDispatchTracePath::None:
+      break;
   }
-  for (std::uint64_t index = 0; index < aggregate->count; ++index) {
-    if (aggregate->entries[index] == target) {
-      return true;
+  if (event.method_cache_generation != state.method_cache_generation) {
+    return view;
+  }
+  if (event.selector_stable_id != 0 &&
+      event.selector_stable_id <= state.selector_slots.size()) {
+    view.selector =
+        state.selector_slots[event.selector_stable_id - 1u].handle.selector;
+  }
+  if (!event.has_cache_entry) {
+    return view;
+  }
+  const auto cache_it = state.method_cache.find(MethodCacheKey{
+      event.normalized_receiver_identity, event.selector_stable_id});
+  if (cache_it == state.method_cache.end() ||
+      !IsMethodCacheEntryCurrentUnlocked(state, *cache_it->second)) {
+    return view;
+  }
+  const MethodCacheEntry &entry = *cache_it->second;
+  view.fast_path_reason = StableCString(entry.fast_path_reason);
+  view.resolved_class_name =
+      StableCString(RuntimeSymbolName(state, entry.class_id));
+  view.resolved_owner_identity = StableCString(entry.owner_identity);
+  if (entry.runtime_property_accessor != nullptr &&
+      entry.runtime_property_accessor->property_descriptor != nullptr) {
+    const char *property_name =
+        entry.runtime_property_accessor->property_descriptor->property_name;
+    if (property_name != nullptr && property_name[0] != '\0') {
+      view.property_name = property_name;
     }
   }
-  return false;
+  return view;
 }
 
-bool ImageDescriptorsMatch(const objc3_runtime_image_descriptor *lhs,
-                           const objc3_runtime_image_descriptor *rhs) {
-  if (lhs == nullptr || rhs == nullptr) {
-    return false;
+void RecordMethodCacheHitCounters(bool resolved, bool fast_path_seeded) {
+  if (!resolved) {
+    BumpRuntimeMetric(RuntimeMetric::MethodCacheFallbackHit);
+    return;
+  }
+  BumpRuntimeMetric(RuntimeMetric::MethodCacheLiveHit);
+  if (fast_path_seeded) {
+    BumpRuntimeMetric(RuntimeMetric::FastPathHit);
   }
-
-  const std::string lhs_module =
-      lhs->module_name != nullptr ? lhs->module_name : "";
-  const std::string rhs_module =
-      rhs->module_name != nullptr ? rhs->module_name : "";
-  const std::string lhs_identity =
-      lhs->translation_unit_identity_key != nullptr
-          ? lhs->translation_unit_identity_key
-          : "";
-  const std::string rhs_identity =
-      rhs->translation_unit_identity_key != nullptr
-          ? rhs->translation_unit_identity_key
-          : "";
-  return lhs_module == rhs_module &&
-         lhs_identity == rhs_identity &&
-         lhs->registration_order_ordinal == rhs->registration_order_ordinal &&
-         lhs->class_descriptor_count == rhs->class_descriptor_count &&
-         lhs->protocol_descriptor_count == rhs->protocol_descriptor_count &&
-         lhs->category_descriptor_count == rhs->category_descriptor_count &&
-         lhs->property_descriptor_count == rhs->property_descriptor_count &&
-         lhs->ivar_descriptor_count == rhs->ivar_descriptor_count;
 }
 
-const char *StableCString(const std::string &text) {
-  return text.empty() ? nullptr : text.c_str();
+void RecordMethodCacheHitCounters(const MethodCacheEntry &entry) {
+  RecordMethodCacheHitCounters(entry.resolved, entry.fast_path_seeded);
 }
 
-void MarkRejectedRegistrationUnlocked(
-    RuntimeState &state, const objc3_runtime_image_descriptor *image,
-    int status) {
-  state.last_registration_status = status;
-  state.last_rejected_module_name =
-      image != nullptr && image->module_name != nullptr ? image->module_name : "";
-  state.last_rejected_translation_unit_identity_key =
-      image != nullptr && image->translation_unit_identity_key != nullptr
-          ? image->translation_unit_identity_key
-          : "";
-  state.last_rejected_registration_order_ordinal =
-      image != nullptr ? image->registration_order_ordinal : 0;
+std::size_t DispatchHitCacheSlotIndex(int receiver, const char *selector) {
+  const std::uint64_t mixed =
+      (static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(selector)) >>
+       4u) ^
+      (static_cast<std::uint64_t>(static_cast<std::uint32_t>(receiver)) *
+       0x9E3779B97F4A7C15ull);
+  return static_cast<std::size_t>((mixed ^ (mixed >> 29u)) &
+                                  (kRuntimeDispatchHitCacheSlotCount - 1u));
 }
 
-void ClearRejectedRegistrationUnlocked(RuntimeState &state) {
-  state.last_rejected_module_name.clear();
-  state.last_rejected_translation_unit_identity_key.clear();
-  state.last_rejected_registration_order_ordinal = 0;
+void PublishDispatchHitCacheSlotUnlocked(
+    const RuntimeState &state, RuntimeDispatchHitCacheSlot &slot, int receiver,
+    const char *selector, const objc3_runtime_selector_handle *selector_handle,
+    std::uint64_t base_identity,
+    const std::shared_ptr<MethodCacheEntry> &entry) {
+  if (RuntimeHandleKindOf(receiver) == RuntimeHandleKind::Instance &&
+      FindRuntimeInstanceUnlocked(state, receiver) == nullptr) {
+    return;
+  }
+  slot.epoch = state.dispatch_cache_epoch.load(std::memory_order_relaxed);
+  slot.receiver = receiver;
+  slot.selector = selector;
+  slot.selector_handle = selector_handle;
+  slot.base_identity = base_identity;
+  slot.method_cache_generation = state.method_cache_generation;
+  slot.entry = entry;
+}
+
+// An instance binding stays valid only while its handle does: freeing the
+// instance advances the slot generation, so the lock-free retain-word check
+// rejects the stale handle without flushing every thread's cache.
+bool IsDispatchHitReceiverLive(const RuntimeState &state, int receiver) {
+  return RuntimeHandleKindOf(receiver) != RuntimeHandleKind::Instance ||
+         FindRuntimeInstanceUnlocked(state, receiver) != nullptr;
+}
+
+bool DispatchHitCacheSlotMatches(const RuntimeState &state,
+                                 const RuntimeDispatchHitCacheSlot &slot,
+                                 int receiver, const char *selector) {
+  return slot.epoch ==
+             state.dispatch_cache_epoch.load(std::memory_order_acquire) &&
+         slot.receiver == receiver && slot.selector == selector &&
+         slot.selector_handle != nullptr &&
+         IsDispatchHitReceiverLive(state, receiver);
+}
+
+void AdoptDispatchHitCacheSlot(RuntimeState &state,
+                               const RuntimeDispatchHitCacheSlot &slot,
+                               RuntimeDispatchInvocation &invocation) {
+  BumpRuntimeMetric(RuntimeMetric::DispatchCacheHit);
+  RecordMethodCacheHitCounters(*slot.entry);
+  RecordMethodCacheDispatchTraceEvent(BeginDispatchTraceEvent(state),
+                                      *slot.entry, slot.base_identity,
+                                      slot.method_cache_generation, true);
+  AdoptMethodCacheEntryForInvocation(*slot.entry, slot.base_identity,
+                                     invocation);
+}
+
+bool TryDispatchThroughThreadHitCache(RuntimeState &state, int receiver,
+                                      const char *selector,
+                                      RuntimeDispatchInvocation &invocation) {
+  // lock-free-dispatch-cache anchor: monomorphic sends that already hit the
+  // shared method cache once on this thread are served from the thread-local
+  // slot without touching the runtime mutex. The selector spelling is
+  // re-checked so a reused call-site buffer cannot alias a stale binding.
+  if (receiver <= 0 || selector == nullptr) {
+    return false;
+  }
+  const RuntimeDispatchHitCacheSlot &slot =
+      g_runtime_dispatch_hit_cache[DispatchHitCacheSlotIndex(receiver, selector)];
+  if (!DispatchHitCacheSlotMatches(state, slot, receiver, selector) ||
+      std::strcmp(slot.selector_handle->selector, selector) != 0) {
+    return false;
+  }
+  AdoptDispatchHitCacheSlot(state, slot, invocation);
+  return true;
 }
 
-void ClearImageWalkSnapshotUnlocked(RuntimeState &state) {
-  state.last_discovery_root_entry_count = 0;
-  state.last_walked_class_descriptor_count = 0;
-  state.last_walked_protocol_descriptor_count = 0;
-  state.last_walked_category_descriptor_count = 0;
-  state.last_walked_property_descriptor_count = 0;
-  state.last_walked_ivar_descriptor_count = 0;
-  state.last_walked_selector_pool_count = 0;
-  state.last_walked_string_pool_count = 0;
-  state.last_walked_keypath_descriptor_count = 0;
-  state.last_linker_anchor_matches_discovery_root = false;
-  state.last_registration_used_staged_table = false;
-  state.last_walked_module_name.clear();
-  state.last_walked_translation_unit_identity_key.clear();
+// selector-handle-dispatch anchor: handle-based sends key the thread hit cache
+// on the canonical selector handle, so a hit is pointer identity with no
+// selector spelling comparison.
+bool TryDispatchSelectorHandleThroughThreadHitCache(
+    RuntimeState &state, int receiver,
+    const objc3_runtime_selector_handle *selector_handle,
+    RuntimeDispatchInvocation &invocation) {
+  if (receiver <= 0) {
+    return false;
+  }
+  const RuntimeDispatchHitCacheSlot &slot =
+      g_runtime_dispatch_hit_cache[DispatchHitCacheSlotIndex(
+          receiver, selector_handle->selector)];
+  if (!DispatchHitCacheSlotMatches(state, slot, receiver,
+                                   selector_handle->selector) ||
+      slot.selector_handle != selector_handle) {
+    return false;
+  }
+  AdoptDispatchHitCacheSlot(state, slot, invocation);
+  return true;
 }
 
-void ApplyImageWalkRecordUnlocked(RuntimeState &state,
-                                  const RegisteredImageMetadata &record) {
-  state.walked_image_count = static_cast<std::uint64_t>(
-      state.registered_image_metadata_by_identity_key.size());
-  state.last_discovery_root_entry_count = record.discovery_root_entry_count;
-  state.last_walked_class_descriptor_count = record.class_descriptor_count;
-  state.last_walked_protocol_descriptor_count = record.protocol_descriptor_count;
-  state.last_walked_category_descriptor_count = record.category_descriptor_count;
-  state.last_walked_property_descriptor_count = record.property_descriptor_count;
-  state.last_walked_ivar_descriptor_count = record.ivar_descriptor_count;
-  state.last_walked_selector_pool_count = record.selector_pool_count;
-  state.last_walked_string_pool_count = record.string_pool_count;
-  state.last_walked_keypath_descriptor_count = record.keypath_descriptor_count;
-  state.last_linker_anchor_matches_discovery_root =
-      record.linker_anchor_matches_discovery_root;
-  state.last_registration_used_staged_table =
-      record.used_staged_registration_table;
-  state.last_walked_module_name = record.module_name;
-  state.last_walked_translation_unit_identity_key =
-      record.translation_unit_identity_key;
+// An emitted selector reference is uniqued against the selector table once
+// per table generation. Registration already materialized the image's pool
+// spellings, so binding is a single table probe; every later send reuses the
+// bound handle without hashing the spelling.
+const objc3_runtime_selector_handle *LoadBoundSelectorReference(
+    const RuntimeState &state, objc3_runtime_selector_reference &reference) {
+  if (std::atomic_ref<std::uint64_t>(reference.selector_table_generation)
+          .load(std::memory_order_acquire) !=
+      state.selector_table_generation.load(std::memory_order_acquire)) {
+    return nullptr;
+  }
+  return std::atomic_ref<const objc3_runtime_selector_handle *>(
+             reference.handle)
+      .load(std::memory_order_relaxed);
 }
 
-void RetainBootstrapRecordUnlocked(RuntimeState &state,
-                                   const RegisteredImageMetadata &record) {
-  const auto found = state.retained_bootstrap_metadata_by_identity_key.find(
-      record.translation_unit_identity_key);
-  if (found == state.retained_bootstrap_metadata_by_identity_key.end()) {
-    state.retained_bootstrap_identity_order.push_back(
-        record.translation_unit_identity_key);
+const objc3_runtime_selector_handle *BindSelectorReferenceUnlocked(
+    RuntimeState &state, objc3_runtime_selector_reference &reference) {
+  const objc3_runtime_selector_handle *selector_handle =
+      LoadBoundSelectorReference(state, reference);
+  if (selector_handle != nullptr) {
+    return selector_handle;
   }
-  state.retained_bootstrap_metadata_by_identity_key
-      [record.translation_unit_identity_key] = record;
-}
+  selector_handle = LookupSelectorUnlocked(reference.selector);
+  if (selector_handle == nullptr) {
+    return nullptr;
+  }
+  std::atomic_ref<const objc3_runtime_selector_handle *>(reference.handle)
+      .store(selector_handle, std::memory_order_relaxed);
+  std::atomic_ref<std::uint64_t>(reference.selector_table_generation)
+      .store(state.selector_table_generation.load(std::memory_order_relaxed),
+             std::memory_order_release);
+  ++state.bound_selector_reference_count;
+  return selector_handle;
+}
+
+// dispatch-site-cache anchor: a bound call-site cell points straight at its
+// binding, so a hit is one acquire load of the cell and the usual receiver,
+// selector, and epoch compare, after which the binding's prebuilt invocation
+// and trace event are copied out whole. Each site owns exactly one binding. A
+// rebind that resolves to the same target only refreshes its epoch; a new
+// target rewrites the binding in place under its sequence word, which is odd
+// while the rewrite runs, and a hit that sees the word move discards what it
+// copied and misses. A site that has published more than
+// kRuntimeDispatchSiteBindingLimit targets is marked megamorphic and answered
+// from the thread hit cache from then on, so a binding is never rewritten
+// without bound and the bindings a testing reset frees are one per site.
+constexpr std::uint64_t kRuntimeDispatchSiteBindingLimit = 8u;
+
+struct RuntimeDispatchSiteBinding {
+  std::atomic<std::uint64_t> sequence{0};
+  std::atomic<std::uint64_t> epoch{0};
+  std::atomic<std::uint64_t> method_cache_generation{0};
+  // Target and key; its own epoch and generation fields are not read.
+  RuntimeDispatchHitCacheSlot slot;
+  RuntimeDispatchInvocation invocation;
+  // Hit event minus its sequence and generation.
+  RuntimeDispatchTraceEvent trace_event;
+  // Targets this site has published, counting the current one.
+  std::uint64_t binding_count = 1;
+};
 
-std::uint64_t ZeroRetainedBootstrapImageLocalInitStatesUnlocked(
-    RuntimeState &state) {
-  std::uint64_t cleared_count = 0;
-  for (const std::string &identity_key : state.retained_bootstrap_identity_order) {
-    const auto found =
-        state.retained_bootstrap_metadata_by_identity_key.find(identity_key);
-    if (found == state.retained_bootstrap_metadata_by_identity_key.end()) {
-      continue;
-    }
-    const RegisteredImageMetadata &record = found->second;
-    if (record.registration_table == nullptr ||
+// Never matches a send: its epoch stays zero while the dispatch epoch starts
+// at one.
+RuntimeDispatchSiteBinding &MegamorphicDispatchSiteBinding() {
+  static RuntimeDispatchSiteBinding *binding = new RuntimeDispatchSiteBinding();
+  return *binding;
+}
+
+const RuntimeDispatchSiteBinding *LoadDispatchSiteBinding(
+    objc3_runtime_dispatch_site_cache &site) {
+  return static_cast<const RuntimeDispatchSiteBinding *>(
+      std::atomic_ref<const void *>(site.binding)
+          .load(std::memory_order_acquire));
+}
+
+bool DispatchSiteBindingMatches(const RuntimeState &state,
+                                const RuntimeDispatchSiteBinding &binding,
+                                int receiver, const char *selector) {
+  return binding.epoch.load(std::memory_order_acquire) ==
+             state.dispatch_cache_epoch.load(std::memory_order_acquire) &&
+         binding.slot.receiver == receiver &&
+         binding.slot.selector == selector &&
+         IsDispatchHitReceiverLive(state, receiver);
+}
+
+// Same key and every entry field a hit adopts or traces.
+bool SameDispatchSiteTarget(const RuntimeDispatchHitCacheSlot &lhs,
+                            const RuntimeDispatchHitCacheSlot &rhs) {
+  const MethodCacheEntry &a = *lhs.entry;
+  const MethodCacheEntry &b = *rhs.entry;
+  return lhs.receiver == rhs.receiver && lhs.selector == rhs.selector &&
+         lhs.selector_handle == rhs.selector_handle &&
+         lhs.base_identity == rhs.base_identity && a.resolved == b.resolved &&
+         a.fast_path_seeded == b.fast_path_seeded &&
+         a.effective_direct_dispatch == b.effective_direct_dispatch &&
+         a.normalized_receiver_identity == b.normalized_receiver_identity &&
+         a.selector_stable_id == b.selector_stable_id &&
+         a.parameter_count == b.parameter_count &&
+         a.return_kind == b.return_kind &&
+         a.category_probe_count == b.category_probe_count &&
+         a.protocol_probe_count == b.protocol_probe_count &&
+         a.implementation == b.implementation &&
+         a.builtin_kind == b.builtin_kind &&
+         a.runtime_property_accessor == b.runtime_property_accessor;
+}
+
+void FillDispatchSiteBindingUnlocked(RuntimeDispatchSiteBinding &binding,
+                                     const RuntimeDispatchHitCacheSlot &resolved,
+                                     std::uint64_t binding_count) {
+  binding.slot = resolved;
+  binding.invocation = RuntimeDispatchInvocation{};
+  AdoptMethodCacheEntryForInvocation(*resolved.entry, resolved.base_identity,
+                                     binding.invocation);
+  binding.invocation.selector_score = ComputeSelectorScore(resolved.selector);
+  binding.trace_event = RuntimeDispatchTraceEvent{};
+  RecordMethodCacheDispatchTraceEvent(binding.trace_event, *resolved.entry,
+                                      resolved.base_identity, 0, true);
+  binding.binding_count = binding_count;
+  binding.method_cache_generation.store(resolved.method_cache_generation,
+                                        std::memory_order_relaxed);
+  binding.epoch.store(resolved.epoch, std::memory_order_relaxed);
+}
+
+// |resolved| is the slot ResolveRuntimeDispatchUnlocked just filled; it stays
+// empty when the receiver could not be published.
+void PublishDispatchSiteBindingUnlocked(
+    RuntimeState &state, objc3_runtime_dispatch_site_cache &site,
+    const RuntimeDispatchHitCacheSlot &resolved) {
+  std::atomic_ref<std::uint64_t> site_index_ref(site.site_index);
+  if (site_index_ref.load(std::memory_order_relaxed) == 0) {
+    site_index_ref.store(++state.bound_dispatch_site_count,
+                         std::memory_order_relaxed);
+    state.bound_dispatch_sites.push_back(&site);
+  }
+  if (resolved.selector_handle == nullptr) {
+    return;
+  }
+  std::atomic_ref<const void *> binding_ref(site.binding);
+  RuntimeDispatchSiteBinding *const current =
+      const_cast<RuntimeDispatchSiteBinding *>(
+          static_cast<const RuntimeDispatchSiteBinding *>(
+              binding_ref.load(std::memory_order_relaxed)));
+  if (current != nullptr && SameDispatchSiteTarget(current->slot, resolved)) {
+    current->method_cache_generation.store(resolved.method_cache_generation,
+                                           std::memory_order_relaxed);
+    current->epoch.store(resolved.epoch, std::memory_order_release);
+    return;
+  }
+  const std::uint64_t binding_count =
+      current == nullptr ? 1u : current->binding_count + 1u;
+  if (binding_count > kRuntimeDispatchSiteBindingLimit) {
+    binding_ref.store(&MegamorphicDispatchSiteBinding(),
+                      std::memory_order_release);
+    ++state.megamorphic_dispatch_site_count;
+    return;
+  }
+  if (current == nullptr) {
+    auto binding = std::make_unique<RuntimeDispatchSiteBinding>();
+    FillDispatchSiteBindingUnlocked(*binding, resolved, binding_count);
+    binding_ref.store(binding.get(), std::memory_order_release);
+    state.dispatch_site_bindings.push_back(std::move(binding));
+    return;
+  }
+  const std::uint64_t sequence =
+      current->sequence.load(std::memory_order_relaxed);
+  current->sequence.store(sequence + 1u, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  FillDispatchSiteBindingUnlocked(*current, resolved, binding_count);
+  current->sequence.store(sequence + 2u, std::memory_order_release);
+}
+
+// The binding is copied out before its sequence word is re-checked, so a hit
+// never adopts a target torn by a concurrent rewrite.
+bool TryAdoptDispatchSiteBinding(RuntimeState &state,
+                                 const RuntimeDispatchSiteBinding &binding,
+                                 int receiver, const char *selector,
+                                 RuntimeDispatchInvocation &invocation) {
+  const std::uint64_t sequence =
+      binding.sequence.load(std::memory_order_acquire);
+  if ((sequence & 1u) != 0u ||
+      !DispatchSiteBindingMatches(state, binding, receiver, selector)) {
+    return false;
+  }
+  const RuntimeDispatchTraceEvent hit_event = binding.trace_event;
+  const RuntimeDispatchInvocation hit_invocation = binding.invocation;
+  const std::uint64_t method_cache_generation =
+      binding.method_cache_generation.load(std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_acquire);
+  if (binding.sequence.load(std::memory_order_relaxed) != sequence) {
+    return false;
+  }
+  BumpRuntimeMetric(RuntimeMetric::DispatchSiteCacheHit);
+  BumpRuntimeMetric(RuntimeMetric::DispatchCacheHit);
+  RecordMethodCacheHitCounters(hit_event.resolved_live_method,
+                               hit_event.used_fast_path);
+  RuntimeDispatchTraceEvent &event = BeginDispatchTraceEvent(state);
+  const std::uint64_t event_sequence = event.sequence;
+  event = hit_event;
+  event.sequence = event_sequence;
+  event.method_cache_generation = method_cache_generation;
+  invocation = hit_invocation;
+  return true;
+}
+
+// Testing reset only: no send may be in flight while bindings are freed.
+void ClearDispatchSiteBindingsUnlocked(RuntimeState &state) {
+  for (objc3_runtime_dispatch_site_cache *site : state.bound_dispatch_sites) {
+    std::atomic_ref<const void *>(site->binding)
+        .store(nullptr, std::memory_order_relaxed);
+  }
+  state.dispatch_site_bindings.clear();
+  state.megamorphic_dispatch_site_count = 0;
+}
+
+// Probes the shared method cache for one decoded receiver and selector and
+// fills it from the class-graph slow path on a miss.
+const std::shared_ptr<MethodCacheEntry> &FindOrResolveMethodCacheEntryUnlocked(
+    RuntimeState &state, std::uint64_t base_identity,
+    std::uint64_t normalized_receiver_identity, DispatchFamily family,
+    const objc3_runtime_selector_handle &selector_handle, bool &used_cache) {
+  const MethodCacheKey cache_key{normalized_receiver_identity,
+                                 selector_handle.stable_id};
+  auto cache_it = state.method_cache.find(cache_key);
+  used_cache = cache_it != state.method_cache.end() &&
+               IsMethodCacheEntryCurrentUnlocked(state, *cache_it->second);
+  if (used_cache) {
+    cache_it->second->ring_referenced = true;
+    RecordMethodCacheHitCounters(*cache_it->second);
+    return cache_it->second;
+  }
+  ++state.method_cache_miss_count;
+  ++state.slow_path_lookup_count;
+  BumpRuntimeMetric(RuntimeMetric::SlowPathLookup);
+  const bool profiled = DispatchProfileSamplePending(state);
+  const std::chrono::steady_clock::time_point slow_path_started =
+      profiled ? std::chrono::steady_clock::now()
+               : std::chrono::steady_clock::time_point{};
+  SlowPathResolution resolution = ResolveMethodSlowPathUnlocked(
+      state, base_identity, normalized_receiver_identity, family,
+      selector_handle.stable_id, selector_handle.selector);
+  if (profiled) {
+    g_runtime_dispatch_profile_slow_path_ns = static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - slow_path_started)
+            .count());
+  }
+  MethodCacheEntry cache_entry;
+  cache_entry.resolved = resolution.resolved;
+  cache_entry.dispatch_family_is_class = resolution.dispatch_family_is_class;
+  cache_entry.effective_direct_dispatch = resolution.effective_direct_dispatch;
+  cache_entry.objc_final_declared = resolution.objc_final_declared;
+  cache_entry.objc_sealed_declared = resolution.objc_sealed_declared;
+  cache_entry.selector_storage = resolution.selector_storage;
+  cache_entry.fast_path_reason = resolution.fast_path_reason;
+  cache_entry.class_id = resolution.class_id;
+  cache_entry.owner_identity = resolution.owner_identity;
+  cache_entry.normalized_receiver_identity = normalized_receiver_identity;
+  cache_entry.selector_stable_id = selector_handle.stable_id;
+  cache_entry.parameter_count = resolution.parameter_count;
+  cache_entry.return_kind = resolution.return_kind;
+  cache_entry.category_probe_count = resolution.category_probe_count;
+  cache_entry.protocol_probe_count = resolution.protocol_probe_count;
+  cache_entry.implementation = resolution.implementation;
+  cache_entry.builtin_kind = resolution.builtin_kind;
+  cache_entry.runtime_property_accessor = resolution.runtime_property_accessor;
+  cache_entry.base_identity = base_identity;
+  if (cache_it == state.method_cache.end()) {
+    cache_it = state.method_cache
+                   .emplace(cache_key, std::make_shared<MethodCacheEntry>(
+                                           std::move(cache_entry)))
+                   .first;
+  } else {
+    DetachMethodCacheEntryUnlocked(state, *cache_it->second);
+    ++state.stale_method_cache_reclaim_count;
+    cache_it->second =
+        std::make_shared<MethodCacheEntry>(std::move(cache_entry));
+  }
+  AttachMethodCacheEntryUnlocked(state, cache_key, *cache_it->second,
+                                 resolution.resolved
+                                     ? MethodCacheRing::Resolved
+                                     : MethodCacheRing::Negative);
+  if (resolution.resolved) {
+    ++state.live_dispatch_count;
+  } else {
+    ++state.fallback_dispatch_count;
+  }
+  return cache_it->second;
+}
+
+// Resolves one send under the runtime mutex once the caller has produced the
+// selector handle: receiver decoding, shared method-cache probe or slow-path fill, and publication of
+// the binding into either the hashed thread slot or the call-site slot.
+void ResolveRuntimeDispatchUnlocked(
+    RuntimeState &state, int receiver, const char *selector,
+    const objc3_runtime_selector_handle *selector_handle,
+    RuntimeDispatchHitCacheSlot *site_slot,
+    RuntimeDispatchInvocation &invocation) {
+  BumpRuntimeMetric(RuntimeMetric::DispatchLockedResolve);
+  RuntimeDispatchTraceEvent &event = BeginDispatchTraceEvent(state);
+  event.method_cache_generation = state.method_cache_generation;
+  event.selector_stable_id =
+      selector_handle != nullptr ? selector_handle->stable_id : 0;
+
+  if (receiver != 0 && selector_handle != nullptr) {
+    std::uint64_t base_identity = 0;
+    std::uint64_t normalized_receiver_identity = 0;
+    DispatchFamily family = DispatchFamily::Invalid;
+    if (DecodeReceiverIdentity(state, receiver, base_identity, family,
+                               normalized_receiver_identity)) {
+      event.normalized_receiver_identity = normalized_receiver_identity;
+      bool used_cache = false;
+      const std::shared_ptr<MethodCacheEntry> &entry =
+          FindOrResolveMethodCacheEntryUnlocked(
+              state, base_identity, normalized_receiver_identity, family,
+              *selector_handle, used_cache);
+      RecordMethodCacheDispatchTraceEvent(event, *entry, base_identity,
+                                          state.method_cache_generation,
+                                          used_cache);
+      AdoptMethodCacheEntryForInvocation(*entry, base_identity, invocation);
+      PublishDispatchHitCacheSlotUnlocked(
+          state,
+          site_slot != nullptr
+              ? *site_slot
+              : g_runtime_dispatch_hit_cache[DispatchHitCacheSlotIndex(
+                    receiver, selector)],
+          receiver, selector, selector_handle, base_identity, entry);
+    } else {
+      ++state.fallback_dispatch_count;
+      event.fell_back = true;
+      event.path = RuntimeDispatchTracePath::InvalidReceiverFallback;
+    }
+  }
+}
+
+std::uint64_t CountSelectorParameters(const char *selector) {
+  std::uint64_t count = 0;
+  for (const char *cursor = selector; cursor != nullptr && *cursor != '\0';
+       ++cursor) {
+    if (*cursor == ':') {
+      ++count;
+    }
+  }
+  return count;
+}
+
+// A sealed table slot may only hold what the lowered indirect call can invoke
+// in place of the runtime: an emitted i32 method body taking exactly the
+// selector's arguments, with no builtin or property-accessor frame to set up.
+bool IsSealedDispatchTableEntry(const MethodCacheEntry &entry,
+                                const char *selector) {
+  return entry.resolved && entry.dispatch_family_is_class &&
+         entry.implementation != nullptr &&
+         entry.builtin_kind == RuntimeBuiltinKind::None &&
+         entry.runtime_property_accessor == nullptr &&
+         entry.return_kind == RuntimeMethodReturnKind::I32Like &&
+         entry.parameter_count == CountSelectorParameters(selector);
+}
+
+// sealed-dispatch-table anchor: a table binds only for a class receiver whose
+// realized class is the one the emitter built the table for. Each slot is
+// filled from the shared method cache, so the table agrees with what the
+// canonical entrypoint would call; slots that cannot be called in place stay
+// null and keep taking the runtime path.
+void BindSealedDispatchTableUnlocked(RuntimeState &state,
+                                     objc3_runtime_sealed_dispatch_table &table,
+                                     int receiver) {
+  if (table.class_name == nullptr || table.selectors == nullptr ||
+      table.entries == nullptr || table.slot_count == 0) {
+    return;
+  }
+  std::uint64_t base_identity = 0;
+  std::uint64_t normalized_receiver_identity = 0;
+  DispatchFamily family = DispatchFamily::Invalid;
+  if (!DecodeReceiverIdentity(state, receiver, base_identity, family,
+                              normalized_receiver_identity) ||
+      family != DispatchFamily::Class ||
+      normalized_receiver_identity >
+          static_cast<std::uint64_t>(std::numeric_limits<std::int32_t>::max())) {
+    return;
+  }
+  const RealizedReceiverBinding *binding =
+      FindRealizedReceiverBindingUnlocked(state, base_identity);
+  if (binding == nullptr || !binding->bound ||
+      binding->class_id != FindRuntimeSymbolUnlocked(state, table.class_name)) {
+    return;
+  }
+  std::atomic_ref<std::int32_t> bound_receiver(table.bound_receiver);
+  if (bound_receiver.load(std::memory_order_relaxed) != 0) {
+    return;
+  }
+  for (std::uint64_t slot = 0; slot < table.slot_count; ++slot) {
+    const char *slot_selector = table.selectors[slot];
+    const void *implementation = nullptr;
+    if (const objc3_runtime_selector_handle *selector_handle =
+            LookupSelectorUnlocked(slot_selector)) {
+      bool used_cache = false;
+      const MethodCacheEntry &entry = *FindOrResolveMethodCacheEntryUnlocked(
+          state, base_identity, normalized_receiver_identity, family,
+          *selector_handle, used_cache);
+      if (IsSealedDispatchTableEntry(entry, slot_selector)) {
+        implementation = entry.implementation;
+        ++state.bound_sealed_dispatch_slot_count;
+      }
+    }
+    std::atomic_ref<const void *>(table.entries[slot])
+        .store(implementation, std::memory_order_relaxed);
+  }
+  bound_receiver.store(static_cast<std::int32_t>(normalized_receiver_identity),
+                       std::memory_order_release);
+  state.bound_sealed_dispatch_tables.push_back(&table);
+  ++state.sealed_dispatch_table_bind_count;
+}
+
+struct DispatchProfileTotals {
+  std::array<std::uint64_t, kRuntimeDispatchTracePathCount> path_counts{};
+  std::uint64_t slow_path_ns = 0;
+};
+
+struct DispatchProfileAggregate {
+  std::unordered_map<MethodCacheKey, DispatchProfileTotals, MethodCacheKeyHash>
+      totals;
+  std::uint64_t table_count = 0;
+  std::uint64_t dropped_sample_count = 0;
+};
+
+// Sums the current generation's samples from every thread's table, including
+// tables whose thread has exited.
+void CollectDispatchProfile(const RuntimeState &state,
+                            DispatchProfileAggregate &aggregate) {
+  const std::uint64_t generation =
+      state.dispatch_profile_generation.load(std::memory_order_relaxed);
+  RuntimeMetricsRegistry &registry = MetricsRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  for (const RuntimeMetricsBlock *block = registry.blocks; block != nullptr;
+       block = block->next) {
+    const RuntimeDispatchProfileTable *table =
+        block->dispatch_profile.load(std::memory_order_acquire);
+    if (table == nullptr ||
+        table->generation.load(std::memory_order_acquire) != generation) {
+      continue;
+    }
+    ++aggregate.table_count;
+    aggregate.dropped_sample_count +=
+        table->dropped_sample_count.load(std::memory_order_relaxed);
+    for (const RuntimeDispatchProfileSlot &slot : table->slots) {
+      if (!slot.occupied.load(std::memory_order_acquire)) {
+        continue;
+      }
+      DispatchProfileTotals &totals = aggregate.totals[MethodCacheKey{
+          slot.normalized_receiver_identity.load(std::memory_order_relaxed),
+          slot.selector_stable_id.load(std::memory_order_relaxed)}];
+      for (std::size_t index = 0; index < kRuntimeDispatchTracePathCount;
+           ++index) {
+        totals.path_counts[index] +=
+            slot.path_counts[index].load(std::memory_order_relaxed);
+      }
+      totals.slow_path_ns += slot.slow_path_ns.load(std::memory_order_relaxed);
+    }
+  }
+}
+
+// Folded-stack frames for one profile key: the realized class name (or a
+// placeholder for receivers no image describes) and the selector prefixed
+// with `+` for class sends and `-` for instance sends.
+std::string DescribeDispatchProfileKeyUnlocked(const RuntimeState &state,
+                                               const MethodCacheKey &key) {
+  std::string frames = "dispatch;";
+  const std::uint64_t identity = key.normalized_receiver_identity;
+  const std::uint64_t salt =
+      identity >= kReceiverIdentityBase
+          ? (identity - kReceiverIdentityBase) % kReceiverIdentityStride
+          : 0u;
+  const RealizedClassNode *node =
+      salt != 0 ? FindRealizedClassNodeByBaseIdentityUnlocked(state,
+                                                              identity - salt)
+                : nullptr;
+  if (salt == 0) {
+    frames += "<invalid-receiver>";
+  } else if (node == nullptr || node->class_id == kNoRuntimeSymbol) {
+    frames += "<unrealized>";
+  } else {
+    frames += RuntimeSymbolName(state, node->class_id);
+  }
+  frames += salt == 2u ? ";+" : ";-";
+  if (key.selector_stable_id != 0 &&
+      key.selector_stable_id <= state.selector_slots.size()) {
+    frames += state.selector_slots[key.selector_stable_id - 1u].handle.selector;
+  } else {
+    frames += "<unknown-selector>";
+  }
+  return frames;
+}
+
+// Writes one `frames count` line per (class, selector, dispatch path) with
+// samples, sorted so identical profiles produce identical files, replacing
+// any previous file through a rename.
+bool WriteDispatchProfile(const char *path) {
+  RuntimeState &state = State();
+  DispatchProfileAggregate aggregate;
+  CollectDispatchProfile(state, aggregate);
+  std::vector<std::pair<std::string, std::uint64_t>> lines;
+  {
+    std::lock_guard<std::mutex> lock(state.mutex);
+    for (const auto &[key, totals] : aggregate.totals) {
+      const std::string frames = DescribeDispatchProfileKeyUnlocked(state, key);
+      for (std::size_t index = 0; index < kRuntimeDispatchTracePathCount;
+           ++index) {
+        const char *path_name = DescribeDispatchTracePath(
+            static_cast<RuntimeDispatchTracePath>(index));
+        if (totals.path_counts[index] != 0 && path_name != nullptr) {
+          lines.emplace_back(frames + ";" + path_name,
+                             totals.path_counts[index]);
+        }
+      }
+    }
+  }
+  std::sort(lines.begin(), lines.end());
+  const std::string staging_path = std::string(path) + ".tmp";
+  std::FILE *file = std::fopen(staging_path.c_str(), "w");
+  if (file == nullptr) {
+    return false;
+  }
+  for (const auto &[frames, count] : lines) {
+    std::fprintf(file, "%s %llu\n", frames.c_str(),
+                 static_cast<unsigned long long>(count));
+  }
+  return std::fclose(file) == 0 &&
+         std::rename(staging_path.c_str(), path) == 0;
+}
+
+// OBJC3_RUNTIME_DISPATCH_PROFILE_OUTPUT=<path> writes the folded profile to
+// <path> at exit, once any thread has taken a sample.
+void EnsureDispatchProfileOutput() {
+  static std::once_flag registered;
+  std::call_once(registered, []() {
+    const char *path = std::getenv("OBJC3_RUNTIME_DISPATCH_PROFILE_OUTPUT");
+    if (path == nullptr || path[0] == '\0') {
+      return;
+    }
+    static const std::string *output_path = new std::string(path);
+    std::atexit([]() { (void)WriteDispatchProfile(output_path->c_str()); });
+  });
+}
+
+int InvokeRuntimeDispatch(RuntimeState &state, int receiver,
+                          const char *selector,
+                          const RuntimeDispatchInvocation &invocation, int a0,
+                          int a1, int a2, int a3) {
+  // runtime call ABI generation anchor: canonical runtime dispatch
+  // owns nil-receiver semantics for lowered instance/class/super surfaces, so
+  // a zero receiver returns zero without requiring lowering-side elision.
+  BumpRuntimeMetric(RuntimeMetric::DispatchSend);
+  if (receiver == 0) {
+    BumpRuntimeMetric(RuntimeMetric::NilDispatch);
+    g_runtime_dispatch_trace.events[g_runtime_dispatch_trace.head].path =
+        RuntimeDispatchTracePath::NilShortCircuit;
+    return 0;
+  }
+  const std::uint64_t profile_period =
+      state.dispatch_profile_period.load(std::memory_order_relaxed);
+  if (profile_period != 0 &&
+      ++g_runtime_dispatch_profile_tick >= profile_period) {
+    g_runtime_dispatch_profile_tick = 0;
+    RecordDispatchProfileSample(
+        state, g_runtime_dispatch_trace.events[g_runtime_dispatch_trace.head]);
+  }
+  if (invocation.resolved_live_method && invocation.implementation != nullptr) {
+    PushRuntimeDispatchFrame(receiver, invocation.receiver_base_identity,
+                             invocation.runtime_property_accessor);
+    const int result = InvokeResolvedMethod(
+        invocation.implementation, invocation.return_kind,
+        invocation.parameter_count, a0, a1, a2, a3);
+    PopRuntimeDispatchFrame(state);
+    return result;
+  }
+  if (invocation.resolved_live_method &&
+      invocation.builtin_kind != RuntimeBuiltinKind::None) {
+    PushRuntimeDispatchFrame(receiver, invocation.receiver_base_identity,
+                             invocation.runtime_property_accessor);
+    const int result = InvokeRuntimeBuiltinMethod(
+        state, invocation.builtin_kind, receiver,
+        invocation.receiver_base_identity,
+        invocation.runtime_property_accessor, a0, a1, a2, a3);
+    PopRuntimeDispatchFrame(state);
+    return result;
+  }
+  BumpRuntimeMetric(RuntimeMetric::FallbackDispatch);
+  return invocation.selector_score >= 0
+             ? ComputeDispatchResultForSelectorScore(
+                   receiver, invocation.selector_score, a0, a1, a2, a3)
+             : ComputeDispatchResult(receiver, selector, a0, a1, a2, a3);
+}
+
+std::uint64_t DescriptorTotal(
+    const objc3_runtime_image_descriptor *image) {
+  return image->class_descriptor_count + image->protocol_descriptor_count +
+         image->category_descriptor_count + image->property_descriptor_count +
+         image->ivar_descriptor_count;
+}
+
+std::uint64_t AggregateCount(const objc3_runtime_pointer_aggregate *aggregate) {
+  return aggregate == nullptr ? 0 : aggregate->count;
+}
+
+const void *AggregateEntry(const objc3_runtime_pointer_aggregate *aggregate,
+                           std::uint64_t index) {
+  if (aggregate == nullptr || index >= aggregate->count) {
+    return nullptr;
+  }
+  return aggregate->entries[index];
+}
+
+bool AggregateContainsPointer(const objc3_runtime_pointer_aggregate *aggregate,
+                              const void *target) {
+  if (aggregate == nullptr || target == nullptr) {
+    return false;
+  }
+  for (std::uint64_t index = 0; index < aggregate->count; ++index) {
+    if (aggregate->entries[index] == target) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool ImageDescriptorsMatch(const objc3_runtime_image_descriptor *lhs,
+                           const objc3_runtime_image_descriptor *rhs) {
+  if (lhs == nullptr || rhs == nullptr) {
+    return false;
+  }
+
+  const std::string lhs_module =
+      lhs->module_name != nullptr ? lhs->module_name : "";
+  const std::string rhs_module =
+      rhs->module_name != nullptr ? rhs->module_name : "";
+  const std::string lhs_identity =
+      lhs->translation_unit_identity_key != nullptr
+          ? lhs->translation_unit_identity_key
+          : "";
+  const std::string rhs_identity =
+      rhs->translation_unit_identity_key != nullptr
+          ? rhs->translation_unit_identity_key
+          : "";
+  return lhs_module == rhs_module &&
+         lhs_identity == rhs_identity &&
+         lhs->registration_order_ordinal == rhs->registration_order_ordinal &&
+         lhs->class_descriptor_count == rhs->class_descriptor_count &&
+         lhs->protocol_descriptor_count == rhs->protocol_descriptor_count &&
+         lhs->category_descriptor_count == rhs->category_descriptor_count &&
+         lhs->property_descriptor_count == rhs->property_descriptor_count &&
+         lhs->ivar_descriptor_count == rhs->ivar_descriptor_count;
+}
+
+const char *StableCString(const std::string &text) {
+  return text.empty() ? nullptr : text.c_str();
+}
+
+void MarkRejectedRegistrationUnlocked(
+    RuntimeState &state, const objc3_runtime_image_descriptor *image,
+    int status) {
+  state.last_registration_status = status;
+  state.last_rejected_module_name =
+      image != nullptr && image->module_name != nullptr ? image->module_name : "";
+  state.last_rejected_translation_unit_identity_key =
+      image != nullptr && image->translation_unit_identity_key != nullptr
+          ? image->translation_unit_identity_key
+          : "";
+  state.last_rejected_registration_order_ordinal =
+      image != nullptr ? image->registration_order_ordinal : 0;
+}
+
+void ClearRejectedRegistrationUnlocked(RuntimeState &state) {
+  state.last_rejected_module_name.clear();
+  state.last_rejected_translation_unit_identity_key.clear();
+  state.last_rejected_registration_order_ordinal = 0;
+}
+
+void ClearImageWalkSnapshotUnlocked(RuntimeState &state) {
+  state.last_discovery_root_entry_count = 0;
+  state.last_walked_class_descriptor_count = 0;
+  state.last_walked_protocol_descriptor_count = 0;
+  state.last_walked_category_descriptor_count = 0;
+  state.last_walked_property_descriptor_count = 0;
+  state.last_walked_ivar_descriptor_count = 0;
+  state.last_walked_selector_pool_count = 0;
+  state.last_walked_string_pool_count = 0;
+  state.last_walked_keypath_descriptor_count = 0;
+  state.last_linker_anchor_matches_discovery_root = false;
+  state.last_registration_used_staged_table = false;
+  state.last_walked_module_name.clear();
+  state.last_walked_translation_unit_identity_key.clear();
+}
+
+void ApplyImageWalkRecordUnlocked(RuntimeState &state,
+                                  const RegisteredImageMetadata &record) {
+  state.walked_image_count = static_cast<std::uint64_t>(
+      state.registered_image_metadata_by_identity_key.size());
+  state.last_discovery_root_entry_count = record.discovery_root_entry_count;
+  state.last_walked_class_descriptor_count = record.class_descriptor_count;
+  state.last_walked_protocol_descriptor_count = record.protocol_descriptor_count;
+  state.last_walked_category_descriptor_count = record.category_descriptor_count;
+  state.last_walked_property_descriptor_count = record.property_descriptor_count;
+  state.last_walked_ivar_descriptor_count = record.ivar_descriptor_count;
+  state.last_walked_selector_pool_count = record.selector_pool_count;
+  state.last_walked_string_pool_count = record.string_pool_count;
+  state.last_walked_keypath_descriptor_count = record.keypath_descriptor_count;
+  state.last_linker_anchor_matches_discovery_root =
+      record.linker_anchor_matches_discovery_root;
+  state.last_registration_used_staged_table =
+      record.used_staged_registration_table;
+  state.last_walked_module_name = record.module_name;
+  state.last_walked_translation_unit_identity_key =
+      record.translation_unit_identity_key;
+}
+
+void RetainBootstrapRecordUnlocked(RuntimeState &state,
+                                   const RegisteredImageMetadata &record) {
+  const auto found = state.retained_bootstrap_metadata_by_identity_key.find(
+      record.translation_unit_identity_key);
+  if (found == state.retained_bootstrap_metadata_by_identity_key.end()) {
+    state.retained_bootstrap_identity_order.push_back(
+        record.translation_unit_identity_key);
+  }
+  state.retained_bootstrap_metadata_by_identity_key
+      [record.translation_unit_identity_key] = record;
+}
+
+std::uint64_t ZeroRetainedBootstrapImageLocalInitStatesUnlocked(
+    RuntimeState &state) {
+  std::uint64_t cleared_count = 0;
+  for (const std::string &identity_key : state.retained_bootstrap_identity_order) {
+    const auto found =
+        state.retained_bootstrap_metadata_by_identity_key.find(identity_key);
+    if (found == state.retained_bootstrap_metadata_by_identity_key.end()) {
+      continue;
+    }
+    const RegisteredImageMetadata &record = found->second;
+    if (record.registration_table == nullptr ||
         record.registration_table->image_local_init_state == nullptr) {
       continue;
     }
@@ -3452,6 +7291,10 @@ void ClearLiveRegistrationStateUnlocked(RuntimeState &state) {
   state.registered_image_metadata_by_identity_key.clear();
   state.selector_index_by_name.clear();
   state.selector_slots.clear();
+  state.adopted_selector_table = AdoptedSelectorTable{};
+  state.selector_table_generation.fetch_add(1u, std::memory_order_release);
+  state.selector_spelling_lookup_count = 0;
+  state.bound_selector_reference_count = 0;
   state.metadata_backed_selector_count = 0;
   state.dynamic_selector_count = 0;
   state.metadata_provider_edge_count = 0;
@@ -3471,23 +7314,141 @@ void ClearLiveRegistrationStateUnlocked(RuntimeState &state) {
   state.last_keypath_query_ambiguous = false;
   state.last_resolved_keypath_profile.clear();
   ClearMethodCacheStateUnlocked(state);
+  state.sealed_dispatch_table_bind_count = 0;
+  state.sealed_dispatch_table_unbind_count = 0;
+  state.sealed_dispatch_table_miss_count = 0;
   ClearRealizedClassGraphUnlocked(state);
   ClearRuntimeInstanceStateUnlocked(state);
   state.staged_registration_table = nullptr;
+  state.staged_prebuilt_image_words = nullptr;
+  state.staged_prebuilt_image_byte_count = 0;
+  state.prebuilt_image_adopted_count = 0;
+  state.prebuilt_image_fallback_count = 0;
+  state.prebuilt_image_adopted_selector_count = 0;
+  state.prebuilt_class_ordinal_image_count = 0;
+  state.last_prebuilt_image_byte_count = 0;
+  state.last_prebuilt_image_status = kPrebuiltImageStatusNone;
   state.walked_image_count = 0;
   ClearImageWalkSnapshotUnlocked(state);
 }
 
-bool TryWalkRegistrationTableUnlocked(
-    RuntimeState &state,
-    const objc3_runtime_registration_table *registration_table,
-    const objc3_runtime_image_descriptor *image,
-    RegisteredImageMetadata &record) {
-  // runtime-bootstrap-table-consumption anchor: staged registration
-  // tables must match the image descriptor exactly, discovery-root membership
-  // must close over every descriptor family before image state is published,
-  // and the walked image snapshot is derived from this validated table rather
-  // than from sidecar manifests or replay-only bookkeeping.
+// The header of a prebuilt metadata image, checked against its byte count.
+struct PrebuiltImageHeader {
+  std::uint32_t selector_count = 0;
+  std::uint32_t class_descriptor_count = 0;
+  std::uint32_t class_ordinal_count = 0;
+  AdoptedSelectorTable selectors;
+  const std::uint32_t *class_ordinals = nullptr;
+};
+
+bool ReadPrebuiltImageHeader(const std::uint32_t *words,
+                             std::uint64_t byte_count,
+                             PrebuiltImageHeader &header) {
+  if (words == nullptr ||
+      reinterpret_cast<std::uintptr_t>(words) % alignof(std::uint32_t) != 0 ||
+      byte_count % sizeof(std::uint32_t) != 0 ||
+      byte_count < kPrebuiltImageHeaderWordCount * sizeof(std::uint32_t) ||
+      words[0] != kPrebuiltImageMagic || words[1] != kPrebuiltImageVersion ||
+      static_cast<std::uint64_t>(words[2]) * sizeof(std::uint32_t) !=
+          byte_count) {
+    return false;
+  }
+  const std::uint64_t word_count = words[2];
+  const std::uint32_t group_count = words[7];
+  const std::uint32_t bucket_count = words[8];
+  if (group_count == 0 || (group_count & (group_count - 1u)) != 0 ||
+      bucket_count == 0 || (bucket_count & (bucket_count - 1u)) != 0 ||
+      bucket_count < words[3] ||
+      static_cast<std::uint64_t>(words[9]) + group_count > word_count ||
+      static_cast<std::uint64_t>(words[10]) + bucket_count > word_count ||
+      static_cast<std::uint64_t>(words[11]) + words[4] > word_count) {
+    return false;
+  }
+  header.selector_count = words[3];
+  header.class_descriptor_count = words[4];
+  header.class_ordinal_count = words[5];
+  header.selectors.hash_seed = words[6];
+  header.selectors.group_mask = group_count - 1u;
+  header.selectors.bucket_mask = bucket_count - 1u;
+  header.selectors.group_displacements = words + words[9];
+  header.selectors.buckets = words + words[10];
+  header.selectors.selector_count = words[3];
+  header.class_ordinals = words + words[11];
+  return true;
+}
+
+// Decides whether a walk may adopt the image's selector table: the selector
+// table must still be empty and every pool spelling must land on its own
+// bucket, which also proves the pool non-empty-string and duplicate free.
+int CheckPrebuiltSelectorTableUnlocked(
+    const RuntimeState &state, const PrebuiltImageHeader &header,
+    const objc3_runtime_pointer_aggregate *selector_pool_root,
+    std::uint64_t selector_pool_count) {
+  if (header.selector_count != selector_pool_count) {
+    return kPrebuiltImageStatusShapeMismatch;
+  }
+  if (!state.selector_slots.empty()) {
+    return kPrebuiltImageStatusSelectorsPresent;
+  }
+  for (std::uint64_t index = 0; index < selector_pool_count; ++index) {
+    const char *selector = reinterpret_cast<const char *>(
+        AggregateEntry(selector_pool_root, index));
+    if (selector == nullptr || selector[0] == '\0' ||
+        header.selectors.buckets[PrebuiltImageSelectorBucket(
+            header.selectors,
+            PrebuiltImageSelectorHash(selector, header.selectors.hash_seed))] !=
+            index + 1u) {
+      return kPrebuiltImageStatusHashMismatch;
+    }
+  }
+  return kPrebuiltImageStatusAdopted;
+}
+
+// Publishes an adopted selector table with the same slot contents, stable
+// ids, and counters the per-entry materialization would have produced.
+void AdoptPrebuiltSelectorTableUnlocked(
+    RuntimeState &state, const PrebuiltImageHeader &header,
+    const objc3_runtime_pointer_aggregate *selector_pool_root,
+    std::uint64_t registration_order_ordinal) {
+  const std::size_t count = header.selector_count;
+  state.selector_slots.resize(count);
+  for (std::size_t index = 0; index < count; ++index) {
+    SelectorSlot &slot = state.selector_slots[index];
+    slot.handle.selector =
+        reinterpret_cast<const char *>(selector_pool_root->entries[index]);
+    slot.handle.stable_id = static_cast<std::uint64_t>(index + 1u);
+    slot.metadata_backed = true;
+    slot.metadata_provider_count = 1;
+    slot.first_registration_order_ordinal = registration_order_ordinal;
+    slot.last_registration_order_ordinal = registration_order_ordinal;
+    slot.first_selector_pool_index = index + 1u;
+    slot.last_selector_pool_index = index + 1u;
+  }
+  state.adopted_selector_table = header.selectors;
+  state.metadata_backed_selector_count += count;
+  state.metadata_provider_edge_count += count;
+  if (count != 0) {
+    state.last_materialized_selector = state.selector_slots[count - 1u].handle.selector;
+    state.last_materialized_stable_id = count;
+    state.last_materialized_registration_order_ordinal =
+        registration_order_ordinal;
+    state.last_materialized_selector_pool_index = count;
+    state.last_materialized_from_metadata = true;
+  }
+}
+
+bool TryWalkRegistrationTableUnlocked(
+    RuntimeState &state,
+    const objc3_runtime_registration_table *registration_table,
+    const objc3_runtime_image_descriptor *image,
+    const std::uint32_t *prebuilt_image_words,
+    std::uint64_t prebuilt_image_byte_count,
+    RegisteredImageMetadata &record) {
+  // runtime-bootstrap-table-consumption anchor: staged registration
+  // tables must match the image descriptor exactly, discovery-root membership
+  // must close over every descriptor family before image state is published,
+  // and the walked image snapshot is derived from this validated table rather
+  // than from sidecar manifests or replay-only bookkeeping.
   if (registration_table == nullptr ||
       registration_table->abi_version != 2 ||
       registration_table->pointer_field_count != 12 ||
@@ -3528,9 +7489,6 @@ bool TryWalkRegistrationTableUnlocked(
       AggregateCount(registration_table->string_pool_root);
   const std::uint64_t keypath_descriptor_count =
       AggregateCount(registration_table->keypath_descriptor_root);
-  state.selector_index_by_name.reserve(
-      state.selector_index_by_name.size() +
-      static_cast<std::size_t>(selector_pool_count));
   state.keypath_slots.reserve(
       state.keypath_slots.size() +
       static_cast<std::size_t>(keypath_descriptor_count));
@@ -3572,22 +7530,46 @@ bool TryWalkRegistrationTableUnlocked(
     return false;
   }
 
-  std::unordered_set<std::string> selector_pool_spelling_set;
-  selector_pool_spelling_set.reserve(
-      static_cast<std::size_t>(selector_pool_count));
+  // prebuilt-metadata-image anchor: a valid staged image replaces the
+  // duplicate check and per-selector materialization below with one hash
+  // check per selector and one slot store pass; any mismatch walks the pool
+  // exactly as before.
+  PrebuiltImageHeader prebuilt_header;
+  int prebuilt_status = kPrebuiltImageStatusNone;
+  if (prebuilt_image_words != nullptr) {
+    prebuilt_status =
+        ReadPrebuiltImageHeader(prebuilt_image_words, prebuilt_image_byte_count,
+                                prebuilt_header)
+            ? CheckPrebuiltSelectorTableUnlocked(
+                  state, prebuilt_header, registration_table->selector_pool_root,
+                  selector_pool_count)
+            : kPrebuiltImageStatusHeaderMismatch;
+  }
+  const bool adopt_prebuilt_selectors =
+      prebuilt_status == kPrebuiltImageStatusAdopted;
+
   std::vector<std::string> selector_pool_spellings;
-  selector_pool_spellings.reserve(static_cast<std::size_t>(selector_pool_count));
-  for (std::uint64_t index = 0; index < selector_pool_count; ++index) {
-    const char *selector = reinterpret_cast<const char *>(
-        AggregateEntry(registration_table->selector_pool_root, index));
-    if (selector == nullptr || selector[0] == '\0') {
-      return false;
-    }
-    const auto inserted = selector_pool_spelling_set.emplace(selector);
-    if (!inserted.second) {
-      return false;
+  if (!adopt_prebuilt_selectors) {
+    state.selector_index_by_name.reserve(
+        state.selector_index_by_name.size() +
+        static_cast<std::size_t>(selector_pool_count));
+    std::unordered_set<std::string> selector_pool_spelling_set;
+    selector_pool_spelling_set.reserve(
+        static_cast<std::size_t>(selector_pool_count));
+    selector_pool_spellings.reserve(
+        static_cast<std::size_t>(selector_pool_count));
+    for (std::uint64_t index = 0; index < selector_pool_count; ++index) {
+      const char *selector = reinterpret_cast<const char *>(
+          AggregateEntry(registration_table->selector_pool_root, index));
+      if (selector == nullptr || selector[0] == '\0') {
+        return false;
+      }
+      const auto inserted = selector_pool_spelling_set.emplace(selector);
+      if (!inserted.second) {
+        return false;
+      }
+      selector_pool_spellings.emplace_back(selector);
     }
-    selector_pool_spellings.emplace_back(selector);
   }
   for (std::uint64_t index = 0; index < string_pool_count; ++index) {
     const char *value = reinterpret_cast<const char *>(
@@ -3632,14 +7614,40 @@ bool TryWalkRegistrationTableUnlocked(
   record.linker_anchor_matches_discovery_root =
       linker_anchor_matches_discovery_root;
   record.used_staged_registration_table = true;
-
-  for (std::size_t index = 0; index < selector_pool_spellings.size(); ++index) {
-    if (!MaterializeSelectorLookupEntryUnlocked(
-            state, selector_pool_spellings[index].c_str(),
-            image->registration_order_ordinal,
-            static_cast<std::uint64_t>(index + 1u))) {
-      return false;
+  if (prebuilt_status != kPrebuiltImageStatusNone &&
+      prebuilt_status != kPrebuiltImageStatusHeaderMismatch) {
+    record.prebuilt_image_words = prebuilt_image_words;
+    record.prebuilt_image_byte_count = prebuilt_image_byte_count;
+  }
+  if (adopt_prebuilt_selectors &&
+      prebuilt_header.class_descriptor_count == class_descriptor_count) {
+    record.prebuilt_class_ordinals = prebuilt_header.class_ordinals;
+    record.prebuilt_class_ordinal_count = prebuilt_header.class_ordinal_count;
+  }
+
+  if (adopt_prebuilt_selectors) {
+    AdoptPrebuiltSelectorTableUnlocked(state, prebuilt_header,
+                                       registration_table->selector_pool_root,
+                                       image->registration_order_ordinal);
+    ++state.prebuilt_image_adopted_count;
+    state.prebuilt_image_adopted_selector_count += selector_pool_count;
+  } else {
+    for (std::size_t index = 0; index < selector_pool_spellings.size();
+         ++index) {
+      if (!MaterializeSelectorLookupEntryUnlocked(
+              state, selector_pool_spellings[index].c_str(),
+              image->registration_order_ordinal,
+              static_cast<std::uint64_t>(index + 1u))) {
+        return false;
+      }
     }
+    if (prebuilt_status != kPrebuiltImageStatusNone) {
+      ++state.prebuilt_image_fallback_count;
+    }
+  }
+  if (prebuilt_status != kPrebuiltImageStatusNone) {
+    state.last_prebuilt_image_status = prebuilt_status;
+    state.last_prebuilt_image_byte_count = prebuilt_image_byte_count;
   }
   return true;
 }
@@ -3647,7 +7655,9 @@ bool TryWalkRegistrationTableUnlocked(
 int RegisterImageUnlocked(
     RuntimeState &state, const objc3_runtime_image_descriptor *image,
     const objc3_runtime_registration_table *staged_registration_table,
-    bool retain_bootstrap_record, bool mark_image_local_init_state) {
+    const std::uint32_t *prebuilt_image_words,
+    std::uint64_t prebuilt_image_byte_count, bool retain_bootstrap_record,
+    bool mark_image_local_init_state) {
   // runtime-bootstrap-table-consumption anchor: duplicate identity
   // rejection and out-of-order rejection happen before live counters advance,
   // while successful staged-table consumption is the only path allowed to
@@ -3680,6 +7690,7 @@ int RegisterImageUnlocked(
   }
 
   std::uint64_t descriptor_total = DescriptorTotal(image);
+  const RegisteredImageMetadata *realized_record = nullptr;
   if (staged_registration_table != nullptr) {
     state.registration_order_by_identity_key.reserve(
         state.registration_order_by_identity_key.size() + 1u);
@@ -3687,7 +7698,8 @@ int RegisterImageUnlocked(
         state.registered_image_metadata_by_identity_key.size() + 1u);
     RegisteredImageMetadata record;
     if (!TryWalkRegistrationTableUnlocked(state, staged_registration_table, image,
-                                          record)) {
+                                          prebuilt_image_words,
+                                          prebuilt_image_byte_count, record)) {
       ClearImageWalkSnapshotUnlocked(state);
       MarkRejectedRegistrationUnlocked(
           state, image,
@@ -3702,12 +7714,9 @@ int RegisterImageUnlocked(
     if (retain_bootstrap_record) {
       RetainBootstrapRecordUnlocked(state, record);
     }
-    state.registered_image_metadata_by_identity_key
-        [record.translation_unit_identity_key] = record;
-    ApplyImageWalkRecordUnlocked(
-        state,
-        state.registered_image_metadata_by_identity_key
-            .at(record.translation_unit_identity_key));
+    realized_record = &(state.registered_image_metadata_by_identity_key
+                            [record.translation_unit_identity_key] = record);
+    ApplyImageWalkRecordUnlocked(state, *realized_record);
     if (mark_image_local_init_state &&
         staged_registration_table->image_local_init_state != nullptr) {
       *staged_registration_table->image_local_init_state = 1;
@@ -3731,10 +7740,15 @@ int RegisterImageUnlocked(
   // metaclass-graph-root-class anchor: successful registration now
   // republishes a runtime-owned realized class/metaclass graph and root-class
   // baseline before dispatch can consume the image.
-  RebuildRealizedClassGraphUnlocked(state);
+  ClassGraphRealizationDelta realization_delta;
+  realization_delta.first_new_node_index = state.realized_class_nodes.size();
+  if (realized_record != nullptr) {
+    RealizeImageClassGraphUnlocked(state, *realized_record, realization_delta);
+  } else {
+    state.last_registration_realized_class_count = 0;
+  }
   ClearRejectedRegistrationUnlocked(state);
-  ClearMethodCacheStateUnlocked(state);
-  SeedDispatchIntentFastPathCacheUnlocked(state);
+  InvalidateRealizedClassCachesUnlocked(state, realization_delta);
   return OBJC3_RUNTIME_REGISTRATION_STATUS_OK;
 }
 
@@ -3756,52 +7770,1403 @@ bool ProtocolExistsByNameUnlocked(const RuntimeState &state,
       }
     }
   }
-  return false;
+  return false;
+}
+
+// Appends the protocols reachable from `protocol_refs` in the order
+// QueryProtocolConformanceFromAggregateUnlocked visits them. Returns false on
+// metadata that walk would fail closed on.
+bool AppendProtocolClosureFromAggregateUnlocked(
+    RuntimeState &state, const objc3_runtime_pointer_aggregate *protocol_refs,
+    const char *attachment_owner_identity,
+    std::unordered_set<const EmittedProtocolRecord *> &visited,
+    RealizedClassConformance &conformance) {
+  if (protocol_refs == nullptr) {
+    return true;
+  }
+  std::vector<const EmittedProtocolRecord *> stack;
+  for (std::uint64_t index = 0; index < protocol_refs->count; ++index) {
+    const auto *protocol_record = static_cast<const EmittedProtocolRecord *>(
+        AggregateEntry(protocol_refs, index));
+    if (protocol_record == nullptr) {
+      return false;
+    }
+    stack.push_back(protocol_record);
+    while (!stack.empty()) {
+      const EmittedProtocolRecord *record = stack.back();
+      stack.pop_back();
+      if (!visited.insert(record).second) {
+        continue;
+      }
+      if (record->protocol_name == nullptr || record->owner_identity == nullptr ||
+          record->protocol_name[0] == '\0') {
+        return false;
+      }
+      const RuntimeSymbolId protocol_id =
+          InternRuntimeSymbolUnlocked(state, record->protocol_name);
+      const std::size_t word = protocol_id / 64u;
+      if (word >= conformance.protocol_bits.size()) {
+        conformance.protocol_bits.resize(word + 1u, 0u);
+      }
+      conformance.protocol_bits[word] |= std::uint64_t{1} << (protocol_id % 64u);
+      conformance.closure.push_back(RealizedConformanceEntry{
+          protocol_id, record->owner_identity, attachment_owner_identity});
+      const objc3_runtime_pointer_aggregate *inherited_refs =
+          record->inherited_protocol_refs;
+      if (inherited_refs == nullptr) {
+        continue;
+      }
+      for (std::uint64_t inherited_index = 0;
+           inherited_index < inherited_refs->count; ++inherited_index) {
+        const auto *inherited_record =
+            static_cast<const EmittedProtocolRecord *>(
+                AggregateEntry(inherited_refs, inherited_index));
+        if (inherited_record == nullptr) {
+          return false;
+        }
+        stack.push_back(inherited_record);
+      }
+    }
+  }
+  return true;
+}
+
+const RealizedClassConformance &EnsureRealizedClassConformanceUnlocked(
+    RuntimeState &state, const RealizedClassNode &start_node) {
+  RealizedClassConformance &conformance = start_node.conformance;
+  if (conformance.built) {
+    return conformance;
+  }
+  ++state.conformance_bitset_build_count;
+  conformance.built = true;
+  conformance.walkable = true;
+  std::unordered_set<const EmittedProtocolRecord *> visited_protocols;
+  std::unordered_set<const RealizedClassNode *> visited_nodes;
+  const RealizedClassNode *node = &start_node;
+  while (node != nullptr && visited_nodes.insert(node).second) {
+    bool walkable =
+        node->bundle != nullptr &&
+        AppendProtocolClosureFromAggregateUnlocked(
+            state, node->bundle->class_record.adopted_protocol_refs, nullptr,
+            visited_protocols, conformance);
+    for (const EmittedCategoryRecord *category_record :
+         node->attached_category_records) {
+      if (!walkable) {
+        break;
+      }
+      walkable = AppendProtocolClosureFromAggregateUnlocked(
+          state, category_record->adopted_protocol_refs,
+          category_record->category_owner_identity != nullptr
+              ? category_record->category_owner_identity
+              : "",
+          visited_protocols, conformance);
+    }
+    if (!walkable) {
+      conformance.walkable = false;
+      conformance.protocol_bits.clear();
+      conformance.closure.clear();
+      break;
+    }
+    node = node->has_super_node ? &state.realized_class_nodes[node->super_node_index]
+                                : nullptr;
+  }
+  return conformance;
+}
+
+bool RealizedClassConformsToProtocolId(
+    const RealizedClassConformance &conformance, RuntimeSymbolId protocol_id) {
+  const std::size_t word = protocol_id / 64u;
+  return protocol_id != kNoRuntimeSymbol &&
+         word < conformance.protocol_bits.size() &&
+         ((conformance.protocol_bits[word] >> (protocol_id % 64u)) & 1u) != 0u;
+}
+
+bool WalkRealizedClassProtocolConformanceUnlocked(
+    RuntimeState &state, const RealizedClassNode *start_node,
+    const char *protocol_name, std::uint64_t &visited_protocol_count,
+    std::string &matched_protocol_owner_identity,
+    std::string &matched_attachment_owner_identity) {
+  // category-attachment-protocol-conformance anchor: runtime-facing
+  // protocol conformance queries walk realized class nodes, attached category
+  // protocol refs, and inherited protocol closures without widening the public
+  // dispatch ABI.
+  if (start_node == nullptr || protocol_name == nullptr || protocol_name[0] == '\0') {
+    return false;
+  }
+  std::unordered_set<const EmittedProtocolRecord *> visited_protocols;
+  std::unordered_set<const RealizedClassNode *> visited_nodes;
+  const RealizedClassNode *node = start_node;
+  while (node != nullptr && visited_nodes.insert(node).second) {
+    if (node->bundle == nullptr) {
+      return false;
+    }
+    matched_attachment_owner_identity.clear();
+    const EmittedClassRecord &record = node->bundle->class_record;
+    if (QueryProtocolConformanceFromAggregateUnlocked(
+            record.adopted_protocol_refs, protocol_name, visited_protocols,
+            visited_protocol_count, matched_protocol_owner_identity)) {
+      return true;
+    }
+    for (const EmittedCategoryRecord *category_record :
+         node->attached_category_records) {
+      if (QueryProtocolConformanceFromAggregateUnlocked(
+              category_record->adopted_protocol_refs, protocol_name,
+              visited_protocols, visited_protocol_count,
+              matched_protocol_owner_identity)) {
+        matched_attachment_owner_identity =
+            category_record->category_owner_identity != nullptr
+                ? category_record->category_owner_identity
+                : "";
+        return true;
+      }
+    }
+    node = node->has_super_node ? &state.realized_class_nodes[node->super_node_index]
+                                : nullptr;
+  }
+  return false;
+}
+
+bool QueryRealizedClassProtocolConformanceUnlocked(
+    RuntimeState &state, const RealizedClassNode *start_node,
+    const char *protocol_name, std::uint64_t &visited_protocol_count,
+    std::string &matched_protocol_owner_identity,
+    std::string &matched_attachment_owner_identity) {
+  // conformance-bitset anchor: a memoized closure answers with one bit test
+  // and, on a hit, reports the same visit count and owners the walk would.
+  if (start_node == nullptr || protocol_name == nullptr || protocol_name[0] == '\0') {
+    return false;
+  }
+  const RealizedClassConformance &conformance =
+      EnsureRealizedClassConformanceUnlocked(state, *start_node);
+  if (!conformance.walkable) {
+    return WalkRealizedClassProtocolConformanceUnlocked(
+        state, start_node, protocol_name, visited_protocol_count,
+        matched_protocol_owner_identity, matched_attachment_owner_identity);
+  }
+  ++state.conformance_bitset_test_count;
+  const RuntimeSymbolId protocol_id =
+      FindRuntimeSymbolUnlocked(state, protocol_name);
+  if (!RealizedClassConformsToProtocolId(conformance, protocol_id)) {
+    visited_protocol_count +=
+        static_cast<std::uint64_t>(conformance.closure.size());
+    return false;
+  }
+  for (std::size_t index = 0; index < conformance.closure.size(); ++index) {
+    const RealizedConformanceEntry &entry = conformance.closure[index];
+    if (entry.protocol_id != protocol_id) {
+      continue;
+    }
+    visited_protocol_count += static_cast<std::uint64_t>(index + 1u);
+    matched_protocol_owner_identity = entry.protocol_owner_identity;
+    matched_attachment_owner_identity =
+        entry.attachment_owner_identity != nullptr
+            ? entry.attachment_owner_identity
+            : "";
+    return true;
+  }
+  return false;
+}
+
+// task-executor anchor: body-carrying tasks run on a work-stealing pool. Each
+// worker owns a deque it pushes and pops at the back while idle workers steal
+// from the front of the others; spawns from threads outside the pool go
+// through one injection queue. Executor tags resolve the way the lowering
+// computes them: untagged and `objc_executor(global)` tasks run directly on
+// the pool, while `main` and every `named(...)` executor is a serial queue
+// whose tasks pool workers drain one at a time in submission order.
+constexpr int kRuntimeTaskKindChild = 1;
+constexpr int kRuntimeTaskKindDetached = 2;
+constexpr int kRuntimeSerialExecutorTurnLength = 64;
+
+constexpr std::uint32_t HashRuntimeExecutorTagText(std::uint32_t hash,
+                                                   const char *text) {
+  for (; *text != '\0'; ++text) {
+    hash ^= static_cast<std::uint32_t>(static_cast<unsigned char>(*text));
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+// Mirrors the emitter's StablePositiveAsyncTag("executor-kind:global").
+constexpr int kRuntimeGlobalExecutorTag = static_cast<int>(
+    HashRuntimeExecutorTagText(
+        HashRuntimeExecutorTagText(2166136261u, "executor-kind:"), "global") %
+        2147483646u +
+    1u);
+
+struct RuntimeTaskGroup;
+struct RuntimeAsyncFrame;
+
+struct RuntimeTaskRecord {
+  int handle = 0;
+  int kind = 0;
+  int block_handle = 0;
+  int argument = 0;
+  int result = 0;
+  // Set for tasks whose body is an async frame; cleared by its first step.
+  RuntimeAsyncFrame *frame = nullptr;
+  std::atomic<bool> cancelled{false};
+  std::atomic<bool> completed{false};
+  // Child tasks observe their parent's cancellation.
+  std::shared_ptr<RuntimeTaskRecord> parent;
+  RuntimeTaskGroup *group = nullptr;
+};
+
+struct RuntimeTaskGroup {
+  int handle = 0;
+  int executor_tag = 0;
+  std::mutex mutex;
+  bool cancelled = false;
+  std::unordered_map<int, std::shared_ptr<RuntimeTaskRecord>> pending_by_handle;
+  std::deque<int> completed_results;
+};
+
+// A thread hopping onto a busy serial executor parks this on its own stack
+// and waits for an executor turn to run `run` in queue order.
+struct RuntimeActorHop {
+  void (*run)(void *) = nullptr;
+  void *context = nullptr;
+  std::atomic<bool> done{false};
+};
+
+// One intrusive node of a serial executor's run queue or an actor's value
+// mailbox. Run-queue nodes carry a task, an actor message, a hop, or a
+// suspended async frame; mailbox nodes carry their value in `argument`.
+struct RuntimeActorJob {
+  std::atomic<RuntimeActorJob *> next{nullptr};
+  std::shared_ptr<RuntimeTaskRecord> task;
+  RuntimeActorHop *hop = nullptr;
+  RuntimeAsyncFrame *frame = nullptr;
+  int block_handle = 0;
+  int argument = 0;
+};
+
+// Intrusive multi-producer single-consumer queue (Vyukov): producers link in
+// with one exchange on `head` and never block; the single consumer walks from
+// `tail` and recycles `stub` to tell the last node apart from an empty queue.
+struct RuntimeActorQueue {
+  std::atomic<RuntimeActorJob *> head;
+  RuntimeActorJob *tail;
+  RuntimeActorJob stub;
+  RuntimeActorQueue() : head(&stub), tail(&stub) {}
+};
+
+// actor-executor anchor: a serial executor owns its run queue while
+// `pending_job_count` is non-zero. Whoever moves the count off zero owns the
+// executor and either queues a pool turn or drains inline; the owner keeps
+// draining until its own decrement returns the count to zero, so at most one
+// thread ever runs the executor's jobs.
+struct RuntimeSerialExecutor {
+  int tag = 0;
+  RuntimeActorQueue jobs;
+  std::atomic<std::uint64_t> pending_job_count{0};
+  std::atomic<std::uint64_t> executed_job_count{0};
+  std::atomic<std::uint64_t> turn_count{0};
+};
+
+// Actors bound to `main` or a named executor share that tag's serial
+// executor; unbound actors run on their own. Value mailboxes are drained only
+// while holding the actor's executor, which keeps them single-consumer.
+struct RuntimeActor {
+  int handle = 0;
+  RuntimeSerialExecutor own_executor;
+  std::atomic<RuntimeSerialExecutor *> serial{nullptr};
+  RuntimeActorQueue mailbox;
+  std::atomic<std::uint64_t> mailbox_depth{0};
+  std::atomic<std::uint64_t> sent_message_count{0};
+};
+
+// A pool job runs one task, one turn of a serial executor, or one step of an
+// async frame resumed onto the global executor.
+struct RuntimeExecutorJob {
+  std::shared_ptr<RuntimeTaskRecord> task;
+  RuntimeSerialExecutor *serial = nullptr;
+  RuntimeAsyncFrame *frame = nullptr;
+};
+
+struct RuntimeWorkerDeque {
+  std::mutex mutex;
+  std::deque<RuntimeExecutorJob> jobs;
+};
+
+struct RuntimeTaskExecutor {
+  std::once_flag workers_started;
+  std::vector<std::unique_ptr<RuntimeWorkerDeque>> worker_deques;
+  std::atomic<std::uint64_t> worker_count{0};
+  std::mutex injection_mutex;
+  std::deque<RuntimeExecutorJob> injection_jobs;
+  std::atomic<std::uint64_t> queued_job_count{0};
+  std::atomic<std::uint64_t> in_flight_task_count{0};
+  // Sleeping workers wait on work_cv; joiners wait on done_cv for a task to
+  // complete or for work they can help run.
+  std::mutex wait_mutex;
+  std::condition_variable work_cv;
+  std::condition_variable done_cv;
+  std::atomic<int> sleeping_worker_count{0};
+  std::atomic<int> waiter_count{0};
+  std::mutex registry_mutex;
+  int next_task_handle = 1;
+  int next_group_handle = 1;
+  std::unordered_map<int, std::shared_ptr<RuntimeTaskRecord>> tasks_by_handle;
+  std::unordered_map<int, std::unique_ptr<RuntimeTaskGroup>> groups_by_handle;
+  // Serial executors are never destroyed: a trailing drain turn may still be
+  // queued after their last task completes.
+  std::unordered_map<int, std::unique_ptr<RuntimeSerialExecutor>>
+      serial_executors_by_tag;
+  // Actors are never destroyed either, so threads cache them by handle.
+  std::unordered_map<int, std::unique_ptr<RuntimeActor>> actors_by_handle;
+  std::atomic<std::uint64_t> spawned_task_count{0};
+  std::atomic<std::uint64_t> completed_task_count{0};
+  std::atomic<std::uint64_t> stolen_job_count{0};
+  std::atomic<std::uint64_t> same_executor_hop_count{0};
+  std::atomic<std::uint64_t> inline_hop_count{0};
+  std::atomic<std::uint64_t> queued_hop_count{0};
+};
+
+struct RuntimeActorCacheEntry {
+  int handle = 0;
+  RuntimeActor *actor = nullptr;
+};
+
+constexpr std::size_t kRuntimeActorCacheSize = 64;
+
+thread_local int g_runtime_task_worker_index = -1;
+thread_local const std::shared_ptr<RuntimeTaskRecord> *g_runtime_current_task =
+    nullptr;
+thread_local RuntimeSerialExecutor *g_runtime_current_serial_executor =
+    nullptr;
+thread_local RuntimeAsyncFrame *g_runtime_current_async_frame = nullptr;
+thread_local std::array<RuntimeActorCacheEntry, kRuntimeActorCacheSize>
+    g_runtime_actor_cache{};
+
+// Leaked so detached workers never observe it being destroyed at exit.
+RuntimeTaskExecutor &TaskExecutor() {
+  static RuntimeTaskExecutor *executor = new RuntimeTaskExecutor();
+  return *executor;
+}
+
+// async-frame anchor: an async function lowered to a state machine keeps its
+// locals in a frame drawn from size-classed pools. This runtime prefix sits
+// in front of the emitted slots, whose first two i32 fields hold the resume
+// point and the awaited or returned value. One thread runs a frame at a time:
+// a step that parks or yields hands the frame to whoever resumes it and must
+// not touch it again.
+struct RuntimeAsyncFrameSlots {
+  std::int32_t resume_point;
+  std::int32_t value;
+};
+
+constexpr std::uint8_t kRuntimeAsyncFrameRunning = 0;
+constexpr std::uint8_t kRuntimeAsyncFrameSuspended = 1;
+constexpr std::uint8_t kRuntimeAsyncFrameCompleted = 2;
+
+struct RuntimeAsyncFrame {
+  // Run-queue node used while the frame waits for a serial executor turn.
+  RuntimeActorJob job;
+  int (*resume)(void *slots) = nullptr;
+  // The task the frame runs as; null while a synchronous caller waits on it.
+  std::shared_ptr<RuntimeTaskRecord> task;
+  // Where the next step runs; null resumes on the global pool.
+  RuntimeSerialExecutor *serial = nullptr;
+  std::atomic<std::uint8_t> state{kRuntimeAsyncFrameRunning};
+  // Group opened by the frame's block-bodied lowered task helpers; the frame
+  // joins it when it finishes, wherever its steps ran.
+  int task_group_handle = 0;
+  std::uint32_t size_class = 0;
+  std::uint64_t block_bytes = 0;
+  RuntimeAsyncFrame *next_free = nullptr;
+};
+
+constexpr std::size_t kRuntimeAsyncFrameGranuleBytes = 16;
+constexpr std::size_t kRuntimeAsyncFramePrefixBytes =
+    (sizeof(RuntimeAsyncFrame) + kRuntimeAsyncFrameGranuleBytes - 1u) &
+    ~(kRuntimeAsyncFrameGranuleBytes - 1u);
+// Frames up to 1 KiB come from per-size-class pools; larger ones are
+// allocated individually.
+constexpr std::size_t kRuntimeAsyncFrameSizeClassCount = 64;
+constexpr std::size_t kRuntimeAsyncFramesPerChunk = 64;
+constexpr std::uint32_t kRuntimeAsyncFrameUnpooled = 0xffffffffu;
+
+struct RuntimeAsyncFrameSizeClass {
+  std::mutex mutex;
+  RuntimeAsyncFrame *free_list = nullptr;
+};
+
+// async-continuation anchor: continuation records live in chunks that are
+// never freed, so every handle stays resolvable. A handle packs a 9-bit
+// generation above the record index + 1; the record's state word packs the
+// full generation above its state and only changes by compare-exchange, so
+// any thread may resume or cancel a parked continuation and stale handles
+// fail closed. Until a continuation is parked, only its allocating thread
+// may hand it off, park it, resume it, or cancel it.
+constexpr std::uint32_t kRuntimeAsyncContinuationFree = 0;
+constexpr std::uint32_t kRuntimeAsyncContinuationPending = 1;
+constexpr std::uint32_t kRuntimeAsyncContinuationParked = 2;
+constexpr std::uint32_t kRuntimeAsyncContinuationResumed = 3;
+constexpr std::uint32_t kRuntimeAsyncContinuationCancelled = 4;
+constexpr std::uint32_t kRuntimeAsyncContinuationStateMask = 0xffu;
+constexpr std::uint32_t kRuntimeAsyncContinuationIndexBits = 22;
+constexpr std::uint32_t kRuntimeAsyncContinuationGenerationMask = 0x1ffu;
+constexpr std::uint32_t kRuntimeAsyncContinuationChunkBits = 12;
+constexpr std::uint32_t kRuntimeAsyncContinuationChunkSize =
+    1u << kRuntimeAsyncContinuationChunkBits;
+constexpr std::uint32_t kRuntimeAsyncContinuationChunkLimit =
+    ((1u << kRuntimeAsyncContinuationIndexBits) - 1u) /
+    kRuntimeAsyncContinuationChunkSize;
+
+struct RuntimeAsyncContinuation {
+  std::atomic<std::uint32_t> word{0};
+  // Free-stack link: the next free record's index + 1, or 0.
+  std::atomic<std::uint32_t> next_free{0};
+  int resume_entry_tag = 0;
+  int executor_tag = 0;
+  RuntimeAsyncFrame *frame = nullptr;
+};
+
+struct RuntimeAsyncRuntime {
+  std::mutex growth_mutex;
+  std::array<std::atomic<RuntimeAsyncContinuation *>,
+             kRuntimeAsyncContinuationChunkLimit>
+      chunks{};
+  std::atomic<std::uint32_t> chunk_count{0};
+  // Treiber stack of free records: ABA tag << 32 | (index + 1), 0 if empty.
+  std::atomic<std::uint64_t> free_head{0};
+  std::atomic<std::uint64_t> live_continuation_count{0};
+  std::array<RuntimeAsyncFrameSizeClass, kRuntimeAsyncFrameSizeClassCount>
+      frame_classes;
+  std::atomic<std::uint64_t> pooled_frame_bytes{0};
+  std::atomic<std::uint64_t> live_frame_count{0};
+  std::atomic<std::uint64_t> live_frame_bytes{0};
+  std::atomic<std::uint64_t> suspended_frame_count{0};
+  std::atomic<std::uint64_t> suspended_frame_bytes{0};
+  std::atomic<std::uint64_t> suspension_count{0};
+  std::atomic<std::uint64_t> inline_await_count{0};
+  std::atomic<std::uint64_t> resumed_continuation_count{0};
+  std::atomic<std::uint64_t> cancelled_continuation_count{0};
+  std::atomic<std::uint64_t> completed_frame_count{0};
+  // Helper-call traffic for the continuation testing snapshot.
+  std::atomic<std::uint64_t> allocation_call_count{0};
+  std::atomic<std::uint64_t> handoff_call_count{0};
+  std::atomic<std::uint64_t> resume_call_count{0};
+  std::atomic<int> last_allocated_handle{0};
+  std::atomic<int> last_allocated_resume_entry_tag{0};
+  std::atomic<int> last_allocated_executor_tag{0};
+  std::atomic<int> last_handoff_handle{0};
+  std::atomic<int> last_handoff_executor_tag{0};
+  std::atomic<int> last_resume_handle{0};
+  std::atomic<int> last_resume_result_value{0};
+  std::atomic<int> last_resume_return_value{0};
+};
+
+// Leaked for the same reason as the task executor.
+RuntimeAsyncRuntime &AsyncRuntime() {
+  static RuntimeAsyncRuntime *async = new RuntimeAsyncRuntime();
+  return *async;
+}
+
+RuntimeAsyncFrameSlots *RuntimeAsyncFrameSlotsOf(RuntimeAsyncFrame *frame) {
+  return reinterpret_cast<RuntimeAsyncFrameSlots *>(
+      reinterpret_cast<unsigned char *>(frame) + kRuntimeAsyncFramePrefixBytes);
+}
+
+RuntimeAsyncFrame *RuntimeAsyncFrameFromSlots(void *slots) {
+  return reinterpret_cast<RuntimeAsyncFrame *>(
+      static_cast<unsigned char *>(slots) - kRuntimeAsyncFramePrefixBytes);
+}
+
+// Returns zeroed slots of at least `slot_bytes`, so a fresh frame starts at
+// resume point 0.
+void *AllocateRuntimeAsyncFrame(RuntimeAsyncRuntime &async,
+                                int (*resume)(void *),
+                                std::uint64_t slot_bytes) {
+  const std::size_t block_bytes =
+      (kRuntimeAsyncFramePrefixBytes + static_cast<std::size_t>(slot_bytes) +
+       kRuntimeAsyncFrameGranuleBytes - 1u) &
+      ~(kRuntimeAsyncFrameGranuleBytes - 1u);
+  const std::size_t size_class =
+      block_bytes / kRuntimeAsyncFrameGranuleBytes - 1u;
+  RuntimeAsyncFrame *frame = nullptr;
+  if (size_class < kRuntimeAsyncFrameSizeClassCount) {
+    RuntimeAsyncFrameSizeClass &pool = async.frame_classes[size_class];
+    std::lock_guard<std::mutex> lock(pool.mutex);
+    if (pool.free_list == nullptr) {
+      auto *const chunk = static_cast<unsigned char *>(::operator new(
+          block_bytes * kRuntimeAsyncFramesPerChunk,
+          std::align_val_t{kRuntimeAsyncFrameGranuleBytes}));
+      for (std::size_t index = kRuntimeAsyncFramesPerChunk; index-- > 0;) {
+        auto *const carved =
+            new (chunk + index * block_bytes) RuntimeAsyncFrame();
+        carved->size_class = static_cast<std::uint32_t>(size_class);
+        carved->block_bytes = block_bytes;
+        carved->next_free = pool.free_list;
+        pool.free_list = carved;
+      }
+      async.pooled_frame_bytes.fetch_add(
+          block_bytes * kRuntimeAsyncFramesPerChunk, std::memory_order_relaxed);
+    }
+    frame = pool.free_list;
+    pool.free_list = frame->next_free;
+  } else {
+    frame = new (::operator new(
+        block_bytes, std::align_val_t{kRuntimeAsyncFrameGranuleBytes}))
+        RuntimeAsyncFrame();
+    frame->size_class = kRuntimeAsyncFrameUnpooled;
+    frame->block_bytes = block_bytes;
+  }
+  frame->resume = resume;
+  frame->job.frame = frame;
+  frame->state.store(kRuntimeAsyncFrameRunning, std::memory_order_relaxed);
+  RuntimeAsyncFrameSlots *const slots = RuntimeAsyncFrameSlotsOf(frame);
+  std::memset(slots, 0, block_bytes - kRuntimeAsyncFramePrefixBytes);
+  async.live_frame_count.fetch_add(1u, std::memory_order_relaxed);
+  async.live_frame_bytes.fetch_add(block_bytes, std::memory_order_relaxed);
+  return slots;
+}
+
+void ReleaseRuntimeAsyncFrame(RuntimeAsyncRuntime &async,
+                              RuntimeAsyncFrame *frame) {
+  async.live_frame_bytes.fetch_sub(frame->block_bytes,
+                                   std::memory_order_relaxed);
+  async.live_frame_count.fetch_sub(1u, std::memory_order_relaxed);
+  frame->task.reset();
+  frame->serial = nullptr;
+  frame->resume = nullptr;
+  frame->task_group_handle = 0;
+  if (frame->size_class == kRuntimeAsyncFrameUnpooled) {
+    frame->~RuntimeAsyncFrame();
+    ::operator delete(frame,
+                      std::align_val_t{kRuntimeAsyncFrameGranuleBytes});
+    return;
+  }
+  RuntimeAsyncFrameSizeClass &pool = async.frame_classes[frame->size_class];
+  std::lock_guard<std::mutex> lock(pool.mutex);
+  frame->next_free = pool.free_list;
+  pool.free_list = frame;
+}
+
+void MarkRuntimeAsyncFrameSuspended(RuntimeAsyncRuntime &async,
+                                    RuntimeAsyncFrame *frame) {
+  frame->state.store(kRuntimeAsyncFrameSuspended, std::memory_order_relaxed);
+  async.suspended_frame_count.fetch_add(1u, std::memory_order_relaxed);
+  async.suspended_frame_bytes.fetch_add(frame->block_bytes,
+                                        std::memory_order_relaxed);
+  async.suspension_count.fetch_add(1u, std::memory_order_relaxed);
+}
+
+RuntimeAsyncContinuation &RuntimeAsyncContinuationAt(RuntimeAsyncRuntime &async,
+                                                     std::uint32_t index) {
+  return async.chunks[index >> kRuntimeAsyncContinuationChunkBits].load(
+      std::memory_order_acquire)[index &
+                                 (kRuntimeAsyncContinuationChunkSize - 1u)];
+}
+
+int RuntimeAsyncContinuationHandle(std::uint32_t index, std::uint32_t word) {
+  return static_cast<int>(
+      (((word >> 8) & kRuntimeAsyncContinuationGenerationMask)
+       << kRuntimeAsyncContinuationIndexBits) |
+      (index + 1u));
+}
+
+// Resolves `handle` to its record index and the generation it was issued
+// under; the record's state word still decides whether the handle is live.
+bool DecodeRuntimeAsyncContinuationHandle(RuntimeAsyncRuntime &async,
+                                          int handle, std::uint32_t &index,
+                                          std::uint32_t &generation) {
+  if (handle <= 0) {
+    return false;
+  }
+  const auto bits = static_cast<std::uint32_t>(handle);
+  const std::uint32_t slot =
+      bits & ((1u << kRuntimeAsyncContinuationIndexBits) - 1u);
+  if (slot == 0u || ((slot - 1u) >> kRuntimeAsyncContinuationChunkBits) >=
+                        async.chunk_count.load(std::memory_order_acquire)) {
+    return false;
+  }
+  index = slot - 1u;
+  generation = bits >> kRuntimeAsyncContinuationIndexBits;
+  return true;
+}
+
+bool IsRuntimeAsyncContinuationWord(std::uint32_t word,
+                                    std::uint32_t generation,
+                                    std::uint32_t state) {
+  return ((word >> 8) & kRuntimeAsyncContinuationGenerationMask) ==
+             generation &&
+         (word & kRuntimeAsyncContinuationStateMask) == state;
+}
+
+void PushRuntimeAsyncContinuations(RuntimeAsyncRuntime &async,
+                                   std::uint32_t first_index,
+                                   RuntimeAsyncContinuation &last) {
+  std::uint64_t head = async.free_head.load(std::memory_order_relaxed);
+  std::uint64_t replacement = 0;
+  do {
+    last.next_free.store(static_cast<std::uint32_t>(head),
+                         std::memory_order_relaxed);
+    replacement = (((head >> 32) + 1u) << 32) | (first_index + 1u);
+  } while (!async.free_head.compare_exchange_weak(
+      head, replacement, std::memory_order_release,
+      std::memory_order_relaxed));
+}
+
+bool PopRuntimeAsyncContinuation(RuntimeAsyncRuntime &async,
+                                 std::uint32_t &index) {
+  std::uint64_t head = async.free_head.load(std::memory_order_acquire);
+  while (static_cast<std::uint32_t>(head) != 0u) {
+    const std::uint32_t top = static_cast<std::uint32_t>(head) - 1u;
+    // A stale read here loses the race below: the tag has moved on.
+    const std::uint32_t next = RuntimeAsyncContinuationAt(async, top)
+                                   .next_free.load(std::memory_order_relaxed);
+    const std::uint64_t replacement = (((head >> 32) + 1u) << 32) | next;
+    if (async.free_head.compare_exchange_weak(head, replacement,
+                                              std::memory_order_acquire,
+                                              std::memory_order_acquire)) {
+      index = top;
+      return true;
+    }
+  }
+  return false;
+}
+
+// Takes a free record, growing the pool by one chunk when the free stack is
+// empty. Fails only once every chunk is in use.
+bool AcquireRuntimeAsyncContinuation(RuntimeAsyncRuntime &async,
+                                     std::uint32_t &index) {
+  if (PopRuntimeAsyncContinuation(async, index)) {
+    return true;
+  }
+  std::lock_guard<std::mutex> lock(async.growth_mutex);
+  if (PopRuntimeAsyncContinuation(async, index)) {
+    return true;
+  }
+  const std::uint32_t chunk = async.chunk_count.load(std::memory_order_relaxed);
+  if (chunk == kRuntimeAsyncContinuationChunkLimit) {
+    return false;
+  }
+  auto *const records =
+      new RuntimeAsyncContinuation[kRuntimeAsyncContinuationChunkSize];
+  const std::uint32_t base = chunk << kRuntimeAsyncContinuationChunkBits;
+  for (std::uint32_t offset = 1; offset + 1u < kRuntimeAsyncContinuationChunkSize;
+       ++offset) {
+    records[offset].next_free.store(base + offset + 2u,
+                                    std::memory_order_relaxed);
+  }
+  async.chunks[chunk].store(records, std::memory_order_release);
+  async.chunk_count.store(chunk + 1u, std::memory_order_release);
+  PushRuntimeAsyncContinuations(
+      async, base + 1u, records[kRuntimeAsyncContinuationChunkSize - 1u]);
+  index = base;
+  return true;
+}
+
+// Retires a record whose state word the caller just moved out of a live
+// state; bumping the generation invalidates every outstanding handle.
+void ReleaseRuntimeAsyncContinuation(RuntimeAsyncRuntime &async,
+                                     std::uint32_t index) {
+  RuntimeAsyncContinuation &continuation =
+      RuntimeAsyncContinuationAt(async, index);
+  continuation.frame = nullptr;
+  const std::uint32_t word =
+      continuation.word.load(std::memory_order_relaxed);
+  continuation.word.store(
+      (((word >> 8) + 1u) << 8) | kRuntimeAsyncContinuationFree,
+      std::memory_order_release);
+  async.live_continuation_count.fetch_sub(1u, std::memory_order_relaxed);
+  PushRuntimeAsyncContinuations(async, index, continuation);
+}
+
+// Moves a pending or parked continuation to `target` (resumed or cancelled)
+// and retires it. Returns false for stale or already-finished handles;
+// otherwise `frame` receives the parked frame, if any, for the caller to
+// reschedule.
+bool FinishRuntimeAsyncContinuation(RuntimeAsyncRuntime &async, int handle,
+                                    std::uint32_t target,
+                                    RuntimeAsyncFrame *&frame) {
+  std::uint32_t index = 0;
+  std::uint32_t generation = 0;
+  if (!DecodeRuntimeAsyncContinuationHandle(async, handle, index,
+                                            generation)) {
+    return false;
+  }
+  RuntimeAsyncContinuation &continuation =
+      RuntimeAsyncContinuationAt(async, index);
+  std::uint32_t word = continuation.word.load(std::memory_order_acquire);
+  for (;;) {
+    if (!IsRuntimeAsyncContinuationWord(word, generation,
+                                        kRuntimeAsyncContinuationPending) &&
+        !IsRuntimeAsyncContinuationWord(word, generation,
+                                        kRuntimeAsyncContinuationParked)) {
+      return false;
+    }
+    if (continuation.word.compare_exchange_weak(
+            word, (word & ~kRuntimeAsyncContinuationStateMask) | target,
+            std::memory_order_acq_rel, std::memory_order_acquire)) {
+      break;
+    }
+  }
+  frame = (word & kRuntimeAsyncContinuationStateMask) ==
+                  kRuntimeAsyncContinuationParked
+              ? continuation.frame
+              : nullptr;
+  ReleaseRuntimeAsyncContinuation(async, index);
+  return true;
+}
+
+bool PopRuntimeExecutorJob(RuntimeTaskExecutor &executor,
+                           RuntimeExecutorJob &job) {
+  const int self = g_runtime_task_worker_index;
+  if (self >= 0) {
+    RuntimeWorkerDeque &own =
+        *executor.worker_deques[static_cast<std::size_t>(self)];
+    std::lock_guard<std::mutex> lock(own.mutex);
+    if (!own.jobs.empty()) {
+      job = std::move(own.jobs.back());
+      own.jobs.pop_back();
+      executor.queued_job_count.fetch_sub(1u);
+      return true;
+    }
+  }
+  {
+    std::lock_guard<std::mutex> lock(executor.injection_mutex);
+    if (!executor.injection_jobs.empty()) {
+      job = std::move(executor.injection_jobs.front());
+      executor.injection_jobs.pop_front();
+      executor.queued_job_count.fetch_sub(1u);
+      return true;
+    }
+  }
+  const std::size_t worker_count = executor.worker_deques.size();
+  const std::size_t start = self >= 0 ? static_cast<std::size_t>(self) + 1u : 0u;
+  for (std::size_t offset = 0; offset < worker_count; ++offset) {
+    const std::size_t victim = (start + offset) % worker_count;
+    if (static_cast<int>(victim) == self) {
+      continue;
+    }
+    RuntimeWorkerDeque &other = *executor.worker_deques[victim];
+    std::lock_guard<std::mutex> lock(other.mutex);
+    if (!other.jobs.empty()) {
+      job = std::move(other.jobs.front());
+      other.jobs.pop_front();
+      executor.queued_job_count.fetch_sub(1u);
+      executor.stolen_job_count.fetch_add(1u, std::memory_order_relaxed);
+      return true;
+    }
+  }
+  return false;
+}
+
+void PushRuntimeExecutorJob(RuntimeTaskExecutor &executor,
+                            RuntimeExecutorJob job) {
+  const int self = g_runtime_task_worker_index;
+  if (self >= 0) {
+    RuntimeWorkerDeque &own =
+        *executor.worker_deques[static_cast<std::size_t>(self)];
+    std::lock_guard<std::mutex> lock(own.mutex);
+    own.jobs.push_back(std::move(job));
+  } else {
+    std::lock_guard<std::mutex> lock(executor.injection_mutex);
+    executor.injection_jobs.push_back(std::move(job));
+  }
+  executor.queued_job_count.fetch_add(1u);
+  if (executor.sleeping_worker_count.load() > 0) {
+    { std::lock_guard<std::mutex> lock(executor.wait_mutex); }
+    executor.work_cv.notify_one();
+  }
+  if (executor.waiter_count.load() > 0) {
+    { std::lock_guard<std::mutex> lock(executor.wait_mutex); }
+    executor.done_cv.notify_all();
+  }
+}
+
+void RunRuntimeExecutorJob(RuntimeTaskExecutor &executor,
+                           RuntimeExecutorJob &job);
+void StepRuntimeAsyncFrame(RuntimeTaskExecutor &executor,
+                           RuntimeAsyncFrame *frame);
+
+void RunRuntimeTaskWorker(RuntimeTaskExecutor &executor, int index) {
+  g_runtime_task_worker_index = index;
+  for (;;) {
+    RuntimeExecutorJob job;
+    if (PopRuntimeExecutorJob(executor, job)) {
+      RunRuntimeExecutorJob(executor, job);
+      continue;
+    }
+    std::unique_lock<std::mutex> lock(executor.wait_mutex);
+    executor.sleeping_worker_count.fetch_add(1);
+    executor.work_cv.wait(
+        lock, [&executor]() { return executor.queued_job_count.load() > 0u; });
+    executor.sleeping_worker_count.fetch_sub(1);
+  }
+}
+
+// OBJC3_RUNTIME_TASK_WORKERS=<n> overrides the pool size, which otherwise
+// follows the hardware thread count.
+unsigned RuntimeTaskWorkerCount() {
+  const char *value = std::getenv("OBJC3_RUNTIME_TASK_WORKERS");
+  if (value != nullptr && value[0] != '\0') {
+    const unsigned long requested = std::strtoul(value, nullptr, 10);
+    if (requested > 0ul) {
+      return static_cast<unsigned>(std::min(requested, 256ul));
+    }
+  }
+  return std::max(1u, std::thread::hardware_concurrency());
+}
+
+// Workers start on first spawn and run detached for the life of the process.
+void EnsureRuntimeTaskWorkers(RuntimeTaskExecutor &executor) {
+  std::call_once(executor.workers_started, [&executor]() {
+    const unsigned worker_count = RuntimeTaskWorkerCount();
+    for (unsigned index = 0; index < worker_count; ++index) {
+      executor.worker_deques.push_back(std::make_unique<RuntimeWorkerDeque>());
+    }
+    for (unsigned index = 0; index < worker_count; ++index) {
+      std::thread(RunRuntimeTaskWorker, std::ref(executor),
+                  static_cast<int>(index))
+          .detach();
+    }
+    executor.worker_count.store(worker_count);
+  });
+}
+
+// Blocks until `ready` holds, running queued jobs meanwhile so a worker that
+// joins a task never starves the pool of the thread the task needs.
+template <typename Ready>
+void WaitForRuntimeTasks(RuntimeTaskExecutor &executor, Ready ready) {
+  EnsureRuntimeTaskWorkers(executor);
+  while (!ready()) {
+    RuntimeExecutorJob job;
+    if (PopRuntimeExecutorJob(executor, job)) {
+      RunRuntimeExecutorJob(executor, job);
+      continue;
+    }
+    std::unique_lock<std::mutex> lock(executor.wait_mutex);
+    executor.waiter_count.fetch_add(1);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    executor.done_cv.wait(lock, [&executor, &ready]() {
+      return ready() || executor.queued_job_count.load() > 0u;
+    });
+    executor.waiter_count.fetch_sub(1);
+  }
+}
+
+bool IsRuntimeTaskCancelled(const RuntimeTaskRecord *task) {
+  for (; task != nullptr; task = task->parent.get()) {
+    if (task->cancelled.load(std::memory_order_relaxed)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Wakes joiners so they re-check their readiness condition.
+void NotifyRuntimeTaskWaiters(RuntimeTaskExecutor &executor) {
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (executor.waiter_count.load(std::memory_order_relaxed) > 0) {
+    { std::lock_guard<std::mutex> lock(executor.wait_mutex); }
+    executor.done_cv.notify_all();
+  }
+}
+
+void CompleteRuntimeTask(RuntimeTaskExecutor &executor,
+                         const std::shared_ptr<RuntimeTaskRecord> &task,
+                         int result) {
+  task->result = result;
+  task->completed.store(true, std::memory_order_release);
+  if (task->group != nullptr) {
+    std::lock_guard<std::mutex> lock(task->group->mutex);
+    task->group->pending_by_handle.erase(task->handle);
+    task->group->completed_results.push_back(result);
+  }
+  if (task->group != nullptr || task->kind == kRuntimeTaskKindDetached) {
+    std::lock_guard<std::mutex> lock(executor.registry_mutex);
+    executor.tasks_by_handle.erase(task->handle);
+  }
+  executor.completed_task_count.fetch_add(1u, std::memory_order_relaxed);
+  executor.in_flight_task_count.fetch_sub(1u);
+  NotifyRuntimeTaskWaiters(executor);
+}
+
+void RunRuntimeTask(RuntimeTaskExecutor &executor,
+                    const std::shared_ptr<RuntimeTaskRecord> &task) {
+  if (task->frame != nullptr) {
+    // The frame completes the task when its last step returns.
+    RuntimeAsyncFrame *const frame = task->frame;
+    task->frame = nullptr;
+    StepRuntimeAsyncFrame(executor, frame);
+    return;
+  }
+  const std::shared_ptr<RuntimeTaskRecord> *const previous =
+      g_runtime_current_task;
+  g_runtime_current_task = &task;
+  const int result = objc3_runtime_invoke_block_i32(task->block_handle,
+                                                    task->argument, 0, 0, 0);
+  g_runtime_current_task = previous;
+  (void)objc3_runtime_release_i32(task->block_handle);
+  CompleteRuntimeTask(executor, task, result);
+}
+
+void PushRuntimeActorJob(RuntimeActorQueue &queue, RuntimeActorJob *job) {
+  job->next.store(nullptr, std::memory_order_relaxed);
+  RuntimeActorJob *const previous =
+      queue.head.exchange(job, std::memory_order_acq_rel);
+  previous->next.store(job, std::memory_order_release);
+}
+
+// Consumer side only. Returns null both when the queue is empty and while a
+// producer sits between its exchange and its link store.
+RuntimeActorJob *PopRuntimeActorJob(RuntimeActorQueue &queue) {
+  RuntimeActorJob *tail = queue.tail;
+  RuntimeActorJob *next = tail->next.load(std::memory_order_acquire);
+  if (tail == &queue.stub) {
+    if (next == nullptr) {
+      return nullptr;
+    }
+    queue.tail = next;
+    tail = next;
+    next = next->next.load(std::memory_order_acquire);
+  }
+  if (next != nullptr) {
+    queue.tail = next;
+    return tail;
+  }
+  if (tail != queue.head.load(std::memory_order_acquire)) {
+    return nullptr;
+  }
+  PushRuntimeActorJob(queue, &queue.stub);
+  next = tail->next.load(std::memory_order_acquire);
+  if (next != nullptr) {
+    queue.tail = next;
+    return tail;
+  }
+  return nullptr;
+}
+
+void RunRuntimeActorJob(RuntimeTaskExecutor &executor, RuntimeActorJob *job) {
+  if (job->hop != nullptr) {
+    // The job lives on the hopping thread's stack; it may return as soon as
+    // `done` is set.
+    RuntimeActorHop &hop = *job->hop;
+    hop.run(hop.context);
+    hop.done.store(true, std::memory_order_release);
+    NotifyRuntimeTaskWaiters(executor);
+    return;
+  }
+  if (job->frame != nullptr) {
+    // The node is embedded in the frame, which may be freed by this step.
+    StepRuntimeAsyncFrame(executor, job->frame);
+    return;
+  }
+  if (job->task != nullptr) {
+    RunRuntimeTask(executor, job->task);
+  } else {
+    (void)objc3_runtime_invoke_block_i32(job->block_handle, job->argument, 0,
+                                         0, 0);
+    (void)objc3_runtime_release_i32(job->block_handle);
+  }
+  delete job;
+}
+
+// Runs `serial`'s queued jobs on the calling thread, which must own it. Stops
+// after `budget` jobs, once `until` has run, or when the next job is not
+// linked yet. Returns false once the queue went idle and ownership lapsed;
+// true means the caller still owns the executor and must keep it moving.
+bool DrainRuntimeSerialExecutor(RuntimeTaskExecutor &executor,
+                                RuntimeSerialExecutor &serial, int budget,
+                                const RuntimeActorJob *until) {
+  RuntimeSerialExecutor *const previous = g_runtime_current_serial_executor;
+  g_runtime_current_serial_executor = &serial;
+  serial.turn_count.fetch_add(1u, std::memory_order_relaxed);
+  bool owned = true;
+  for (int index = 0; index < budget; ++index) {
+    RuntimeActorJob *const job = PopRuntimeActorJob(serial.jobs);
+    if (job == nullptr) {
+      break;
+    }
+    const bool reached = job == until;
+    serial.executed_job_count.fetch_add(1u, std::memory_order_relaxed);
+    RunRuntimeActorJob(executor, job);
+    if (serial.pending_job_count.fetch_sub(1u, std::memory_order_acq_rel) ==
+        1u) {
+      owned = false;
+      break;
+    }
+    if (reached) {
+      break;
+    }
+  }
+  g_runtime_current_serial_executor = previous;
+  if (!owned) {
+    NotifyRuntimeTaskWaiters(executor);
+  }
+  return owned;
+}
+
+void RunRuntimeExecutorJob(RuntimeTaskExecutor &executor,
+                           RuntimeExecutorJob &job) {
+  if (job.frame != nullptr) {
+    StepRuntimeAsyncFrame(executor, job.frame);
+    return;
+  }
+  if (job.serial == nullptr) {
+    RunRuntimeTask(executor, job.task);
+    return;
+  }
+  // One turn runs a bounded batch, then requeues the executor so a busy
+  // serial executor cannot monopolize a worker.
+  if (DrainRuntimeSerialExecutor(executor, *job.serial,
+                                 kRuntimeSerialExecutorTurnLength, nullptr)) {
+    PushRuntimeExecutorJob(executor, RuntimeExecutorJob{nullptr, job.serial});
+  }
+}
+
+void EnqueueRuntimeSerialJob(RuntimeTaskExecutor &executor,
+                             RuntimeSerialExecutor &serial,
+                             RuntimeActorJob *job) {
+  PushRuntimeActorJob(serial.jobs, job);
+  if (serial.pending_job_count.fetch_add(1u, std::memory_order_acq_rel) ==
+      0u) {
+    PushRuntimeExecutorJob(executor, RuntimeExecutorJob{nullptr, &serial});
+  }
+}
+
+bool IsRuntimeSerialExecutorTag(int executor_tag) {
+  return executor_tag != 0 && executor_tag != kRuntimeGlobalExecutorTag;
+}
+
+RuntimeSerialExecutor &RuntimeSerialExecutorForTag(
+    RuntimeTaskExecutor &executor, int executor_tag) {
+  std::lock_guard<std::mutex> lock(executor.registry_mutex);
+  std::unique_ptr<RuntimeSerialExecutor> &slot =
+      executor.serial_executors_by_tag[executor_tag];
+  if (slot == nullptr) {
+    slot = std::make_unique<RuntimeSerialExecutor>();
+    slot->tag = executor_tag;
+  }
+  return *slot;
+}
+
+void ScheduleRuntimeTask(RuntimeTaskExecutor &executor,
+                         std::shared_ptr<RuntimeTaskRecord> task,
+                         int executor_tag) {
+  if (!IsRuntimeSerialExecutorTag(executor_tag)) {
+    PushRuntimeExecutorJob(executor, RuntimeExecutorJob{std::move(task), nullptr});
+    return;
+  }
+  auto *const job = new RuntimeActorJob();
+  job->task = std::move(task);
+  EnqueueRuntimeSerialJob(executor,
+                          RuntimeSerialExecutorForTag(executor, executor_tag),
+                          job);
+}
+
+// Runs `body` while holding `serial`. An idle executor is claimed inline on
+// the calling thread; a busy one gets a hop job queued behind its pending
+// work, and the caller helps the pool until a turn has run it. A thread that
+// already holds the executor runs `body` directly. Hopping synchronously into
+// an executor whose pending work hops back into one the caller holds
+// deadlocks, as joining such a task would.
+template <typename Body>
+void RunOnRuntimeSerialExecutor(RuntimeTaskExecutor &executor,
+                                RuntimeSerialExecutor &serial, Body &body) {
+  if (g_runtime_current_serial_executor == &serial) {
+    executor.same_executor_hop_count.fetch_add(1u, std::memory_order_relaxed);
+    body();
+    return;
+  }
+  RuntimeActorHop hop;
+  hop.run = [](void *context) { (*static_cast<Body *>(context))(); };
+  hop.context = &body;
+  RuntimeActorJob job;
+  job.hop = &hop;
+  PushRuntimeActorJob(serial.jobs, &job);
+  if (serial.pending_job_count.fetch_add(1u, std::memory_order_acq_rel) !=
+      0u) {
+    executor.queued_hop_count.fetch_add(1u, std::memory_order_relaxed);
+  } else {
+    // The executor was idle, so this thread owns it: run everything queued
+    // ahead of the hop, the hop itself, and hand any remainder to the pool.
+    executor.inline_hop_count.fetch_add(1u, std::memory_order_relaxed);
+    bool owned = true;
+    while (owned && !hop.done.load(std::memory_order_acquire)) {
+      owned = DrainRuntimeSerialExecutor(executor, serial,
+                                         std::numeric_limits<int>::max(), &job);
+      if (owned && !hop.done.load(std::memory_order_acquire)) {
+        std::this_thread::yield();
+      }
+    }
+    if (owned) {
+      EnsureRuntimeTaskWorkers(executor);
+      PushRuntimeExecutorJob(executor, RuntimeExecutorJob{nullptr, &serial});
+    }
+  }
+  // Ownership can also lapse before the hop ran when a producer linked ahead
+  // of it had not counted itself yet; that producer's turn runs the hop.
+  if (!hop.done.load(std::memory_order_acquire)) {
+    WaitForRuntimeTasks(executor, [&hop]() {
+      return hop.done.load(std::memory_order_acquire);
+    });
+  }
+}
+
+// Hands a suspended frame to the executor its next step runs on.
+void ScheduleRuntimeAsyncFrame(RuntimeTaskExecutor &executor,
+                               RuntimeAsyncFrame *frame) {
+  EnsureRuntimeTaskWorkers(executor);
+  RuntimeSerialExecutor *const serial = frame->serial;
+  if (serial != nullptr) {
+    EnqueueRuntimeSerialJob(executor, *serial, &frame->job);
+    return;
+  }
+  PushRuntimeExecutorJob(executor, RuntimeExecutorJob{nullptr, nullptr, frame});
+}
+
+void FinishRuntimeAsyncFrame(RuntimeTaskExecutor &executor,
+                             RuntimeAsyncFrame *frame) {
+  RuntimeAsyncRuntime &async = AsyncRuntime();
+  if (frame->task_group_handle != 0) {
+    (void)objc3_runtime_join_task_group_i32(frame->task_group_handle);
+    frame->task_group_handle = 0;
+  }
+  async.completed_frame_count.fetch_add(1u, std::memory_order_relaxed);
+  if (frame->task == nullptr) {
+    // The synchronous caller waiting on the frame reads its result and
+    // releases it.
+    frame->state.store(kRuntimeAsyncFrameCompleted, std::memory_order_release);
+    NotifyRuntimeTaskWaiters(executor);
+    return;
+  }
+  const std::shared_ptr<RuntimeTaskRecord> task = std::move(frame->task);
+  const int result = RuntimeAsyncFrameSlotsOf(frame)->value;
+  ReleaseRuntimeAsyncFrame(async, frame);
+  CompleteRuntimeTask(executor, task, result);
+}
+
+// Runs the frame up to its next suspension point or its return.
+void StepRuntimeAsyncFrame(RuntimeTaskExecutor &executor,
+                           RuntimeAsyncFrame *frame) {
+  RuntimeAsyncRuntime &async = AsyncRuntime();
+  if (frame->state.exchange(kRuntimeAsyncFrameRunning,
+                            std::memory_order_acq_rel) ==
+      kRuntimeAsyncFrameSuspended) {
+    async.suspended_frame_count.fetch_sub(1u, std::memory_order_relaxed);
+    async.suspended_frame_bytes.fetch_sub(frame->block_bytes,
+                                          std::memory_order_relaxed);
+  }
+  const std::shared_ptr<RuntimeTaskRecord> *const previous =
+      g_runtime_current_task;
+  RuntimeAsyncFrame *const previous_frame = g_runtime_current_async_frame;
+  if (frame->task != nullptr) {
+    g_runtime_current_task = &frame->task;
+  }
+  g_runtime_current_async_frame = frame;
+  const bool finished = frame->resume(RuntimeAsyncFrameSlotsOf(frame)) != 0;
+  g_runtime_current_async_frame = previous_frame;
+  g_runtime_current_task = previous;
+  if (finished) {
+    FinishRuntimeAsyncFrame(executor, frame);
+  }
+}
+
+// Schedules the frames of continuations still parked, as if cancelled, so
+// their tasks can finish before a reset tears the pool down.
+void CancelParkedRuntimeAsyncContinuations(RuntimeTaskExecutor &executor,
+                                           RuntimeAsyncRuntime &async) {
+  const std::uint32_t record_count =
+      async.chunk_count.load(std::memory_order_acquire)
+      << kRuntimeAsyncContinuationChunkBits;
+  for (std::uint32_t index = 0; index < record_count; ++index) {
+    const std::uint32_t word = RuntimeAsyncContinuationAt(async, index)
+                                   .word.load(std::memory_order_acquire);
+    if ((word & kRuntimeAsyncContinuationStateMask) !=
+        kRuntimeAsyncContinuationParked) {
+      continue;
+    }
+    RuntimeAsyncFrame *frame = nullptr;
+    if (FinishRuntimeAsyncContinuation(
+            async, RuntimeAsyncContinuationHandle(index, word),
+            kRuntimeAsyncContinuationCancelled, frame) &&
+        frame != nullptr) {
+      async.cancelled_continuation_count.fetch_add(1u,
+                                                   std::memory_order_relaxed);
+      RuntimeAsyncFrameSlotsOf(frame)->value = 0;
+      ScheduleRuntimeAsyncFrame(executor, frame);
+    }
+  }
 }
 
-bool QueryRealizedClassProtocolConformanceUnlocked(
-    RuntimeState &state, const RealizedClassNode *start_node,
-    const char *protocol_name, std::uint64_t &visited_protocol_count,
-    std::string &matched_protocol_owner_identity,
-    std::string &matched_attachment_owner_identity) {
-  // category-attachment-protocol-conformance anchor: runtime-facing
-  // protocol conformance queries walk realized class nodes, attached category
-  // protocol refs, and inherited protocol closures without widening the public
-  // dispatch ABI.
-  if (start_node == nullptr || protocol_name == nullptr || protocol_name[0] == '\0') {
-    return false;
+// Rebuilds the free stack in index order so handles restart at 1.
+void ResetRuntimeAsyncRuntimeForTesting(RuntimeAsyncRuntime &async) {
+  std::lock_guard<std::mutex> lock(async.growth_mutex);
+  const std::uint32_t record_count =
+      async.chunk_count.load(std::memory_order_acquire)
+      << kRuntimeAsyncContinuationChunkBits;
+  for (std::uint32_t index = 0; index < record_count; ++index) {
+    RuntimeAsyncContinuation &continuation =
+        RuntimeAsyncContinuationAt(async, index);
+    continuation.word.store(kRuntimeAsyncContinuationFree);
+    continuation.next_free.store(index + 1u < record_count ? index + 2u : 0u);
+    continuation.frame = nullptr;
+  }
+  const std::uint64_t tag = (async.free_head.load() >> 32) + 1u;
+  async.free_head.store((tag << 32) | (record_count != 0u ? 1u : 0u));
+  async.live_continuation_count.store(0u);
+  async.suspension_count.store(0u);
+  async.inline_await_count.store(0u);
+  async.resumed_continuation_count.store(0u);
+  async.cancelled_continuation_count.store(0u);
+  async.completed_frame_count.store(0u);
+  async.allocation_call_count.store(0u);
+  async.handoff_call_count.store(0u);
+  async.resume_call_count.store(0u);
+  async.last_allocated_handle.store(0);
+  async.last_allocated_resume_entry_tag.store(0);
+  async.last_allocated_executor_tag.store(0);
+  async.last_handoff_handle.store(0);
+  async.last_handoff_executor_tag.store(0);
+  async.last_resume_handle.store(0);
+  async.last_resume_result_value.store(0);
+  async.last_resume_return_value.store(0);
+}
+
+RuntimeActor &RuntimeActorForHandle(RuntimeTaskExecutor &executor,
+                                    int actor_handle) {
+  RuntimeActorCacheEntry &cached =
+      g_runtime_actor_cache[static_cast<std::uint32_t>(actor_handle) %
+                            kRuntimeActorCacheSize];
+  if (cached.actor != nullptr && cached.handle == actor_handle) {
+    return *cached.actor;
+  }
+  std::lock_guard<std::mutex> lock(executor.registry_mutex);
+  std::unique_ptr<RuntimeActor> &slot =
+      executor.actors_by_handle[actor_handle];
+  if (slot == nullptr) {
+    slot = std::make_unique<RuntimeActor>();
+    slot->handle = actor_handle;
+    slot->serial.store(&slot->own_executor, std::memory_order_release);
+  }
+  cached.handle = actor_handle;
+  cached.actor = slot.get();
+  return *slot;
+}
+
+// The task holds its own reference to the block until the body returns. A
+// task whose body is an async frame instead owns the frame, which completes
+// the task from whichever step returns last.
+int SpawnRuntimeTask(RuntimeTaskExecutor &executor, int task_kind,
+                     RuntimeTaskGroup *group, int block_handle, int argument,
+                     RuntimeAsyncFrame *frame, int executor_tag) {
+  if (frame == nullptr &&
+      TryRetainRuntimeBlock(State(), block_handle) == nullptr) {
+    return 0;
   }
-  std::unordered_set<const EmittedProtocolRecord *> visited_protocols;
-  std::unordered_set<const RealizedClassNode *> visited_nodes;
-  const RealizedClassNode *node = start_node;
-  while (node != nullptr && visited_nodes.insert(node).second) {
-    if (node->bundle == nullptr) {
+  EnsureRuntimeTaskWorkers(executor);
+  auto task = std::make_shared<RuntimeTaskRecord>();
+  task->kind = task_kind;
+  task->block_handle = block_handle;
+  task->argument = argument;
+  task->group = group;
+  task->frame = frame;
+  if (frame != nullptr) {
+    frame->task = task;
+  }
+  if (task_kind == kRuntimeTaskKindChild && group == nullptr &&
+      g_runtime_current_task != nullptr) {
+    task->parent = *g_runtime_current_task;
+  }
+  {
+    std::lock_guard<std::mutex> lock(executor.registry_mutex);
+    do {
+      task->handle = executor.next_task_handle;
+      executor.next_task_handle = executor.next_task_handle == 0x7fffffff
+                                      ? 1
+                                      : executor.next_task_handle + 1;
+    } while (executor.tasks_by_handle.count(task->handle) != 0u);
+    executor.tasks_by_handle.emplace(task->handle, task);
+  }
+  if (group != nullptr) {
+    std::lock_guard<std::mutex> lock(group->mutex);
+    task->cancelled.store(group->cancelled, std::memory_order_relaxed);
+    group->pending_by_handle.emplace(task->handle, task);
+  }
+  executor.spawned_task_count.fetch_add(1u, std::memory_order_relaxed);
+  executor.in_flight_task_count.fetch_add(1u);
+  const int handle = task->handle;
+  ScheduleRuntimeTask(executor, std::move(task), executor_tag);
+  return handle;
+}
+
+std::shared_ptr<RuntimeTaskRecord> FindRuntimeTask(RuntimeTaskExecutor &executor,
+                                                   int task_handle) {
+  std::lock_guard<std::mutex> lock(executor.registry_mutex);
+  const auto found = executor.tasks_by_handle.find(task_handle);
+  return found != executor.tasks_by_handle.end() ? found->second : nullptr;
+}
+
+RuntimeTaskGroup *FindRuntimeTaskGroup(RuntimeTaskExecutor &executor,
+                                       int group_handle) {
+  std::lock_guard<std::mutex> lock(executor.registry_mutex);
+  const auto found = executor.groups_by_handle.find(group_handle);
+  return found != executor.groups_by_handle.end() ? found->second.get()
+                                                  : nullptr;
+}
+
+bool AreRuntimeSerialExecutorsIdle(RuntimeTaskExecutor &executor) {
+  std::lock_guard<std::mutex> lock(executor.registry_mutex);
+  for (const auto &entry : executor.serial_executors_by_tag) {
+    if (entry.second->pending_job_count.load() != 0u) {
       return false;
     }
-    matched_attachment_owner_identity.clear();
-    const EmittedClassRecord &record = node->bundle->class_record;
-    if (QueryProtocolConformanceFromAggregateUnlocked(
-            record.adopted_protocol_refs, protocol_name, visited_protocols,
-            visited_protocol_count, matched_protocol_owner_identity)) {
-      return true;
+  }
+  for (const auto &entry : executor.actors_by_handle) {
+    if (entry.second->own_executor.pending_job_count.load() != 0u) {
+      return false;
     }
-    for (const EmittedCategoryRecord *category_record :
-         node->attached_category_records) {
-      if (QueryProtocolConformanceFromAggregateUnlocked(
-              category_record->adopted_protocol_refs, protocol_name,
-              visited_protocols, visited_protocol_count,
-              matched_protocol_owner_identity)) {
-        matched_attachment_owner_identity =
-            category_record->category_owner_identity != nullptr
-                ? category_record->category_owner_identity
-                : "";
-        return true;
-      }
+  }
+  return true;
+}
+
+// Waits out every in-flight task and actor message before dropping handles,
+// so a reset never races a running body. Workers, serial executors, and
+// actors survive the reset; actors lose their queued values and bindings.
+void ResetRuntimeTaskExecutorForTesting() {
+  RuntimeTaskExecutor &executor = TaskExecutor();
+  RuntimeAsyncRuntime &async = AsyncRuntime();
+  CancelParkedRuntimeAsyncContinuations(executor, async);
+  const auto quiescent = [&executor, &async]() {
+    return executor.in_flight_task_count.load() == 0u &&
+           async.live_frame_count.load() == 0u &&
+           AreRuntimeSerialExecutorsIdle(executor);
+  };
+  if (!quiescent()) {
+    WaitForRuntimeTasks(executor, quiescent);
+  }
+  ResetRuntimeAsyncRuntimeForTesting(async);
+  std::lock_guard<std::mutex> lock(executor.registry_mutex);
+  executor.tasks_by_handle.clear();
+  executor.groups_by_handle.clear();
+  executor.next_task_handle = 1;
+  executor.next_group_handle = 1;
+  executor.spawned_task_count.store(0u);
+  executor.completed_task_count.store(0u);
+  executor.stolen_job_count.store(0u);
+  executor.same_executor_hop_count.store(0u);
+  executor.inline_hop_count.store(0u);
+  executor.queued_hop_count.store(0u);
+  for (const auto &entry : executor.serial_executors_by_tag) {
+    entry.second->executed_job_count.store(0u);
+    entry.second->turn_count.store(0u);
+  }
+  for (const auto &entry : executor.actors_by_handle) {
+    RuntimeActor &actor = *entry.second;
+    while (RuntimeActorJob *const value = PopRuntimeActorJob(actor.mailbox)) {
+      delete value;
     }
-    node = node->has_super_node ? &state.realized_class_nodes[node->super_node_index]
-                                : nullptr;
+    actor.mailbox_depth.store(0u);
+    actor.sent_message_count.store(0u);
+    actor.own_executor.executed_job_count.store(0u);
+    actor.own_executor.turn_count.store(0u);
+    actor.serial.store(&actor.own_executor);
   }
-  return false;
 }
 
 }  // namespace
@@ -3813,6 +9178,14 @@ extern "C" void objc3_runtime_stage_registration_table_for_bootstrap(
   state.staged_registration_table = registration_table;
 }
 
+extern "C" void objc3_runtime_stage_prebuilt_image_for_bootstrap(
+    const void *image, uint64_t byte_count) {
+  RuntimeState &state = State();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  state.staged_prebuilt_image_words = static_cast<const std::uint32_t *>(image);
+  state.staged_prebuilt_image_byte_count = image != nullptr ? byte_count : 0;
+}
+
 // runtime-bootstrap-api anchor: registration, selector lookup,
 // dispatch, snapshot, and reset remain the frozen bootstrap runtime boundary.
 // D002/D003 may extend image walk and reset behavior, but they must preserve
@@ -3822,11 +9195,18 @@ int objc3_runtime_register_image(const objc3_runtime_image_descriptor *image) {
   std::lock_guard<std::mutex> lock(state.mutex);
   const objc3_runtime_registration_table *const staged_registration_table =
       state.staged_registration_table;
+  const std::uint32_t *const staged_prebuilt_image_words =
+      state.staged_prebuilt_image_words;
+  const std::uint64_t staged_prebuilt_image_byte_count =
+      state.staged_prebuilt_image_byte_count;
   // runtime-bootstrap-table-consumption anchor: staging is one-shot
   // and is consumed by the next public registration call only.
   state.staged_registration_table = nullptr;
-  return RegisterImageUnlocked(state, image, staged_registration_table, true,
-                               false);
+  state.staged_prebuilt_image_words = nullptr;
+  state.staged_prebuilt_image_byte_count = 0;
+  return RegisterImageUnlocked(state, image, staged_registration_table,
+                               staged_prebuilt_image_words,
+                               staged_prebuilt_image_byte_count, true, false);
 }
 
 int objc3_runtime_copy_image_walk_state_for_testing(
@@ -3871,6 +9251,26 @@ int objc3_runtime_copy_image_walk_state_for_testing(
   return OBJC3_RUNTIME_REGISTRATION_STATUS_OK;
 }
 
+int objc3_runtime_copy_prebuilt_image_state_for_testing(
+    objc3_runtime_prebuilt_image_state_snapshot *snapshot) {
+  if (snapshot == nullptr) {
+    return OBJC3_RUNTIME_REGISTRATION_STATUS_INVALID_DESCRIPTOR;
+  }
+
+  RuntimeState &state = State();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  snapshot->adopted_image_count = state.prebuilt_image_adopted_count;
+  snapshot->fallback_image_count = state.prebuilt_image_fallback_count;
+  snapshot->adopted_selector_count = state.prebuilt_image_adopted_selector_count;
+  snapshot->prebuilt_class_ordinal_image_count =
+      state.prebuilt_class_ordinal_image_count;
+  snapshot->adopted_selector_table_size =
+      state.adopted_selector_table.selector_count;
+  snapshot->last_image_byte_count = state.last_prebuilt_image_byte_count;
+  snapshot->last_status = state.last_prebuilt_image_status;
+  return OBJC3_RUNTIME_REGISTRATION_STATUS_OK;
+}
+
 int objc3_runtime_copy_reset_replay_state_for_testing(
     objc3_runtime_reset_replay_state_snapshot *snapshot) {
   if (snapshot == nullptr) {
@@ -3920,6 +9320,12 @@ int objc3_runtime_copy_selector_lookup_table_state_for_testing(
       state.last_materialized_selector_pool_index;
   snapshot->last_materialized_from_metadata =
       state.last_materialized_from_metadata ? 1 : 0;
+  snapshot->selector_table_generation =
+      state.selector_table_generation.load(std::memory_order_relaxed);
+  snapshot->selector_spelling_lookup_count =
+      state.selector_spelling_lookup_count;
+  snapshot->bound_selector_reference_count =
+      state.bound_selector_reference_count;
   return OBJC3_RUNTIME_REGISTRATION_STATUS_OK;
 }
 
@@ -3946,12 +9352,12 @@ int objc3_runtime_copy_selector_lookup_entry_for_testing(
 
   RuntimeState &state = State();
   std::lock_guard<std::mutex> lock(state.mutex);
-  const auto found = state.selector_index_by_name.find(selector);
-  if (found == state.selector_index_by_name.end()) {
+  const std::size_t found = FindSelectorSlotIndexUnlocked(state, selector);
+  if (found == kNoSelectorSlot) {
     return OBJC3_RUNTIME_REGISTRATION_STATUS_OK;
   }
 
-  const SelectorSlot &slot = state.selector_slots[found->second];
+  const SelectorSlot &slot = state.selector_slots[found];
   snapshot->found = 1;
   snapshot->metadata_backed = slot.metadata_backed ? 1 : 0;
   snapshot->stable_id = slot.handle.stable_id;
@@ -3969,8 +9375,9 @@ int objc3_runtime_copy_selector_lookup_entry_for_testing(
 // live-optional-send-and-keypath-runtime-support anchor: typed
 // key-path runtime support currently materializes emitted single-component
 // descriptor handles into a private runtime registry plus narrow probe helpers.
-// Optional sends stay on public lookup/dispatch; full multi-component key-path
-// evaluation remains deferred.
+// Optional sends stay on public lookup/dispatch; registered handles of any
+// depth evaluate through the compiled chains behind
+// objc3_runtime_keypath_get_i32/set_i32.
 // cross-module type-surface preservation anchor: when multiple images
 // register through imported runtime surfaces, the same registry path remains
 // authoritative so imported typed key-path descriptors survive startup
@@ -3988,6 +9395,11 @@ int objc3_runtime_copy_keypath_registry_state_for_testing(
   snapshot->image_backed_keypath_count = state.image_backed_keypath_count;
   snapshot->ambiguous_keypath_handle_count =
       state.ambiguous_keypath_handle_count;
+  snapshot->compiled_chain_count =
+      static_cast<std::uint64_t>(state.keypath_chain_cache.size());
+  snapshot->chain_build_count = state.keypath_chain_build_count;
+  snapshot->chain_hit_count = state.keypath_chain_hit_count;
+  snapshot->chain_step_miss_count = state.keypath_chain_step_miss_count;
   snapshot->last_materialized_handle = state.last_materialized_keypath_handle;
   snapshot->last_materialized_registration_order_ordinal =
       state.last_materialized_keypath_registration_order_ordinal;
@@ -4098,6 +9510,34 @@ int objc3_runtime_keypath_root_is_self_for_testing(int keypath_handle) {
   return found->second.root_is_self ? 1 : 0;
 }
 
+// Strong results come back unretained, as from the raw property helpers; a
+// caller that keeps one retains it.
+int objc3_runtime_keypath_get_i32(int keypath_handle, int receiver) {
+  RuntimeState &state = State();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  KeyPathChainStep step;
+  const RuntimeInstanceRecord *instance =
+      ResolveKeyPathTargetUnlocked(state, keypath_handle, receiver, step);
+  int value = 0;
+  return instance != nullptr &&
+                 LoadKeyPathStepValueUnlocked(state, *instance, step, value)
+             ? value
+             : 0;
+}
+
+int objc3_runtime_keypath_set_i32(int keypath_handle, int receiver,
+                                  int value) {
+  RuntimeState &state = State();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  KeyPathChainStep step;
+  RuntimeInstanceRecord *instance =
+      ResolveKeyPathTargetUnlocked(state, keypath_handle, receiver, step);
+  return instance != nullptr &&
+                 StoreKeyPathStepValueUnlocked(state, *instance, step, value)
+             ? 1
+             : 0;
+}
+
 int objc3_runtime_copy_method_cache_state_for_testing(
     objc3_runtime_method_cache_state_snapshot *snapshot) {
   if (snapshot == nullptr) {
@@ -4107,31 +9547,48 @@ int objc3_runtime_copy_method_cache_state_for_testing(
   RuntimeState &state = State();
   std::lock_guard<std::mutex> lock(state.mutex);
   snapshot->cache_entry_count =
-      static_cast<std::uint64_t>(state.method_cache.size());
-  snapshot->cache_hit_count = state.method_cache_hit_count;
+      CurrentMethodCacheEntryCountUnlocked(state);
+  const RuntimeHitStatistics hits =
+      RuntimeHitStatisticsSinceWindowUnlocked(state);
+  snapshot->cache_hit_count = hits.live_hit_count + hits.fallback_hit_count;
   snapshot->cache_miss_count = state.method_cache_miss_count;
   snapshot->slow_path_lookup_count = state.slow_path_lookup_count;
-  snapshot->live_dispatch_count = state.live_dispatch_count;
-  snapshot->fallback_dispatch_count = state.fallback_dispatch_count;
+  snapshot->live_dispatch_count =
+      state.live_dispatch_count + hits.live_hit_count;
+  snapshot->fallback_dispatch_count =
+      state.fallback_dispatch_count + hits.fallback_hit_count;
   snapshot->fast_path_seed_count = state.fast_path_seed_count;
-  snapshot->fast_path_hit_count = state.fast_path_hit_count;
-  snapshot->last_selector_stable_id = state.last_dispatch_selector_stable_id;
+  snapshot->fast_path_hit_count = hits.fast_path_hit_count;
+  const RuntimeDispatchTraceEvent &last = LastDispatchTraceEvent();
+  const RuntimeDispatchTraceView view =
+      ReconstructDispatchTraceEventUnlocked(state, last);
+  snapshot->last_selector_stable_id = last.selector_stable_id;
   snapshot->last_normalized_receiver_identity =
-      state.last_dispatch_normalized_receiver_identity;
-  snapshot->last_category_probe_count = state.last_category_probe_count;
-  snapshot->last_protocol_probe_count = state.last_protocol_probe_count;
-  snapshot->last_dispatch_used_cache = state.last_dispatch_used_cache ? 1 : 0;
-  snapshot->last_dispatch_used_fast_path =
-      state.last_dispatch_used_fast_path ? 1 : 0;
+      last.normalized_receiver_identity;
+  snapshot->last_category_probe_count = last.category_probe_count;
+  snapshot->last_protocol_probe_count = last.protocol_probe_count;
+  snapshot->last_dispatch_used_cache = last.used_cache ? 1 : 0;
+  snapshot->last_dispatch_used_fast_path = last.used_fast_path ? 1 : 0;
   snapshot->last_dispatch_resolved_live_method =
-      state.last_dispatch_resolved_live_method ? 1 : 0;
-  snapshot->last_dispatch_fell_back = state.last_dispatch_fell_back ? 1 : 0;
-  snapshot->last_selector = StableCString(state.last_dispatch_selector);
-  snapshot->last_fast_path_reason = StableCString(state.last_fast_path_reason);
-  snapshot->last_resolved_class_name =
-      StableCString(state.last_resolved_class_name);
-  snapshot->last_resolved_owner_identity =
-      StableCString(state.last_resolved_owner_identity);
+      last.resolved_live_method ? 1 : 0;
+  snapshot->last_dispatch_fell_back = last.fell_back ? 1 : 0;
+  snapshot->last_selector = view.selector;
+  snapshot->last_fast_path_reason = view.fast_path_reason;
+  snapshot->last_resolved_class_name = view.resolved_class_name;
+  snapshot->last_resolved_owner_identity = view.resolved_owner_identity;
+  snapshot->resolved_entry_count = static_cast<std::uint64_t>(
+      state.resolved_method_cache_ring.live_count);
+  snapshot->negative_entry_count = static_cast<std::uint64_t>(
+      state.negative_method_cache_ring.live_count);
+  snapshot->resolved_entry_capacity = static_cast<std::uint64_t>(
+      state.resolved_method_cache_ring.capacity);
+  snapshot->negative_entry_capacity = static_cast<std::uint64_t>(
+      state.negative_method_cache_ring.capacity);
+  snapshot->stale_entry_count = state.stale_method_cache_entry_count;
+  snapshot->eviction_count = state.method_cache_eviction_count;
+  snapshot->negative_eviction_count =
+      state.negative_method_cache_eviction_count;
+  snapshot->stale_reclaim_count = state.stale_method_cache_reclaim_count;
   return OBJC3_RUNTIME_REGISTRATION_STATUS_OK;
 }
 
@@ -4144,38 +9601,249 @@ int objc3_runtime_copy_dispatch_state_for_testing(
   RuntimeState &state = State();
   std::lock_guard<std::mutex> lock(state.mutex);
   snapshot->cache_entry_count =
-      static_cast<std::uint64_t>(state.method_cache.size());
+      CurrentMethodCacheEntryCountUnlocked(state);
+  const RuntimeHitStatistics hits =
+      RuntimeHitStatisticsSinceWindowUnlocked(state);
   snapshot->fast_path_seed_count = state.fast_path_seed_count;
-  snapshot->fast_path_hit_count = state.fast_path_hit_count;
-  snapshot->live_dispatch_count = state.live_dispatch_count;
-  snapshot->fallback_dispatch_count = state.fallback_dispatch_count;
-  snapshot->last_selector_stable_id = state.last_dispatch_selector_stable_id;
+  snapshot->fast_path_hit_count = hits.fast_path_hit_count;
+  snapshot->live_dispatch_count =
+      state.live_dispatch_count + hits.live_hit_count;
+  snapshot->fallback_dispatch_count =
+      state.fallback_dispatch_count + hits.fallback_hit_count;
+  const RuntimeDispatchTraceEvent &last = LastDispatchTraceEvent();
+  const RuntimeDispatchTraceView view =
+      ReconstructDispatchTraceEventUnlocked(state, last);
+  snapshot->last_selector_stable_id = last.selector_stable_id;
   snapshot->last_normalized_receiver_identity =
-      state.last_dispatch_normalized_receiver_identity;
-  snapshot->last_resolved_parameter_count = state.last_dispatch_parameter_count;
-  snapshot->last_property_base_identity =
-      state.last_dispatch_property_base_identity;
-  snapshot->last_property_slot_index = state.last_dispatch_property_slot_index;
-  snapshot->last_dispatch_used_cache = state.last_dispatch_used_cache ? 1 : 0;
-  snapshot->last_dispatch_used_fast_path =
-      state.last_dispatch_used_fast_path ? 1 : 0;
+      last.normalized_receiver_identity;
+  snapshot->last_resolved_parameter_count = last.parameter_count;
+  snapshot->last_property_base_identity = last.property_base_identity;
+  snapshot->last_property_slot_index = last.property_slot_index;
+  snapshot->last_dispatch_used_cache = last.used_cache ? 1 : 0;
+  snapshot->last_dispatch_used_fast_path = last.used_fast_path ? 1 : 0;
   snapshot->last_dispatch_resolved_live_method =
-      state.last_dispatch_resolved_live_method ? 1 : 0;
-  snapshot->last_dispatch_fell_back = state.last_dispatch_fell_back ? 1 : 0;
+      last.resolved_live_method ? 1 : 0;
+  snapshot->last_dispatch_fell_back = last.fell_back ? 1 : 0;
   snapshot->last_effective_direct_dispatch =
-      state.last_dispatch_effective_direct_dispatch ? 1 : 0;
-  snapshot->last_used_builtin = state.last_dispatch_used_builtin ? 1 : 0;
-  snapshot->last_selector = StableCString(state.last_dispatch_selector);
-  snapshot->last_fast_path_reason = StableCString(state.last_fast_path_reason);
-  snapshot->last_dispatch_path = StableCString(state.last_dispatch_path);
-  snapshot->last_implementation_kind =
-      StableCString(state.last_dispatch_implementation_kind);
-  snapshot->last_property_name =
-      StableCString(state.last_dispatch_property_name);
-  snapshot->last_resolved_class_name =
-      StableCString(state.last_resolved_class_name);
-  snapshot->last_resolved_owner_identity =
-      StableCString(state.last_resolved_owner_identity);
+      last.effective_direct_dispatch ? 1 : 0;
+  snapshot->last_used_builtin = last.used_builtin ? 1 : 0;
+  snapshot->last_selector = view.selector;
+  snapshot->last_fast_path_reason = view.fast_path_reason;
+  snapshot->last_dispatch_path = view.dispatch_path;
+  snapshot->last_implementation_kind = view.implementation_kind;
+  snapshot->last_property_name = view.property_name;
+  snapshot->last_resolved_class_name = view.resolved_class_name;
+  snapshot->last_resolved_owner_identity = view.resolved_owner_identity;
+  return OBJC3_RUNTIME_REGISTRATION_STATUS_OK;
+}
+
+int objc3_runtime_copy_metrics(objc3_runtime_metrics_snapshot *snapshot) {
+  if (snapshot == nullptr) {
+    return OBJC3_RUNTIME_REGISTRATION_STATUS_INVALID_DESCRIPTOR;
+  }
+  CopyRuntimeMetrics(*snapshot);
+  return OBJC3_RUNTIME_REGISTRATION_STATUS_OK;
+}
+
+int objc3_runtime_set_dispatch_profile_period_for_testing(uint64_t period) {
+  RuntimeState &state = State();
+  state.dispatch_profile_period.store(period, std::memory_order_relaxed);
+  state.dispatch_profile_generation.fetch_add(1u, std::memory_order_relaxed);
+  g_runtime_dispatch_profile_tick = 0;
+  return OBJC3_RUNTIME_REGISTRATION_STATUS_OK;
+}
+
+int objc3_runtime_copy_dispatch_profile_state_for_testing(
+    objc3_runtime_dispatch_profile_state_snapshot *snapshot) {
+  if (snapshot == nullptr) {
+    return OBJC3_RUNTIME_REGISTRATION_STATUS_INVALID_DESCRIPTOR;
+  }
+
+  const RuntimeState &state = State();
+  DispatchProfileAggregate aggregate;
+  CollectDispatchProfile(state, aggregate);
+  *snapshot = objc3_runtime_dispatch_profile_state_snapshot{};
+  snapshot->sample_period =
+      state.dispatch_profile_period.load(std::memory_order_relaxed);
+  snapshot->table_count = aggregate.table_count;
+  snapshot->profiled_key_count = aggregate.totals.size();
+  snapshot->dropped_sample_count = aggregate.dropped_sample_count;
+  for (const auto &[key, totals] : aggregate.totals) {
+    for (const std::uint64_t count : totals.path_counts) {
+      snapshot->sample_count += count;
+    }
+  }
+  return OBJC3_RUNTIME_REGISTRATION_STATUS_OK;
+}
+
+int objc3_runtime_copy_dispatch_profile_entry_for_testing(
+    int receiver, const char *selector,
+    objc3_runtime_dispatch_profile_entry_snapshot *snapshot) {
+  if (snapshot == nullptr) {
+    return OBJC3_RUNTIME_REGISTRATION_STATUS_INVALID_DESCRIPTOR;
+  }
+
+  *snapshot = objc3_runtime_dispatch_profile_entry_snapshot{};
+  RuntimeState &state = State();
+  MethodCacheKey key;
+  {
+    std::lock_guard<std::mutex> lock(state.mutex);
+    std::uint64_t base_identity = 0;
+    DispatchFamily family = DispatchFamily::Invalid;
+    if (selector == nullptr || selector[0] == '\0' ||
+        !DecodeReceiverIdentity(state, receiver, base_identity, family,
+                                key.normalized_receiver_identity)) {
+      return OBJC3_RUNTIME_REGISTRATION_STATUS_OK;
+    }
+    const std::size_t selector_index =
+        FindSelectorSlotIndexUnlocked(state, selector);
+    if (selector_index == kNoSelectorSlot) {
+      return OBJC3_RUNTIME_REGISTRATION_STATUS_OK;
+    }
+    key.selector_stable_id =
+        state.selector_slots[selector_index].handle.stable_id;
+  }
+  DispatchProfileAggregate aggregate;
+  CollectDispatchProfile(state, aggregate);
+  const auto totals_it = aggregate.totals.find(key);
+  if (totals_it == aggregate.totals.end()) {
+    return OBJC3_RUNTIME_REGISTRATION_STATUS_OK;
+  }
+  const DispatchProfileTotals &totals = totals_it->second;
+  const auto count = [&totals](RuntimeDispatchTracePath path) {
+    return totals.path_counts[static_cast<std::size_t>(path)];
+  };
+  snapshot->found = 1;
+  snapshot->cache_hit_count = count(RuntimeDispatchTracePath::CacheHitFastPath) +
+                              count(RuntimeDispatchTracePath::CacheHitLive) +
+                              count(RuntimeDispatchTracePath::CacheHitFallback);
+  snapshot->slow_path_count = count(RuntimeDispatchTracePath::SlowPathLive) +
+                              count(RuntimeDispatchTracePath::SlowPathFallback);
+  snapshot->fallback_count =
+      count(RuntimeDispatchTracePath::CacheHitFallback) +
+      count(RuntimeDispatchTracePath::SlowPathFallback) +
+      count(RuntimeDispatchTracePath::InvalidReceiverFallback);
+  for (const std::uint64_t path_count : totals.path_counts) {
+    snapshot->sample_count += path_count;
+  }
+  snapshot->slow_path_ns = totals.slow_path_ns;
+  return OBJC3_RUNTIME_REGISTRATION_STATUS_OK;
+}
+
+int objc3_runtime_write_dispatch_profile(const char *path) {
+  if (path == nullptr || path[0] == '\0' || !WriteDispatchProfile(path)) {
+    return OBJC3_RUNTIME_REGISTRATION_STATUS_INVALID_DESCRIPTOR;
+  }
+  return OBJC3_RUNTIME_REGISTRATION_STATUS_OK;
+}
+
+int objc3_runtime_set_method_cache_capacity_for_testing(
+    uint64_t resolved_capacity, uint64_t negative_capacity) {
+  if (resolved_capacity == 0 || negative_capacity == 0) {
+    return OBJC3_RUNTIME_REGISTRATION_STATUS_INVALID_DESCRIPTOR;
+  }
+
+  RuntimeState &state = State();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  DropSlowPathMethodCacheEntriesUnlocked(state);
+  state.dispatch_cache_epoch.fetch_add(1u, std::memory_order_release);
+  state.resolved_method_cache_ring.capacity =
+      static_cast<std::size_t>(resolved_capacity);
+  state.negative_method_cache_ring.capacity =
+      static_cast<std::size_t>(negative_capacity);
+  return OBJC3_RUNTIME_REGISTRATION_STATUS_OK;
+}
+
+int objc3_runtime_set_dispatch_trace_enabled_for_testing(int enabled) {
+  RuntimeState &state = State();
+  return state.dispatch_trace_enabled.exchange(enabled != 0,
+                                               std::memory_order_relaxed)
+             ? 1
+             : 0;
+}
+
+int objc3_runtime_copy_dispatch_trace_state_for_testing(
+    objc3_runtime_dispatch_trace_state_snapshot *snapshot) {
+  if (snapshot == nullptr) {
+    return OBJC3_RUNTIME_REGISTRATION_STATUS_INVALID_DESCRIPTOR;
+  }
+
+  const RuntimeState &state = State();
+  const RuntimeDispatchTraceRing &ring = g_runtime_dispatch_trace;
+  snapshot->trace_enabled =
+      state.dispatch_trace_enabled.load(std::memory_order_relaxed) ? 1 : 0;
+  snapshot->ring_capacity = kRuntimeDispatchTraceCapacity;
+  snapshot->recorded_event_count = ring.recorded_event_count;
+  snapshot->retained_event_count = ring.retained_event_count;
+  return OBJC3_RUNTIME_REGISTRATION_STATUS_OK;
+}
+
+int objc3_runtime_copy_dispatch_trace_event_for_testing(
+    uint64_t age, objc3_runtime_dispatch_trace_event_snapshot *snapshot) {
+  if (snapshot == nullptr) {
+    return OBJC3_RUNTIME_REGISTRATION_STATUS_INVALID_DESCRIPTOR;
+  }
+
+  *snapshot = objc3_runtime_dispatch_trace_event_snapshot{};
+  const RuntimeDispatchTraceRing &ring = g_runtime_dispatch_trace;
+  if (age >= ring.retained_event_count) {
+    return OBJC3_RUNTIME_REGISTRATION_STATUS_OK;
+  }
+  const RuntimeDispatchTraceEvent &event =
+      ring.events[(ring.head + kRuntimeDispatchTraceCapacity -
+                   static_cast<std::size_t>(age)) %
+                  kRuntimeDispatchTraceCapacity];
+  RuntimeState &state = State();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  const RuntimeDispatchTraceView view =
+      ReconstructDispatchTraceEventUnlocked(state, event);
+  snapshot->found = 1;
+  snapshot->sequence = event.sequence;
+  snapshot->selector_stable_id = event.selector_stable_id;
+  snapshot->normalized_receiver_identity = event.normalized_receiver_identity;
+  snapshot->used_cache = event.used_cache ? 1 : 0;
+  snapshot->used_fast_path = event.used_fast_path ? 1 : 0;
+  snapshot->resolved_live_method = event.resolved_live_method ? 1 : 0;
+  snapshot->fell_back = event.fell_back ? 1 : 0;
+  snapshot->selector = view.selector;
+  snapshot->dispatch_path = view.dispatch_path;
+  snapshot->implementation_kind = view.implementation_kind;
+  snapshot->resolved_class_name = view.resolved_class_name;
+  return OBJC3_RUNTIME_REGISTRATION_STATUS_OK;
+}
+
+int objc3_runtime_copy_dispatch_site_cache_state_for_testing(
+    objc3_runtime_dispatch_site_cache_state_snapshot *snapshot) {
+  if (snapshot == nullptr) {
+    return OBJC3_RUNTIME_REGISTRATION_STATUS_INVALID_DESCRIPTOR;
+  }
+
+  RuntimeState &state = State();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  snapshot->bound_site_count = state.bound_dispatch_site_count;
+  snapshot->site_cache_hit_count =
+      RuntimeHitStatisticsSinceWindowUnlocked(state).site_cache_hit_count;
+  snapshot->site_cache_miss_count = state.dispatch_site_cache_miss_count;
+  snapshot->megamorphic_site_count = state.megamorphic_dispatch_site_count;
+  snapshot->site_binding_count =
+      static_cast<std::uint64_t>(state.dispatch_site_bindings.size());
+  return OBJC3_RUNTIME_REGISTRATION_STATUS_OK;
+}
+
+int objc3_runtime_copy_sealed_dispatch_table_state_for_testing(
+    objc3_runtime_sealed_dispatch_table_state_snapshot *snapshot) {
+  if (snapshot == nullptr) {
+    return OBJC3_RUNTIME_REGISTRATION_STATUS_INVALID_DESCRIPTOR;
+  }
+
+  RuntimeState &state = State();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  snapshot->bound_table_count =
+      static_cast<std::uint64_t>(state.bound_sealed_dispatch_tables.size());
+  snapshot->bound_slot_count = state.bound_sealed_dispatch_slot_count;
+  snapshot->table_bind_count = state.sealed_dispatch_table_bind_count;
+  snapshot->table_unbind_count = state.sealed_dispatch_table_unbind_count;
+  snapshot->table_miss_count = state.sealed_dispatch_table_miss_count;
   return OBJC3_RUNTIME_REGISTRATION_STATUS_OK;
 }
 
@@ -4215,18 +9883,20 @@ int objc3_runtime_copy_method_cache_entry_for_testing(
   if (selector == nullptr || selector[0] == '\0') {
     return OBJC3_RUNTIME_REGISTRATION_STATUS_OK;
   }
-  const auto selector_it = state.selector_index_by_name.find(selector);
-  if (selector_it == state.selector_index_by_name.end()) {
+  const std::size_t selector_index =
+      FindSelectorSlotIndexUnlocked(state, selector);
+  if (selector_index == kNoSelectorSlot) {
     return OBJC3_RUNTIME_REGISTRATION_STATUS_OK;
   }
   const MethodCacheKey key{normalized_receiver_identity,
-                           state.selector_slots[selector_it->second]
+                           state.selector_slots[selector_index]
                                .handle.stable_id};
   const auto cache_it = state.method_cache.find(key);
-  if (cache_it == state.method_cache.end()) {
+  if (cache_it == state.method_cache.end() ||
+      !IsMethodCacheEntryCurrentUnlocked(state, *cache_it->second)) {
     return OBJC3_RUNTIME_REGISTRATION_STATUS_OK;
   }
-  const MethodCacheEntry &entry = cache_it->second;
+  const MethodCacheEntry &entry = *cache_it->second;
   snapshot->found = 1;
   snapshot->resolved = entry.resolved ? 1 : 0;
   snapshot->dispatch_family_is_class =
@@ -4243,46 +9913,182 @@ int objc3_runtime_copy_method_cache_entry_for_testing(
   snapshot->objc_sealed_declared = entry.objc_sealed_declared ? 1 : 0;
   snapshot->selector = StableCString(entry.selector_storage);
   snapshot->fast_path_reason = StableCString(entry.fast_path_reason);
-  snapshot->resolved_class_name = StableCString(entry.class_name);
+  snapshot->resolved_class_name =
+      StableCString(RuntimeSymbolName(state, entry.class_id));
   snapshot->resolved_owner_identity = StableCString(entry.owner_identity);
   return OBJC3_RUNTIME_REGISTRATION_STATUS_OK;
 }
 
-int objc3_runtime_copy_realized_class_graph_state_for_testing(
-    objc3_runtime_realized_class_graph_state_snapshot *snapshot) {
+int objc3_runtime_copy_realized_class_graph_state_for_testing(
+    objc3_runtime_realized_class_graph_state_snapshot *snapshot) {
+  if (snapshot == nullptr) {
+    return OBJC3_RUNTIME_REGISTRATION_STATUS_INVALID_DESCRIPTOR;
+  }
+
+  RuntimeState &state = State();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  snapshot->realized_class_count =
+      static_cast<std::uint64_t>(state.realized_class_nodes.size());
+  snapshot->root_class_count = state.realized_root_class_count;
+  snapshot->metaclass_edge_count = state.realized_metaclass_edge_count;
+  snapshot->receiver_class_binding_count = state.receiver_class_binding_count;
+  snapshot->attached_category_count = state.realized_attached_category_count;
+  snapshot->protocol_conformance_edge_count =
+      state.realized_protocol_conformance_edge_count;
+  snapshot->live_instance_count = state.live_runtime_instance_count;
+  snapshot->last_allocated_receiver_identity =
+      state.last_allocated_runtime_instance_receiver;
+  snapshot->last_allocated_base_identity =
+      state.last_allocated_runtime_instance_base_identity;
+  snapshot->last_allocated_instance_size_bytes =
+      state.last_allocated_runtime_instance_size_bytes;
+  snapshot->last_realized_class_name =
+      StableCString(state.last_realized_class_name);
+  snapshot->last_realized_class_owner_identity =
+      StableCString(state.last_realized_class_owner_identity);
+  snapshot->last_realized_metaclass_owner_identity =
+      StableCString(state.last_realized_metaclass_owner_identity);
+  snapshot->last_attached_category_owner_identity =
+      StableCString(state.last_attached_category_owner_identity);
+  snapshot->last_attached_category_name =
+      StableCString(state.last_attached_category_name);
+  const RealizedClassNode *last_allocated_node =
+      state.last_allocated_runtime_instance_receiver != 0u
+          ? FindRealizedClassNodeByBaseIdentityUnlocked(
+                state, state.last_allocated_runtime_instance_base_identity)
+          : nullptr;
+  snapshot->last_allocated_class_name =
+      last_allocated_node != nullptr
+          ? StableCString(RuntimeSymbolName(state, last_allocated_node->class_id))
+          : nullptr;
+  snapshot->last_registration_realized_class_count =
+      state.last_registration_realized_class_count;
+  snapshot->last_registration_invalidated_cache_entry_count =
+      state.last_registration_invalidated_cache_entry_count;
+  snapshot->full_class_graph_invalidation_count =
+      state.full_class_graph_invalidation_count;
+  snapshot->interned_symbol_count =
+      static_cast<std::uint64_t>(state.symbol_names.size());
+  snapshot->conformance_bitset_build_count =
+      state.conformance_bitset_build_count;
+  snapshot->conformance_bitset_test_count = state.conformance_bitset_test_count;
+  return OBJC3_RUNTIME_REGISTRATION_STATUS_OK;
+}
+
+int objc3_runtime_copy_instance_slab_state_for_testing(
+    objc3_runtime_instance_slab_state_snapshot *snapshot) {
+  if (snapshot == nullptr) {
+    return OBJC3_RUNTIME_REGISTRATION_STATUS_INVALID_DESCRIPTOR;
+  }
+
+  RuntimeState &state = State();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  const RuntimeInstanceSlab &slab = state.runtime_instance_slab;
+  std::uint64_t free_storage_block_count = 0;
+  for (const RuntimeInstanceSizeClassSlab &size_class : slab.size_classes) {
+    free_storage_block_count +=
+        static_cast<std::uint64_t>(size_class.free_blocks.size());
+  }
+  snapshot->live_instance_count = state.live_runtime_instance_count;
+  snapshot->slot_capacity = slab.slot_count;
+  snapshot->free_slot_count = static_cast<std::uint64_t>(slab.free_slots.size());
+  snapshot->reused_slot_count = slab.reused_slot_count;
+  snapshot->retired_slot_count =
+      static_cast<std::uint64_t>(slab.quarantined_slots.size());
+  snapshot->size_class_count = kRuntimeInstanceSizeClassCount;
+  snapshot->reserved_storage_bytes = slab.reserved_storage_bytes;
+  snapshot->free_storage_block_count = free_storage_block_count;
+  snapshot->oversize_allocation_count = slab.oversize_allocation_count;
+  snapshot->wrapped_slot_count = slab.wrapped_slot_count;
+  return OBJC3_RUNTIME_REGISTRATION_STATUS_OK;
+}
+
+int objc3_runtime_copy_block_slab_state_for_testing(
+    objc3_runtime_block_slab_state_snapshot *snapshot) {
+  if (snapshot == nullptr) {
+    return OBJC3_RUNTIME_REGISTRATION_STATUS_INVALID_DESCRIPTOR;
+  }
+
+  RuntimeState &state = State();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  const RuntimeBlockSlab &slab = state.runtime_block_slab;
+  snapshot->live_block_count = slab.live_block_count;
+  snapshot->slot_capacity = slab.slot_count;
+  snapshot->free_slot_count = static_cast<std::uint64_t>(slab.free_slots.size());
+  snapshot->reused_slot_count = slab.reused_slot_count;
+  snapshot->retired_slot_count =
+      static_cast<std::uint64_t>(slab.quarantined_slots.size());
+  snapshot->wrapped_slot_count = slab.wrapped_slot_count;
+  return OBJC3_RUNTIME_REGISTRATION_STATUS_OK;
+}
+
+int objc3_runtime_copy_method_table_state_for_testing(
+    objc3_runtime_method_table_state_snapshot *snapshot) {
+  if (snapshot == nullptr) {
+    return OBJC3_RUNTIME_REGISTRATION_STATUS_INVALID_DESCRIPTOR;
+  }
+
+  RuntimeState &state = State();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  snapshot->indexed_method_list_count = state.indexed_method_list_count;
+  snapshot->indexed_method_entry_count = state.indexed_method_entry_count;
+  snapshot->unindexed_method_list_count = state.unindexed_method_list_count;
+  snapshot->method_table_slot_count = state.method_table_slot_count;
+  snapshot->method_table_probe_count = state.method_table_probe_count;
+  snapshot->method_list_scan_count = state.method_list_scan_count;
+  return OBJC3_RUNTIME_REGISTRATION_STATUS_OK;
+}
+
+int objc3_runtime_copy_task_executor_state_for_testing(
+    objc3_runtime_task_executor_state_snapshot *snapshot) {
+  if (snapshot == nullptr) {
+    return OBJC3_RUNTIME_REGISTRATION_STATUS_INVALID_DESCRIPTOR;
+  }
+
+  RuntimeTaskExecutor &executor = TaskExecutor();
+  std::lock_guard<std::mutex> lock(executor.registry_mutex);
+  snapshot->worker_count = executor.worker_count.load();
+  snapshot->spawned_task_count = executor.spawned_task_count.load();
+  snapshot->completed_task_count = executor.completed_task_count.load();
+  snapshot->in_flight_task_count = executor.in_flight_task_count.load();
+  snapshot->stolen_job_count = executor.stolen_job_count.load();
+  snapshot->live_task_handle_count =
+      static_cast<std::uint64_t>(executor.tasks_by_handle.size());
+  snapshot->live_task_group_count =
+      static_cast<std::uint64_t>(executor.groups_by_handle.size());
+  snapshot->serial_executor_count =
+      static_cast<std::uint64_t>(executor.serial_executors_by_tag.size());
+  return OBJC3_RUNTIME_REGISTRATION_STATUS_OK;
+}
+
+int objc3_runtime_copy_actor_executor_state_for_testing(
+    objc3_runtime_actor_executor_state_snapshot *snapshot) {
   if (snapshot == nullptr) {
     return OBJC3_RUNTIME_REGISTRATION_STATUS_INVALID_DESCRIPTOR;
   }
 
-  RuntimeState &state = State();
-  std::lock_guard<std::mutex> lock(state.mutex);
-  snapshot->realized_class_count =
-      static_cast<std::uint64_t>(state.realized_class_nodes.size());
-  snapshot->root_class_count = state.realized_root_class_count;
-  snapshot->metaclass_edge_count = state.realized_metaclass_edge_count;
-  snapshot->receiver_class_binding_count = state.receiver_class_binding_count;
-  snapshot->attached_category_count = state.realized_attached_category_count;
-  snapshot->protocol_conformance_edge_count =
-      state.realized_protocol_conformance_edge_count;
-  snapshot->live_instance_count = state.live_runtime_instance_count;
-  snapshot->last_allocated_receiver_identity =
-      state.last_allocated_runtime_instance_receiver;
-  snapshot->last_allocated_base_identity =
-      state.last_allocated_runtime_instance_base_identity;
-  snapshot->last_allocated_instance_size_bytes =
-      state.last_allocated_runtime_instance_size_bytes;
-  snapshot->last_realized_class_name =
-      StableCString(state.last_realized_class_name);
-  snapshot->last_realized_class_owner_identity =
-      StableCString(state.last_realized_class_owner_identity);
-  snapshot->last_realized_metaclass_owner_identity =
-      StableCString(state.last_realized_metaclass_owner_identity);
-  snapshot->last_attached_category_owner_identity =
-      StableCString(state.last_attached_category_owner_identity);
-  snapshot->last_attached_category_name =
-      StableCString(state.last_attached_category_name);
-  snapshot->last_allocated_class_name =
-      StableCString(state.last_allocated_runtime_instance_class_name);
+  *snapshot = objc3_runtime_actor_executor_state_snapshot{};
+  RuntimeTaskExecutor &executor = TaskExecutor();
+  std::lock_guard<std::mutex> lock(executor.registry_mutex);
+  const auto add_executor = [snapshot](const RuntimeSerialExecutor &serial) {
+    snapshot->executed_job_count += serial.executed_job_count.load();
+    snapshot->executor_turn_count += serial.turn_count.load();
+    snapshot->pending_job_count += serial.pending_job_count.load();
+  };
+  for (const auto &entry : executor.serial_executors_by_tag) {
+    add_executor(*entry.second);
+  }
+  for (const auto &entry : executor.actors_by_handle) {
+    const RuntimeActor &actor = *entry.second;
+    add_executor(actor.own_executor);
+    snapshot->sent_message_count += actor.sent_message_count.load();
+    snapshot->pending_mailbox_value_count += actor.mailbox_depth.load();
+  }
+  snapshot->actor_count =
+      static_cast<std::uint64_t>(executor.actors_by_handle.size());
+  snapshot->same_executor_hop_count = executor.same_executor_hop_count.load();
+  snapshot->inline_hop_count = executor.inline_hop_count.load();
+  snapshot->queued_hop_count = executor.queued_hop_count.load();
   return OBJC3_RUNTIME_REGISTRATION_STATUS_OK;
 }
 
@@ -4322,18 +10128,14 @@ int objc3_runtime_copy_realized_class_entry_for_testing(
   state.last_resolved_class_query_name.clear();
   state.last_resolved_class_query_owner_identity.clear();
   state.last_class_query_found = false;
-  const auto found = state.realized_class_node_indices_by_name.find(class_name);
-  if (found == state.realized_class_node_indices_by_name.end() ||
-      found->second.empty()) {
+  const RealizedClassNode *found =
+      FindFirstRealizedClassNodeByNameUnlocked(state, class_name);
+  if (found == nullptr) {
     return OBJC3_RUNTIME_REGISTRATION_STATUS_OK;
   }
-  const std::size_t node_index = found->second.front();
-  if (node_index >= state.realized_class_nodes.size()) {
-    return OBJC3_RUNTIME_REGISTRATION_STATUS_OK;
-  }
-  const RealizedClassNode &node = state.realized_class_nodes[node_index];
+  const RealizedClassNode &node = *found;
   state.last_class_query_found = true;
-  state.last_resolved_class_query_name = node.class_name;
+  state.last_resolved_class_query_name = RuntimeSymbolName(state, node.class_id);
   state.last_resolved_class_query_owner_identity = node.class_owner_identity;
   snapshot->found = 1;
   snapshot->base_identity = node.base_identity;
@@ -4354,7 +10156,7 @@ int objc3_runtime_copy_realized_class_entry_for_testing(
   snapshot->module_name = StableCString(node.module_name);
   snapshot->translation_unit_identity_key =
       StableCString(node.translation_unit_identity_key);
-  snapshot->class_name = StableCString(node.class_name);
+  snapshot->class_name = StableCString(RuntimeSymbolName(state, node.class_id));
   snapshot->class_owner_identity = StableCString(node.class_owner_identity);
   snapshot->metaclass_owner_identity = StableCString(node.metaclass_owner_identity);
   snapshot->super_class_owner_identity =
@@ -4398,6 +10200,9 @@ int objc3_runtime_copy_property_registry_state_for_testing(
   snapshot->property_lookup_cache_entry_count = 0;
   snapshot->property_lookup_cache_hit_count = 0;
   snapshot->property_lookup_cache_miss_count = 0;
+  snapshot->direct_access_property_count = 0;
+  snapshot->direct_access_get_count = 0;
+  snapshot->direct_access_set_count = 0;
   snapshot->last_query_found = 0;
   snapshot->last_query_inherited = 0;
   snapshot->last_query_used_cache = 0;
@@ -4420,6 +10225,8 @@ int objc3_runtime_copy_property_registry_state_for_testing(
           !accessor.setter_owner_identity.empty() ? 1u : 0u;
       snapshot->slot_backed_property_count +=
           accessor.ivar_descriptor != nullptr ? 1u : 0u;
+      snapshot->direct_access_property_count +=
+          accessor.direct_access != RuntimeDirectPropertyAccess::None ? 1u : 0u;
     }
   }
   snapshot->property_lookup_cache_entry_count =
@@ -4427,6 +10234,10 @@ int objc3_runtime_copy_property_registry_state_for_testing(
   snapshot->property_lookup_cache_hit_count = state.property_lookup_cache_hit_count;
   snapshot->property_lookup_cache_miss_count =
       state.property_lookup_cache_miss_count;
+  snapshot->direct_access_get_count =
+      state.direct_property_get_count.load(std::memory_order_relaxed);
+  snapshot->direct_access_set_count =
+      state.direct_property_set_count.load(std::memory_order_relaxed);
   snapshot->last_query_found = state.last_property_query_found ? 1 : 0;
   snapshot->last_query_inherited = state.last_property_query_inherited ? 1 : 0;
   snapshot->last_query_used_cache =
@@ -4457,6 +10268,7 @@ int objc3_runtime_copy_property_entry_for_testing(
   snapshot->setter_available = 0;
   snapshot->has_runtime_getter = 0;
   snapshot->has_runtime_setter = 0;
+  snapshot->direct_access = 0;
   snapshot->base_identity = 0;
   snapshot->slot_index = 0;
   snapshot->offset_bytes = 0;
@@ -4500,17 +10312,13 @@ int objc3_runtime_copy_property_entry_for_testing(
     return OBJC3_RUNTIME_REGISTRATION_STATUS_OK;
   }
 
-  const auto found = state.realized_class_node_indices_by_name.find(class_name);
-  if (found == state.realized_class_node_indices_by_name.end() ||
-      found->second.empty()) {
-    return OBJC3_RUNTIME_REGISTRATION_STATUS_OK;
-  }
-  const std::size_t node_index = found->second.front();
-  if (node_index >= state.realized_class_nodes.size()) {
+  const RealizedClassNode *found =
+      FindFirstRealizedClassNodeByNameUnlocked(state, class_name);
+  if (found == nullptr) {
     return OBJC3_RUNTIME_REGISTRATION_STATUS_OK;
   }
 
-  const RealizedClassNode &start_node = state.realized_class_nodes[node_index];
+  const RealizedClassNode &start_node = *found;
   const RealizedClassNode *resolved_node = nullptr;
   bool inherited = false;
   bool used_cache = false;
@@ -4526,7 +10334,8 @@ int objc3_runtime_copy_property_entry_for_testing(
 
   state.last_property_query_found = true;
   state.last_property_query_inherited = inherited;
-  state.last_reflected_property_class_name = resolved_node->class_name;
+  state.last_reflected_property_class_name =
+      RuntimeSymbolName(state, resolved_node->class_id);
   state.last_reflected_property_owner_identity =
       accessor->property_descriptor->declaration_owner_identity != nullptr
           ? accessor->property_descriptor->declaration_owner_identity
@@ -4539,6 +10348,7 @@ int objc3_runtime_copy_property_entry_for_testing(
   snapshot->has_runtime_getter = 1;
   snapshot->has_runtime_setter =
       !accessor->setter_owner_identity.empty() ? 1 : 0;
+  snapshot->direct_access = static_cast<int>(accessor->direct_access);
   snapshot->base_identity = resolved_node->base_identity;
   snapshot->slot_index =
       accessor->ivar_descriptor != nullptr
@@ -4683,17 +10493,13 @@ int objc3_runtime_copy_protocol_conformance_query_for_testing(
   snapshot->protocol_found = ProtocolExistsByNameUnlocked(state, protocol_name) ? 1 : 0;
   state.last_protocol_query_protocol_found = snapshot->protocol_found != 0;
 
-  const auto found = state.realized_class_node_indices_by_name.find(class_name);
-  if (found == state.realized_class_node_indices_by_name.end() ||
-      found->second.empty()) {
-    return OBJC3_RUNTIME_REGISTRATION_STATUS_OK;
-  }
-  const std::size_t node_index = found->second.front();
-  if (node_index >= state.realized_class_nodes.size()) {
+  const RealizedClassNode *found =
+      FindFirstRealizedClassNodeByNameUnlocked(state, class_name);
+  if (found == nullptr) {
     return OBJC3_RUNTIME_REGISTRATION_STATUS_OK;
   }
 
-  const RealizedClassNode &node = state.realized_class_nodes[node_index];
+  const RealizedClassNode &node = *found;
   snapshot->class_found = 1;
   state.last_protocol_query_class_found = true;
   snapshot->attached_category_count =
@@ -4717,6 +10523,45 @@ int objc3_runtime_copy_protocol_conformance_query_for_testing(
   return OBJC3_RUNTIME_REGISTRATION_STATUS_OK;
 }
 
+int objc3_runtime_receiver_conforms_to_protocol_i32(int receiver,
+                                                    const char *protocol_name) {
+  if (protocol_name == nullptr || protocol_name[0] == '\0') {
+    return 0;
+  }
+  RuntimeState &state = State();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  std::uint64_t base_identity = 0;
+  std::uint64_t normalized_receiver_identity = 0;
+  DispatchFamily family = DispatchFamily::Invalid;
+  if (!DecodeReceiverIdentity(state, receiver, base_identity, family,
+                              normalized_receiver_identity)) {
+    return 0;
+  }
+  const RealizedClassNode *node =
+      FindRealizedClassNodeByBaseIdentityUnlocked(state, base_identity);
+  if (node == nullptr) {
+    return 0;
+  }
+  const RealizedClassConformance &conformance =
+      EnsureRealizedClassConformanceUnlocked(state, *node);
+  if (!conformance.walkable) {
+    std::uint64_t visited_protocol_count = 0;
+    std::string matched_protocol_owner_identity;
+    std::string matched_attachment_owner_identity;
+    return WalkRealizedClassProtocolConformanceUnlocked(
+               state, node, protocol_name, visited_protocol_count,
+               matched_protocol_owner_identity,
+               matched_attachment_owner_identity)
+               ? 1
+               : 0;
+  }
+  ++state.conformance_bitset_test_count;
+  return RealizedClassConformsToProtocolId(
+             conformance, FindRuntimeSymbolUnlocked(state, protocol_name))
+             ? 1
+             : 0;
+}
+
 int objc3_runtime_copy_object_model_query_state_for_testing(
     objc3_runtime_object_model_query_state_snapshot *snapshot) {
   if (snapshot == nullptr) {
@@ -4752,7 +10597,7 @@ int objc3_runtime_copy_object_model_query_state_for_testing(
   snapshot->protocol_conformance_edge_count =
       state.realized_protocol_conformance_edge_count;
   snapshot->method_cache_entry_count =
-      static_cast<std::uint64_t>(state.method_cache.size());
+      CurrentMethodCacheEntryCountUnlocked(state);
   snapshot->last_class_query_found = state.last_class_query_found ? 1 : 0;
   snapshot->last_property_query_found = state.last_property_query_found ? 1 : 0;
   snapshot->last_property_query_inherited =
@@ -4801,10 +10646,10 @@ int objc3_runtime_copy_memory_management_state_for_testing(
   snapshot->live_runtime_instance_count = 0;
   snapshot->weak_target_count = 0;
   snapshot->weak_slot_ref_count = 0;
-  snapshot->autoreleasepool_depth =
-      static_cast<std::uint64_t>(g_runtime_autoreleasepool_frames.size());
+  snapshot->autoreleasepool_depth = g_runtime_autorelease_pages.pool_depth;
   snapshot->autoreleasepool_max_depth = g_runtime_autoreleasepool_max_depth;
-  snapshot->queued_autorelease_value_count = CountQueuedAutoreleaseValues();
+  snapshot->queued_autorelease_value_count =
+      g_runtime_autorelease_pages.queued_pool_value_count;
   snapshot->drained_autorelease_value_count =
       g_runtime_autoreleasepool_drained_value_count;
   snapshot->last_autoreleased_value = g_runtime_last_autoreleased_value;
@@ -4814,11 +10659,76 @@ int objc3_runtime_copy_memory_management_state_for_testing(
   RuntimeState &state = State();
   std::lock_guard<std::mutex> lock(state.mutex);
   snapshot->live_runtime_instance_count = state.live_runtime_instance_count;
-  snapshot->weak_target_count =
-      static_cast<std::uint64_t>(state.weak_slot_refs_by_target_receiver.size());
-  for (const auto &entry : state.weak_slot_refs_by_target_receiver) {
+  for (RuntimeWeakSideTableStripe &stripe : state.weak_side_table.stripes) {
+    std::lock_guard<std::mutex> stripe_lock(stripe.mutex);
+    snapshot->weak_target_count +=
+        static_cast<std::uint64_t>(stripe.referrers_by_target.size());
     snapshot->weak_slot_ref_count +=
-        static_cast<std::uint64_t>(entry.second.size());
+        static_cast<std::uint64_t>(stripe.referrer_index_by_slot.size());
+  }
+  return OBJC3_RUNTIME_REGISTRATION_STATUS_OK;
+}
+
+int objc3_runtime_copy_autorelease_page_state_for_testing(
+    objc3_runtime_autorelease_page_state_snapshot *snapshot) {
+  if (snapshot == nullptr) {
+    return OBJC3_RUNTIME_REGISTRATION_STATUS_INVALID_DESCRIPTOR;
+  }
+
+  const RuntimeAutoreleasePageStack &stack = g_runtime_autorelease_pages;
+  snapshot->page_size_bytes = kRuntimeAutoreleasePageBytes;
+  snapshot->entries_per_page = RuntimeAutoreleasePage::kEntryCapacity;
+  snapshot->allocated_page_count = stack.allocated_page_count;
+  snapshot->page_allocation_count = stack.page_allocation_count;
+  snapshot->live_entry_count = stack.position;
+  snapshot->high_water_entry_count = stack.high_water_position;
+  return OBJC3_RUNTIME_REGISTRATION_STATUS_OK;
+}
+
+int objc3_runtime_copy_release_batch_state_for_testing(
+    objc3_runtime_release_batch_state_snapshot *snapshot) {
+  if (snapshot == nullptr) {
+    return OBJC3_RUNTIME_REGISTRATION_STATUS_INVALID_DESCRIPTOR;
+  }
+
+  RuntimeState &state = State();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  snapshot->release_batch_count = state.release_batch_count;
+  snapshot->batched_release_value_count = state.batched_release_value_count;
+  snapshot->coalesced_release_value_count =
+      state.coalesced_release_value_count;
+  snapshot->cascade_release_count = state.cascade_release_count;
+  snapshot->max_pending_release_count = state.max_pending_release_count;
+  snapshot->pending_release_count =
+      static_cast<std::uint64_t>(state.pending_releases.size());
+  return OBJC3_RUNTIME_REGISTRATION_STATUS_OK;
+}
+
+int objc3_runtime_copy_weak_side_table_state_for_testing(
+    objc3_runtime_weak_side_table_state_snapshot *snapshot) {
+  if (snapshot == nullptr) {
+    return OBJC3_RUNTIME_REGISTRATION_STATUS_INVALID_DESCRIPTOR;
+  }
+
+  snapshot->stripe_count = kRuntimeWeakSideTableStripeCount;
+  snapshot->weak_target_count = 0;
+  snapshot->weak_slot_ref_count = 0;
+  snapshot->occupied_stripe_count = 0;
+  snapshot->max_stripe_slot_ref_count = 0;
+
+  RuntimeState &state = State();
+  for (RuntimeWeakSideTableStripe &stripe : state.weak_side_table.stripes) {
+    std::lock_guard<std::mutex> stripe_lock(stripe.mutex);
+    const std::uint64_t slot_ref_count =
+        static_cast<std::uint64_t>(stripe.referrer_index_by_slot.size());
+    snapshot->weak_target_count +=
+        static_cast<std::uint64_t>(stripe.referrers_by_target.size());
+    snapshot->weak_slot_ref_count += slot_ref_count;
+    if (slot_ref_count != 0u) {
+      ++snapshot->occupied_stripe_count;
+    }
+    snapshot->max_stripe_slot_ref_count =
+        std::max(snapshot->max_stripe_slot_ref_count, slot_ref_count);
   }
   return OBJC3_RUNTIME_REGISTRATION_STATUS_OK;
 }
@@ -4829,13 +10739,16 @@ int objc3_runtime_copy_arc_debug_state_for_testing(
     return OBJC3_RUNTIME_REGISTRATION_STATUS_INVALID_DESCRIPTOR;
   }
 
-  snapshot->retain_call_count = g_runtime_arc_debug_retain_call_count;
-  snapshot->release_call_count = g_runtime_arc_debug_release_call_count;
-  snapshot->autorelease_call_count = g_runtime_arc_debug_autorelease_call_count;
+  snapshot->retain_call_count =
+      RuntimeMetricSinceThreadReset(RuntimeMetric::Retain);
+  snapshot->release_call_count =
+      RuntimeMetricSinceThreadReset(RuntimeMetric::Release);
+  snapshot->autorelease_call_count =
+      RuntimeMetricSinceThreadReset(RuntimeMetric::Autorelease);
   snapshot->autoreleasepool_push_count =
-      g_runtime_arc_debug_autoreleasepool_push_count;
+      RuntimeMetricSinceThreadReset(RuntimeMetric::AutoreleasePoolPush);
   snapshot->autoreleasepool_pop_count =
-      g_runtime_arc_debug_autoreleasepool_pop_count;
+      RuntimeMetricSinceThreadReset(RuntimeMetric::AutoreleasePoolPop);
   snapshot->current_property_read_count =
       g_runtime_arc_debug_current_property_read_count;
   snapshot->current_property_write_count =
@@ -4881,15 +10794,20 @@ int objc3_runtime_copy_block_arc_runtime_abi_snapshot_for_testing(
   snapshot->public_runtime_header_unchanged = 1;
   snapshot->deterministic = 1;
   snapshot->live_runtime_block_handle_count = 0;
-  snapshot->block_promote_call_count = g_runtime_block_promote_call_count;
-  snapshot->block_invoke_call_count = g_runtime_block_invoke_call_count;
-  snapshot->retain_call_count = g_runtime_arc_debug_retain_call_count;
-  snapshot->release_call_count = g_runtime_arc_debug_release_call_count;
-  snapshot->autorelease_call_count = g_runtime_arc_debug_autorelease_call_count;
+  snapshot->block_promote_call_count =
+      RuntimeMetricSinceThreadReset(RuntimeMetric::BlockPromote);
+  snapshot->block_invoke_call_count =
+      RuntimeMetricSinceThreadReset(RuntimeMetric::BlockInvoke);
+  snapshot->retain_call_count =
+      RuntimeMetricSinceThreadReset(RuntimeMetric::Retain);
+  snapshot->release_call_count =
+      RuntimeMetricSinceThreadReset(RuntimeMetric::Release);
+  snapshot->autorelease_call_count =
+      RuntimeMetricSinceThreadReset(RuntimeMetric::Autorelease);
   snapshot->autoreleasepool_push_count =
-      g_runtime_arc_debug_autoreleasepool_push_count;
+      RuntimeMetricSinceThreadReset(RuntimeMetric::AutoreleasePoolPush);
   snapshot->autoreleasepool_pop_count =
-      g_runtime_arc_debug_autoreleasepool_pop_count;
+      RuntimeMetricSinceThreadReset(RuntimeMetric::AutoreleasePoolPop);
   snapshot->current_property_read_count =
       g_runtime_arc_debug_current_property_read_count;
   snapshot->current_property_write_count =
@@ -4945,7 +10863,7 @@ int objc3_runtime_copy_block_arc_runtime_abi_snapshot_for_testing(
   RuntimeState &state = State();
   std::lock_guard<std::mutex> lock(state.mutex);
   snapshot->live_runtime_block_handle_count =
-      static_cast<std::uint64_t>(state.runtime_blocks_by_handle.size());
+      state.runtime_block_slab.live_block_count;
   return OBJC3_RUNTIME_REGISTRATION_STATUS_OK;
 }
 
@@ -4993,29 +10911,50 @@ int objc3_runtime_copy_async_continuation_state_for_testing(
     return OBJC3_RUNTIME_REGISTRATION_STATUS_INVALID_DESCRIPTOR;
   }
 
-  snapshot->allocation_call_count =
-      g_runtime_async_continuation_allocation_call_count;
-  snapshot->handoff_call_count =
-      g_runtime_async_continuation_handoff_call_count;
-  snapshot->resume_call_count = g_runtime_async_continuation_resume_call_count;
+  const RuntimeAsyncRuntime &async = AsyncRuntime();
+  snapshot->allocation_call_count = async.allocation_call_count.load();
+  snapshot->handoff_call_count = async.handoff_call_count.load();
+  snapshot->resume_call_count = async.resume_call_count.load();
   snapshot->live_continuation_handle_count =
-      g_runtime_async_live_continuation_handles.size();
+      async.live_continuation_count.load();
   snapshot->last_allocated_continuation_handle =
-      g_runtime_async_continuation_last_allocated_handle;
+      async.last_allocated_handle.load();
   snapshot->last_allocated_resume_entry_tag =
-      g_runtime_async_continuation_last_allocated_resume_entry_tag;
+      async.last_allocated_resume_entry_tag.load();
   snapshot->last_allocated_executor_tag =
-      g_runtime_async_continuation_last_allocated_executor_tag;
-  snapshot->last_handoff_continuation_handle =
-      g_runtime_async_continuation_last_handoff_handle;
-  snapshot->last_handoff_executor_tag =
-      g_runtime_async_continuation_last_handoff_executor_tag;
-  snapshot->last_resume_continuation_handle =
-      g_runtime_async_continuation_last_resume_handle;
-  snapshot->last_resume_result_value =
-      g_runtime_async_continuation_last_resume_result_value;
-  snapshot->last_resume_return_value =
-      g_runtime_async_continuation_last_resume_return_value;
+      async.last_allocated_executor_tag.load();
+  snapshot->last_handoff_continuation_handle = async.last_handoff_handle.load();
+  snapshot->last_handoff_executor_tag = async.last_handoff_executor_tag.load();
+  snapshot->last_resume_continuation_handle = async.last_resume_handle.load();
+  snapshot->last_resume_result_value = async.last_resume_result_value.load();
+  snapshot->last_resume_return_value = async.last_resume_return_value.load();
+  return OBJC3_RUNTIME_REGISTRATION_STATUS_OK;
+}
+
+int objc3_runtime_copy_async_frame_state_for_testing(
+    objc3_runtime_async_frame_state_snapshot *snapshot) {
+  if (snapshot == nullptr) {
+    return OBJC3_RUNTIME_REGISTRATION_STATUS_INVALID_DESCRIPTOR;
+  }
+
+  const RuntimeAsyncRuntime &async = AsyncRuntime();
+  snapshot->live_frame_count = async.live_frame_count.load();
+  snapshot->live_frame_bytes = async.live_frame_bytes.load();
+  snapshot->pooled_frame_bytes = async.pooled_frame_bytes.load();
+  snapshot->suspended_frame_count = async.suspended_frame_count.load();
+  snapshot->suspended_frame_bytes = async.suspended_frame_bytes.load();
+  snapshot->suspension_count = async.suspension_count.load();
+  snapshot->inline_await_count = async.inline_await_count.load();
+  snapshot->completed_frame_count = async.completed_frame_count.load();
+  snapshot->live_continuation_count = async.live_continuation_count.load();
+  snapshot->continuation_capacity =
+      static_cast<std::uint64_t>(async.chunk_count.load())
+      << kRuntimeAsyncContinuationChunkBits;
+  snapshot->continuation_record_bytes = sizeof(RuntimeAsyncContinuation);
+  snapshot->resumed_continuation_count =
+      async.resumed_continuation_count.load();
+  snapshot->cancelled_continuation_count =
+      async.cancelled_continuation_count.load();
   return OBJC3_RUNTIME_REGISTRATION_STATUS_OK;
 }
 
@@ -5322,10 +11261,10 @@ int objc3_runtime_replay_registered_images_for_testing(void) {
     }
 
     const RegisteredImageMetadata &record = found->second;
-    const int status = RegisterImageUnlocked(state,
-                                             record.registration_table->image_descriptor,
-                                             record.registration_table, false,
-                                             true);
+    const int status = RegisterImageUnlocked(
+        state, record.registration_table->image_descriptor,
+        record.registration_table, record.prebuilt_image_words,
+        record.prebuilt_image_byte_count, false, true);
     if (status != OBJC3_RUNTIME_REGISTRATION_STATUS_OK) {
       ClearLiveRegistrationStateUnlocked(state);
       state.last_reset_cleared_image_local_init_state_count =
@@ -5383,15 +11322,22 @@ extern "C" int objc3_runtime_read_current_property_i32(void) {
     return 0;
   }
   RuntimeState &state = State();
+  if (UsesWeakRuntimeHooks(*frame->runtime_property_accessor)) {
+    const int result = LoadWeakRuntimeManagedPropertyValue(
+        state, frame->receiver, *frame->runtime_property_accessor);
+    g_runtime_arc_debug_last_property_read_value = result;
+    return result;
+  }
   std::lock_guard<std::mutex> lock(state.mutex);
-  const auto instance_it = state.runtime_instances_by_receiver.find(frame->receiver);
-  if (instance_it == state.runtime_instances_by_receiver.end()) {
+  RuntimeInstanceRecord *instance =
+      FindRuntimeInstanceUnlocked(state, frame->receiver);
+  if (instance == nullptr) {
     g_runtime_arc_debug_last_property_read_value = 0;
     return 0;
   }
   int value = 0;
   const int result = ReadRuntimeManagedPropertyValueUnlocked(
-             state, instance_it->second, *frame->runtime_property_accessor, value)
+             state, *instance, *frame->runtime_property_accessor, value)
                          ? value
                          : 0;
   g_runtime_arc_debug_last_property_read_value = result;
@@ -5409,12 +11355,13 @@ extern "C" void objc3_runtime_write_current_property_i32(int value) {
   }
   RuntimeState &state = State();
   std::lock_guard<std::mutex> lock(state.mutex);
-  const auto instance_it = state.runtime_instances_by_receiver.find(frame->receiver);
-  if (instance_it == state.runtime_instances_by_receiver.end()) {
+  RuntimeInstanceRecord *instance =
+      FindRuntimeInstanceUnlocked(state, frame->receiver);
+  if (instance == nullptr) {
     return;
   }
   (void)WriteRuntimeManagedPropertyValueUnlocked(
-      state, instance_it->second, *frame->runtime_property_accessor, value);
+      state, *instance, *frame->runtime_property_accessor, value);
 }
 
 extern "C" int objc3_runtime_exchange_current_property_i32(int value) {
@@ -5429,14 +11376,15 @@ extern "C" int objc3_runtime_exchange_current_property_i32(int value) {
   }
   RuntimeState &state = State();
   std::lock_guard<std::mutex> lock(state.mutex);
-  const auto instance_it = state.runtime_instances_by_receiver.find(frame->receiver);
-  if (instance_it == state.runtime_instances_by_receiver.end()) {
+  RuntimeInstanceRecord *instance =
+      FindRuntimeInstanceUnlocked(state, frame->receiver);
+  if (instance == nullptr) {
     g_runtime_arc_debug_last_property_exchange_previous_value = 0;
     return 0;
   }
   int previous_value = 0;
   const int result = ExchangeRuntimeManagedPropertyValueUnlocked(
-             state, instance_it->second, *frame->runtime_property_accessor, value,
+             state, *instance, *frame->runtime_property_accessor, value,
              previous_value)
                          ? previous_value
                          : 0;
@@ -5453,19 +11401,15 @@ extern "C" int objc3_runtime_bind_current_property_context_for_testing(
 
   RuntimeState &state = State();
   std::lock_guard<std::mutex> lock(state.mutex);
-  const auto instance_it = state.runtime_instances_by_receiver.find(receiver);
-  const auto found = state.realized_class_node_indices_by_name.find(class_name);
-  if (instance_it == state.runtime_instances_by_receiver.end() ||
-      found == state.realized_class_node_indices_by_name.end() ||
-      found->second.empty()) {
-    return OBJC3_RUNTIME_REGISTRATION_STATUS_INVALID_DESCRIPTOR;
-  }
-  const std::size_t node_index = found->second.front();
-  if (node_index >= state.realized_class_nodes.size()) {
+  const RuntimeInstanceRecord *instance =
+      FindRuntimeInstanceUnlocked(state, receiver);
+  const RealizedClassNode *found =
+      FindFirstRealizedClassNodeByNameUnlocked(state, class_name);
+  if (instance == nullptr || found == nullptr) {
     return OBJC3_RUNTIME_REGISTRATION_STATUS_INVALID_DESCRIPTOR;
   }
 
-  const RealizedClassNode &start_node = state.realized_class_nodes[node_index];
+  const RealizedClassNode &start_node = *found;
   const RealizedClassNode *resolved_node = nullptr;
   bool inherited = false;
   bool used_cache = false;
@@ -5481,7 +11425,7 @@ extern "C" int objc3_runtime_bind_current_property_context_for_testing(
   g_runtime_testing_dispatch_frame = RuntimeDispatchFrame{};
   g_runtime_testing_dispatch_frame.receiver = receiver;
   g_runtime_testing_dispatch_frame.base_identity =
-      instance_it->second.base_identity;
+      instance->base_identity;
   g_runtime_testing_dispatch_frame.runtime_property_accessor = accessor;
   g_runtime_has_testing_dispatch_frame = true;
   RecordArcDebugPropertyContext(&g_runtime_testing_dispatch_frame);
@@ -5572,46 +11516,223 @@ extern "C" int objc3_runtime_catch_matches_error_i32(int error_value,
 
 extern "C" int objc3_runtime_allocate_async_continuation_i32(
     int resume_entry_tag, int executor_tag) {
-  ++g_runtime_async_continuation_allocation_call_count;
-  const int handle = g_runtime_async_continuation_next_handle++;
-  g_runtime_async_continuation_last_allocated_handle = handle;
-  g_runtime_async_continuation_last_allocated_resume_entry_tag =
-      resume_entry_tag;
-  g_runtime_async_continuation_last_allocated_executor_tag = executor_tag;
-  g_runtime_async_live_continuation_handles.insert(handle);
+  RuntimeAsyncRuntime &async = AsyncRuntime();
+  async.allocation_call_count.fetch_add(1u, std::memory_order_relaxed);
+  std::uint32_t index = 0;
+  int handle = 0;
+  if (AcquireRuntimeAsyncContinuation(async, index)) {
+    RuntimeAsyncContinuation &continuation =
+        RuntimeAsyncContinuationAt(async, index);
+    continuation.resume_entry_tag = resume_entry_tag;
+    continuation.executor_tag = executor_tag;
+    continuation.frame = nullptr;
+    const std::uint32_t word =
+        (continuation.word.load(std::memory_order_relaxed) &
+         ~kRuntimeAsyncContinuationStateMask) |
+        kRuntimeAsyncContinuationPending;
+    continuation.word.store(word, std::memory_order_release);
+    async.live_continuation_count.fetch_add(1u, std::memory_order_relaxed);
+    handle = RuntimeAsyncContinuationHandle(index, word);
+  }
+  async.last_allocated_handle.store(handle, std::memory_order_relaxed);
+  async.last_allocated_resume_entry_tag.store(resume_entry_tag,
+                                              std::memory_order_relaxed);
+  async.last_allocated_executor_tag.store(executor_tag,
+                                          std::memory_order_relaxed);
   return handle;
 }
 
 extern "C" int objc3_runtime_handoff_async_continuation_to_executor_i32(
     int continuation_handle, int executor_tag) {
-  ++g_runtime_async_continuation_handoff_call_count;
-  g_runtime_async_continuation_last_handoff_handle = continuation_handle;
-  g_runtime_async_continuation_last_handoff_executor_tag = executor_tag;
-  if (continuation_handle == 0 ||
-      g_runtime_async_live_continuation_handles.find(continuation_handle) ==
-          g_runtime_async_live_continuation_handles.end()) {
+  RuntimeAsyncRuntime &async = AsyncRuntime();
+  async.handoff_call_count.fetch_add(1u, std::memory_order_relaxed);
+  async.last_handoff_handle.store(continuation_handle,
+                                  std::memory_order_relaxed);
+  async.last_handoff_executor_tag.store(executor_tag,
+                                        std::memory_order_relaxed);
+  std::uint32_t index = 0;
+  std::uint32_t generation = 0;
+  if (!DecodeRuntimeAsyncContinuationHandle(async, continuation_handle, index,
+                                            generation)) {
+    return 0;
+  }
+  RuntimeAsyncContinuation &continuation =
+      RuntimeAsyncContinuationAt(async, index);
+  if (!IsRuntimeAsyncContinuationWord(
+          continuation.word.load(std::memory_order_acquire), generation,
+          kRuntimeAsyncContinuationPending)) {
     return 0;
   }
+  continuation.executor_tag = executor_tag;
   return continuation_handle;
 }
 
+// A pending continuation resumes inline and simply returns the value; a
+// parked one also reschedules its frame, which reads the value on its next
+// step. Stale or already-finished handles return 0.
 extern "C" int objc3_runtime_resume_async_continuation_i32(
     int continuation_handle, int result_value) {
-  ++g_runtime_async_continuation_resume_call_count;
-  g_runtime_async_continuation_last_resume_handle = continuation_handle;
-  g_runtime_async_continuation_last_resume_result_value = result_value;
-  const auto found =
-      g_runtime_async_live_continuation_handles.find(continuation_handle);
-  if (continuation_handle == 0 ||
-      found == g_runtime_async_live_continuation_handles.end()) {
-    g_runtime_async_continuation_last_resume_return_value = 0;
+  RuntimeAsyncRuntime &async = AsyncRuntime();
+  async.resume_call_count.fetch_add(1u, std::memory_order_relaxed);
+  async.last_resume_handle.store(continuation_handle,
+                                 std::memory_order_relaxed);
+  async.last_resume_result_value.store(result_value,
+                                       std::memory_order_relaxed);
+  RuntimeAsyncFrame *frame = nullptr;
+  if (!FinishRuntimeAsyncContinuation(async, continuation_handle,
+                                      kRuntimeAsyncContinuationResumed,
+                                      frame)) {
+    async.last_resume_return_value.store(0, std::memory_order_relaxed);
     return 0;
   }
-  g_runtime_async_live_continuation_handles.erase(found);
-  g_runtime_async_continuation_last_resume_return_value = result_value;
+  async.resumed_continuation_count.fetch_add(1u, std::memory_order_relaxed);
+  async.last_resume_return_value.store(result_value,
+                                       std::memory_order_relaxed);
+  if (frame != nullptr) {
+    RuntimeAsyncFrameSlotsOf(frame)->value = result_value;
+    ScheduleRuntimeAsyncFrame(TaskExecutor(), frame);
+  }
   return result_value;
 }
 
+// A cancelled parked frame resumes with 0 and, when it runs as a task, with
+// that task marked cancelled.
+extern "C" int objc3_runtime_cancel_async_continuation_i32(
+    int continuation_handle) {
+  RuntimeAsyncRuntime &async = AsyncRuntime();
+  RuntimeAsyncFrame *frame = nullptr;
+  if (!FinishRuntimeAsyncContinuation(async, continuation_handle,
+                                      kRuntimeAsyncContinuationCancelled,
+                                      frame)) {
+    return 0;
+  }
+  async.cancelled_continuation_count.fetch_add(1u, std::memory_order_relaxed);
+  if (frame != nullptr) {
+    RuntimeAsyncFrameSlotsOf(frame)->value = 0;
+    if (frame->task != nullptr) {
+      frame->task->cancelled.store(true, std::memory_order_relaxed);
+    }
+    ScheduleRuntimeAsyncFrame(TaskExecutor(), frame);
+  }
+  return 1;
+}
+
+extern "C" void *objc3_runtime_allocate_async_frame(int (*resume)(void *),
+                                                    std::uint64_t slot_bytes) {
+  if (resume == nullptr ||
+      slot_bytes < sizeof(RuntimeAsyncFrameSlots)) {
+    return nullptr;
+  }
+  return AllocateRuntimeAsyncFrame(AsyncRuntime(), resume, slot_bytes);
+}
+
+// Synchronous entry: runs the frame's first step on the calling thread and,
+// if it suspends, helps the pool until a later step completes it. Consumes
+// the frame.
+extern "C" int objc3_runtime_run_async_frame_i32(void *slots) {
+  if (slots == nullptr) {
+    return 0;
+  }
+  RuntimeTaskExecutor &executor = TaskExecutor();
+  RuntimeAsyncFrame *const frame = RuntimeAsyncFrameFromSlots(slots);
+  StepRuntimeAsyncFrame(executor, frame);
+  if (frame->state.load(std::memory_order_acquire) !=
+      kRuntimeAsyncFrameCompleted) {
+    WaitForRuntimeTasks(executor, [frame]() {
+      return frame->state.load(std::memory_order_acquire) ==
+             kRuntimeAsyncFrameCompleted;
+    });
+  }
+  const int result = RuntimeAsyncFrameSlotsOf(frame)->value;
+  ReleaseRuntimeAsyncFrame(AsyncRuntime(), frame);
+  return result;
+}
+
+// Emitted at each await after the awaited value is stored in the frame.
+// Returns 1 when the frame was handed to `executor_tag`'s serial executor,
+// in which case the caller must return without touching the frame; returns
+// 0 when the await can continue inline on the current thread.
+extern "C" int objc3_runtime_await_async_frame_i32(void *slots,
+                                                   int executor_tag) {
+  RuntimeAsyncRuntime &async = AsyncRuntime();
+  RuntimeTaskExecutor &executor = TaskExecutor();
+  if (slots == nullptr || !IsRuntimeSerialExecutorTag(executor_tag)) {
+    async.inline_await_count.fetch_add(1u, std::memory_order_relaxed);
+    return 0;
+  }
+  RuntimeSerialExecutor &serial =
+      RuntimeSerialExecutorForTag(executor, executor_tag);
+  if (g_runtime_current_serial_executor == &serial) {
+    async.inline_await_count.fetch_add(1u, std::memory_order_relaxed);
+    return 0;
+  }
+  RuntimeAsyncFrame *const frame = RuntimeAsyncFrameFromSlots(slots);
+  frame->serial = &serial;
+  MarkRuntimeAsyncFrameSuspended(async, frame);
+  ScheduleRuntimeAsyncFrame(executor, frame);
+  return 1;
+}
+
+// Parks the frame on a pending continuation until another thread resumes or
+// cancels it; the resumed value lands in the frame's value slot. Returns 1
+// once parked, in which case the caller must return without touching the
+// frame, and 0 for stale handles.
+extern "C" int objc3_runtime_park_async_frame_i32(void *slots,
+                                                  int continuation_handle) {
+  RuntimeAsyncRuntime &async = AsyncRuntime();
+  std::uint32_t index = 0;
+  std::uint32_t generation = 0;
+  if (slots == nullptr ||
+      !DecodeRuntimeAsyncContinuationHandle(async, continuation_handle, index,
+                                            generation)) {
+    return 0;
+  }
+  RuntimeAsyncContinuation &continuation =
+      RuntimeAsyncContinuationAt(async, index);
+  std::uint32_t word = continuation.word.load(std::memory_order_acquire);
+  if (!IsRuntimeAsyncContinuationWord(word, generation,
+                                      kRuntimeAsyncContinuationPending)) {
+    return 0;
+  }
+  RuntimeAsyncFrame *const frame = RuntimeAsyncFrameFromSlots(slots);
+  frame->serial =
+      IsRuntimeSerialExecutorTag(continuation.executor_tag)
+          ? &RuntimeSerialExecutorForTag(TaskExecutor(),
+                                         continuation.executor_tag)
+          : nullptr;
+  continuation.frame = frame;
+  MarkRuntimeAsyncFrameSuspended(async, frame);
+  // Publishing the parked state hands the frame to any resuming thread. A
+  // cancel that finished the pending record first leaves the frame running.
+  if (!continuation.word.compare_exchange_strong(
+          word,
+          (word & ~kRuntimeAsyncContinuationStateMask) |
+              kRuntimeAsyncContinuationParked,
+          std::memory_order_acq_rel, std::memory_order_acquire)) {
+    frame->state.store(kRuntimeAsyncFrameRunning, std::memory_order_relaxed);
+    async.suspended_frame_count.fetch_sub(1u, std::memory_order_relaxed);
+    async.suspended_frame_bytes.fetch_sub(frame->block_bytes,
+                                          std::memory_order_relaxed);
+    async.suspension_count.fetch_sub(1u, std::memory_order_relaxed);
+    frame->serial = nullptr;
+    return 0;
+  }
+  return 1;
+}
+
+// Runs the frame as a task on `executor_tag`; the task completes with the
+// frame's return value and consumes the frame.
+extern "C" int objc3_runtime_spawn_async_frame_task_i32(int task_kind,
+                                                        void *slots,
+                                                        int executor_tag) {
+  if (slots == nullptr || (task_kind != kRuntimeTaskKindChild &&
+                           task_kind != kRuntimeTaskKindDetached)) {
+    return 0;
+  }
+  return SpawnRuntimeTask(TaskExecutor(), task_kind, nullptr, 0, 0,
+                          RuntimeAsyncFrameFromSlots(slots), executor_tag);
+}
+
 // live task runtime anchor: the supported Part 7 task slice now
 // executes through this private helper cluster and publishes deterministic
 // snapshot state for linked runtime probes without widening the public ABI.
@@ -5621,6 +11742,25 @@ extern "C" int objc3_runtime_resume_async_continuation_i32(
 // live cleanup/runtime integration anchor: linked Part 8 probes now
 // also execute through this same helper cluster while emitted cleanup/resource
 // calls remain ordinary lowered function calls in the compiled module body.
+// lowered task-group anchor: block-bodied lowered task helpers spawn their
+// promoted bodies into one task group per async frame, or per thread outside
+// one. The frame joins its group when it finishes.
+RuntimeTaskGroup *LoweredRuntimeTaskGroup(RuntimeTaskExecutor &executor,
+                                          bool open) {
+  int &handle = g_runtime_current_async_frame != nullptr
+                    ? g_runtime_current_async_frame->task_group_handle
+                    : g_runtime_lowered_task_group_handle;
+  RuntimeTaskGroup *group =
+      handle != 0 ? FindRuntimeTaskGroup(executor, handle) : nullptr;
+  if (group == nullptr && open) {
+    // Children run on the global pool, so a caller that holds a serial
+    // executor can still wait on them.
+    handle = objc3_runtime_create_task_group_i32(kRuntimeGlobalExecutorTag);
+    group = FindRuntimeTaskGroup(executor, handle);
+  }
+  return group;
+}
+
 extern "C" int objc3_runtime_spawn_task_i32(int task_kind, int executor_tag) {
   ++g_runtime_task_spawn_call_count;
   g_runtime_task_last_spawn_kind = task_kind;
@@ -5640,24 +11780,52 @@ extern "C" int objc3_runtime_add_task_group_task_i32(int executor_tag) {
   return 1;
 }
 
+// Once block-bodied lowering has opened the caller's task group, `wait_next`
+// yields its next completion and 0 once it is drained; without one it keeps
+// the deterministic symbol-profile result.
 extern "C" int objc3_runtime_wait_task_group_next_i32(int executor_tag) {
   ++g_runtime_task_wait_next_call_count;
   g_runtime_task_last_wait_next_executor_tag = executor_tag;
-  g_runtime_task_last_wait_next_result = 23;
+  RuntimeTaskGroup *const group = LoweredRuntimeTaskGroup(TaskExecutor(), false);
+  int result = 23;
+  if (group != nullptr &&
+      objc3_runtime_task_group_next_i32(group->handle, &result) == 0) {
+    result = 0;
+  }
+  g_runtime_task_last_wait_next_result = result;
   return g_runtime_task_last_wait_next_result;
 }
 
+// Cancels the caller's block-bodied task group and returns 1; without one it
+// keeps the deterministic symbol-profile result.
 extern "C" int objc3_runtime_cancel_task_group_i32(int executor_tag) {
   ++g_runtime_task_cancel_all_call_count;
   g_runtime_task_last_cancel_all_executor_tag = executor_tag;
+  RuntimeTaskGroup *const group = LoweredRuntimeTaskGroup(TaskExecutor(), false);
   g_runtime_task_last_cancel_all_result = 31;
+  if (group != nullptr) {
+    (void)objc3_runtime_cancel_task_group_tasks_i32(group->handle);
+    g_runtime_task_last_cancel_all_result = 1;
+  }
   return g_runtime_task_last_cancel_all_result;
 }
 
+// Returns the caller's lowered task group, opening it on first use, for
+// block-bodied `task_spawn_child` and `task_group_add_task` lowering.
+extern "C" int objc3_runtime_open_lowered_task_group_i32(void) {
+  RuntimeTaskGroup *const group = LoweredRuntimeTaskGroup(TaskExecutor(), true);
+  return group != nullptr ? group->handle : 0;
+}
+
 extern "C" int objc3_runtime_task_is_cancelled_i32(int executor_tag) {
   ++g_runtime_task_cancellation_poll_call_count;
   g_runtime_task_last_cancellation_poll_executor_tag = executor_tag;
-  g_runtime_task_last_cancellation_poll_result = 0;
+  // Outside an executor task there is nothing to cancel.
+  g_runtime_task_last_cancellation_poll_result =
+      g_runtime_current_task != nullptr &&
+              IsRuntimeTaskCancelled(g_runtime_current_task->get())
+          ? 1
+          : 0;
   return g_runtime_task_last_cancellation_poll_result;
 }
 
@@ -5674,6 +11842,132 @@ extern "C" int objc3_runtime_executor_hop_i32(int value, int executor_tag) {
   return value;
 }
 
+extern "C" int objc3_runtime_spawn_block_task_i32(int task_kind,
+                                                  int block_handle,
+                                                  int argument,
+                                                  int executor_tag) {
+  if (task_kind != kRuntimeTaskKindChild &&
+      task_kind != kRuntimeTaskKindDetached) {
+    return 0;
+  }
+  return SpawnRuntimeTask(TaskExecutor(), task_kind, nullptr, block_handle,
+                          argument, nullptr, executor_tag);
+}
+
+extern "C" int objc3_runtime_join_task_i32(int task_handle) {
+  RuntimeTaskExecutor &executor = TaskExecutor();
+  const std::shared_ptr<RuntimeTaskRecord> task =
+      FindRuntimeTask(executor, task_handle);
+  if (task == nullptr || task->kind != kRuntimeTaskKindChild ||
+      task->group != nullptr) {
+    return 0;
+  }
+  WaitForRuntimeTasks(executor, [&task]() {
+    return task->completed.load(std::memory_order_acquire);
+  });
+  {
+    std::lock_guard<std::mutex> lock(executor.registry_mutex);
+    executor.tasks_by_handle.erase(task_handle);
+  }
+  return task->result;
+}
+
+extern "C" int objc3_runtime_cancel_task_i32(int task_handle) {
+  const std::shared_ptr<RuntimeTaskRecord> task =
+      FindRuntimeTask(TaskExecutor(), task_handle);
+  if (task == nullptr) {
+    return 0;
+  }
+  task->cancelled.store(true, std::memory_order_relaxed);
+  return 1;
+}
+
+extern "C" int objc3_runtime_create_task_group_i32(int executor_tag) {
+  RuntimeTaskExecutor &executor = TaskExecutor();
+  auto group = std::make_unique<RuntimeTaskGroup>();
+  group->executor_tag = executor_tag;
+  std::lock_guard<std::mutex> lock(executor.registry_mutex);
+  do {
+    group->handle = executor.next_group_handle;
+    executor.next_group_handle = executor.next_group_handle == 0x7fffffff
+                                     ? 1
+                                     : executor.next_group_handle + 1;
+  } while (executor.groups_by_handle.count(group->handle) != 0u);
+  const int handle = group->handle;
+  executor.groups_by_handle.emplace(handle, std::move(group));
+  return handle;
+}
+
+extern "C" int objc3_runtime_task_group_spawn_block_i32(int group_handle,
+                                                        int block_handle,
+                                                        int argument) {
+  RuntimeTaskExecutor &executor = TaskExecutor();
+  RuntimeTaskGroup *const group = FindRuntimeTaskGroup(executor, group_handle);
+  if (group == nullptr) {
+    return 0;
+  }
+  return SpawnRuntimeTask(executor, kRuntimeTaskKindChild, group, block_handle,
+                          argument, nullptr, group->executor_tag);
+}
+
+extern "C" int objc3_runtime_task_group_next_i32(int group_handle,
+                                                 int *result_out) {
+  RuntimeTaskExecutor &executor = TaskExecutor();
+  RuntimeTaskGroup *const group = FindRuntimeTaskGroup(executor, group_handle);
+  if (group == nullptr) {
+    return 0;
+  }
+  WaitForRuntimeTasks(executor, [group]() {
+    std::lock_guard<std::mutex> lock(group->mutex);
+    return !group->completed_results.empty() ||
+           group->pending_by_handle.empty();
+  });
+  std::lock_guard<std::mutex> lock(group->mutex);
+  if (group->completed_results.empty()) {
+    return 0;
+  }
+  if (result_out != nullptr) {
+    *result_out = group->completed_results.front();
+  }
+  group->completed_results.pop_front();
+  return 1;
+}
+
+extern "C" int objc3_runtime_cancel_task_group_tasks_i32(int group_handle) {
+  RuntimeTaskGroup *const group =
+      FindRuntimeTaskGroup(TaskExecutor(), group_handle);
+  if (group == nullptr) {
+    return 0;
+  }
+  std::lock_guard<std::mutex> lock(group->mutex);
+  group->cancelled = true;
+  for (const auto &entry : group->pending_by_handle) {
+    entry.second->cancelled.store(true, std::memory_order_relaxed);
+  }
+  return static_cast<int>(group->pending_by_handle.size());
+}
+
+extern "C" int objc3_runtime_join_task_group_i32(int group_handle) {
+  RuntimeTaskExecutor &executor = TaskExecutor();
+  RuntimeTaskGroup *const group = FindRuntimeTaskGroup(executor, group_handle);
+  if (group == nullptr) {
+    return 0;
+  }
+  WaitForRuntimeTasks(executor, [group]() {
+    std::lock_guard<std::mutex> lock(group->mutex);
+    return group->pending_by_handle.empty();
+  });
+  int discarded_result_count = 0;
+  {
+    std::lock_guard<std::mutex> lock(group->mutex);
+    discarded_result_count =
+        static_cast<int>(group->completed_results.size());
+  }
+  std::lock_guard<std::mutex> lock(executor.registry_mutex);
+  executor.groups_by_handle.erase(group_handle);
+  return discarded_result_count;
+}
+
 extern "C" int objc3_runtime_actor_enter_isolation_thunk_i32(int executor_tag) {
   // actor lowering/runtime anchor: helper-backed actor lowering now
   // reaches the runtime through this private thunk/hop/nonisolated cluster.
@@ -5695,6 +11989,15 @@ extern "C" int objc3_runtime_actor_hop_to_executor_i32(int value,
   ++g_runtime_actor_hop_to_executor_call_count;
   g_runtime_actor_last_hop_value = value;
   g_runtime_actor_last_hop_executor_tag = executor_tag;
+  // Returns only after a turn of the target serial executor, ordered behind
+  // the work already queued on it, has run the hop. The global executor is
+  // concurrent and needs no hop.
+  if (IsRuntimeSerialExecutorTag(executor_tag)) {
+    RuntimeTaskExecutor &executor = TaskExecutor();
+    auto arrive = []() {};
+    RunOnRuntimeSerialExecutor(
+        executor, RuntimeSerialExecutorForTag(executor, executor_tag), arrive);
+  }
   g_runtime_actor_last_hop_result = value;
   return value;
 }
@@ -5716,13 +12019,21 @@ extern "C" int objc3_runtime_actor_bind_executor_i32(int actor_handle,
   // actor-mailbox/isolation-runtime anchor: actor runtime proof now
   // includes private mailbox binding state and deterministic enqueue/drain
   // helpers without widening the public runtime ABI.
+  // actor-executor anchor: binding moves the actor's later messages onto the
+  // tag's shared serial executor; messages already queued stay where they are.
   ++g_runtime_actor_bind_executor_call_count;
   g_runtime_actor_last_bound_actor_handle = actor_handle;
   g_runtime_actor_last_bound_executor_tag = executor_tag;
   g_runtime_actor_last_mailbox_actor_handle = actor_handle;
   g_runtime_actor_last_mailbox_executor_tag = executor_tag;
-  g_runtime_actor_last_mailbox_depth =
-      static_cast<int>(g_runtime_actor_mailboxes[actor_handle].size());
+  RuntimeTaskExecutor &executor = TaskExecutor();
+  RuntimeActor &actor = RuntimeActorForHandle(executor, actor_handle);
+  actor.serial.store(IsRuntimeSerialExecutorTag(executor_tag)
+                         ? &RuntimeSerialExecutorForTag(executor, executor_tag)
+                         : &actor.own_executor,
+                     std::memory_order_release);
+  g_runtime_actor_last_mailbox_depth = static_cast<int>(
+      actor.mailbox_depth.load(std::memory_order_acquire));
   return executor_tag;
 }
 
@@ -5733,9 +12044,15 @@ extern "C" int objc3_runtime_actor_mailbox_enqueue_i32(int actor_handle,
   g_runtime_actor_last_mailbox_actor_handle = actor_handle;
   g_runtime_actor_last_mailbox_enqueued_value = value;
   g_runtime_actor_last_mailbox_executor_tag = executor_tag;
-  std::deque<int> &mailbox = g_runtime_actor_mailboxes[actor_handle];
-  mailbox.push_back(value);
-  g_runtime_actor_last_mailbox_depth = static_cast<int>(mailbox.size());
+  RuntimeActor &actor = RuntimeActorForHandle(TaskExecutor(), actor_handle);
+  auto *const node = new RuntimeActorJob();
+  node->argument = value;
+  // Counted before it is linked, so a drain that sees a non-zero depth knows
+  // the value is about to become visible.
+  const std::uint64_t depth =
+      actor.mailbox_depth.fetch_add(1u, std::memory_order_acq_rel) + 1u;
+  PushRuntimeActorJob(actor.mailbox, node);
+  g_runtime_actor_last_mailbox_depth = static_cast<int>(depth);
   return value;
 }
 
@@ -5744,39 +12061,68 @@ extern "C" int objc3_runtime_actor_mailbox_drain_next_i32(int actor_handle,
   ++g_runtime_actor_mailbox_drain_call_count;
   g_runtime_actor_last_mailbox_actor_handle = actor_handle;
   g_runtime_actor_last_mailbox_executor_tag = executor_tag;
-  std::deque<int> &mailbox = g_runtime_actor_mailboxes[actor_handle];
-  if (mailbox.empty()) {
-    g_runtime_actor_last_mailbox_depth = 0;
-    g_runtime_actor_last_mailbox_drained_value = 0;
-    return 0;
-  }
-  const int value = mailbox.front();
-  mailbox.pop_front();
-  g_runtime_actor_last_mailbox_depth = static_cast<int>(mailbox.size());
+  RuntimeTaskExecutor &executor = TaskExecutor();
+  RuntimeActor &actor = RuntimeActorForHandle(executor, actor_handle);
+  int value = 0;
+  std::uint64_t depth = 0;
+  auto drain = [&actor, &value, &depth]() {
+    RuntimeActorJob *node = nullptr;
+    while (actor.mailbox_depth.load(std::memory_order_acquire) != 0u &&
+           (node = PopRuntimeActorJob(actor.mailbox)) == nullptr) {
+      std::this_thread::yield();
+    }
+    if (node != nullptr) {
+      value = node->argument;
+      delete node;
+      depth = actor.mailbox_depth.fetch_sub(1u, std::memory_order_acq_rel) - 1u;
+    }
+  };
+  RunOnRuntimeSerialExecutor(
+      executor, *actor.serial.load(std::memory_order_acquire), drain);
+  g_runtime_actor_last_mailbox_depth = static_cast<int>(depth);
   g_runtime_actor_last_mailbox_drained_value = value;
   return value;
 }
 
+extern "C" int objc3_runtime_actor_send_block_i32(int actor_handle,
+                                                  int block_handle,
+                                                  int argument) {
+  // The message holds its own reference to the block until the body returns.
+  if (TryRetainRuntimeBlock(State(), block_handle) == nullptr) {
+    return 0;
+  }
+  RuntimeTaskExecutor &executor = TaskExecutor();
+  RuntimeActor &actor = RuntimeActorForHandle(executor, actor_handle);
+  EnsureRuntimeTaskWorkers(executor);
+  auto *const job = new RuntimeActorJob();
+  job->block_handle = block_handle;
+  job->argument = argument;
+  actor.sent_message_count.fetch_add(1u, std::memory_order_relaxed);
+  EnqueueRuntimeSerialJob(executor,
+                          *actor.serial.load(std::memory_order_acquire), job);
+  return 1;
+}
+
 extern "C" int objc3_runtime_retain_i32(int value) {
-  ++g_runtime_arc_debug_retain_call_count;
+  BumpRuntimeMetric(RuntimeMetric::Retain);
   g_runtime_arc_debug_last_retain_value = value;
   RuntimeState &state = State();
-  std::lock_guard<std::mutex> lock(state.mutex);
-  RetainRuntimeValueUnlocked(state, value);
+  if (TryRetainRuntimeInstance(state, value)) {
+    return value;
+  }
+  (void)TryRetainRuntimeBlock(state, value);
   return value;
 }
 
 extern "C" int objc3_runtime_release_i32(int value) {
-  ++g_runtime_arc_debug_release_call_count;
+  BumpRuntimeMetric(RuntimeMetric::Release);
   g_runtime_arc_debug_last_release_value = value;
-  RuntimeState &state = State();
-  std::lock_guard<std::mutex> lock(state.mutex);
-  ReleaseRuntimeValueUnlocked(state, value);
+  ReleaseRuntimeValueOutsideMutex(State(), value);
   return value;
 }
 
 extern "C" int objc3_runtime_autorelease_i32(int value) {
-  ++g_runtime_arc_debug_autorelease_call_count;
+  BumpRuntimeMetric(RuntimeMetric::Autorelease);
   g_runtime_arc_debug_last_autorelease_value = value;
   EnqueueAutoreleaseValue(value);
   return value;
@@ -5796,21 +12142,19 @@ extern "C" int objc3_runtime_promote_block_i32(
   if (storage == nullptr || storage_size_bytes == 0u) {
     return 0;
   }
-  ++g_runtime_block_promote_call_count;
+  BumpRuntimeMetric(RuntimeMetric::BlockPromote);
   g_runtime_last_promote_has_pointer_capture_storage =
       has_pointer_capture_storage != 0 ? 1 : 0;
   RuntimeState &state = State();
   std::lock_guard<std::mutex> lock(state.mutex);
-  int block_handle = state.next_runtime_block_handle;
-  while (block_handle <= 0 ||
-         state.runtime_instances_by_receiver.find(block_handle) !=
-             state.runtime_instances_by_receiver.end() ||
-         state.runtime_blocks_by_handle.find(block_handle) !=
-             state.runtime_blocks_by_handle.end()) {
-    ++block_handle;
-  }
-  state.next_runtime_block_handle = block_handle + 1;
-  RuntimeBlockRecord record;
+  std::uint32_t generation = 0;
+  RuntimeBlockRecord *const slot =
+      AcquireRuntimeBlockSlotUnlocked(state, generation);
+  if (slot == nullptr) {
+    return 0;
+  }
+  RuntimeBlockRecord &record = *slot;
+  const int block_handle = RuntimeBlockHandle(record.slot_index, generation);
   record.block_handle = block_handle;
   record.has_pointer_capture_storage = has_pointer_capture_storage != 0;
   record.storage_size_bytes =
@@ -5823,6 +12167,7 @@ extern "C" int objc3_runtime_promote_block_i32(
   std::memcpy(&record.invoke, record.storage_words.data(), sizeof(record.invoke));
   if (record.has_pointer_capture_storage) {
     if (record.storage_size_bytes < sizeof(void *) * 3u) {
+      FreeRuntimeBlockSlotUnlocked(state, record, false);
       return 0;
     }
     std::memcpy(&record.copy_helper,
@@ -5834,6 +12179,7 @@ extern "C" int objc3_runtime_promote_block_i32(
                     sizeof(void *) * 2u,
                 sizeof(record.dispose_helper));
     if (!PromotePointerCaptureCellsIntoRuntimeOwnedStorage(record)) {
+      FreeRuntimeBlockSlotUnlocked(state, record, false);
       return 0;
     }
     if (record.copy_helper != nullptr) {
@@ -5841,9 +12187,12 @@ extern "C" int objc3_runtime_promote_block_i32(
     }
   }
   if (record.invoke == nullptr) {
+    FreeRuntimeBlockSlotUnlocked(state, record, false);
     return 0;
   }
-  state.runtime_blocks_by_handle.emplace(block_handle, std::move(record));
+  ++state.runtime_block_slab.live_block_count;
+  record.retain_state.store(RuntimeInstanceRetainState(generation, 1u),
+                            std::memory_order_release);
   g_runtime_last_promoted_block_handle = block_handle;
   return block_handle;
 }
@@ -5854,25 +12203,24 @@ extern "C" int objc3_runtime_invoke_block_i32(int block_handle, int a0, int a1,
   // works for any promoted runtime block record with a concrete invoke thunk,
   // including pointer-capture storage promoted through the private helper
   // surface.
-  ++g_runtime_block_invoke_call_count;
+  // The call runs on the record's own storage, pinned by a retain for its
+  // duration, so invoke neither copies the storage nor takes the runtime
+  // mutex; a release inside the thunk cannot free the storage under it.
+  BumpRuntimeMetric(RuntimeMetric::BlockInvoke);
   g_runtime_last_invoked_block_handle = block_handle;
-  RuntimeBlockInvokeFn invoke = nullptr;
-  std::vector<std::uint64_t> storage_words;
-  {
-    RuntimeState &state = State();
-    std::lock_guard<std::mutex> lock(state.mutex);
-    const auto block_it = state.runtime_blocks_by_handle.find(block_handle);
-    if (block_it == state.runtime_blocks_by_handle.end() ||
-        block_it->second.invoke == nullptr) {
-      return 0;
-    }
-    invoke = block_it->second.invoke;
-    storage_words = block_it->second.storage_words;
-  }
-  if (invoke == nullptr || storage_words.empty()) {
+  RuntimeState &state = State();
+  RuntimeBlockRecord *const record = TryRetainRuntimeBlock(state, block_handle);
+  if (record == nullptr) {
     return 0;
   }
-  const int result = invoke(storage_words.data(), a0, a1, a2, a3);
+  // Promotion only publishes records with an invoke thunk and storage.
+  const int result =
+      record->invoke(record->storage_words.data(), a0, a1, a2, a3);
+  if (TryReleaseRuntimeBlock(state, block_handle) ==
+      RuntimeRetainReleaseResult::FinalRelease) {
+    std::lock_guard<std::mutex> lock(state.mutex);
+    ReleaseRuntimeBlockUnlocked(state, block_handle, 1u);
+  }
   g_runtime_last_block_invoke_result = result;
   return result;
 }
@@ -5900,18 +12248,8 @@ extern "C" void objc3_runtime_push_autoreleasepool_scope(void) {
 // autoreleasepool helpers plus reset-stable snapshot state to prove
 // cancellation/autorelease determinism without widening the public ABI.
 extern "C" void objc3_runtime_pop_autoreleasepool_scope(void) {
-  ++g_runtime_arc_debug_autoreleasepool_pop_count;
-  const std::vector<int> values = PopRuntimeAutoreleasePoolFrameValues();
-  if (values.empty()) {
-    return;
-  }
-  RuntimeState &state = State();
-  std::lock_guard<std::mutex> lock(state.mutex);
-  for (auto it = values.rbegin(); it != values.rend(); ++it) {
-    g_runtime_last_drained_autorelease_value = *it;
-    ++g_runtime_autoreleasepool_drained_value_count;
-    ReleaseRuntimeValueUnlocked(state, *it);
-  }
+  BumpRuntimeMetric(RuntimeMetric::AutoreleasePoolPop);
+  PopRuntimeAutoreleasePoolFrame(State());
 }
 
 // runtime-fast-path-integration anchor: Part 9 freezes the current
@@ -5925,234 +12263,127 @@ extern "C" void objc3_runtime_pop_autoreleasepool_scope(void) {
 int objc3_runtime_dispatch_i32(int receiver, const char *selector, int a0,
                                int a1, int a2, int a3) {
   RuntimeState &state = State();
-  const void *resolved_implementation = nullptr;
-  const RealizedPropertyAccessor *resolved_runtime_property_accessor = nullptr;
-  std::uint64_t resolved_parameter_count = 0;
-  RuntimeMethodReturnKind resolved_return_kind =
-      RuntimeMethodReturnKind::Unsupported;
-  RuntimeBuiltinKind resolved_builtin_kind = RuntimeBuiltinKind::None;
-  bool resolved_live_method = false;
-  std::uint64_t receiver_base_identity = 0;
-  {
+  RuntimeDispatchInvocation invocation;
+  // lock-free-dispatch-cache anchor: the thread-local hit cache is probed
+  // before the mutex; only thread-cache misses, slow-path resolution, and
+  // fallback classification serialize on the runtime lock.
+  if (!TryDispatchThroughThreadHitCache(state, receiver, selector, invocation)) {
     std::lock_guard<std::mutex> lock(state.mutex);
-    const objc3_runtime_selector_handle *selector_handle =
-        LookupSelectorUnlocked(selector);
-    state.last_dispatch_selector = selector != nullptr ? selector : "";
-    state.last_dispatch_selector_stable_id =
-        selector_handle != nullptr ? selector_handle->stable_id : 0;
-    state.last_dispatch_normalized_receiver_identity = 0;
-    state.last_category_probe_count = 0;
-    state.last_protocol_probe_count = 0;
-    state.last_dispatch_used_cache = false;
-    state.last_dispatch_used_fast_path = false;
-    state.last_dispatch_resolved_live_method = false;
-    state.last_dispatch_fell_back = false;
-    state.last_dispatch_effective_direct_dispatch = false;
-    state.last_dispatch_used_builtin = false;
-    state.last_fast_path_reason.clear();
-    state.last_dispatch_path.clear();
-    state.last_dispatch_implementation_kind.clear();
-    state.last_dispatch_property_name.clear();
-    state.last_resolved_class_name.clear();
-    state.last_resolved_owner_identity.clear();
-    state.last_dispatch_parameter_count = 0;
-    state.last_dispatch_property_base_identity = 0;
-    state.last_dispatch_property_slot_index = 0;
-
-    if (receiver != 0 && selector_handle != nullptr) {
-      std::uint64_t base_identity = 0;
-      std::uint64_t normalized_receiver_identity = 0;
-      DispatchFamily family = DispatchFamily::Invalid;
-      if (DecodeReceiverIdentity(state, receiver, base_identity, family,
-                                 normalized_receiver_identity)) {
-        receiver_base_identity = base_identity;
-        state.last_dispatch_normalized_receiver_identity =
-            normalized_receiver_identity;
-        const MethodCacheKey cache_key{normalized_receiver_identity,
-                                       selector_handle->stable_id};
-        const auto cache_it = state.method_cache.find(cache_key);
-        if (cache_it != state.method_cache.end()) {
-          const MethodCacheEntry &entry = cache_it->second;
-          ++state.method_cache_hit_count;
-          state.last_dispatch_used_cache = true;
-          state.last_dispatch_used_fast_path = entry.fast_path_seeded;
-          state.last_dispatch_resolved_live_method = entry.resolved;
-          state.last_dispatch_fell_back = !entry.resolved;
-          state.last_dispatch_effective_direct_dispatch =
-              entry.effective_direct_dispatch;
-          state.last_category_probe_count = entry.category_probe_count;
-          state.last_protocol_probe_count = entry.protocol_probe_count;
-          state.last_fast_path_reason = entry.fast_path_reason;
-          state.last_resolved_class_name = entry.class_name;
-          state.last_resolved_owner_identity = entry.owner_identity;
-          state.last_dispatch_parameter_count = entry.parameter_count;
-          if (entry.runtime_property_accessor != nullptr &&
-              entry.runtime_property_accessor->property_descriptor != nullptr) {
-            state.last_dispatch_property_name =
-                entry.runtime_property_accessor->property_descriptor
-                        ->property_name != nullptr
-                    ? entry.runtime_property_accessor->property_descriptor
-                          ->property_name
-                    : "";
-            state.last_dispatch_property_base_identity = receiver_base_identity;
-            state.last_dispatch_property_slot_index =
-                entry.runtime_property_accessor->ivar_descriptor != nullptr
-                    ? entry.runtime_property_accessor->ivar_descriptor->slot_index
-                    : entry.runtime_property_accessor->property_descriptor
-                          ->ivar_layout_slot_index;
-          }
-          if (entry.resolved) {
-            resolved_live_method = true;
-            resolved_builtin_kind = entry.builtin_kind;
-            resolved_implementation = entry.implementation;
-            resolved_runtime_property_accessor = entry.runtime_property_accessor;
-            resolved_parameter_count = entry.parameter_count;
-            resolved_return_kind = entry.return_kind;
-            state.last_dispatch_used_builtin =
-                entry.builtin_kind != RuntimeBuiltinKind::None;
-            state.last_dispatch_path =
-                entry.fast_path_seeded ? "cache-hit-fast-path"
-                                       : "cache-hit-live";
-            state.last_dispatch_implementation_kind =
-                DescribeResolvedImplementationKind(entry.builtin_kind,
-                                                   entry.implementation);
-            ++state.live_dispatch_count;
-            if (entry.fast_path_seeded) {
-              ++state.fast_path_hit_count;
-            }
-          } else {
-            state.last_dispatch_path = "cache-hit-fallback";
-            state.last_dispatch_implementation_kind = "fallback-formula";
-            ++state.fallback_dispatch_count;
-          }
-        } else {
-          ++state.method_cache_miss_count;
-          ++state.slow_path_lookup_count;
-          SlowPathResolution resolution = ResolveMethodSlowPathUnlocked(
-              state, base_identity, normalized_receiver_identity, family,
-              selector_handle->stable_id, selector_handle->selector);
-          MethodCacheEntry cache_entry;
-          cache_entry.resolved = resolution.resolved;
-          cache_entry.dispatch_family_is_class =
-              resolution.dispatch_family_is_class;
-          cache_entry.effective_direct_dispatch =
-              resolution.effective_direct_dispatch;
-          cache_entry.objc_final_declared = resolution.objc_final_declared;
-          cache_entry.objc_sealed_declared = resolution.objc_sealed_declared;
-          cache_entry.selector_storage = resolution.selector_storage;
-          cache_entry.fast_path_reason = resolution.fast_path_reason;
-          cache_entry.class_name = resolution.class_name;
-          cache_entry.owner_identity = resolution.owner_identity;
-          cache_entry.normalized_receiver_identity =
-              normalized_receiver_identity;
-          cache_entry.selector_stable_id = selector_handle->stable_id;
-          cache_entry.parameter_count = resolution.parameter_count;
-          cache_entry.return_kind = resolution.return_kind;
-          cache_entry.category_probe_count = resolution.category_probe_count;
-          cache_entry.protocol_probe_count = resolution.protocol_probe_count;
-          cache_entry.implementation = resolution.implementation;
-          cache_entry.builtin_kind = resolution.builtin_kind;
-          cache_entry.runtime_property_accessor =
-              resolution.runtime_property_accessor;
-          state.method_cache.emplace(cache_key, std::move(cache_entry));
-          state.last_dispatch_resolved_live_method = resolution.resolved;
-          state.last_dispatch_fell_back = !resolution.resolved;
-          state.last_dispatch_effective_direct_dispatch =
-              resolution.effective_direct_dispatch;
-          state.last_category_probe_count = resolution.category_probe_count;
-          state.last_protocol_probe_count = resolution.protocol_probe_count;
-          state.last_fast_path_reason = resolution.fast_path_reason;
-          state.last_resolved_class_name = resolution.class_name;
-          state.last_resolved_owner_identity = resolution.owner_identity;
-          state.last_dispatch_parameter_count = resolution.parameter_count;
-          if (resolution.runtime_property_accessor != nullptr &&
-              resolution.runtime_property_accessor->property_descriptor !=
-                  nullptr) {
-            state.last_dispatch_property_name =
-                resolution.runtime_property_accessor->property_descriptor
-                        ->property_name != nullptr
-                    ? resolution.runtime_property_accessor->property_descriptor
-                          ->property_name
-                    : "";
-            state.last_dispatch_property_base_identity = receiver_base_identity;
-            state.last_dispatch_property_slot_index =
-                resolution.runtime_property_accessor->ivar_descriptor != nullptr
-                    ? resolution.runtime_property_accessor->ivar_descriptor
-                          ->slot_index
-                    : resolution.runtime_property_accessor->property_descriptor
-                          ->ivar_layout_slot_index;
-          }
-          if (resolution.resolved) {
-            resolved_live_method = true;
-            resolved_builtin_kind = resolution.builtin_kind;
-            resolved_implementation = resolution.implementation;
-            resolved_runtime_property_accessor =
-                resolution.runtime_property_accessor;
-            resolved_parameter_count = resolution.parameter_count;
-            resolved_return_kind = resolution.return_kind;
-            state.last_dispatch_used_builtin =
-                resolution.builtin_kind != RuntimeBuiltinKind::None;
-            state.last_dispatch_path = "slow-path-live";
-            state.last_dispatch_implementation_kind =
-                DescribeResolvedImplementationKind(resolution.builtin_kind,
-                                                   resolution.implementation);
-            ++state.live_dispatch_count;
-          } else {
-            state.last_dispatch_path = "slow-path-fallback";
-            state.last_dispatch_implementation_kind = "fallback-formula";
-            ++state.fallback_dispatch_count;
-          }
-        }
-      } else {
-        ++state.fallback_dispatch_count;
-        state.last_dispatch_fell_back = true;
-        state.last_dispatch_path = "invalid-receiver-fallback";
-        state.last_dispatch_implementation_kind = "fallback-formula";
-      }
-    }
+    ResolveRuntimeDispatchUnlocked(state, receiver, selector,
+                                   LookupSelectorUnlocked(selector), nullptr,
+                                   invocation);
   }
-  // runtime call ABI generation anchor: canonical runtime dispatch
-  // owns nil-receiver semantics for lowered instance/class/super surfaces, so
-  // a zero receiver returns zero without requiring lowering-side elision.
-  if (receiver == 0) {
+  return InvokeRuntimeDispatch(state, receiver, selector, invocation, a0, a1,
+                               a2, a3);
+}
+
+// selector-handle-dispatch anchor: lowering with selector handles passes one
+// module-private selector reference per selector instead of its spelling. The
+// reference binds to the canonical handle on first use; after that neither
+// the hit path nor the locked resolve path hashes the selector string.
+int objc3_runtime_dispatch_sel_i32(int receiver,
+                                   objc3_runtime_selector_reference *selector,
+                                   int a0, int a1, int a2, int a3) {
+  if (selector == nullptr) {
+    return objc3_runtime_dispatch_i32(receiver, nullptr, a0, a1, a2, a3);
+  }
+  RuntimeState &state = State();
+  RuntimeDispatchInvocation invocation;
+  const objc3_runtime_selector_handle *selector_handle =
+      LoadBoundSelectorReference(state, *selector);
+  if (selector_handle == nullptr ||
+      !TryDispatchSelectorHandleThroughThreadHitCache(
+          state, receiver, selector_handle, invocation)) {
     std::lock_guard<std::mutex> lock(state.mutex);
-    state.last_dispatch_path = "nil-short-circuit";
-    state.last_dispatch_implementation_kind = "nil-short-circuit";
-    return 0;
+    if (selector_handle == nullptr) {
+      selector_handle = BindSelectorReferenceUnlocked(state, *selector);
+    }
+    ResolveRuntimeDispatchUnlocked(
+        state, receiver,
+        selector_handle != nullptr ? selector_handle->selector
+                                   : selector->selector,
+        selector_handle, nullptr, invocation);
+  }
+  return InvokeRuntimeDispatch(
+      state, receiver,
+      selector_handle != nullptr ? selector_handle->selector
+                                 : selector->selector,
+      invocation, a0, a1, a2, a3);
+}
+
+// dispatch-site-cache anchor: lowering with per-call-site caches routes each
+// send site through its own emitted cell. A hit compares the receiver, the
+// selector pointer, and the dispatch epoch against the binding the cell points
+// at and skips both the hashed thread cache and the selector spelling
+// comparison; a megamorphic site uses the thread cache like the canonical
+// entrypoint, and any other miss resolves under the mutex and rebinds the site.
+int objc3_runtime_dispatch_site_cached_i32(
+    objc3_runtime_dispatch_site_cache *site, int receiver, const char *selector,
+    int a0, int a1, int a2, int a3) {
+  if (site == nullptr) {
+    return objc3_runtime_dispatch_i32(receiver, selector, a0, a1, a2, a3);
   }
-  if (resolved_live_method && resolved_implementation != nullptr) {
-    PushRuntimeDispatchFrame(receiver, receiver_base_identity,
-                             resolved_runtime_property_accessor);
-    const int result =
-        InvokeResolvedMethod(resolved_implementation, resolved_return_kind,
-                            resolved_parameter_count, a0, a1, a2, a3);
-    const std::vector<int> autorelease_values =
-        PopRuntimeDispatchFrameAutoreleaseValues();
-    if (!autorelease_values.empty()) {
-      std::lock_guard<std::mutex> lock(state.mutex);
-      for (int value : autorelease_values) {
-        ReleaseRuntimeValueUnlocked(state, value);
-      }
+  RuntimeState &state = State();
+  RuntimeDispatchInvocation invocation;
+  const bool bindable = receiver > 0 && selector != nullptr;
+  const RuntimeDispatchSiteBinding *binding =
+      bindable ? LoadDispatchSiteBinding(*site) : nullptr;
+  const bool hit = binding != nullptr &&
+                   TryAdoptDispatchSiteBinding(state, *binding, receiver,
+                                               selector, invocation);
+  if (!hit && (binding != &MegamorphicDispatchSiteBinding() ||
+               !TryDispatchThroughThreadHitCache(state, receiver, selector,
+                                                 invocation))) {
+    std::lock_guard<std::mutex> lock(state.mutex);
+    ++state.dispatch_site_cache_miss_count;
+    if (bindable &&
+        LoadDispatchSiteBinding(*site) != &MegamorphicDispatchSiteBinding()) {
+      RuntimeDispatchHitCacheSlot resolved;
+      ResolveRuntimeDispatchUnlocked(state, receiver, selector,
+                                     LookupSelectorUnlocked(selector),
+                                     &resolved, invocation);
+      PublishDispatchSiteBindingUnlocked(state, *site, resolved);
+    } else {
+      ResolveRuntimeDispatchUnlocked(state, receiver, selector,
+                                     LookupSelectorUnlocked(selector), nullptr,
+                                     invocation);
     }
-    return result;
   }
-  if (resolved_live_method && resolved_builtin_kind != RuntimeBuiltinKind::None) {
-    PushRuntimeDispatchFrame(receiver, receiver_base_identity,
-                             resolved_runtime_property_accessor);
-    const int result = InvokeRuntimeBuiltinMethod(
-        state, resolved_builtin_kind, receiver, receiver_base_identity,
-        resolved_runtime_property_accessor, a0, a1, a2, a3);
-    const std::vector<int> autorelease_values =
-        PopRuntimeDispatchFrameAutoreleaseValues();
-    if (!autorelease_values.empty()) {
-      std::lock_guard<std::mutex> lock(state.mutex);
-      for (int value : autorelease_values) {
-        ReleaseRuntimeValueUnlocked(state, value);
-      }
+  return InvokeRuntimeDispatch(state, receiver, selector, invocation, a0, a1,
+                               a2, a3);
+}
+
+// sealed-dispatch-table anchor: lowered sends on objc_final/objc_sealed class
+// receivers call the bound table entry directly and only reach this
+// entrypoint while the table is unbound or the slot cannot be called in
+// place. An unbound table binds here once; the send itself always resolves
+// through the canonical path so its result matches objc3_runtime_dispatch_i32.
+int objc3_runtime_dispatch_sealed_i32(
+    objc3_runtime_sealed_dispatch_table *table, uint64_t slot, int receiver,
+    const char *selector, int a0, int a1, int a2, int a3) {
+  RuntimeState &state = State();
+  RuntimeDispatchInvocation invocation;
+  const bool table_unbound =
+      table != nullptr && slot < table->slot_count &&
+      std::atomic_ref<std::int32_t>(table->bound_receiver)
+              .load(std::memory_order_acquire) == 0;
+  if (table_unbound ||
+      !TryDispatchThroughThreadHitCache(state, receiver, selector,
+                                        invocation)) {
+    // Sends the thread hit cache answers are not table misses.
+    state.sealed_dispatch_table_miss_count.fetch_add(1u,
+                                                     std::memory_order_relaxed);
+    BumpRuntimeMetric(RuntimeMetric::SealedTableMiss);
+    std::lock_guard<std::mutex> lock(state.mutex);
+    if (table_unbound) {
+      BindSealedDispatchTableUnlocked(state, *table, receiver);
     }
-    return result;
+    ResolveRuntimeDispatchUnlocked(state, receiver, selector,
+                                   LookupSelectorUnlocked(selector), nullptr,
+                                   invocation);
   }
-  return ComputeDispatchResult(receiver, selector, a0, a1, a2, a3);
+  return InvokeRuntimeDispatch(state, receiver, selector, invocation, a0, a1,
+                               a2, a3);
 }
 
 int objc3_runtime_copy_registration_state_for_testing(
@@ -6191,6 +12422,7 @@ extern "C" int objc3_msgsend_i32(int receiver, const char *selector, int a0,
 }
 
 void objc3_runtime_reset_for_testing(void) {
+  ResetRuntimeTaskExecutorForTesting();
   RuntimeState &state = State();
   std::lock_guard<std::mutex> lock(state.mutex);
   // live-restart-hardening anchor: teardown clears only live runtime
@@ -6198,6 +12430,7 @@ void objc3_runtime_reset_for_testing(void) {
   // local init cells, and advances reset-generation evidence for repeated
   // restart-cycle probes.
   ClearLiveRegistrationStateUnlocked(state);
+  ClearDispatchSiteBindingsUnlocked(state);
   state.last_reset_cleared_image_local_init_state_count =
       ZeroRetainedBootstrapImageLocalInitStatesUnlocked(state);
   ++state.reset_generation;
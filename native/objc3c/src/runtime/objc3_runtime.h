@@ -48,6 +48,29 @@ typedef struct objc3_runtime_registration_state_snapshot {
   uint64_t last_rejected_registration_order_ordinal;
 } objc3_runtime_registration_state_snapshot;
 
+// Process-wide hot-path counters; see objc3_runtime_copy_metrics.
+typedef struct objc3_runtime_metrics_snapshot {
+  uint64_t thread_block_count;
+  uint64_t active_thread_block_count;
+  uint64_t dispatch_count;
+  uint64_t dispatch_cache_hit_count;
+  uint64_t dispatch_site_cache_hit_count;
+  uint64_t dispatch_locked_resolve_count;
+  uint64_t slow_path_lookup_count;
+  uint64_t fallback_dispatch_count;
+  uint64_t nil_dispatch_count;
+  uint64_t sealed_table_miss_count;
+  uint64_t retain_count;
+  uint64_t release_count;
+  uint64_t autorelease_count;
+  uint64_t autoreleasepool_push_count;
+  uint64_t autoreleasepool_pop_count;
+  uint64_t instance_alloc_count;
+  uint64_t instance_dealloc_count;
+  uint64_t block_promote_count;
+  uint64_t block_invoke_count;
+} objc3_runtime_metrics_snapshot;
+
 // lookup-dispatch-runtime anchor: the canonical runtime-owned lookup
 // and dispatch surface remains objc3_runtime_lookup_selector plus
 // objc3_runtime_dispatch_i32 over objc3_runtime_selector_handle. Later
@@ -114,6 +137,14 @@ int objc3_runtime_dispatch_i32(int receiver, const char *selector, int a0,
 int objc3_runtime_copy_registration_state_for_testing(
     objc3_runtime_registration_state_snapshot *snapshot);
 void objc3_runtime_reset_for_testing(void);
+// runtime-metrics anchor: the one deliberate widening of this header past
+// registration, lookup, and dispatch. Process-wide counters are summed over
+// every thread's counter block, including threads that have exited. Unlike
+// the testing snapshots they never reset, so readers compare two copies.
+// Setting OBJC3_RUNTIME_METRICS_DUMP=<path> also rewrites <path> with the
+// same fields as JSON every OBJC3_RUNTIME_METRICS_DUMP_INTERVAL_MS (default
+// 1000).
+int objc3_runtime_copy_metrics(objc3_runtime_metrics_snapshot *snapshot);
 
 #ifdef __cplusplus
 }
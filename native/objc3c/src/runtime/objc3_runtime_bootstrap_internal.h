@@ -47,6 +47,21 @@ typedef struct objc3_runtime_image_walk_state_snapshot {
   const char *last_walked_translation_unit_identity_key;
 } objc3_runtime_image_walk_state_snapshot;
 
+// prebuilt-metadata-image anchor: `last_status` is 0 when no image was
+// staged, 1 when its selector table was adopted, and otherwise the reason the
+// walk ran instead: 2 header/version/size mismatch, 3 selector count differs
+// from the registration table, 4 selector table already populated, 5 a pool
+// spelling did not hash to its own bucket.
+typedef struct objc3_runtime_prebuilt_image_state_snapshot {
+  uint64_t adopted_image_count;
+  uint64_t fallback_image_count;
+  uint64_t adopted_selector_count;
+  uint64_t prebuilt_class_ordinal_image_count;
+  uint64_t adopted_selector_table_size;
+  uint64_t last_image_byte_count;
+  int last_status;
+} objc3_runtime_prebuilt_image_state_snapshot;
+
 typedef struct objc3_runtime_reset_replay_state_snapshot {
   uint64_t retained_bootstrap_image_count;
   uint64_t last_reset_cleared_image_local_init_state_count;
@@ -68,6 +83,12 @@ typedef struct objc3_runtime_selector_lookup_table_state_snapshot {
   uint64_t last_materialized_registration_order_ordinal;
   uint64_t last_materialized_selector_pool_index;
   int last_materialized_from_metadata;
+  // selector-handle-dispatch anchor: spelling lookups count every hashed
+  // selector-table probe; handle-based sends only add to it when a selector
+  // reference binds.
+  uint64_t selector_table_generation;
+  uint64_t selector_spelling_lookup_count;
+  uint64_t bound_selector_reference_count;
 } objc3_runtime_selector_lookup_table_state_snapshot;
 
 typedef struct objc3_runtime_selector_lookup_entry_snapshot {
@@ -86,6 +107,10 @@ typedef struct objc3_runtime_keypath_registry_state_snapshot {
   uint64_t keypath_table_entry_count;
   uint64_t image_backed_keypath_count;
   uint64_t ambiguous_keypath_handle_count;
+  uint64_t compiled_chain_count;
+  uint64_t chain_build_count;
+  uint64_t chain_hit_count;
+  uint64_t chain_step_miss_count;
   uint64_t last_materialized_handle;
   uint64_t last_materialized_registration_order_ordinal;
   uint64_t last_queried_handle;
@@ -141,6 +166,17 @@ typedef struct objc3_runtime_method_cache_state_snapshot {
   const char *last_fast_path_reason;
   const char *last_resolved_class_name;
   const char *last_resolved_owner_identity;
+  // bounded-method-cache anchor: slow-path fills occupy two CLOCK rings,
+  // resolved and negative, each capped independently. Stale entries are
+  // fills retired by a later image that still hold a ring slot.
+  uint64_t resolved_entry_count;
+  uint64_t negative_entry_count;
+  uint64_t resolved_entry_capacity;
+  uint64_t negative_entry_capacity;
+  uint64_t stale_entry_count;
+  uint64_t eviction_count;
+  uint64_t negative_eviction_count;
+  uint64_t stale_reclaim_count;
 } objc3_runtime_method_cache_state_snapshot;
 
 typedef struct objc3_runtime_method_cache_entry_snapshot {
@@ -193,6 +229,112 @@ typedef struct objc3_runtime_dispatch_state_snapshot {
   const char *last_resolved_owner_identity;
 } objc3_runtime_dispatch_state_snapshot;
 
+// dispatch-trace-ring anchor: dispatch evidence lives in a fixed-size
+// per-thread binary ring. The last-dispatch fields above are reconstructed
+// from the newest event; these snapshots expose the ring itself, which only
+// retains history while tracing is enabled through
+// `objc3_runtime_set_dispatch_trace_enabled_for_testing` or
+// OBJC3_RUNTIME_DISPATCH_TRACE=1.
+typedef struct objc3_runtime_dispatch_trace_state_snapshot {
+  int trace_enabled;
+  uint64_t ring_capacity;
+  uint64_t recorded_event_count;
+  uint64_t retained_event_count;
+} objc3_runtime_dispatch_trace_state_snapshot;
+
+typedef struct objc3_runtime_dispatch_trace_event_snapshot {
+  int found;
+  uint64_t sequence;
+  uint64_t selector_stable_id;
+  uint64_t normalized_receiver_identity;
+  int used_cache;
+  int used_fast_path;
+  int resolved_live_method;
+  int fell_back;
+  const char *selector;
+  const char *dispatch_path;
+  const char *implementation_kind;
+  const char *resolved_class_name;
+} objc3_runtime_dispatch_trace_event_snapshot;
+
+// dispatch-profile anchor: sampled sends aggregated per (class or metaclass,
+// selector) across every thread's profile table. Hits cover the three
+// cache-hit trace paths, slow-path counts and time cover resolutions that
+// missed the shared method cache, and fallbacks cover every path that ended
+// in the formula result.
+typedef struct objc3_runtime_dispatch_profile_state_snapshot {
+  uint64_t sample_period;
+  uint64_t table_count;
+  uint64_t profiled_key_count;
+  uint64_t sample_count;
+  uint64_t dropped_sample_count;
+} objc3_runtime_dispatch_profile_state_snapshot;
+
+typedef struct objc3_runtime_dispatch_profile_entry_snapshot {
+  int found;
+  uint64_t sample_count;
+  uint64_t cache_hit_count;
+  uint64_t slow_path_count;
+  uint64_t fallback_count;
+  uint64_t slow_path_ns;
+} objc3_runtime_dispatch_profile_entry_snapshot;
+
+// selector-handle-dispatch anchor: `--objc3-selector-handles` lowering emits
+// one selector reference per selector-pool entry it sends and calls
+// `objc3_runtime_dispatch_sel_i32` with it. `selector` points at the emitted
+// pool spelling; the runtime fills `handle` with the canonical table handle and
+// stamps the selector-table generation it was bound under.
+typedef struct objc3_runtime_selector_reference {
+  const char *selector;
+  const objc3_runtime_selector_handle *handle;
+  uint64_t selector_table_generation;
+} objc3_runtime_selector_reference;
+
+// dispatch-site-cache anchor: `--objc3-dispatch-site-caches` lowering emits
+// one zero-initialized cell per dynamic send site and routes the send through
+// `objc3_runtime_dispatch_site_cached_i32`. The runtime assigns `site_index`
+// on the site's first miss and publishes the site's current binding in
+// `binding`, so a hit reads the cell itself rather than any per-thread table.
+typedef struct objc3_runtime_dispatch_site_cache {
+  uint64_t site_index;
+  const void *binding;
+} objc3_runtime_dispatch_site_cache;
+
+typedef struct objc3_runtime_dispatch_site_cache_state_snapshot {
+  uint64_t bound_site_count;
+  uint64_t site_cache_hit_count;
+  uint64_t site_cache_miss_count;
+  // Sites that changed target too often and now defer to the thread cache.
+  uint64_t megamorphic_site_count;
+  // Bindings the runtime owns: one per site that has bound a target, however
+  // many targets it has seen.
+  uint64_t site_binding_count;
+} objc3_runtime_dispatch_site_cache_state_snapshot;
+
+// sealed-dispatch-table anchor: `--objc3-sealed-dispatch-tables` lowering
+// emits one dense table per objc_final/objc_sealed class that receives
+// class-method sends. The emitter numbers the hierarchy's class-method
+// selectors lexicographically; `selectors[slot]` names each slot and
+// `entries[slot]` holds the bound implementation or null. `bound_receiver`
+// is the normalized class receiver identity the entries were bound for, or 0
+// while unbound, and lowered sends compare it before loading an entry.
+typedef struct objc3_runtime_sealed_dispatch_table {
+  const char *class_name;
+  const char *const *selectors;
+  const void **entries;
+  uint64_t slot_count;
+  int32_t bound_receiver;
+  int32_t reserved;
+} objc3_runtime_sealed_dispatch_table;
+
+typedef struct objc3_runtime_sealed_dispatch_table_state_snapshot {
+  uint64_t bound_table_count;
+  uint64_t bound_slot_count;
+  uint64_t table_bind_count;
+  uint64_t table_unbind_count;
+  uint64_t table_miss_count;
+} objc3_runtime_sealed_dispatch_table_state_snapshot;
+
 typedef struct objc3_runtime_realized_class_graph_state_snapshot {
   uint64_t realized_class_count;
   uint64_t root_class_count;
@@ -210,8 +352,60 @@ typedef struct objc3_runtime_realized_class_graph_state_snapshot {
   const char *last_attached_category_owner_identity;
   const char *last_attached_category_name;
   const char *last_allocated_class_name;
+  // Registration realizes only the new image's classes; these report how many
+  // nodes it appended, how many cached resolutions it had to drop, and how
+  // often a late super link forced a full cache flush instead.
+  uint64_t last_registration_realized_class_count;
+  uint64_t last_registration_invalidated_cache_entry_count;
+  uint64_t full_class_graph_invalidation_count;
+  // Class, property, and protocol names interned since the last reset;
+  // realized nodes and caches refer to them by 32-bit id.
+  uint64_t interned_symbol_count;
+  // Per-class protocol closures built, and conformance checks answered from
+  // them by a bit test, since the last reset.
+  uint64_t conformance_bitset_build_count;
+  uint64_t conformance_bitset_test_count;
 } objc3_runtime_realized_class_graph_state_snapshot;
 
+// Runtime instances live in a slot slab whose handles encode slot index plus
+// reuse generation; storage comes from power-of-two size-class slabs.
+typedef struct objc3_runtime_instance_slab_state_snapshot {
+  uint64_t live_instance_count;
+  uint64_t slot_capacity;
+  uint64_t free_slot_count;
+  uint64_t reused_slot_count;
+  // Slots held out of service in the wrap quarantine right now.
+  uint64_t retired_slot_count;
+  uint64_t size_class_count;
+  uint64_t reserved_storage_bytes;
+  uint64_t free_storage_block_count;
+  uint64_t oversize_allocation_count;
+  uint64_t wrapped_slot_count;
+} objc3_runtime_instance_slab_state_snapshot;
+
+// Promoted blocks live in their own slot slab with the same handle encoding;
+// invoke pins a block with a retain and calls it on its stable storage.
+typedef struct objc3_runtime_block_slab_state_snapshot {
+  uint64_t live_block_count;
+  uint64_t slot_capacity;
+  uint64_t free_slot_count;
+  uint64_t reused_slot_count;
+  // Slots held out of service in the wrap quarantine right now.
+  uint64_t retired_slot_count;
+  uint64_t wrapped_slot_count;
+} objc3_runtime_block_slab_state_snapshot;
+
+// Realized classes index each class and category method list by selector id;
+// lists naming selectors that were not interned at realization stay linear.
+typedef struct objc3_runtime_method_table_state_snapshot {
+  uint64_t indexed_method_list_count;
+  uint64_t indexed_method_entry_count;
+  uint64_t unindexed_method_list_count;
+  uint64_t method_table_slot_count;
+  uint64_t method_table_probe_count;
+  uint64_t method_list_scan_count;
+} objc3_runtime_method_table_state_snapshot;
+
 typedef struct objc3_runtime_realized_class_entry_snapshot {
   int found;
   uint64_t base_identity;
@@ -242,6 +436,11 @@ typedef struct objc3_runtime_property_registry_state_snapshot {
   uint64_t property_lookup_cache_entry_count;
   uint64_t property_lookup_cache_hit_count;
   uint64_t property_lookup_cache_miss_count;
+  /* Accessors of final/sealed classes that get and set their slot in place
+   * without the runtime mutex, and how many gets and sets took that path. */
+  uint64_t direct_access_property_count;
+  uint64_t direct_access_get_count;
+  uint64_t direct_access_set_count;
   int last_query_found;
   int last_query_inherited;
   int last_query_used_cache;
@@ -257,6 +456,8 @@ typedef struct objc3_runtime_property_entry_snapshot {
   int setter_available;
   int has_runtime_getter;
   int has_runtime_setter;
+  /* 0 locked accessors, 1 direct scalar slot, 2 direct nonatomic strong. */
+  int direct_access;
   uint64_t base_identity;
   uint64_t slot_index;
   uint64_t offset_bytes;
@@ -351,6 +552,38 @@ typedef struct objc3_runtime_memory_management_state_snapshot {
   int last_drained_autorelease_value;
 } objc3_runtime_memory_management_state_snapshot;
 
+// Autoreleased values sit on the calling thread's stack of 4KB pages; pool
+// boundaries and dispatch-frame marks are positions in that stack.
+typedef struct objc3_runtime_autorelease_page_state_snapshot {
+  uint64_t page_size_bytes;
+  uint64_t entries_per_page;
+  uint64_t allocated_page_count;
+  uint64_t page_allocation_count;
+  uint64_t live_entry_count;
+  uint64_t high_water_entry_count;
+} objc3_runtime_autorelease_page_state_snapshot;
+
+// Pool and dispatch-frame drains release their values as one sorted batch;
+// final releases cascade through a worklist rather than recursion.
+typedef struct objc3_runtime_release_batch_state_snapshot {
+  uint64_t release_batch_count;
+  uint64_t batched_release_value_count;
+  uint64_t coalesced_release_value_count;
+  uint64_t cascade_release_count;
+  uint64_t max_pending_release_count;
+  uint64_t pending_release_count;
+} objc3_runtime_release_batch_state_snapshot;
+
+// Weak referrers live in a side table sharded by target across independently
+// locked stripes; weak loads take only the target's stripe.
+typedef struct objc3_runtime_weak_side_table_state_snapshot {
+  uint64_t stripe_count;
+  uint64_t weak_target_count;
+  uint64_t weak_slot_ref_count;
+  uint64_t occupied_stripe_count;
+  uint64_t max_stripe_slot_ref_count;
+} objc3_runtime_weak_side_table_state_snapshot;
+
 typedef struct objc3_runtime_arc_debug_state_snapshot {
   uint64_t retain_call_count;
   uint64_t release_call_count;
@@ -454,6 +687,24 @@ typedef struct objc3_runtime_async_continuation_state_snapshot {
   int last_resume_return_value;
 } objc3_runtime_async_continuation_state_snapshot;
 
+// Async frames are the heap state of state-machine-lowered async functions;
+// suspended frames hold no worker thread while they wait.
+typedef struct objc3_runtime_async_frame_state_snapshot {
+  uint64_t live_frame_count;
+  uint64_t live_frame_bytes;
+  uint64_t pooled_frame_bytes;
+  uint64_t suspended_frame_count;
+  uint64_t suspended_frame_bytes;
+  uint64_t suspension_count;
+  uint64_t inline_await_count;
+  uint64_t completed_frame_count;
+  uint64_t live_continuation_count;
+  uint64_t continuation_capacity;
+  uint64_t continuation_record_bytes;
+  uint64_t resumed_continuation_count;
+  uint64_t cancelled_continuation_count;
+} objc3_runtime_async_frame_state_snapshot;
+
 typedef struct objc3_runtime_task_runtime_state_snapshot {
   uint64_t spawn_call_count;
   uint64_t scope_call_count;
@@ -478,6 +729,19 @@ typedef struct objc3_runtime_task_runtime_state_snapshot {
   int last_cancellation_poll_result;
 } objc3_runtime_task_runtime_state_snapshot;
 
+// Body-carrying tasks run on a work-stealing pool; `main` and named executor
+// tags map to serial executors drained by the same workers.
+typedef struct objc3_runtime_task_executor_state_snapshot {
+  uint64_t worker_count;
+  uint64_t spawned_task_count;
+  uint64_t completed_task_count;
+  uint64_t in_flight_task_count;
+  uint64_t stolen_job_count;
+  uint64_t live_task_handle_count;
+  uint64_t live_task_group_count;
+  uint64_t serial_executor_count;
+} objc3_runtime_task_executor_state_snapshot;
+
 typedef struct objc3_runtime_actor_runtime_state_snapshot {
   uint64_t isolation_thunk_call_count;
   uint64_t nonisolated_entry_call_count;
@@ -504,6 +768,22 @@ typedef struct objc3_runtime_actor_runtime_state_snapshot {
   int last_mailbox_drained_value;
 } objc3_runtime_actor_runtime_state_snapshot;
 
+// Actors share the task pool: each actor handle owns a lock-free MPSC value
+// mailbox and runs messages on a serial executor, its own or the shared one
+// its bound `main`/named tag resolves to. Hops and mailbox drains enter that
+// executor inline when it is idle and queue behind its work otherwise.
+typedef struct objc3_runtime_actor_executor_state_snapshot {
+  uint64_t actor_count;
+  uint64_t sent_message_count;
+  uint64_t executed_job_count;
+  uint64_t executor_turn_count;
+  uint64_t pending_job_count;
+  uint64_t same_executor_hop_count;
+  uint64_t inline_hop_count;
+  uint64_t queued_hop_count;
+  uint64_t pending_mailbox_value_count;
+} objc3_runtime_actor_executor_state_snapshot;
+
 // actor lowering/runtime anchor: actor thunk, nonisolated entry,
 // and executor-hop lowering remain private runtime helpers with a private
 // testing snapshot rather than a public actor runtime ABI.
@@ -546,6 +826,14 @@ void objc3_runtime_stage_registration_table_for_bootstrap(
     const objc3_runtime_registration_table *registration_table);
 int objc3_runtime_copy_image_walk_state_for_testing(
     objc3_runtime_image_walk_state_snapshot *snapshot);
+// prebuilt-metadata-image anchor: emitted constructors stage the image's
+// prebuilt word blob before its registration table; the same next
+// registration consumes both, and the retained record keeps the blob so
+// replay adopts it again.
+void objc3_runtime_stage_prebuilt_image_for_bootstrap(const void *image,
+                                                      uint64_t byte_count);
+int objc3_runtime_copy_prebuilt_image_state_for_testing(
+    objc3_runtime_prebuilt_image_state_snapshot *snapshot);
 // live-registration-discovery-replay anchor: the retained bootstrap
 // catalog, reset/replay snapshot, and replay entrypoint are the canonical
 // runtime-owned proof surface for live discovery tracking and deterministic
@@ -577,8 +865,45 @@ int objc3_runtime_copy_method_cache_state_for_testing(
 int objc3_runtime_copy_method_cache_entry_for_testing(
     int receiver, const char *selector,
     objc3_runtime_method_cache_entry_snapshot *snapshot);
+// Replaces the slow-path ring capacities and drops every slow-path fill;
+// registration seeds stay. Both capacities must be nonzero.
+int objc3_runtime_set_method_cache_capacity_for_testing(
+    uint64_t resolved_capacity, uint64_t negative_capacity);
 int objc3_runtime_copy_dispatch_state_for_testing(
     objc3_runtime_dispatch_state_snapshot *snapshot);
+int objc3_runtime_set_dispatch_trace_enabled_for_testing(int enabled);
+int objc3_runtime_copy_dispatch_trace_state_for_testing(
+    objc3_runtime_dispatch_trace_state_snapshot *snapshot);
+// `age` counts back from the calling thread's newest event (0 = newest).
+int objc3_runtime_copy_dispatch_trace_event_for_testing(
+    uint64_t age, objc3_runtime_dispatch_trace_event_snapshot *snapshot);
+// dispatch-profile anchor: every `period`th send a thread makes through the
+// canonical dispatch entrypoints is sampled; 0 turns sampling off, and each
+// new period discards earlier samples. OBJC3_RUNTIME_DISPATCH_PROFILE=<n>
+// sets the startup period. `objc3_runtime_write_dispatch_profile` writes the
+// samples as folded stacks (`dispatch;Class;+selector;path count`) for
+// flame-graph tools; OBJC3_RUNTIME_DISPATCH_PROFILE_OUTPUT=<path> does so at
+// exit.
+int objc3_runtime_set_dispatch_profile_period_for_testing(uint64_t period);
+int objc3_runtime_copy_dispatch_profile_state_for_testing(
+    objc3_runtime_dispatch_profile_state_snapshot *snapshot);
+int objc3_runtime_copy_dispatch_profile_entry_for_testing(
+    int receiver, const char *selector,
+    objc3_runtime_dispatch_profile_entry_snapshot *snapshot);
+int objc3_runtime_write_dispatch_profile(const char *path);
+int objc3_runtime_dispatch_sel_i32(int receiver,
+                                   objc3_runtime_selector_reference *selector,
+                                   int a0, int a1, int a2, int a3);
+int objc3_runtime_dispatch_site_cached_i32(
+    objc3_runtime_dispatch_site_cache *site, int receiver, const char *selector,
+    int a0, int a1, int a2, int a3);
+int objc3_runtime_copy_dispatch_site_cache_state_for_testing(
+    objc3_runtime_dispatch_site_cache_state_snapshot *snapshot);
+int objc3_runtime_dispatch_sealed_i32(
+    objc3_runtime_sealed_dispatch_table *table, uint64_t slot, int receiver,
+    const char *selector, int a0, int a1, int a2, int a3);
+int objc3_runtime_copy_sealed_dispatch_table_state_for_testing(
+    objc3_runtime_sealed_dispatch_table_state_snapshot *snapshot);
 // metaclass-graph-root-class anchor: the runtime now owns a realized
 // class/metaclass graph with explicit root-class publication, and the
 // canonical proof surface for that graph stays behind private testing
@@ -605,6 +930,14 @@ int objc3_runtime_copy_dispatch_state_for_testing(
 // runtime-owned metadata without widening the public ABI.
 int objc3_runtime_copy_realized_class_graph_state_for_testing(
     objc3_runtime_realized_class_graph_state_snapshot *snapshot);
+int objc3_runtime_copy_instance_slab_state_for_testing(
+    objc3_runtime_instance_slab_state_snapshot *snapshot);
+int objc3_runtime_copy_block_slab_state_for_testing(
+    objc3_runtime_block_slab_state_snapshot *snapshot);
+int objc3_runtime_copy_task_executor_state_for_testing(
+    objc3_runtime_task_executor_state_snapshot *snapshot);
+int objc3_runtime_copy_method_table_state_for_testing(
+    objc3_runtime_method_table_state_snapshot *snapshot);
 int objc3_runtime_copy_realized_class_entry_for_testing(
     const char *class_name,
     objc3_runtime_realized_class_entry_snapshot *snapshot);
@@ -618,6 +951,11 @@ int objc3_runtime_copy_storage_accessor_implementation_snapshot_for_testing(
 int objc3_runtime_copy_protocol_conformance_query_for_testing(
     const char *class_name, const char *protocol_name,
     objc3_runtime_protocol_conformance_query_snapshot *snapshot);
+// conformance-bitset anchor: `id<Proto>` checks on a live receiver resolve
+// its realized class and test one bit of that class's memoized protocol
+// closure. Returns 1 when the receiver's class conforms, 0 otherwise.
+int objc3_runtime_receiver_conforms_to_protocol_i32(int receiver,
+                                                    const char *protocol_name);
 int objc3_runtime_copy_object_model_query_state_for_testing(
     objc3_runtime_object_model_query_state_snapshot *snapshot);
 // optional/key-path runtime-helper freeze anchor: the current Part 3
@@ -638,6 +976,13 @@ int objc3_runtime_copy_object_model_query_state_for_testing(
 // second key-path registry model.
 int objc3_runtime_keypath_component_count_for_testing(int keypath_handle);
 int objc3_runtime_keypath_root_is_self_for_testing(int keypath_handle);
+// keypath-chain anchor: evaluate a registered key path handle of any depth
+// against a live receiver through the accessor chain compiled for the
+// receiver's class. Get returns the final component's value, or 0 when the
+// path does not resolve (strong values come back unretained); set stores
+// through the final component's ownership rules and returns 1 on success.
+int objc3_runtime_keypath_get_i32(int keypath_handle, int receiver);
+int objc3_runtime_keypath_set_i32(int keypath_handle, int receiver, int value);
 // ownership runtime hook emission anchor: lowering-generated
 // synthesized accessors target these private runtime helpers so retain/release,
 // autorelease, and weak property paths execute against realized runtime-backed
@@ -820,6 +1165,20 @@ int objc3_runtime_handoff_async_continuation_to_executor_i32(
     int continuation_handle, int executor_tag);
 int objc3_runtime_resume_async_continuation_i32(int continuation_handle,
                                                 int result_value);
+// async-frame anchor: state-machine-lowered async functions keep their
+// locals in a runtime-pooled frame. The entry wrapper runs the frame
+// synchronously or spawns it as a task; each await stores the awaited value
+// and either continues inline or returns after the frame was handed to the
+// awaited executor. Parked frames wait on a continuation that any thread may
+// resume or cancel.
+int objc3_runtime_cancel_async_continuation_i32(int continuation_handle);
+void *objc3_runtime_allocate_async_frame(int (*resume)(void *slots),
+                                         uint64_t slot_bytes);
+int objc3_runtime_run_async_frame_i32(void *slots);
+int objc3_runtime_await_async_frame_i32(void *slots, int executor_tag);
+int objc3_runtime_park_async_frame_i32(void *slots, int continuation_handle);
+int objc3_runtime_spawn_async_frame_task_i32(int task_kind, void *slots,
+                                             int executor_tag);
 // task-runtime lowering anchor: the IR emitter now rewrites the
 // supported task/executor/cancellation symbol-profile family onto this private
 // helper cluster so task creation, task-group operations, cancellation polls,
@@ -840,6 +1199,27 @@ int objc3_runtime_cancel_task_group_i32(int executor_tag);
 int objc3_runtime_task_is_cancelled_i32(int executor_tag);
 int objc3_runtime_task_on_cancel_i32(int executor_tag);
 int objc3_runtime_executor_hop_i32(int value, int executor_tag);
+// task-executor anchor: tasks whose body is a promoted block run on the
+// runtime's work-stealing executor. Child tasks (kind 1) are joined for their
+// result; detached tasks (kind 2) retire on completion. Group tasks complete
+// into the group in completion order for `next`, and cancellation is
+// cooperative: `objc3_runtime_task_is_cancelled_i32` reports it to the running
+// body. Lowering passes a promoted task body here, and spawns group bodies
+// into the caller's lowered group from
+// `objc3_runtime_open_lowered_task_group_i32`; `wait_next` and `cancel_all`
+// then act on that group. Body-less symbol-profile helpers above keep their
+// deterministic results.
+int objc3_runtime_spawn_block_task_i32(int task_kind, int block_handle,
+                                       int argument, int executor_tag);
+int objc3_runtime_join_task_i32(int task_handle);
+int objc3_runtime_cancel_task_i32(int task_handle);
+int objc3_runtime_create_task_group_i32(int executor_tag);
+int objc3_runtime_task_group_spawn_block_i32(int group_handle,
+                                             int block_handle, int argument);
+int objc3_runtime_task_group_next_i32(int group_handle, int *result_out);
+int objc3_runtime_cancel_task_group_tasks_i32(int group_handle);
+int objc3_runtime_join_task_group_i32(int group_handle);
+int objc3_runtime_open_lowered_task_group_i32(void);
 int objc3_runtime_actor_enter_isolation_thunk_i32(int executor_tag);
 int objc3_runtime_actor_enter_nonisolated_i32(int value, int executor_tag);
 int objc3_runtime_actor_hop_to_executor_i32(int value, int executor_tag);
@@ -850,6 +1230,11 @@ int objc3_runtime_actor_mailbox_enqueue_i32(int actor_handle, int value,
                                             int executor_tag);
 int objc3_runtime_actor_mailbox_drain_next_i32(int actor_handle,
                                                int executor_tag);
+// actor-executor anchor: mailbox values and hops are process-wide, and a
+// drain or hop runs on the actor's serial executor, so no two threads ever
+// run one actor at once. Sent blocks run as actor messages in send order.
+int objc3_runtime_actor_send_block_i32(int actor_handle, int block_handle,
+                                       int argument);
 int objc3_runtime_retain_i32(int value);
 int objc3_runtime_release_i32(int value);
 int objc3_runtime_autorelease_i32(int value);
@@ -885,6 +1270,12 @@ void objc3_runtime_push_autoreleasepool_scope(void);
 void objc3_runtime_pop_autoreleasepool_scope(void);
 int objc3_runtime_copy_memory_management_state_for_testing(
     objc3_runtime_memory_management_state_snapshot *snapshot);
+int objc3_runtime_copy_autorelease_page_state_for_testing(
+    objc3_runtime_autorelease_page_state_snapshot *snapshot);
+int objc3_runtime_copy_release_batch_state_for_testing(
+    objc3_runtime_release_batch_state_snapshot *snapshot);
+int objc3_runtime_copy_weak_side_table_state_for_testing(
+    objc3_runtime_weak_side_table_state_snapshot *snapshot);
 // ownership-debug/runtime-validation anchor: ARC ownership-debug
 // counters and last-value/property context remain a private runtime-testing
 // surface so lane-D can validate ARC helper traffic without widening the
@@ -909,10 +1300,14 @@ int objc3_runtime_copy_error_bridge_state_for_testing(
     objc3_runtime_error_bridge_state_snapshot *snapshot);
 int objc3_runtime_copy_async_continuation_state_for_testing(
     objc3_runtime_async_continuation_state_snapshot *snapshot);
+int objc3_runtime_copy_async_frame_state_for_testing(
+    objc3_runtime_async_frame_state_snapshot *snapshot);
 int objc3_runtime_copy_task_runtime_state_for_testing(
     objc3_runtime_task_runtime_state_snapshot *snapshot);
 int objc3_runtime_copy_actor_runtime_state_for_testing(
     objc3_runtime_actor_runtime_state_snapshot *snapshot);
+int objc3_runtime_copy_actor_executor_state_for_testing(
+    objc3_runtime_actor_executor_state_snapshot *snapshot);
 
 #ifdef __cplusplus
 }
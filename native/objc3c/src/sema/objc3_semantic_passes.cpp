@@ -1690,6 +1690,7 @@ struct Objc3MessageSendResolutionContext {
   bool inside_method = false;
   bool is_class_method = false;
   bool inside_async_context = false;
+  const std::unordered_set<std::string> *declared_protocol_names = nullptr;
 };
 
 std::string BuildConcurrencyTaskLowercaseProfileToken(std::string token) {
@@ -6742,6 +6743,19 @@ static SemanticTypeInfo ValidateExpr(const Expr *expr, const std::vector<Semanti
         }
         return MakeScalarSemanticType(ValueType::ObjCId);
       }
+      if (expr->protocol_literal_enabled) {
+        if (message_send_context.declared_protocol_names == nullptr ||
+            message_send_context.declared_protocol_names->count(
+                expr->protocol_literal_name) == 0u) {
+          diagnostics.push_back(MakeDiag(
+              expr->line, expr->column, "O3S206",
+              "type mismatch: protocol literal '" +
+                  expr->protocol_literal_name +
+                  "' does not name a declared protocol"));
+          return MakeScalarSemanticType(ValueType::Unknown);
+        }
+        return MakeScalarSemanticType(ValueType::ObjCId);
+      }
       if (expr->ident == "super" && !message_send_context.inside_method) {
         diagnostics.push_back(MakeDiag(
             expr->line, expr->column, "O3S216",
@@ -26128,6 +26142,10 @@ void ValidateSemanticBodies(const Objc3ParsedProgram &program, const Objc3Semant
   for (const auto &implementation_decl : ast.implementations) {
     body_globals.try_emplace(implementation_decl.name, ValueType::ObjCClass);
   }
+  std::unordered_set<std::string> declared_protocol_names;
+  for (const auto &protocol_decl : ast.protocols) {
+    declared_protocol_names.insert(protocol_decl.name);
+  }
   StaticScalarBindings global_static_bindings;
   std::unordered_set<std::string> assigned_identifier_names;
   for (const auto &fn : ast.functions) {
@@ -26206,6 +26224,7 @@ void ValidateSemanticBodies(const Objc3ParsedProgram &program, const Objc3Semant
       const StaticScalarBindings static_scalar_bindings = CollectFunctionStaticScalarBindings(fn, &global_static_bindings);
       Objc3MessageSendResolutionContext message_send_context;
       message_send_context.surface = &surface;
+      message_send_context.declared_protocol_names = &declared_protocol_names;
       message_send_context.inside_async_context = fn.async_declared;
       ValidateStatements(fn.body, scopes, body_globals, surface.functions, expected_return_type, fn.name, diagnostics,
                          0, 0, 0, 0, false, options.max_message_send_args,
@@ -26309,6 +26328,7 @@ void ValidateSemanticBodies(const Objc3ParsedProgram &program, const Objc3Semant
           "method '" + MethodSelectorName(method) + "' in implementation '" + implementation_decl.name + "'";
       Objc3MessageSendResolutionContext message_send_context;
       message_send_context.surface = &surface;
+      message_send_context.declared_protocol_names = &declared_protocol_names;
       message_send_context.current_implementation_name = implementation_decl.name;
       message_send_context.inside_method = true;
       message_send_context.is_class_method = method.is_class_method;
@@ -24,6 +24,31 @@ SUPPORTED_WORKLOAD_IDS = (
     "reflection-query",
     "ownership-helpers",
     "storage-ownership-reflection",
+    "dispatch-contention",
+    "dispatch-site-cache",
+    "selector-handle-dispatch",
+    "startup-incremental-realization",
+    "instance-allocation-churn",
+    "retain-release-contention",
+    "weak-side-table",
+    "autorelease-page-stack",
+    "release-batch-teardown",
+    "block-invoke-throughput",
+    "task-executor",
+    "actor-ping-pong",
+    "async-continuation-suspension",
+    "receiver-handle-decode",
+    "class-symbol-table",
+    "protocol-conformance-query",
+    "direct-property-access",
+    "keypath-chain-evaluation",
+    "bounded-method-cache",
+    "runtime-metrics-export",
+    "dispatch-profile",
+    "startup-large-image",
+    "cold-method-miss",
+    "sealed-dispatch-table",
+    "startup-prebuilt-image",
 )
 CASE_FUNCTION_NAMES = {
     "startup-installation": "check_installation_lifecycle_case",
@@ -31,6 +56,31 @@ CASE_FUNCTION_NAMES = {
     "reflection-query": "check_realization_lookup_reflection_runtime_case",
     "ownership-helpers": "check_arc_property_helper_case",
     "storage-ownership-reflection": "check_storage_ownership_reflection_case",
+    "dispatch-contention": "check_dispatch_cache_contention_case",
+    "dispatch-site-cache": "check_dispatch_site_cache_case",
+    "selector-handle-dispatch": "check_selector_handle_dispatch_case",
+    "startup-incremental-realization": "check_incremental_class_realization_case",
+    "instance-allocation-churn": "check_instance_allocation_churn_case",
+    "retain-release-contention": "check_retain_release_contention_case",
+    "weak-side-table": "check_weak_side_table_case",
+    "autorelease-page-stack": "check_autorelease_page_stack_case",
+    "release-batch-teardown": "check_release_batch_teardown_case",
+    "block-invoke-throughput": "check_block_invoke_throughput_case",
+    "task-executor": "check_task_executor_case",
+    "actor-ping-pong": "check_actor_ping_pong_case",
+    "async-continuation-suspension": "check_async_continuation_suspension_case",
+    "receiver-handle-decode": "check_receiver_handle_decode_case",
+    "class-symbol-table": "check_class_symbol_table_case",
+    "protocol-conformance-query": "check_protocol_conformance_query_case",
+    "direct-property-access": "check_direct_property_access_case",
+    "keypath-chain-evaluation": "check_keypath_chain_evaluation_case",
+    "bounded-method-cache": "check_bounded_method_cache_case",
+    "runtime-metrics-export": "check_runtime_metrics_export_case",
+    "dispatch-profile": "check_dispatch_profile_case",
+    "startup-large-image": "check_large_image_class_realization_case",
+    "cold-method-miss": "check_cold_method_miss_case",
+    "sealed-dispatch-table": "check_sealed_dispatch_table_case",
+    "startup-prebuilt-image": "check_prebuilt_metadata_image_startup_case",
 }
 
 
@@ -334,6 +334,123 @@ BLOCK_ARC_RUNTIME_ABI_PROBE = (
 REALIZATION_LOOKUP_REFLECTION_RUNTIME_PROBE = (
     "tests/tooling/runtime/object_model_lookup_reflection_runtime_probe.cpp"
 )
+DISPATCH_CACHE_CONTENTION_BENCHMARK_PROBE = (
+    "tests/tooling/runtime/dispatch_cache_contention_benchmark_probe.cpp"
+)
+DISPATCH_TRACE_RING_PROBE = (
+    "tests/tooling/runtime/dispatch_trace_ring_probe.cpp"
+)
+DISPATCH_SITE_CACHE_BENCHMARK_PROBE = (
+    "tests/tooling/runtime/dispatch_site_cache_benchmark_probe.cpp"
+)
+DISPATCH_SITE_CACHE_FIXTURE = (
+    "tests/tooling/fixtures/native/dispatch_site_cache_send_loop_positive.objc3"
+)
+SELECTOR_HANDLE_DISPATCH_PROBE = (
+    "tests/tooling/runtime/selector_handle_dispatch_probe.cpp"
+)
+INCREMENTAL_CLASS_REALIZATION_BENCHMARK_PROBE = (
+    "tests/tooling/runtime/incremental_class_realization_benchmark_probe.cpp"
+)
+PREBUILT_METADATA_IMAGE_STARTUP_PROBE = (
+    "tests/tooling/runtime/prebuilt_metadata_image_startup_probe.cpp"
+)
+PREBUILT_METADATA_IMAGE_LARGE_CLASS_COUNT = 256
+PREBUILT_METADATA_IMAGE_LARGE_METHODS_PER_CLASS = 4
+INSTANCE_ALLOCATION_CHURN_BENCHMARK_PROBE = (
+    "tests/tooling/runtime/instance_allocation_churn_benchmark_probe.cpp"
+)
+RETAIN_RELEASE_STRESS_BENCHMARK_PROBE = (
+    "tests/tooling/runtime/retain_release_stress_benchmark_probe.cpp"
+)
+WEAK_SIDE_TABLE_BENCHMARK_PROBE = (
+    "tests/tooling/runtime/weak_side_table_benchmark_probe.cpp"
+)
+WEAK_SIDE_TABLE_FIXTURE = (
+    "tests/tooling/fixtures/native/reference_counting_weak_autoreleasepool_positive.objc3"
+)
+AUTORELEASE_PAGE_STACK_BENCHMARK_PROBE = (
+    "tests/tooling/runtime/autorelease_page_stack_benchmark_probe.cpp"
+)
+RELEASE_BATCH_TEARDOWN_BENCHMARK_PROBE = (
+    "tests/tooling/runtime/release_batch_teardown_benchmark_probe.cpp"
+)
+BLOCK_INVOKE_BENCHMARK_PROBE = "tests/tooling/runtime/block_invoke_benchmark_probe.cpp"
+TASK_EXECUTOR_BENCHMARK_PROBE = "tests/tooling/runtime/task_executor_benchmark_probe.cpp"
+TASK_GROUP_BLOCK_BODY_FIXTURE = (
+    "tests/tooling/fixtures/native/task_group_block_body_positive.objc3"
+)
+ACTOR_PING_PONG_BENCHMARK_PROBE = (
+    "tests/tooling/runtime/actor_ping_pong_benchmark_probe.cpp"
+)
+ASYNC_CONTINUATION_SUSPENSION_BENCHMARK_PROBE = (
+    "tests/tooling/runtime/async_continuation_suspension_benchmark_probe.cpp"
+)
+ASYNC_LOWERING_EXECUTION_FIXTURES = (
+    "tests/tooling/fixtures/native/async_lowering_positive.objc3",
+    "tests/tooling/fixtures/native/continuation_runtime_helper_positive.objc3",
+    "tests/tooling/fixtures/native/async_await_executor_source_closure_positive.objc3",
+)
+ASYNC_AWAIT_SERIAL_SUSPENSION_FIXTURE = (
+    "tests/tooling/fixtures/native/async_await_serial_suspension_positive.objc3"
+)
+ASYNC_AWAIT_SERIAL_SUSPENSION_PROBE = (
+    "tests/tooling/runtime/async_await_serial_suspension_probe.cpp"
+)
+RECEIVER_HANDLE_DECODE_BENCHMARK_PROBE = (
+    "tests/tooling/runtime/receiver_handle_decode_benchmark_probe.cpp"
+)
+CLASS_SYMBOL_TABLE_BENCHMARK_PROBE = (
+    "tests/tooling/runtime/class_symbol_table_benchmark_probe.cpp"
+)
+PROTOCOL_CONFORMANCE_QUERY_BENCHMARK_PROBE = (
+    "tests/tooling/runtime/protocol_conformance_query_benchmark_probe.cpp"
+)
+PROTOCOL_CONFORMANCE_QUERY_LOWERING_FIXTURE = (
+    "tests/tooling/fixtures/native/protocol_conformance_query_lowering_positive.objc3"
+)
+CANONICAL_RUNNABLE_SAMPLE_SET_FIXTURE = (
+    "tests/tooling/fixtures/native/canonical_runnable_sample_set.objc3"
+)
+DIRECT_PROPERTY_ACCESS_BENCHMARK_PROBE = (
+    "tests/tooling/runtime/direct_property_access_benchmark_probe.cpp"
+)
+DIRECT_PROPERTY_ACCESS_FIXTURE = (
+    "tests/tooling/fixtures/native/direct_property_access_positive.objc3"
+)
+KEYPATH_CHAIN_EVALUATION_BENCHMARK_PROBE = (
+    "tests/tooling/runtime/keypath_chain_evaluation_benchmark_probe.cpp"
+)
+KEYPATH_CHAIN_EVALUATION_FIXTURE = (
+    "tests/tooling/fixtures/native/keypath_chain_evaluation_positive.objc3"
+)
+BOUNDED_METHOD_CACHE_BENCHMARK_PROBE = (
+    "tests/tooling/runtime/bounded_method_cache_benchmark_probe.cpp"
+)
+BOUNDED_METHOD_CACHE_FIXTURE = (
+    "tests/tooling/fixtures/native/bounded_method_cache_positive.objc3"
+)
+RUNTIME_METRICS_EXPORT_BENCHMARK_PROBE = (
+    "tests/tooling/runtime/runtime_metrics_export_benchmark_probe.cpp"
+)
+DISPATCH_PROFILE_BENCHMARK_PROBE = (
+    "tests/tooling/runtime/dispatch_profile_benchmark_probe.cpp"
+)
+DISPATCH_PROFILE_FIXTURE = (
+    "tests/tooling/fixtures/native/dispatch_profile_positive.objc3"
+)
+LARGE_IMAGE_CLASS_REALIZATION_BENCHMARK_PROBE = (
+    "tests/tooling/runtime/large_image_class_realization_benchmark_probe.cpp"
+)
+COLD_METHOD_MISS_BENCHMARK_PROBE = (
+    "tests/tooling/runtime/cold_method_miss_benchmark_probe.cpp"
+)
+SEALED_DISPATCH_TABLE_BENCHMARK_PROBE = (
+    "tests/tooling/runtime/sealed_dispatch_table_benchmark_probe.cpp"
+)
+SEALED_DISPATCH_TABLE_FIXTURE = (
+    "tests/tooling/fixtures/native/sealed_dispatch_table_positive.objc3"
+)
 RUNTIME_ACCEPTANCE_COMMAND = "python scripts/check_objc3c_runtime_acceptance.py"
 VALIDATE_RUNTIME_ARCHITECTURE_COMMAND = (
     "python scripts/objc3c_public_workflow_runner.py validate-runtime-architecture"
@@ -13814,6 +13931,1590 @@ def check_live_dispatch_fast_path_case(clangxx: str, run_dir: Path) -> CaseResul
     )
 
 
+def check_dispatch_cache_contention_case(clangxx: str, run_dir: Path) -> CaseResult:
+    case_dir = run_dir / "dispatch-cache-contention"
+    probe = ROOT / Path(DISPATCH_CACHE_CONTENTION_BENCHMARK_PROBE)
+    exe_path = case_dir / "dispatch_cache_contention_benchmark_probe.exe"
+    compile_probe(clangxx, probe, exe_path, [])
+    payload = parse_json_output(run_probe(exe_path), "dispatch cache contention probe")
+
+    samples = payload.get("samples")
+    expect(
+        isinstance(samples, list) and [row.get("thread_count") for row in samples] == [1, 2, 4, 8],
+        "expected dispatch cache contention probe to publish 1/2/4/8-thread samples",
+    )
+    expect(payload.get("results_match") == 1, "expected contended cache-hit sends to stay deterministic")
+    expect(payload.get("cache_status") == 0, "expected method-cache snapshot to succeed after contention")
+    expect(
+        payload.get("cache_miss_count") == payload.get("receiver_count")
+        and payload.get("cache_entry_count") == payload.get("receiver_count"),
+        "expected one shared method-cache miss per contended receiver",
+    )
+    expect(
+        payload.get("cache_hit_count", 0) + payload.get("cache_miss_count", 0)
+        == payload.get("expected_send_count"),
+        "expected lock-free cache hits to stay visible in the shared hit counter",
+    )
+    expect(
+        payload.get("hits_stay_unlocked") == 1,
+        "expected every timed contended send to hit its thread cache without the runtime mutex",
+    )
+    hardware_threads = payload.get("hardware_threads", 0)
+    expect(
+        all(
+            row.get("scaling_ratio", 0) > 1.0
+            for row in samples
+            if 1 < row.get("thread_count", 0) <= hardware_threads
+        ),
+        "expected contended cache-hit throughput to grow with every thread count the host can run in parallel",
+    )
+
+    return CaseResult(
+        case_id="dispatch-cache-contention",
+        probe=DISPATCH_CACHE_CONTENTION_BENCHMARK_PROBE,
+        fixture=None,
+        claim_class="linked-runtime-probe",
+        passed=True,
+        summary={
+            "sends_per_thread": payload.get("sends_per_thread"),
+            "sends_per_second_by_thread_count": {
+                str(row.get("thread_count")): row.get("sends_per_second")
+                for row in samples
+                if isinstance(row, dict)
+            },
+            "scaling_ratio_by_thread_count": {
+                str(row.get("thread_count")): row.get("scaling_ratio")
+                for row in samples
+                if isinstance(row, dict)
+            },
+            "hardware_threads": hardware_threads,
+            "peak_scaling_ratio": payload.get("peak_scaling_ratio"),
+            "cache_hit_count": payload.get("cache_hit_count"),
+            "cache_miss_count": payload.get("cache_miss_count"),
+        },
+    )
+
+
+def check_dispatch_trace_ring_case(clangxx: str, run_dir: Path) -> CaseResult:
+    case_dir = run_dir / "dispatch-trace-ring"
+    probe = ROOT / Path(DISPATCH_TRACE_RING_PROBE)
+    exe_path = case_dir / "dispatch_trace_ring_probe.exe"
+    compile_probe(clangxx, probe, exe_path, [])
+    payload = parse_json_output(run_probe(exe_path), "dispatch trace ring probe")
+
+    untraced_state = payload.get("untraced_state", {})
+    traced_state = payload.get("traced_state", {})
+    newest_event = payload.get("newest_event", {})
+    miss_event = payload.get("miss_event", {})
+    hit_event = payload.get("hit_event", {})
+    expect(
+        untraced_state.get("trace_enabled") == 0
+        and untraced_state.get("retained_event_count") == 1
+        and untraced_state.get("recorded_event_count") == payload.get("timed_send_count", 0) + 1,
+        "expected untraced dispatch to keep only the newest binary trace event",
+    )
+    expect(
+        payload.get("untraced_last_dispatch_path") == "cache-hit-fallback"
+        and payload.get("untraced_last_selector") == "traceProbe:",
+        "expected last-dispatch snapshots to be reconstructed from the trace ring head",
+    )
+    expect(
+        traced_state.get("trace_enabled") == 1
+        and traced_state.get("retained_event_count") == traced_state.get("ring_capacity"),
+        "expected enabled tracing to retain a full ring of dispatch events",
+    )
+    expect(
+        newest_event.get("dispatch_path") == "nil-short-circuit"
+        and miss_event.get("dispatch_path") == "slow-path-fallback"
+        and miss_event.get("normalized_receiver_identity") == 1042
+        and hit_event.get("dispatch_path") == "cache-hit-fallback"
+        and hit_event.get("sequence", 0) + 2 == newest_event.get("sequence"),
+        "expected traced dispatch events to replay in send order",
+    )
+    expect(payload.get("expired_event_found") == 0, "expected events older than the ring to be reported missing")
+
+    return CaseResult(
+        case_id="dispatch-trace-ring",
+        probe=DISPATCH_TRACE_RING_PROBE,
+        fixture=None,
+        claim_class="linked-runtime-probe",
+        passed=True,
+        summary={
+            "ring_capacity": traced_state.get("ring_capacity"),
+            "untraced_sends_per_second": payload.get("untraced_sends_per_second"),
+            "traced_sends_per_second": payload.get("traced_sends_per_second"),
+        },
+    )
+
+
+def check_dispatch_site_cache_case(clangxx: str, run_dir: Path) -> CaseResult:
+    case_dir = run_dir / "dispatch-site-cache"
+    _, ll_path, _ = compile_fixture_outputs_with_args(
+        ROOT / Path(DISPATCH_SITE_CACHE_FIXTURE),
+        case_dir / "compile",
+        ["--objc3-dispatch-site-caches"],
+    )
+    ll_text = ll_path.read_text(encoding="utf-8")
+    expect(
+        "@__objc3_dispatch_site_cache_0 = internal global { i64, ptr } zeroinitializer" in ll_text
+        and "call i32 @objc3_runtime_dispatch_site_cached_i32(ptr @__objc3_dispatch_site_cache_0"
+        in ll_text
+        and "call i32 @objc3_runtime_dispatch_i32(" not in ll_text,
+        "expected site-cache lowering to route the send through its own cache cell",
+    )
+
+    probe = ROOT / Path(DISPATCH_SITE_CACHE_BENCHMARK_PROBE)
+    exe_path = case_dir / "dispatch_site_cache_benchmark_probe.exe"
+    compile_probe(clangxx, probe, exe_path, [])
+    payload = parse_json_output(run_probe(exe_path), "dispatch site cache benchmark probe")
+    expect(payload.get("results_match") == 1, "expected site-cached sends to match canonical dispatch results")
+    expect(
+        payload.get("site_index") == 1
+        and payload.get("warm_site_cache_miss_count") == 1
+        and payload.get("warm_site_cache_hit_count") == payload.get("timed_send_count", 0) - 1,
+        "expected one bind miss followed by site-cache hits for the timed loop",
+    )
+    expect(
+        payload.get("rebound_matches") == 1
+        and payload.get("nil_result") == 0
+        and payload.get("null_site_matches") == 1,
+        "expected receiver changes, nil receivers, and null sites to keep canonical semantics",
+    )
+    expect(
+        payload.get("polymorphic_matches") == 1 and payload.get("megamorphic_site_count") == 1,
+        "expected a site that keeps changing receivers to go megamorphic with canonical results",
+    )
+    expect(
+        payload.get("site_binding_count") == 2,
+        "expected each site to rewrite its one binding in place instead of allocating per target",
+    )
+    expect(
+        payload.get("site_speedup_ratio", 0) > 1.0,
+        "expected site-cached sends to outrun canonical dispatch",
+    )
+
+    return CaseResult(
+        case_id="dispatch-site-cache",
+        probe=DISPATCH_SITE_CACHE_BENCHMARK_PROBE,
+        fixture=DISPATCH_SITE_CACHE_FIXTURE,
+        claim_class="linked-runtime-probe",
+        passed=True,
+        summary={
+            "canonical_sends_per_second": payload.get("canonical_sends_per_second"),
+            "site_cached_sends_per_second": payload.get("site_cached_sends_per_second"),
+            "site_speedup_ratio": payload.get("site_speedup_ratio"),
+        },
+    )
+
+
+def check_selector_handle_dispatch_case(clangxx: str, run_dir: Path) -> CaseResult:
+    case_dir = run_dir / "selector-handle-dispatch"
+    _, ll_path, _ = compile_fixture_outputs_with_args(
+        ROOT / Path(DISPATCH_SITE_CACHE_FIXTURE),
+        case_dir / "compile",
+        ["--objc3-selector-handles"],
+    )
+    ll_text = ll_path.read_text(encoding="utf-8")
+    expect(
+        "@__objc3_sel_ref_0000 = internal global { ptr, ptr, i64 } { ptr @__objc3_sel_pool_0000, ptr null, i64 0 }"
+        in ll_text
+        and "call i32 @objc3_runtime_dispatch_sel_i32(" in ll_text
+        and "call i32 @objc3_runtime_dispatch_i32(" not in ll_text,
+        "expected selector-handle lowering to pass an emitted selector reference",
+    )
+
+    probe = ROOT / Path(SELECTOR_HANDLE_DISPATCH_PROBE)
+    exe_path = case_dir / "selector_handle_dispatch_probe.exe"
+    compile_probe(clangxx, probe, exe_path, [])
+    payload = parse_json_output(run_probe(exe_path), "selector handle dispatch probe")
+    expect(payload.get("results_match") == 1, "expected handle sends to match spelling sends")
+    expect(
+        payload.get("handle_selector_lookups") == 0
+        and payload.get("spelling_selector_lookups", 0) > 0
+        and payload.get("bound_selector_reference_count") == 1
+        and payload.get("bound_to_canonical") == 1,
+        "expected a bound selector reference to skip selector spelling lookups",
+    )
+    expect(
+        payload.get("generation_after_reset", 0) > payload.get("generation_before_reset", 0)
+        and payload.get("rebound_selector_reference_count") == 1
+        and payload.get("rebound_matches") == 1
+        and payload.get("nil_result") == 0,
+        "expected selector references to rebind after a selector-table reset",
+    )
+
+    return CaseResult(
+        case_id="selector-handle-dispatch",
+        probe=SELECTOR_HANDLE_DISPATCH_PROBE,
+        fixture=DISPATCH_SITE_CACHE_FIXTURE,
+        claim_class="linked-runtime-probe",
+        passed=True,
+        summary={
+            "spelling_sends_per_second": payload.get("spelling_sends_per_second"),
+            "handle_sends_per_second": payload.get("handle_sends_per_second"),
+            "handle_speedup_ratio": payload.get("handle_speedup_ratio"),
+        },
+    )
+
+
+def check_incremental_class_realization_case(clangxx: str, run_dir: Path) -> CaseResult:
+    case_dir = run_dir / "startup-incremental-realization"
+    probe = ROOT / Path(INCREMENTAL_CLASS_REALIZATION_BENCHMARK_PROBE)
+    exe_path = case_dir / "incremental_class_realization_benchmark_probe.exe"
+    compile_probe(clangxx, probe, exe_path, [])
+    payload = parse_json_output(run_probe(exe_path), "incremental class realization probe")
+
+    samples = payload.get("samples")
+    expect(
+        isinstance(samples, list) and [row.get("image_count") for row in samples] == [1, 10, 100, 1000],
+        "expected incremental class realization probe to publish 1/10/100/1000-image samples",
+    )
+    classes_per_image = payload.get("classes_per_image", 0)
+    expect(
+        all(
+            row.get("realized_class_count") == row.get("image_count") * classes_per_image
+            and row.get("metaclass_edge_count") == row.get("image_count") * classes_per_image - 1
+            for row in samples
+        ),
+        "expected every registration to realize and link only its own image's classes",
+    )
+    expect(payload.get("samples_ok") == 1, "expected incremental registration to avoid full graph flushes")
+    expect(
+        payload.get("unaffected_invalidated_cache_entry_count") == 0
+        and payload.get("unaffected_cache_hit_count") == 1
+        and payload.get("unaffected_cache_miss_count") == 0
+        and payload.get("unbound_results_match") == 1,
+        "expected registration to keep cached resolutions for receivers the new image cannot reach",
+    )
+    expect(
+        payload.get("affected_invalidated_cache_entry_count") == 1
+        and payload.get("full_class_graph_invalidation_count") == 0,
+        "expected registration to drop only the cached resolutions on rebound receiver ordinals",
+    )
+
+    return CaseResult(
+        case_id="startup-incremental-realization",
+        probe=INCREMENTAL_CLASS_REALIZATION_BENCHMARK_PROBE,
+        fixture=None,
+        claim_class="linked-runtime-probe",
+        passed=True,
+        summary={
+            "classes_per_image": classes_per_image,
+            "per_image_us_by_image_count": {
+                str(row.get("image_count")): row.get("per_image_us")
+                for row in samples
+                if isinstance(row, dict)
+            },
+            "late_to_early_per_image_ratio": payload.get("late_to_early_per_image_ratio"),
+            "affected_invalidated_cache_entry_count": payload.get(
+                "affected_invalidated_cache_entry_count"
+            ),
+        },
+    )
+
+
+def write_prebuilt_metadata_image_large_source(path: Path) -> None:
+    lines = [f"module prebuiltImageLarge{PREBUILT_METADATA_IMAGE_LARGE_CLASS_COUNT};", ""]
+    for class_index in range(PREBUILT_METADATA_IMAGE_LARGE_CLASS_COUNT):
+        class_name = f"C{class_index:04d}"
+        selectors = [
+            f"c{class_index:04d}v{method_index}"
+            for method_index in range(PREBUILT_METADATA_IMAGE_LARGE_METHODS_PER_CLASS)
+        ]
+        lines.append(f"@interface {class_name}")
+        lines.extend(f"+ (i32) {selector};" for selector in selectors)
+        lines.extend(["@end", "", f"@implementation {class_name}"])
+        for method_index, selector in enumerate(selectors):
+            lines.extend([f"+ (i32) {selector} {{", f"  return {method_index};", "}"])
+        lines.extend(["@end", ""])
+    path.parent.mkdir(parents=True, exist_ok=True)
+    path.write_text("\n".join(lines), encoding="utf-8")
+
+
+def run_prebuilt_metadata_image_startup_probe(
+    clangxx: str,
+    fixture: Path,
+    case_dir: Path,
+    class_name: str,
+    class_selector: str,
+    class_result: int,
+) -> dict[str, object]:
+    obj_path, ll_path, _ = compile_fixture_outputs(fixture, case_dir / "compile")
+    ll_text = ll_path.read_text(encoding="utf-8")
+    image_global = re.search(
+        r"^@__objc3_runtime_prebuilt_image_\w+ = internal constant \[(\d+) x i32\] \[(.*)\], "
+        r'section "objc3\.runtime\.prebuilt_image", align 4$',
+        ll_text,
+        re.MULTILINE,
+    )
+    expect(
+        image_global is not None,
+        f"expected {fixture.name} to publish a prebuilt metadata image in its own section",
+    )
+    expect(
+        all(word.strip().startswith("i32 ") for word in image_global.group(2).split(",")),
+        "expected the prebuilt metadata image to hold plain words with no relocations",
+    )
+    expect(
+        "call void @objc3_runtime_stage_prebuilt_image_for_bootstrap(" in ll_text,
+        "expected the bootstrap init stub to stage the prebuilt metadata image",
+    )
+
+    probe_fixture_config = case_dir / "prebuilt_metadata_image_startup_probe_fixture_config.h"
+    probe_fixture_config.write_text(
+        "\n".join(
+            [
+                "#pragma once",
+                f"#define OBJC3_PREBUILT_IMAGE_FIXTURE_CLASS_NAME {json.dumps(class_name)}",
+                f"#define OBJC3_PREBUILT_IMAGE_FIXTURE_CLASS_SELECTOR {json.dumps(class_selector)}",
+                f"#define OBJC3_PREBUILT_IMAGE_FIXTURE_CLASS_RESULT {class_result}",
+                "",
+            ]
+        ),
+        encoding="utf-8",
+    )
+    exe_path = case_dir / "prebuilt_metadata_image_startup_probe.exe"
+    compile_probe_with_args(
+        clangxx,
+        ROOT / Path(PREBUILT_METADATA_IMAGE_STARTUP_PROBE),
+        exe_path,
+        [obj_path],
+        ["-include", str(probe_fixture_config)],
+    )
+    payload = parse_json_output(run_probe(exe_path), "prebuilt metadata image startup probe")
+    expect(
+        payload.get("startup_image_byte_count") == int(image_global.group(1)) * 4,
+        "expected startup registration to stage the whole emitted prebuilt image",
+    )
+    return payload
+
+
+def check_prebuilt_metadata_image_startup_case(clangxx: str, run_dir: Path) -> CaseResult:
+    case_dir = run_dir / "startup-prebuilt-image"
+    large_fixture = case_dir / "large" / "prebuilt_image_large.objc3"
+    write_prebuilt_metadata_image_large_source(large_fixture)
+    last_class_index = PREBUILT_METADATA_IMAGE_LARGE_CLASS_COUNT - 1
+    last_method_index = PREBUILT_METADATA_IMAGE_LARGE_METHODS_PER_CLASS - 1
+    samples = {
+        "canonical": run_prebuilt_metadata_image_startup_probe(
+            clangxx,
+            ROOT / Path(INSTALLATION_LIFECYCLE_FIXTURE),
+            case_dir / "canonical",
+            "Widget",
+            "classValue",
+            11,
+        ),
+        "large": run_prebuilt_metadata_image_startup_probe(
+            clangxx,
+            large_fixture,
+            case_dir / "large",
+            f"C{last_class_index:04d}",
+            f"c{last_class_index:04d}v{last_method_index}",
+            last_method_index,
+        ),
+    }
+
+    for label, payload in samples.items():
+        expect(
+            payload.get("startup_ok") == 1 and payload.get("startup_adopted_image_count") == 1,
+            f"expected the {label} image to adopt its prebuilt metadata image at startup",
+        )
+        expect(
+            payload.get("paths_agree") == 1 and payload.get("walked_last_status") == 4,
+            f"expected the {label} image to realize the same graph through the walk fallback",
+        )
+        expect(
+            payload.get("fallback_ok") == 1 and payload.get("mismatched_last_status") == 2,
+            f"expected the {label} run to reject a mismatched image version and walk instead",
+        )
+        expect(
+            payload.get("mapped_ok") == 1 and payload.get("mapped_last_status") == 1,
+            f"expected the {label} run to adopt an image mapped read-only from a file",
+        )
+    expect(
+        samples["large"].get("startup_adopted_selector_count")
+        == PREBUILT_METADATA_IMAGE_LARGE_CLASS_COUNT * PREBUILT_METADATA_IMAGE_LARGE_METHODS_PER_CLASS
+        and samples["large"].get("realized_class_count") == PREBUILT_METADATA_IMAGE_LARGE_CLASS_COUNT,
+        "expected the large image to adopt every selector and realize every class",
+    )
+
+    return CaseResult(
+        case_id="startup-prebuilt-image",
+        probe=PREBUILT_METADATA_IMAGE_STARTUP_PROBE,
+        fixture=INSTALLATION_LIFECYCLE_FIXTURE,
+        claim_class="linked-runtime-probe",
+        passed=True,
+        summary={
+            label: {
+                "startup_adopted_selector_count": payload.get("startup_adopted_selector_count"),
+                "startup_image_byte_count": payload.get("startup_image_byte_count"),
+                "adopted_mean_us": payload.get("adopted_mean_us"),
+                "walked_mean_us": payload.get("walked_mean_us"),
+                "walked_to_adopted_ratio": payload.get("walked_to_adopted_ratio"),
+            }
+            for label, payload in samples.items()
+        },
+    )
+
+
+def check_instance_allocation_churn_case(clangxx: str, run_dir: Path) -> CaseResult:
+    case_dir = run_dir / "instance-allocation-churn"
+    probe = ROOT / Path(INSTANCE_ALLOCATION_CHURN_BENCHMARK_PROBE)
+    exe_path = case_dir / "instance_allocation_churn_benchmark_probe.exe"
+    compile_probe(clangxx, probe, exe_path, [])
+    payload = parse_json_output(run_probe(exe_path), "instance allocation churn probe")
+
+    working_set_size = payload.get("working_set_size")
+    expect(
+        payload.get("registration_status") == 0 and payload.get("allocations_ok") == 1,
+        "expected every churn allocation to return a live runtime instance",
+    )
+    expect(
+        payload.get("warm_slot_capacity") == working_set_size
+        and payload.get("churned_live_instance_count") == working_set_size,
+        "expected the instance slab to hold exactly the live working set",
+    )
+    expect(
+        payload.get("churned_reserved_storage_bytes") == payload.get("warm_reserved_storage_bytes"),
+        "expected steady-state churn to recycle size-class storage without reserving more",
+    )
+    expect(
+        payload.get("reused_slot_count", 0) > 0,
+        "expected released instance slots to be reused through the slab free list",
+    )
+    expect(
+        payload.get("stale_handle_ignored") == 1,
+        "expected a handle to a recycled slot to stay dead after reuse",
+    )
+
+    return CaseResult(
+        case_id="instance-allocation-churn",
+        probe=INSTANCE_ALLOCATION_CHURN_BENCHMARK_PROBE,
+        fixture=None,
+        claim_class="linked-runtime-probe",
+        passed=True,
+        summary={
+            "timed_allocation_count": payload.get("timed_allocation_count"),
+            "allocations_per_second": payload.get("allocations_per_second"),
+            "rss_before_kb": payload.get("rss_before_kb"),
+            "rss_after_kb": payload.get("rss_after_kb"),
+            "reused_slot_count": payload.get("reused_slot_count"),
+            "churned_reserved_storage_bytes": payload.get("churned_reserved_storage_bytes"),
+        },
+    )
+
+
+def check_retain_release_contention_case(clangxx: str, run_dir: Path) -> CaseResult:
+    case_dir = run_dir / "retain-release-contention"
+    probe = ROOT / Path(RETAIN_RELEASE_STRESS_BENCHMARK_PROBE)
+    exe_path = case_dir / "retain_release_stress_benchmark_probe.exe"
+    compile_probe(clangxx, probe, exe_path, [])
+    payload = parse_json_output(run_probe(exe_path), "retain/release stress probe")
+
+    samples = payload.get("samples")
+    expect(
+        isinstance(samples, list) and [row.get("thread_count") for row in samples] == [1, 2, 4, 8],
+        "expected retain/release stress probe to publish 1/2/4/8-thread samples",
+    )
+    expect(payload.get("registration_status") == 0, "expected the stress image to register")
+    expect(
+        payload.get("live_after_stress") == payload.get("live_before"),
+        "expected balanced concurrent retain/release traffic to destroy nothing",
+    )
+    expect(
+        payload.get("live_after_final_release") == payload.get("live_before", 0) - 1
+        and payload.get("live_after_stale_release") == payload.get("live_after_final_release")
+        and payload.get("live_after_cleanup") == 0,
+        "expected the final release to destroy exactly once and ignore the dead handle afterwards",
+    )
+
+    return CaseResult(
+        case_id="retain-release-contention",
+        probe=RETAIN_RELEASE_STRESS_BENCHMARK_PROBE,
+        fixture=None,
+        claim_class="linked-runtime-probe",
+        passed=True,
+        summary={
+            "pairs_per_thread": payload.get("pairs_per_thread"),
+            "shared_pairs_per_second_by_thread_count": {
+                str(row.get("thread_count")): row.get("shared_pairs_per_second")
+                for row in samples
+                if isinstance(row, dict)
+            },
+            "private_pairs_per_second_by_thread_count": {
+                str(row.get("thread_count")): row.get("private_pairs_per_second")
+                for row in samples
+                if isinstance(row, dict)
+            },
+            "private_peak_scaling_ratio": payload.get("private_peak_scaling_ratio"),
+        },
+    )
+
+
+def check_weak_side_table_case(clangxx: str, run_dir: Path) -> CaseResult:
+    case_dir = run_dir / "weak-side-table"
+    fixture = ROOT / Path(WEAK_SIDE_TABLE_FIXTURE)
+    obj_path = compile_fixture(fixture, case_dir / "compile")
+    probe = ROOT / Path(WEAK_SIDE_TABLE_BENCHMARK_PROBE)
+    exe_path = case_dir / "weak_side_table_benchmark_probe.exe"
+    compile_probe(clangxx, probe, exe_path, [obj_path])
+    payload = parse_json_output(run_probe(exe_path), "weak side table probe")
+
+    fan_in_registered = payload.get("fan_in_registered", {})
+    fan_out_registered = payload.get("fan_out_registered", {})
+    expect(
+        fan_in_registered.get("weak_target_count") == 1
+        and fan_in_registered.get("weak_slot_ref_count") == payload.get("fan_in_referrer_count"),
+        "expected every fan-in owner to register one weak slot against the shared target",
+    )
+    expect(
+        payload.get("fan_in_loads_matched") == 1 and payload.get("fan_in_all_zeroed") == 1,
+        "expected fan-in weak loads to see the live target and read nil after it is destroyed",
+    )
+    expect(
+        fan_out_registered.get("weak_slot_ref_count") == payload.get("fan_out_object_count")
+        and fan_out_registered.get("occupied_stripe_count") == fan_out_registered.get("stripe_count"),
+        "expected one weak slot per fan-out object spread across every side-table stripe",
+    )
+    expect(
+        payload.get("fan_out_loads_matched") == 1
+        and payload.get("fan_out_survivors_zeroed") == 1
+        and payload.get("fan_out_half_released", {}).get("weak_slot_ref_count") == 0
+        and payload.get("fan_out_released", {}).get("weak_target_count") == 0,
+        "expected destroying referrers and targets to leave no stale side-table entries",
+    )
+
+    return CaseResult(
+        case_id="weak-side-table",
+        probe=WEAK_SIDE_TABLE_BENCHMARK_PROBE,
+        fixture=WEAK_SIDE_TABLE_FIXTURE,
+        claim_class="linked-runtime-probe",
+        passed=True,
+        summary={
+            "fan_in_referrer_count": payload.get("fan_in_referrer_count"),
+            "fan_in_retargets_per_second": payload.get("fan_in_retargets_per_second"),
+            "fan_in_zero_ms": payload.get("fan_in_zero_ms"),
+            "fan_out_object_count": payload.get("fan_out_object_count"),
+            "fan_out_registers_per_second": payload.get("fan_out_registers_per_second"),
+            "fan_out_loads_per_second": payload.get("fan_out_loads_per_second"),
+            "fan_out_half_release_ms": payload.get("fan_out_half_release_ms"),
+            "max_stripe_slot_ref_count": fan_out_registered.get("max_stripe_slot_ref_count"),
+        },
+    )
+
+
+def check_autorelease_page_stack_case(clangxx: str, run_dir: Path) -> CaseResult:
+    case_dir = run_dir / "autorelease-page-stack"
+    probe = ROOT / Path(AUTORELEASE_PAGE_STACK_BENCHMARK_PROBE)
+    exe_path = case_dir / "autorelease_page_stack_benchmark_probe.exe"
+    compile_probe(clangxx, probe, exe_path, [])
+    payload = parse_json_output(run_probe(exe_path), "autorelease page stack probe")
+
+    expect(
+        payload.get("registration_status") == 0 and payload.get("allocations_ok") == 1,
+        "expected the autorelease working set to allocate live runtime instances",
+    )
+    expect(
+        payload.get("page_size_bytes") == 4096
+        and payload.get("timed_page_allocation_count") == 0
+        and payload.get("live_entry_count") == 0,
+        "expected nested pools to reuse the warm 4KB page chain and drain it empty",
+    )
+    expect(
+        payload.get("timed_drained_value_count") == payload.get("timed_autorelease_count")
+        and payload.get("autoreleasepool_depth") == 0
+        and payload.get("queued_autorelease_value_count") == 0
+        and payload.get("lifo_last_drained_matches") == 1,
+        "expected every pooled value to drain exactly once in LIFO order",
+    )
+    expect(
+        payload.get("live_instance_count_after_release") == 0,
+        "expected drain-time releases to balance every timed autorelease",
+    )
+
+    return CaseResult(
+        case_id="autorelease-page-stack",
+        probe=AUTORELEASE_PAGE_STACK_BENCHMARK_PROBE,
+        fixture=None,
+        claim_class="linked-runtime-probe",
+        passed=True,
+        summary={
+            "timed_autorelease_count": payload.get("timed_autorelease_count"),
+            "autoreleases_per_second": payload.get("autoreleases_per_second"),
+            "allocated_page_count": payload.get("allocated_page_count"),
+            "high_water_entry_count": payload.get("high_water_entry_count"),
+        },
+    )
+
+
+def check_release_batch_teardown_case(clangxx: str, run_dir: Path) -> CaseResult:
+    case_dir = run_dir / "release-batch-teardown"
+    fixture = ROOT / Path(WEAK_SIDE_TABLE_FIXTURE)
+    obj_path = compile_fixture(fixture, case_dir / "compile")
+    probe = ROOT / Path(RELEASE_BATCH_TEARDOWN_BENCHMARK_PROBE)
+    exe_path = case_dir / "release_batch_teardown_benchmark_probe.exe"
+    compile_probe(clangxx, probe, exe_path, [obj_path])
+    payload = parse_json_output(run_probe(exe_path), "release batch teardown probe")
+
+    chain_length = payload.get("chain_length", 0)
+    expect(
+        payload.get("chain_live_count") == chain_length
+        and payload.get("chain_cascade_release_count") == chain_length - 1
+        and payload.get("live_after_chain") == 0,
+        "expected releasing the chain head to free every chained box",
+    )
+    expect(
+        payload.get("max_pending_release_count") == 1,
+        "expected the chain cascade to run on a one-deep worklist instead of recursion",
+    )
+    expect(
+        payload.get("pool_batch_count") == 1
+        and payload.get("pool_coalesced_value_count", 0) > 0
+        and payload.get("pending_release_count") == 0
+        and payload.get("live_after_pool") == 0,
+        "expected the pool drain to release one coalesced batch that frees every box",
+    )
+
+    return CaseResult(
+        case_id="release-batch-teardown",
+        probe=RELEASE_BATCH_TEARDOWN_BENCHMARK_PROBE,
+        fixture=WEAK_SIDE_TABLE_FIXTURE,
+        claim_class="linked-runtime-probe",
+        passed=True,
+        summary={
+            "chain_length": chain_length,
+            "chain_teardown_objects_per_second": payload.get("chain_teardown_objects_per_second"),
+            "pool_drained_values_per_second": payload.get("pool_drained_values_per_second"),
+            "pool_coalesced_value_count": payload.get("pool_coalesced_value_count"),
+        },
+    )
+
+
+def check_block_invoke_throughput_case(clangxx: str, run_dir: Path) -> CaseResult:
+    case_dir = run_dir / "block-invoke-throughput"
+    probe = ROOT / Path(BLOCK_INVOKE_BENCHMARK_PROBE)
+    exe_path = case_dir / "block_invoke_benchmark_probe.exe"
+    compile_probe(clangxx, probe, exe_path, [])
+    payload = parse_json_output(run_probe(exe_path), "block invoke probe")
+
+    expect(
+        payload.get("checksum_matched") == 1 and payload.get("threads_matched") == 1,
+        "expected single- and multi-thread block invokes to return the promoted block's results",
+    )
+    expect(
+        payload.get("invoke_heap_allocations") == 0,
+        "expected block invoke to run on the promoted storage without allocating",
+    )
+    expect(
+        payload.get("dead_handle_result") == 0 and payload.get("churn_ok") == 1,
+        "expected released and recycled block handles to stay dead",
+    )
+    expect(
+        payload.get("churn_copy_count") == payload.get("churn_count")
+        and payload.get("churn_dispose_count") == payload.get("churn_count"),
+        "expected every churned block to run its copy and dispose helpers exactly once",
+    )
+    expect(
+        payload.get("self_release_result") == 42
+        and payload.get("dispose_count_seen_inside_self_release") == 0
+        and payload.get("self_release_dispose_count") == 1
+        and payload.get("live_block_count") == 0,
+        "expected a block releasing itself mid-invoke to be disposed only after the call returns",
+    )
+
+    return CaseResult(
+        case_id="block-invoke-throughput",
+        probe=BLOCK_INVOKE_BENCHMARK_PROBE,
+        fixture=None,
+        claim_class="linked-runtime-probe",
+        passed=True,
+        summary={
+            "timed_invoke_count": payload.get("timed_invoke_count"),
+            "single_thread_invokes_per_second": payload.get("single_thread_invokes_per_second"),
+            "multi_thread_invokes_per_second": payload.get("multi_thread_invokes_per_second"),
+            "invoke_heap_allocations": payload.get("invoke_heap_allocations"),
+            "churn_reused_slot_count": payload.get("churn_reused_slot_count"),
+        },
+    )
+
+
+def check_task_executor_case(clangxx: str, run_dir: Path) -> CaseResult:
+    case_dir = run_dir / "task-executor"
+    probe = ROOT / Path(TASK_EXECUTOR_BENCHMARK_PROBE)
+    exe_path = case_dir / "task_executor_benchmark_probe.exe"
+    compile_probe(clangxx, probe, exe_path, [])
+    payload = parse_json_output(run_probe(exe_path), "task executor probe")
+
+    expect(
+        isinstance(payload.get("worker_count"), int) and payload["worker_count"] > 0,
+        "expected the task executor to start at least one worker",
+    )
+    expect(
+        payload.get("cpu_checksum_matched") == 1
+        and payload.get("group_sum_matched") == 1
+        and payload.get("group_result_count") == payload.get("small_task_count"),
+        "expected joined and grouped tasks to return their block results",
+    )
+    expect(
+        payload.get("drained_group_next") == 0 and payload.get("group_discarded") == 0,
+        "expected task group next to report an empty group once every result is consumed",
+    )
+    expect(
+        payload.get("fan_out_leaves") == 1024,
+        "expected child tasks spawned from inside the pool to join correctly",
+    )
+    expect(
+        payload.get("serial_order_breaks") == 0 and payload.get("serial_overlaps") == 0,
+        "expected main and named executors to run their tasks serially in order",
+    )
+    expect(
+        payload.get("cancelled_results") == payload.get("cancelled_pending")
+        and payload.get("outside_task_cancelled") == 0,
+        "expected group cancellation to reach every pending task cooperatively",
+    )
+    expect(
+        payload.get("dead_block_spawn") == 0
+        and payload.get("reset_in_flight_task_count") == 0
+        and payload.get("reset_live_task_handle_count") == 0
+        and payload.get("reset_live_task_group_count") == 0,
+        "expected released blocks not to spawn and reset to retire every task handle",
+    )
+
+    return CaseResult(
+        case_id="task-executor",
+        probe=TASK_EXECUTOR_BENCHMARK_PROBE,
+        fixture=None,
+        claim_class="linked-runtime-probe",
+        passed=True,
+        summary={
+            "worker_count": payload.get("worker_count"),
+            "cpu_parallel_speedup": payload.get("cpu_parallel_speedup"),
+            "small_tasks_per_second": payload.get("small_tasks_per_second"),
+            "fan_out_stolen_job_count": payload.get("fan_out_stolen_job_count"),
+        },
+    )
+
+
+def check_task_group_block_body_case(clangxx: str, run_dir: Path) -> CaseResult:
+    case_dir = run_dir / "task-group-block-body"
+    obj_path, ll_path, _ = compile_fixture_outputs(
+        ROOT / Path(TASK_GROUP_BLOCK_BODY_FIXTURE), case_dir / "compile"
+    )
+    ll_text = ll_path.read_text(encoding="utf-8")
+    expect(
+        "call i32 @objc3_runtime_task_group_spawn_block_i32(" in ll_text
+        and "call i32 @objc3_runtime_spawn_block_task_i32(" in ll_text
+        and "call i32 @objc3_runtime_open_lowered_task_group_i32()" in ll_text,
+        "expected block-bodied task calls to lower onto the spawn-block entrypoints",
+    )
+    expect(
+        "call i32 @objc3_runtime_spawn_task_i32(" not in ll_text
+        and "call i32 @objc3_runtime_add_task_group_task_i32(" not in ll_text,
+        "expected no body-less task helper calls for block-bodied spawns",
+    )
+    exe_path = case_dir / "task_group_block_body.exe"
+    link_fixture_executable(clangxx, obj_path, exe_path)
+    result = run([str(exe_path)])
+    # groupedWorker: bodies over 1, 2, 3 scaled by 10 plus a drained wait
+    # (60); the serial worker: bodies over 4 and 6 plus one, a drained wait,
+    # and a cancel (13); the detached spawn (100).
+    expect(
+        result.returncode == 173,
+        f"expected the task-group block-body fixture to exit 173, saw {result.returncode}",
+    )
+
+    return CaseResult(
+        case_id="task-group-block-body",
+        probe=None,
+        fixture=TASK_GROUP_BLOCK_BODY_FIXTURE,
+        claim_class="runtime-linked-execution",
+        passed=True,
+        summary={"exit_code": result.returncode},
+    )
+
+
+def check_actor_ping_pong_case(clangxx: str, run_dir: Path) -> CaseResult:
+    case_dir = run_dir / "actor-ping-pong"
+    probe = ROOT / Path(ACTOR_PING_PONG_BENCHMARK_PROBE)
+    exe_path = case_dir / "actor_ping_pong_benchmark_probe.exe"
+    compile_probe(clangxx, probe, exe_path, [])
+    payload = parse_json_output(run_probe(exe_path), "actor ping-pong probe")
+
+    expect(
+        payload.get("received_mismatch_count") == 0
+        and payload.get("sent_message_count") == payload.get("ping_pong_message_count"),
+        "expected every ping-pong message to reach its actor exactly once",
+    )
+    expect(
+        payload.get("overlap_count") == 0
+        and payload.get("fan_in_sum") == payload.get("fan_in_message_count"),
+        "expected each actor to run its messages on one thread at a time",
+    )
+    expect(
+        payload.get("cross_thread_order_breaks") == 0 and payload.get("drained_empty") == 0,
+        "expected mailbox values enqueued on one thread to drain in order on another",
+    )
+    expect(
+        payload.get("hop_result") == 31
+        and payload.get("hop_waited_for_message") == 1
+        and payload.get("queued_hop_count") == 1,
+        "expected a hop onto a busy executor to wait for the running message",
+    )
+    expect(
+        payload.get("reset_pending_job_count") == 0
+        and payload.get("reset_pending_mailbox_value_count") == 0,
+        "expected reset to leave every actor idle with an empty mailbox",
+    )
+
+    return CaseResult(
+        case_id="actor-ping-pong",
+        probe=ACTOR_PING_PONG_BENCHMARK_PROBE,
+        fixture=None,
+        claim_class="linked-runtime-probe",
+        passed=True,
+        summary={
+            "actor_count": payload.get("actor_count"),
+            "ping_pong_messages_per_second": payload.get("ping_pong_messages_per_second"),
+            "fan_in_messages_per_second": payload.get("fan_in_messages_per_second"),
+            "executor_turn_count": payload.get("executor_turn_count"),
+        },
+    )
+
+
+def check_async_continuation_suspension_case(clangxx: str, run_dir: Path) -> CaseResult:
+    case_dir = run_dir / "async-continuation-suspension"
+    probe = ROOT / Path(ASYNC_CONTINUATION_SUSPENSION_BENCHMARK_PROBE)
+    exe_path = case_dir / "async_continuation_suspension_benchmark_probe.exe"
+    compile_probe(clangxx, probe, exe_path, [])
+    payload = parse_json_output(run_probe(exe_path), "async continuation suspension probe")
+
+    suspended_task_count = payload.get("suspended_task_count")
+    expect(
+        payload.get("suspended_frame_count") == suspended_task_count
+        and payload.get("in_flight_task_count") == suspended_task_count,
+        "expected every parked task to hold a suspended frame and no worker thread",
+    )
+    frame_bytes = payload.get("frame_bytes_per_suspended_task")
+    expect(
+        isinstance(frame_bytes, (int, float)) and 0 < frame_bytes <= 256,
+        "expected a suspended frame to stay within its pooled size class",
+    )
+    expect(
+        payload.get("resumed_sum") == suspended_task_count,
+        "expected a resume from another thread to finish every parked task once",
+    )
+    expect(
+        payload.get("stale_resume") == 0
+        and payload.get("stale_cancel") == 0
+        and payload.get("cancel_accepted") == payload.get("cancelled_observed_count")
+        and payload.get("mixed_sum") == 1000,
+        "expected stale continuations to fail closed and cancelled ones to mark their task",
+    )
+    expect(
+        payload.get("hop_result_mismatch_count") == 0
+        and payload.get("hop_overlap_count") == 0
+        and payload.get("sync_hop_result") == 2,
+        "expected awaits that hop executors to resume their frames on the target executor",
+    )
+    expect(
+        payload.get("live_frame_count") == 0
+        and payload.get("reset_live_frame_count") == 0
+        and payload.get("reset_live_continuation_count") == 0
+        and payload.get("first_handle_after_reset") == 1
+        and payload.get("handle_resumed_inline") == 9,
+        "expected completed and reset frames to return to their pools",
+    )
+
+    return CaseResult(
+        case_id="async-continuation-suspension",
+        probe=ASYNC_CONTINUATION_SUSPENSION_BENCHMARK_PROBE,
+        fixture=None,
+        claim_class="linked-runtime-probe",
+        passed=True,
+        summary={
+            "suspended_task_count": suspended_task_count,
+            "frame_bytes_per_suspended_task": frame_bytes,
+            "resident_bytes_per_suspended_task": payload.get(
+                "resident_bytes_per_suspended_task"
+            ),
+            "resumes_per_second": payload.get("resumes_per_second"),
+        },
+    )
+
+
+def check_async_lowering_execution_case(clangxx: str, run_dir: Path) -> CaseResult:
+    case_dir = run_dir / "async-lowering-execution"
+    exit_codes: dict[str, int] = {}
+    for fixture in ASYNC_LOWERING_EXECUTION_FIXTURES:
+        fixture_path = ROOT / Path(fixture)
+        obj_path, ll_path, _ = compile_fixture_outputs(
+            fixture_path, case_dir / fixture_path.stem / "compile"
+        )
+        expect(
+            "call i32 @objc3_runtime_await_async_frame_i32(" in ll_path.read_text(encoding="utf-8"),
+            f"expected {fixture_path.name} to lower its awaits onto async frames",
+        )
+        exe_path = case_dir / fixture_path.stem / f"{fixture_path.stem}.exe"
+        link_fixture_executable(clangxx, obj_path, exe_path)
+        result = run([str(exe_path)])
+        expect(
+            result.returncode == 7,
+            f"expected {fixture_path.name} to exit 7 as before frame lowering, saw {result.returncode}",
+        )
+        exit_codes[fixture_path.stem] = result.returncode
+
+    obj_path, _, _ = compile_fixture_outputs(
+        ROOT / Path(ASYNC_AWAIT_SERIAL_SUSPENSION_FIXTURE), case_dir / "serial" / "compile"
+    )
+    exe_path = case_dir / "serial" / "async_await_serial_suspension_probe.exe"
+    compile_probe(clangxx, ROOT / Path(ASYNC_AWAIT_SERIAL_SUSPENSION_PROBE), exe_path, [obj_path])
+    payload = parse_json_output(run_probe(exe_path), "async await serial suspension probe")
+    expect(
+        payload.get("status") == 0 and payload.get("result") == 12,
+        "expected the serial-executor awaits to produce 2 + 4 + 6",
+    )
+    expect(
+        payload.get("suspension_count") == 1 and payload.get("inline_await_count") == 2,
+        "expected the first await to suspend onto the serial executor and the rest to run inline",
+    )
+    expect(
+        payload.get("completed_frame_count") == 1
+        and payload.get("live_frame_count") == 0
+        and payload.get("suspended_frame_count") == 0,
+        "expected the suspended frame to resume, complete, and return to its pool",
+    )
+
+    return CaseResult(
+        case_id="async-lowering-execution",
+        probe=ASYNC_AWAIT_SERIAL_SUSPENSION_PROBE,
+        fixture=ASYNC_AWAIT_SERIAL_SUSPENSION_FIXTURE,
+        claim_class="compile-linked-runtime-probe",
+        passed=True,
+        summary={
+            "exit_codes": exit_codes,
+            "suspension_count": payload.get("suspension_count"),
+            "inline_await_count": payload.get("inline_await_count"),
+        },
+    )
+
+
+def check_receiver_handle_decode_case(clangxx: str, run_dir: Path) -> CaseResult:
+    case_dir = run_dir / "receiver-handle-decode"
+    fixture = ROOT / Path(WEAK_SIDE_TABLE_FIXTURE)
+    obj_path = compile_fixture(fixture, case_dir / "compile")
+    probe = ROOT / Path(RECEIVER_HANDLE_DECODE_BENCHMARK_PROBE)
+    exe_path = case_dir / "receiver_handle_decode_benchmark_probe.exe"
+    compile_probe(clangxx, probe, exe_path, [obj_path])
+    payload = parse_json_output(run_probe(exe_path), "receiver handle decode probe")
+
+    expect(
+        payload.get("churn_failure_count") == 0
+        and payload.get("allocated_box") == 1
+        and payload.get("receiver_class_binding_count", 0) > 0,
+        "expected class receivers to resolve their realized node by ordinal",
+    )
+    expect(
+        payload.get("spread_fallback_count") == 0
+        and payload.get("spread_nonzero_count") == 0,
+        "expected every live instance handle to decode without falling back",
+    )
+    expect(
+        payload.get("class_handle_kind") == 0
+        and payload.get("block_handle_kind") == 1
+        and payload.get("instance_handle_kind", 0) >= 2,
+        "expected class, block, and instance handles to carry distinct tags",
+    )
+    expect(
+        payload.get("kind_fallback_count") == 2
+        and payload.get("block_invoke_result") == 5,
+        "expected block and freed instance handles to never decode as receivers",
+    )
+    expect(
+        payload.get("live_instance_count") == 0,
+        "expected every allocated box to be freed",
+    )
+
+    return CaseResult(
+        case_id="receiver-handle-decode",
+        probe=RECEIVER_HANDLE_DECODE_BENCHMARK_PROBE,
+        fixture=WEAK_SIDE_TABLE_FIXTURE,
+        claim_class="linked-runtime-probe",
+        passed=True,
+        summary={
+            "alloc_release_pairs_per_second": payload.get(
+                "alloc_release_pairs_per_second"
+            ),
+            "spread_sends_per_second": payload.get("spread_sends_per_second"),
+            "spread_instance_count": payload.get("spread_instance_count"),
+        },
+    )
+
+
+def check_class_symbol_table_case(clangxx: str, run_dir: Path) -> CaseResult:
+    case_dir = run_dir / "class-symbol-table"
+    fixture = ROOT / Path(WEAK_SIDE_TABLE_FIXTURE)
+    obj_path = compile_fixture(fixture, case_dir / "compile")
+    probe = ROOT / Path(CLASS_SYMBOL_TABLE_BENCHMARK_PROBE)
+    exe_path = case_dir / "class_symbol_table_benchmark_probe.exe"
+    compile_probe(clangxx, probe, exe_path, [obj_path])
+    payload = parse_json_output(run_probe(exe_path), "class symbol table probe")
+
+    expect(
+        payload.get("replay_failure_count") == 0
+        and payload.get("query_failure_count") == 0,
+        "expected every replay and name-keyed query to resolve the Box class",
+    )
+    expect(
+        payload.get("class_entry_is_box") == 1
+        and payload.get("property_resolved_to_box") == 1
+        and payload.get("cache_entry_is_box") == 1,
+        "expected class ids to report the interned class name in snapshots",
+    )
+    expect(
+        payload.get("negative_miss_count") == 1
+        and payload.get("negative_hit_count") == 1
+        and payload.get("missing_class_found") == 0
+        and payload.get("missing_class_property_found") == 0,
+        "expected undeclared names to miss once and then hit the lookup cache",
+    )
+    expect(
+        payload.get("interned_symbol_count", 0) > 0
+        and payload.get("reset_symbol_count") == 0
+        and payload.get("replayed_symbol_count")
+        == payload.get("interned_symbol_count"),
+        "expected reset to drop the symbol table and replay to rebuild it",
+    )
+
+    return CaseResult(
+        case_id="class-symbol-table",
+        probe=CLASS_SYMBOL_TABLE_BENCHMARK_PROBE,
+        fixture=WEAK_SIDE_TABLE_FIXTURE,
+        claim_class="linked-runtime-probe",
+        passed=True,
+        summary={
+            "replay_cycles_per_second": payload.get("replay_cycles_per_second"),
+            "query_rounds_per_second": payload.get("query_rounds_per_second"),
+            "interned_symbol_count": payload.get("interned_symbol_count"),
+        },
+    )
+
+
+def check_protocol_conformance_query_case(clangxx: str, run_dir: Path) -> CaseResult:
+    case_dir = run_dir / "protocol-conformance-query"
+    fixture = ROOT / Path(CANONICAL_RUNNABLE_SAMPLE_SET_FIXTURE)
+    obj_path = compile_fixture(fixture, case_dir / "compile")
+    probe = ROOT / Path(PROTOCOL_CONFORMANCE_QUERY_BENCHMARK_PROBE)
+    exe_path = case_dir / "protocol_conformance_query_benchmark_probe.exe"
+    compile_probe(clangxx, probe, exe_path, [obj_path])
+    payload = parse_json_output(
+        run_probe(exe_path), "protocol conformance query probe"
+    )
+
+    expect(
+        payload.get("query_failure_count") == 0
+        and payload.get("query_build_count") == 2,
+        "expected Widget and Base to build one conformance bitset each",
+    )
+    expect(
+        payload.get("worker_visited_protocol_count") == 1
+        and payload.get("tracer_visited_protocol_count") == 2
+        and payload.get("missing_visited_protocol_count") == 2
+        and payload.get("base_visited_protocol_count") == 0
+        and payload.get("worker_owner_ok") == 1
+        and payload.get("tracer_owner_ok") == 1,
+        "expected bitset answers to report the walk's visit counts and owners",
+    )
+    expect(
+        payload.get("cast_conforming_count") == payload.get("cast_check_count")
+        and payload.get("cast_bitset_test_count") == payload.get("cast_check_count")
+        and payload.get("class_conforms") == 1
+        and payload.get("base_conforms") == 0
+        and payload.get("invalid_conforms") == 0
+        and payload.get("released_conforms") == 0,
+        "expected receiver conformance checks to be single bit tests that fail closed",
+    )
+    expect(
+        payload.get("reset_build_count") == 0
+        and payload.get("replayed_tracer_conforms") == 1
+        and payload.get("replayed_build_count") == 1,
+        "expected reset to drop conformance bitsets and replay to rebuild on demand",
+    )
+
+    lowering_obj, lowering_ll, _ = compile_fixture_outputs(
+        ROOT / Path(PROTOCOL_CONFORMANCE_QUERY_LOWERING_FIXTURE),
+        case_dir / "lowering",
+    )
+    lowering_text = lowering_ll.read_text(encoding="utf-8")
+    shape_body = lowering_text.split("define i32 @conformsToShape(", 1)[-1].split(
+        "\n}\n", 1
+    )[0]
+    expect(
+        "call i32 @objc3_runtime_receiver_conforms_to_protocol_i32(" in shape_body
+        and "@objc3_runtime_dispatch_i32(" not in shape_body,
+        "expected conformsToProtocol: sends on @protocol literals to lower onto the conformance entrypoint",
+    )
+    lowering_exe = case_dir / "protocol_conformance_query_lowering.exe"
+    link_fixture_executable(clangxx, lowering_obj, lowering_exe)
+    lowering_result = run([str(lowering_exe)])
+    # Square conforms to Shape through Base and to Sized directly (150); Base
+    # conforms to Shape but not Sized (10); Plain, Named, and nil answer 0.
+    expect(
+        lowering_result.returncode == 160,
+        f"expected the conformance query lowering fixture to exit 160, saw {lowering_result.returncode}",
+    )
+
+    return CaseResult(
+        case_id="protocol-conformance-query",
+        probe=PROTOCOL_CONFORMANCE_QUERY_BENCHMARK_PROBE,
+        fixture=CANONICAL_RUNNABLE_SAMPLE_SET_FIXTURE,
+        claim_class="linked-runtime-probe",
+        passed=True,
+        summary={
+            "query_rounds_per_second": payload.get("query_rounds_per_second"),
+            "cast_checks_per_second": payload.get("cast_checks_per_second"),
+            "query_build_count": payload.get("query_build_count"),
+            "lowered_exit_code": lowering_result.returncode,
+        },
+    )
+
+
+def check_direct_property_access_case(clangxx: str, run_dir: Path) -> CaseResult:
+    case_dir = run_dir / "direct-property-access"
+    fixture = ROOT / Path(DIRECT_PROPERTY_ACCESS_FIXTURE)
+    obj_path = compile_fixture(fixture, case_dir / "compile")
+    probe = ROOT / Path(DIRECT_PROPERTY_ACCESS_BENCHMARK_PROBE)
+    exe_path = case_dir / "direct_property_access_benchmark_probe.exe"
+    compile_probe(clangxx, probe, exe_path, [obj_path])
+    payload = parse_json_output(
+        run_probe(exe_path), "direct property access probe"
+    )
+
+    expect(
+        payload.get("direct_access_property_count") == 3
+        and payload.get("count_direct_access") == 1
+        and payload.get("enabled_direct_access") == 1
+        and payload.get("value_direct_access") == 2
+        and payload.get("guarded_direct_access") == 0
+        and payload.get("observer_direct_access") == 0
+        and payload.get("plain_count_direct_access") == 0,
+        "expected only the final class's scalar and nonatomic strong accessors to qualify",
+    )
+    expect(
+        payload.get("direct_result") == payload.get("bump_round_count")
+        and payload.get("locked_result") == payload.get("bump_round_count")
+        and payload.get("direct_get_count") == payload.get("bump_round_count") + 1
+        and payload.get("direct_set_count") == payload.get("bump_round_count")
+        and payload.get("locked_direct_count") == 0
+        and payload.get("enabled_result") == 1,
+        "expected final-class get/set pairs to take the direct path with locked-path results",
+    )
+    expect(
+        payload.get("strong_failure_count") == 0
+        and payload.get("guarded_result_matches") == 1
+        and payload.get("observer_result_matches") == 1
+        and payload.get("cleared_value") == 0
+        and payload.get("cleared_guarded") == 0
+        and payload.get("zeroed_observer") == 0
+        and payload.get("live_instance_count") == 0
+        and payload.get("stale_direct_count") == 0,
+        "expected direct strong swaps to balance ownership and released receivers to fall back",
+    )
+
+    return CaseResult(
+        case_id="direct-property-access",
+        probe=DIRECT_PROPERTY_ACCESS_BENCHMARK_PROBE,
+        fixture=DIRECT_PROPERTY_ACCESS_FIXTURE,
+        claim_class="linked-runtime-probe",
+        passed=True,
+        summary={
+            "direct_get_set_pairs_per_second": payload.get("direct_get_set_pairs_per_second"),
+            "locked_get_set_pairs_per_second": payload.get("locked_get_set_pairs_per_second"),
+            "direct_speedup_ratio": payload.get("direct_speedup_ratio"),
+        },
+    )
+
+
+def check_keypath_chain_evaluation_case(clangxx: str, run_dir: Path) -> CaseResult:
+    case_dir = run_dir / "keypath-chain-evaluation"
+    fixture = ROOT / Path(KEYPATH_CHAIN_EVALUATION_FIXTURE)
+    obj_path, ll_path, _ = compile_fixture_outputs(fixture, case_dir / "compile")
+    ll_text = ll_path.read_text(encoding="utf-8")
+    keypath_bodies = [
+        ll_text.split(f"define i32 @{name}(", 1)[-1].split("\n}\n", 1)[0]
+        for name in ("readNodeValue", "writeNodeValue")
+    ]
+    expect(
+        "call i32 @objc3_runtime_keypath_get_i32(i32 1, " in keypath_bodies[0]
+        and "call i32 @objc3_runtime_keypath_set_i32(i32 1, " in keypath_bodies[1]
+        and all("@objc3_runtime_dispatch_i32(" not in body for body in keypath_bodies),
+        "expected key-path sends to lower onto the key-path evaluation entrypoints",
+    )
+    probe = ROOT / Path(KEYPATH_CHAIN_EVALUATION_BENCHMARK_PROBE)
+    exe_path = case_dir / "keypath_chain_evaluation_benchmark_probe.exe"
+    compile_probe(clangxx, probe, exe_path, [obj_path])
+    payload = parse_json_output(
+        run_probe(exe_path), "keypath chain evaluation probe"
+    )
+
+    read_count = payload.get("read_count_per_depth")
+    expect(
+        payload.get("registration_status") == 0
+        and payload.get("keypath_table_entry_count") == 7
+        and payload.get("emitted_handle") == 1
+        and payload.get("emitted_write") == 1
+        and payload.get("emitted_read") == 11,
+        "expected emitted and registered key-path handles to evaluate",
+    )
+    expect(
+        read_count == 1000000
+        and all(
+            payload.get(f"depth_{depth}_failure_count") == 0
+            for depth in range(1, 6)
+        )
+        and payload.get("read_chain_build_count") == 5
+        and payload.get("read_chain_hit_count") == 5 * (read_count - 1),
+        "expected one compiled chain per handle and root class across every depth",
+    )
+    expect(
+        payload.get("deep_write") == 1
+        and payload.get("deep_value") == 77
+        and payload.get("nil_hop_value") == 0
+        and payload.get("foreign_root_value") == 0
+        and payload.get("unknown_handle_value") == 0
+        and payload.get("relink_write") == 1
+        and payload.get("tail_value") == 99
+        and payload.get("step_miss_count") == 1
+        and payload.get("live_instance_count") == 0
+        and payload.get("stale_value") == 0,
+        "expected deep stores, step re-resolution, and failed hops to match accessor semantics",
+    )
+
+    return CaseResult(
+        case_id="keypath-chain-evaluation",
+        probe=KEYPATH_CHAIN_EVALUATION_BENCHMARK_PROBE,
+        fixture=KEYPATH_CHAIN_EVALUATION_FIXTURE,
+        claim_class="linked-runtime-probe",
+        passed=True,
+        summary={
+            "depth_1_compiled_reads_per_second": payload.get("depth_1_compiled_reads_per_second"),
+            "depth_5_compiled_reads_per_second": payload.get("depth_5_compiled_reads_per_second"),
+            "depth_5_speedup_ratio": payload.get("depth_5_speedup_ratio"),
+        },
+    )
+
+
+def check_bounded_method_cache_case(clangxx: str, run_dir: Path) -> CaseResult:
+    case_dir = run_dir / "bounded-method-cache"
+    fixture = ROOT / Path(BOUNDED_METHOD_CACHE_FIXTURE)
+    obj_path = compile_fixture(fixture, case_dir / "compile")
+    probe = ROOT / Path(BOUNDED_METHOD_CACHE_BENCHMARK_PROBE)
+    exe_path = case_dir / "bounded_method_cache_benchmark_probe.exe"
+    compile_probe(clangxx, probe, exe_path, [obj_path])
+    payload = parse_json_output(run_probe(exe_path), "bounded method cache probe")
+
+    expect(
+        payload.get("fixture_result") == 11
+        and payload.get("shrink_status") == 0
+        and payload.get("referenced_result") == 11
+        and payload.get("third_result") == 17
+        and payload.get("clock_eviction_count") == 1
+        and payload.get("clock_resolved_entry_count") == 2
+        and payload.get("referenced_kept") == 1
+        and payload.get("cold_evicted") == 1
+        and payload.get("third_cached") == 1,
+        "expected a full resolved ring to evict the fill no send referenced",
+    )
+    negative_capacity = payload.get("negative_entry_capacity")
+    expect(
+        payload.get("restore_status") == 0
+        and payload.get("warm_total") == 41
+        and payload.get("flood_distinct_key_count", 0) > negative_capacity
+        and payload.get("entries_after_flood") <= payload.get("entry_bound")
+        and payload.get("negative_entries_after_flood") == negative_capacity
+        and payload.get("negative_eviction_count", 0) > 0
+        and payload.get("resolved_entries_after_flood") == 3
+        and payload.get("resolved_eviction_count") == 0,
+        "expected fallback floods to recycle only negative slots within their bound",
+    )
+    expect(
+        payload.get("warm_after_total") == 41
+        and payload.get("warm_miss_count") == 0
+        and payload.get("warm_entries_cached") == 1,
+        "expected the resolved working set to stay warm through the flood",
+    )
+
+    return CaseResult(
+        case_id="bounded-method-cache",
+        probe=BOUNDED_METHOD_CACHE_BENCHMARK_PROBE,
+        fixture=BOUNDED_METHOD_CACHE_FIXTURE,
+        claim_class="linked-runtime-probe",
+        passed=True,
+        summary={
+            "flood_sends_per_second": payload.get("flood_sends_per_second"),
+            "entries_after_flood": payload.get("entries_after_flood"),
+            "negative_eviction_count": payload.get("negative_eviction_count"),
+        },
+    )
+
+
+def check_runtime_metrics_export_case(clangxx: str, run_dir: Path) -> CaseResult:
+    case_dir = run_dir / "runtime-metrics-export"
+    probe = ROOT / Path(RUNTIME_METRICS_EXPORT_BENCHMARK_PROBE)
+    exe_path = case_dir / "runtime_metrics_export_benchmark_probe.exe"
+    compile_probe(clangxx, probe, exe_path, [])
+    payload = parse_json_output(run_probe(exe_path), "runtime metrics export probe")
+
+    thread_count = payload.get("thread_count")
+    wave_sends = thread_count * (payload.get("sends_per_thread") + 1)
+    expect(
+        payload.get("dispatch_count") == wave_sends
+        and payload.get("second_dispatch_count") == wave_sends
+        and payload.get("cache_hit_count") + payload.get("locked_resolve_count")
+        == wave_sends
+        and payload.get("locked_resolve_count") == thread_count * 2
+        and payload.get("nil_count") == thread_count
+        and payload.get("fallback_count") == wave_sends - thread_count,
+        "expected aggregated dispatch counters to sum every thread's sends exactly",
+    )
+    expect(
+        payload.get("retain_count") == payload.get("release_count")
+        and payload.get("retain_count", 0) > 0
+        and payload.get("pool_push_count") == thread_count
+        and payload.get("pool_pop_count") == thread_count,
+        "expected ownership and autoreleasepool counters to balance",
+    )
+    expect(
+        payload.get("first_thread_block_count") == thread_count
+        and payload.get("second_thread_block_count") == thread_count
+        and payload.get("active_thread_block_count") == 0,
+        "expected exited threads to hand their counter blocks to the next wave",
+    )
+    expect(
+        payload.get("thread_snapshot_mismatch_count") == 0,
+        "expected per-thread ARC snapshot counts to read only the calling thread's own calls",
+    )
+    expect(
+        payload.get("dump_sequence", 0) > 0
+        and payload.get("dump_dispatch_count") == wave_sends * 2
+        and payload.get("dump_retain_count") == payload.get("retain_count") * 2,
+        "expected the periodic metrics dump to catch up with the live totals",
+    )
+
+    return CaseResult(
+        case_id="runtime-metrics-export",
+        probe=RUNTIME_METRICS_EXPORT_BENCHMARK_PROBE,
+        fixture=None,
+        claim_class="linked-runtime-probe",
+        passed=True,
+        summary={
+            "sends_per_second": payload.get("sends_per_second"),
+            "thread_block_count": payload.get("second_thread_block_count"),
+            "dump_sequence": payload.get("dump_sequence"),
+        },
+    )
+
+
+def check_dispatch_profile_case(clangxx: str, run_dir: Path) -> CaseResult:
+    case_dir = run_dir / "dispatch-profile"
+    fixture = ROOT / Path(DISPATCH_PROFILE_FIXTURE)
+    obj_path = compile_fixture(fixture, case_dir / "compile")
+    probe = ROOT / Path(DISPATCH_PROFILE_BENCHMARK_PROBE)
+    exe_path = case_dir / "dispatch_profile_benchmark_probe.exe"
+    compile_probe(clangxx, probe, exe_path, [obj_path])
+    payload = parse_json_output(run_probe(exe_path), "dispatch profile probe")
+
+    expect(
+        payload.get("fixture_result") == 3
+        and payload.get("every_send_status") == 0
+        and payload.get("cold_results") == 14
+        and payload.get("cold_sample_count") == 2
+        and payload.get("cold_slow_path_count") == 1
+        and payload.get("cold_cache_hit_count") == 1
+        and payload.get("cold_slow_path_ns", 0) > 0
+        and payload.get("fallback_sample_count") == 2
+        and payload.get("fallback_fallback_count") == 2
+        and payload.get("every_send_sample_count") == 4,
+        "expected per-send sampling to split the timed slow path from cache hits and fallbacks",
+    )
+    expect(
+        payload.get("off_status") == 0
+        and payload.get("off_sample_count") == 0
+        and payload.get("sampled_status") == 0
+        and payload.get("totals_match") == 1
+        and payload.get("sampled_count") == payload.get("expected_sampled_count")
+        and payload.get("profiled_key_count") == 3
+        and 0.85 < payload.get("hot_share", 0.0) < 0.95,
+        "expected periodic sampling to take one sample per period in proportion to the send mix",
+    )
+    expect(
+        payload.get("threaded_sample_count") == payload.get("expected_threaded_count")
+        and payload.get("table_count") == 3
+        and payload.get("dropped_sample_count") == 0
+        and payload.get("write_status") == 0
+        and payload.get("folded_sample_count") == payload.get("threaded_sample_count")
+        and payload.get("folded_hot_hit_count", 0) > 0,
+        "expected exited threads' samples to reach the folded-stack file",
+    )
+
+    return CaseResult(
+        case_id="dispatch-profile",
+        probe=DISPATCH_PROFILE_BENCHMARK_PROBE,
+        fixture=DISPATCH_PROFILE_FIXTURE,
+        claim_class="linked-runtime-probe",
+        passed=True,
+        summary={
+            "off_sends_per_second": payload.get("off_sends_per_second"),
+            "sampled_sends_per_second": payload.get("sampled_sends_per_second"),
+            "sampled_count": payload.get("sampled_count"),
+        },
+    )
+
+
+def check_large_image_class_realization_case(clangxx: str, run_dir: Path) -> CaseResult:
+    case_dir = run_dir / "startup-large-image"
+    probe = ROOT / Path(LARGE_IMAGE_CLASS_REALIZATION_BENCHMARK_PROBE)
+    exe_path = case_dir / "large_image_class_realization_benchmark_probe.exe"
+    compile_probe(clangxx, probe, exe_path, [])
+    payload = parse_json_output(run_probe(exe_path), "large image class realization probe")
+
+    samples = payload.get("samples")
+    expect(
+        isinstance(samples, list) and [row.get("class_count") for row in samples] == [256, 1024, 4096],
+        "expected large image class realization probe to publish 256/1024/4096-class samples",
+    )
+    classes_per_root = payload.get("classes_per_root", 0)
+    expect(
+        classes_per_root > 0
+        and all(
+            row.get("realized_class_count") == row.get("class_count")
+            and row.get("metaclass_edge_count")
+            == row.get("class_count") - row.get("class_count") // classes_per_root
+            and row.get("last_class_result") == 7
+            for row in samples
+        ),
+        "expected every image size to realize all of its classes and super edges",
+    )
+    expect(payload.get("samples_ok") == 1, "expected every large-image registration to succeed")
+
+    return CaseResult(
+        case_id="startup-large-image",
+        probe=LARGE_IMAGE_CLASS_REALIZATION_BENCHMARK_PROBE,
+        fixture=None,
+        claim_class="linked-runtime-probe",
+        passed=True,
+        summary={
+            "per_class_us_by_class_count": {
+                str(row.get("class_count")): row.get("per_class_us")
+                for row in samples
+                if isinstance(row, dict)
+            },
+            "large_to_small_per_class_ratio": payload.get("large_to_small_per_class_ratio"),
+        },
+    )
+
+
+def check_cold_method_miss_case(clangxx: str, run_dir: Path) -> CaseResult:
+    case_dir = run_dir / "cold-method-miss"
+    probe = ROOT / Path(COLD_METHOD_MISS_BENCHMARK_PROBE)
+    exe_path = case_dir / "cold_method_miss_benchmark_probe.exe"
+    compile_probe(clangxx, probe, exe_path, [])
+    payload = parse_json_output(run_probe(exe_path), "cold method miss probe")
+
+    samples = payload.get("samples")
+    expect(
+        isinstance(samples, list) and [sample.get("depth") for sample in samples] == [1, 8, 32, 64],
+        "expected cold-miss samples for 1-, 8-, 32-, and 64-level hierarchies",
+    )
+    expect(
+        payload.get("samples_ok") == 1,
+        "expected every hierarchy to index its method lists and resolve root selectors by table probe",
+    )
+    for sample in samples:
+        expect(
+            sample.get("method_table_probe_count", 0)
+            <= sample["depth"] * payload.get("methods_per_class", 0) + 1,
+            "expected a cold root-selector miss to probe at most one table per hierarchy level",
+        )
+    expect(
+        payload.get("indexed_method_list_count_after_reset") == 0,
+        "expected reset to drop every realized method table",
+    )
+
+    return CaseResult(
+        case_id="cold-method-miss",
+        probe=COLD_METHOD_MISS_BENCHMARK_PROBE,
+        fixture=None,
+        claim_class="linked-runtime-probe",
+        passed=True,
+        summary={
+            "methods_per_class": payload.get("methods_per_class"),
+            "deepest_cold_miss_us": samples[-1].get("cold_miss_us"),
+            "deepest_to_shallowest_cold_miss_ratio": payload.get(
+                "deepest_to_shallowest_cold_miss_ratio"
+            ),
+        },
+    )
+
+
+def check_sealed_dispatch_table_case(clangxx: str, run_dir: Path) -> CaseResult:
+    case_dir = run_dir / "sealed-dispatch-table"
+    obj_path, ll_path, _ = compile_fixture_outputs_with_args(
+        ROOT / Path(SEALED_DISPATCH_TABLE_FIXTURE),
+        case_dir / "compile",
+        ["--objc3-sealed-dispatch-tables"],
+    )
+    ll_text = ll_path.read_text(encoding="utf-8")
+    expect(
+        "@__objc3_sealed_dispatch_entries_Meter = internal global [4 x ptr] zeroinitializer"
+        in ll_text
+        and "call i32 @objc3_runtime_dispatch_sealed_i32(ptr @__objc3_sealed_dispatch_table_Meter"
+        in ll_text,
+        "expected sealed-table lowering to emit Meter's dense slot table and miss entrypoint",
+    )
+
+    probe = ROOT / Path(SEALED_DISPATCH_TABLE_BENCHMARK_PROBE)
+    exe_path = case_dir / "sealed_dispatch_table_benchmark_probe.exe"
+    compile_probe(clangxx, probe, exe_path, [obj_path])
+    payload = parse_json_output(run_probe(exe_path), "sealed dispatch table benchmark probe")
+    expect(payload.get("results_match") == 1, "expected sealed-table sends to match canonical dispatch results")
+    expect(
+        payload.get("bound_table_count") == 1
+        and payload.get("bound_slot_count") == 3
+        and payload.get("bind_miss_count") == 1
+        and payload.get("timed_table_miss_count") == 0
+        and payload.get("timed_method_cache_hit_count") == 0,
+        "expected one bind miss followed by in-place table calls for the timed loop",
+    )
+    expect(
+        payload.get("scale_result") == 42
+        and payload.get("ready_result") == 1
+        and payload.get("ready_table_miss_count") == 1
+        and payload.get("escape_result") == 9
+        and payload.get("self_steps_result") == 18,
+        "expected unbound slots, dynamic selectors, and self sends to keep canonical semantics",
+    )
+    expect(
+        payload.get("bound_table_count_after_reset") == 0
+        and payload.get("replay_status") == 0
+        and payload.get("rebound_result") == 10
+        and payload.get("rebind_count") == 1,
+        "expected a runtime reset to unbind sealed tables and the next send to rebind them",
+    )
+
+    return CaseResult(
+        case_id="sealed-dispatch-table",
+        probe=SEALED_DISPATCH_TABLE_BENCHMARK_PROBE,
+        fixture=SEALED_DISPATCH_TABLE_FIXTURE,
+        claim_class="linked-runtime-probe",
+        passed=True,
+        summary={
+            "sealed_sends_per_second": payload.get("sealed_sends_per_second"),
+            "canonical_sends_per_second": payload.get("canonical_sends_per_second"),
+            "sealed_speedup_ratio": payload.get("sealed_speedup_ratio"),
+        },
+    )
+
+
 def check_property_reflection_case(clangxx: str, run_dir: Path) -> CaseResult:
     case_dir = run_dir / "property-reflection"
     fixture = ROOT / "tests" / "tooling" / "fixtures" / "native" / "property_metadata_reflection_positive.objc3"
@@ -19314,6 +21015,34 @@ def main() -> int:
         check_canonical_sample_set_case(clangxx, run_dir),
         check_realization_lookup_reflection_runtime_case(clangxx, run_dir),
         check_live_dispatch_fast_path_case(clangxx, run_dir),
+        check_dispatch_cache_contention_case(clangxx, run_dir),
+        check_dispatch_trace_ring_case(clangxx, run_dir),
+        check_dispatch_site_cache_case(clangxx, run_dir),
+        check_selector_handle_dispatch_case(clangxx, run_dir),
+        check_incremental_class_realization_case(clangxx, run_dir),
+        check_prebuilt_metadata_image_startup_case(clangxx, run_dir),
+        check_instance_allocation_churn_case(clangxx, run_dir),
+        check_retain_release_contention_case(clangxx, run_dir),
+        check_weak_side_table_case(clangxx, run_dir),
+        check_autorelease_page_stack_case(clangxx, run_dir),
+        check_release_batch_teardown_case(clangxx, run_dir),
+        check_block_invoke_throughput_case(clangxx, run_dir),
+        check_task_executor_case(clangxx, run_dir),
+        check_task_group_block_body_case(clangxx, run_dir),
+        check_actor_ping_pong_case(clangxx, run_dir),
+        check_async_continuation_suspension_case(clangxx, run_dir),
+        check_async_lowering_execution_case(clangxx, run_dir),
+        check_receiver_handle_decode_case(clangxx, run_dir),
+        check_class_symbol_table_case(clangxx, run_dir),
+        check_protocol_conformance_query_case(clangxx, run_dir),
+        check_direct_property_access_case(clangxx, run_dir),
+        check_keypath_chain_evaluation_case(clangxx, run_dir),
+        check_bounded_method_cache_case(clangxx, run_dir),
+        check_runtime_metrics_export_case(clangxx, run_dir),
+        check_dispatch_profile_case(clangxx, run_dir),
+        check_large_image_class_realization_case(clangxx, run_dir),
+        check_cold_method_miss_case(clangxx, run_dir),
+        check_sealed_dispatch_table_case(clangxx, run_dir),
         check_storage_ownership_reflection_case(clangxx, run_dir),
         check_property_ivar_ordering_semantics_case(run_dir),
         check_accessor_storage_lowering_metadata_surface_case(run_dir),
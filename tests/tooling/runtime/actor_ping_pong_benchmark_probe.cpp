@@ -0,0 +1,248 @@
+#include "runtime/objc3_runtime.h"
+#include "runtime/objc3_runtime_bootstrap_internal.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr int kActorPairCount = 256;
+constexpr int kActorCount = 2 * kActorPairCount;
+constexpr int kRoundTripsPerPair = 2000;
+constexpr int kFirstActorHandle = 7000;
+constexpr int kFanInActorHandle = 6000;
+constexpr int kFanInProducerCount = 4;
+constexpr int kFanInMessagesPerProducer = 50000;
+constexpr int kCrossThreadValueCount = 10000;
+constexpr int kMailboxActorHandle = 6001;
+constexpr int kHopActorHandle = 6002;
+// StablePositiveAsyncTag("executor:com.example.signalmesh"), as lowered for
+// `objc_executor(named("com.example.signalmesh"))`.
+constexpr int kNamedExecutorTag = 1761204479;
+
+using Clock = std::chrono::steady_clock;
+
+// A non-pointer-capture block: the invoke thunk followed by by-value captures.
+struct ValueBlockStorage {
+  int (*invoke)(void *, int, int, int, int) = nullptr;
+  int payload = 0;
+};
+
+int PromoteValueBlock(int (*invoke)(void *, int, int, int, int), int payload) {
+  ValueBlockStorage storage{invoke, payload};
+  return objc3_runtime_promote_block_i32(&storage, sizeof(storage), 0);
+}
+
+double ElapsedMs(Clock::time_point started) {
+  return std::chrono::duration<double, std::milli>(Clock::now() - started)
+      .count();
+}
+
+void WaitUntil(const std::atomic<int> &counter, int target) {
+  while (counter.load(std::memory_order_acquire) < target) {
+    std::this_thread::sleep_for(std::chrono::microseconds(50));
+  }
+}
+
+std::vector<int> g_ping_blocks(kActorCount, 0);
+std::atomic<int> g_inside[kActorCount];
+// Plain counters: updating them from two threads at once would lose counts,
+// so matching totals also witness actor exclusivity.
+int g_received[kActorCount];
+std::atomic<int> g_overlap_count{0};
+std::atomic<int> g_finished_pair_count{0};
+
+// Each message carries the exchanges left; the receiver answers its partner
+// until the count runs out.
+extern "C" int PingInvoke(void *storage, int remaining, int, int, int) {
+  const int actor = static_cast<ValueBlockStorage *>(storage)->payload;
+  if (g_inside[actor].fetch_add(1) != 0) {
+    g_overlap_count.fetch_add(1);
+  }
+  ++g_received[actor];
+  g_inside[actor].fetch_sub(1);
+  if (remaining == 0) {
+    g_finished_pair_count.fetch_add(1, std::memory_order_release);
+    return 0;
+  }
+  const int partner = actor ^ 1;
+  return objc3_runtime_actor_send_block_i32(
+      kFirstActorHandle + partner,
+      g_ping_blocks[static_cast<std::size_t>(partner)], remaining - 1);
+}
+
+std::atomic<int> g_fan_in_inside{0};
+int g_fan_in_sum = 0;
+std::atomic<int> g_fan_in_received{0};
+
+extern "C" int FanInInvoke(void *, int value, int, int, int) {
+  if (g_fan_in_inside.fetch_add(1) != 0) {
+    g_overlap_count.fetch_add(1);
+  }
+  g_fan_in_sum += value;
+  g_fan_in_inside.fetch_sub(1);
+  g_fan_in_received.fetch_add(1, std::memory_order_release);
+  return value;
+}
+
+std::atomic<bool> g_slow_started{false};
+std::atomic<bool> g_slow_finished{false};
+
+extern "C" int SlowInvoke(void *, int, int, int, int) {
+  g_slow_started.store(true);
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  g_slow_finished.store(true);
+  return 0;
+}
+
+objc3_runtime_actor_executor_state_snapshot CopyActorState() {
+  objc3_runtime_actor_executor_state_snapshot snapshot{};
+  (void)objc3_runtime_copy_actor_executor_state_for_testing(&snapshot);
+  return snapshot;
+}
+
+}  // namespace
+
+int main() {
+  objc3_runtime_reset_for_testing();
+
+  // Ping-pong: every pair bounces one message back and forth, so each send
+  // wakes an idle actor on another worker.
+  for (int actor = 0; actor < kActorCount; ++actor) {
+    g_ping_blocks[static_cast<std::size_t>(actor)] =
+        PromoteValueBlock(&PingInvoke, actor);
+  }
+  const int messages_per_pair = 2 * kRoundTripsPerPair;
+  auto started = Clock::now();
+  for (int pair = 0; pair < kActorPairCount; ++pair) {
+    (void)objc3_runtime_actor_send_block_i32(
+        kFirstActorHandle + 2 * pair,
+        g_ping_blocks[static_cast<std::size_t>(2 * pair)],
+        messages_per_pair - 1);
+  }
+  WaitUntil(g_finished_pair_count, kActorPairCount);
+  const double ping_pong_ms = ElapsedMs(started);
+  const std::uint64_t ping_pong_message_count =
+      static_cast<std::uint64_t>(kActorPairCount) * messages_per_pair;
+  int received_mismatch_count = 0;
+  for (int actor = 0; actor < kActorCount; ++actor) {
+    received_mismatch_count +=
+        g_received[actor] == kRoundTripsPerPair ? 0 : 1;
+  }
+  const objc3_runtime_actor_executor_state_snapshot after_ping_pong =
+      CopyActorState();
+
+  // Fan-in: several threads send to one actor at once through its MPSC queue.
+  const int fan_in_block = PromoteValueBlock(&FanInInvoke, 0);
+  started = Clock::now();
+  std::vector<std::thread> producers;
+  for (int producer = 0; producer < kFanInProducerCount; ++producer) {
+    producers.emplace_back([fan_in_block]() {
+      for (int index = 0; index < kFanInMessagesPerProducer; ++index) {
+        (void)objc3_runtime_actor_send_block_i32(kFanInActorHandle,
+                                                 fan_in_block, 1);
+      }
+    });
+  }
+  for (std::thread &producer : producers) {
+    producer.join();
+  }
+  const int fan_in_message_count =
+      kFanInProducerCount * kFanInMessagesPerProducer;
+  WaitUntil(g_fan_in_received, fan_in_message_count);
+  const double fan_in_ms = ElapsedMs(started);
+
+  // Mailbox values enqueued on one thread are drained on another, in order.
+  std::thread([]() {
+    for (int index = 1; index <= kCrossThreadValueCount; ++index) {
+      (void)objc3_runtime_actor_mailbox_enqueue_i32(kMailboxActorHandle, index,
+                                                    0);
+    }
+  }).join();
+  int cross_thread_order_breaks = 0;
+  for (int index = 1; index <= kCrossThreadValueCount; ++index) {
+    cross_thread_order_breaks +=
+        objc3_runtime_actor_mailbox_drain_next_i32(kMailboxActorHandle, 0) ==
+                index
+            ? 0
+            : 1;
+  }
+  const int drained_empty =
+      objc3_runtime_actor_mailbox_drain_next_i32(kMailboxActorHandle, 0);
+
+  // A hop onto a busy executor returns only after its running message ends.
+  (void)objc3_runtime_actor_bind_executor_i32(kHopActorHandle,
+                                              kNamedExecutorTag);
+  const int slow_block = PromoteValueBlock(&SlowInvoke, 0);
+  (void)objc3_runtime_actor_send_block_i32(kHopActorHandle, slow_block, 0);
+  while (!g_slow_started.load()) {
+  }
+  const std::uint64_t queued_hops_before = CopyActorState().queued_hop_count;
+  const int hop_result =
+      objc3_runtime_actor_hop_to_executor_i32(31, kNamedExecutorTag);
+  const bool hop_waited_for_message = g_slow_finished.load();
+  const objc3_runtime_actor_executor_state_snapshot after_hop =
+      CopyActorState();
+
+  for (int block : g_ping_blocks) {
+    (void)objc3_runtime_release_i32(block);
+  }
+  (void)objc3_runtime_release_i32(fan_in_block);
+  (void)objc3_runtime_release_i32(slow_block);
+  objc3_runtime_reset_for_testing();
+  const objc3_runtime_actor_executor_state_snapshot after_reset =
+      CopyActorState();
+
+  std::printf("{");
+  std::printf("\"actor_count\":%d,", kActorCount);
+  std::printf("\"ping_pong_message_count\":%llu,",
+              static_cast<unsigned long long>(ping_pong_message_count));
+  std::printf("\"ping_pong_ms\":%.3f,", ping_pong_ms);
+  std::printf("\"ping_pong_messages_per_second\":%.0f,",
+              ping_pong_ms > 0.0
+                  ? static_cast<double>(ping_pong_message_count) * 1000.0 /
+                        ping_pong_ms
+                  : 0.0);
+  std::printf("\"received_mismatch_count\":%d,", received_mismatch_count);
+  std::printf("\"sent_message_count\":%llu,",
+              static_cast<unsigned long long>(
+                  after_ping_pong.sent_message_count));
+  std::printf("\"executor_turn_count\":%llu,",
+              static_cast<unsigned long long>(
+                  after_ping_pong.executor_turn_count));
+  std::printf("\"fan_in_message_count\":%d,", fan_in_message_count);
+  std::printf("\"fan_in_messages_per_second\":%.0f,",
+              fan_in_ms > 0.0 ? fan_in_message_count * 1000.0 / fan_in_ms
+                              : 0.0);
+  std::printf("\"fan_in_sum\":%d,", g_fan_in_sum);
+  std::printf("\"overlap_count\":%d,", g_overlap_count.load());
+  std::printf("\"cross_thread_order_breaks\":%d,", cross_thread_order_breaks);
+  std::printf("\"drained_empty\":%d,", drained_empty);
+  std::printf("\"hop_result\":%d,", hop_result);
+  std::printf("\"hop_waited_for_message\":%d,",
+              hop_waited_for_message ? 1 : 0);
+  std::printf("\"queued_hop_count\":%llu,",
+              static_cast<unsigned long long>(after_hop.queued_hop_count -
+                                              queued_hops_before));
+  std::printf("\"reset_pending_job_count\":%llu,",
+              static_cast<unsigned long long>(after_reset.pending_job_count));
+  std::printf("\"reset_pending_mailbox_value_count\":%llu",
+              static_cast<unsigned long long>(
+                  after_reset.pending_mailbox_value_count));
+  std::printf("}\n");
+
+  const bool ok =
+      received_mismatch_count == 0 &&
+      after_ping_pong.sent_message_count == ping_pong_message_count &&
+      g_fan_in_sum == fan_in_message_count && g_overlap_count.load() == 0 &&
+      cross_thread_order_breaks == 0 && drained_empty == 0 &&
+      hop_result == 31 && hop_waited_for_message &&
+      after_hop.queued_hop_count - queued_hops_before == 1u &&
+      after_reset.pending_job_count == 0u &&
+      after_reset.pending_mailbox_value_count == 0u;
+  return ok ? 0 : 1;
+}
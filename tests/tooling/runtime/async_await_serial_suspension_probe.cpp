@@ -0,0 +1,27 @@
+#include <cstdio>
+
+#include "runtime/objc3_runtime.h"
+#include "runtime/objc3_runtime_bootstrap_internal.h"
+
+extern "C" int runSerialAwaits();
+
+// The first await hops onto the named serial executor and suspends the frame;
+// the later awaits already hold that executor and complete inline.
+int main() {
+  objc3_runtime_reset_for_testing();
+  const int result = runSerialAwaits();
+
+  objc3_runtime_async_frame_state_snapshot snapshot{};
+  const int status = objc3_runtime_copy_async_frame_state_for_testing(&snapshot);
+
+  std::printf("{\"status\":%d,\"result\":%d,\"suspension_count\":%llu,"
+              "\"inline_await_count\":%llu,\"completed_frame_count\":%llu,"
+              "\"live_frame_count\":%llu,\"suspended_frame_count\":%llu}\n",
+              status, result,
+              static_cast<unsigned long long>(snapshot.suspension_count),
+              static_cast<unsigned long long>(snapshot.inline_await_count),
+              static_cast<unsigned long long>(snapshot.completed_frame_count),
+              static_cast<unsigned long long>(snapshot.live_frame_count),
+              static_cast<unsigned long long>(snapshot.suspended_frame_count));
+  return status == 0 && result == 12 ? 0 : 1;
+}
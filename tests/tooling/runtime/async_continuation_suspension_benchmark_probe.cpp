@@ -0,0 +1,337 @@
+#include "runtime/objc3_runtime.h"
+#include "runtime/objc3_runtime_bootstrap_internal.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+namespace {
+
+constexpr int kTaskKindChild = 1;
+constexpr int kTaskKindDetached = 2;
+constexpr int kSuspendedTaskCount = 100000;
+constexpr int kCancelledTaskCount = 1000;
+constexpr int kHopTaskCount = 1000;
+constexpr int kResumeEntryTag = 16;
+// StablePositiveAsyncTag("executor:com.example.signalmesh"), as lowered for
+// `objc_executor(named("com.example.signalmesh"))`.
+constexpr int kNamedExecutorTag = 1761204479;
+
+using Clock = std::chrono::steady_clock;
+
+// Mirrors the frame an async function lowers to: the resume point and the
+// awaited value come first, then the function's own locals.
+struct ParkFrame {
+  std::int32_t resume_point;
+  std::int32_t value;
+  std::int32_t index;
+};
+
+struct HopFrame {
+  std::int32_t resume_point;
+  std::int32_t value;
+  std::int32_t hops;
+};
+
+std::vector<int> g_handles(kSuspendedTaskCount + kCancelledTaskCount, 0);
+std::atomic<int> g_parked_count{0};
+std::atomic<int> g_finished_count{0};
+std::atomic<long long> g_result_sum{0};
+std::atomic<int> g_cancelled_observed_count{0};
+std::atomic<int> g_hop_overlap_count{0};
+std::atomic<int> g_inside_hop_executor{0};
+
+// `let value = await continuation; return value + index;` with the
+// continuation resumed or cancelled by another thread.
+extern "C" int ParkResume(void *slots) {
+  auto *const frame = static_cast<ParkFrame *>(slots);
+  switch (frame->resume_point) {
+    case 0: {
+      const int handle = objc3_runtime_allocate_async_continuation_i32(
+          kResumeEntryTag, 0);
+      g_handles[static_cast<std::size_t>(frame->index)] = handle;
+      frame->resume_point = 1;
+      g_parked_count.fetch_add(1, std::memory_order_release);
+      if (objc3_runtime_park_async_frame_i32(slots, handle) != 0) {
+        return 0;
+      }
+      frame->value = -1;
+      [[fallthrough]];
+    }
+    case 1:
+      if (frame->value == 0) {
+        g_cancelled_observed_count.fetch_add(
+            objc3_runtime_task_is_cancelled_i32(0), std::memory_order_relaxed);
+      }
+      g_result_sum.fetch_add(frame->value, std::memory_order_relaxed);
+      frame->value += frame->index;
+      g_finished_count.fetch_add(1, std::memory_order_release);
+      return 1;
+    default:
+      return 1;
+  }
+}
+
+// Awaits onto a serial executor twice: the first await yields the worker and
+// resumes as one of that executor's turns, so steps never overlap; the second
+// finds the executor already held and continues inline.
+extern "C" int HopResume(void *slots) {
+  auto *const frame = static_cast<HopFrame *>(slots);
+  switch (frame->resume_point) {
+    case 0:
+      frame->resume_point = 1;
+      if (objc3_runtime_await_async_frame_i32(slots, kNamedExecutorTag) != 0) {
+        return 0;
+      }
+      [[fallthrough]];
+    case 1:
+      if (g_inside_hop_executor.fetch_add(1) != 0) {
+        g_hop_overlap_count.fetch_add(1);
+      }
+      ++frame->hops;
+      g_inside_hop_executor.fetch_sub(1);
+      frame->resume_point = 2;
+      if (objc3_runtime_await_async_frame_i32(slots, kNamedExecutorTag) != 0) {
+        return 0;
+      }
+      [[fallthrough]];
+    default:
+      ++frame->hops;
+      frame->value = frame->hops;
+      return 1;
+  }
+}
+
+void *NewParkFrame(int index) {
+  void *const slots =
+      objc3_runtime_allocate_async_frame(&ParkResume, sizeof(ParkFrame));
+  static_cast<ParkFrame *>(slots)->index = index;
+  return slots;
+}
+
+objc3_runtime_async_frame_state_snapshot CopyFrameState() {
+  objc3_runtime_async_frame_state_snapshot snapshot{};
+  (void)objc3_runtime_copy_async_frame_state_for_testing(&snapshot);
+  return snapshot;
+}
+
+objc3_runtime_task_executor_state_snapshot CopyExecutorState() {
+  objc3_runtime_task_executor_state_snapshot snapshot{};
+  (void)objc3_runtime_copy_task_executor_state_for_testing(&snapshot);
+  return snapshot;
+}
+
+void WaitUntil(const std::atomic<int> &counter, int target) {
+  while (counter.load(std::memory_order_acquire) < target) {
+    std::this_thread::sleep_for(std::chrono::microseconds(50));
+  }
+}
+
+void WaitUntilSuspended(std::uint64_t target) {
+  while (CopyFrameState().suspended_frame_count < target) {
+    std::this_thread::sleep_for(std::chrono::microseconds(50));
+  }
+}
+
+std::uint64_t ResidentBytes() {
+  long pages = 0;
+  long resident = 0;
+  FILE *const statm = std::fopen("/proc/self/statm", "r");
+  if (statm == nullptr) {
+    return 0u;
+  }
+  if (std::fscanf(statm, "%ld %ld", &pages, &resident) != 2) {
+    resident = 0;
+  }
+  std::fclose(statm);
+  return static_cast<std::uint64_t>(resident) *
+         static_cast<std::uint64_t>(sysconf(_SC_PAGESIZE));
+}
+
+double ElapsedMs(Clock::time_point started) {
+  return std::chrono::duration<double, std::milli>(Clock::now() - started)
+      .count();
+}
+
+}  // namespace
+
+int main() {
+  objc3_runtime_reset_for_testing();
+
+  // Park 100k tasks on continuations; none of them holds a worker while it
+  // waits.
+  const std::uint64_t resident_before = ResidentBytes();
+  auto started = Clock::now();
+  for (int index = 0; index < kSuspendedTaskCount; ++index) {
+    (void)objc3_runtime_spawn_async_frame_task_i32(kTaskKindDetached,
+                                                   NewParkFrame(index), 0);
+  }
+  WaitUntil(g_parked_count, kSuspendedTaskCount);
+  WaitUntilSuspended(kSuspendedTaskCount);
+  const double suspend_ms = ElapsedMs(started);
+  const std::uint64_t resident_suspended = ResidentBytes();
+  const objc3_runtime_async_frame_state_snapshot suspended = CopyFrameState();
+  const objc3_runtime_task_executor_state_snapshot suspended_executor =
+      CopyExecutorState();
+
+  // Resume every continuation from a thread outside the pool.
+  started = Clock::now();
+  std::thread([]() {
+    for (int index = 0; index < kSuspendedTaskCount; ++index) {
+      (void)objc3_runtime_resume_async_continuation_i32(
+          g_handles[static_cast<std::size_t>(index)], 1);
+    }
+  }).join();
+  WaitUntil(g_finished_count, kSuspendedTaskCount);
+  const double resume_ms = ElapsedMs(started);
+  const long long resumed_sum = g_result_sum.load();
+  const int stale_resume = objc3_runtime_resume_async_continuation_i32(
+      g_handles[0], 1);
+  const int stale_cancel =
+      objc3_runtime_cancel_async_continuation_i32(g_handles[1]);
+
+  // Cancel half of a second wave and resume the rest; cancelled frames
+  // resume with 0 inside a cancelled task.
+  g_result_sum.store(0);
+  for (int index = kSuspendedTaskCount;
+       index < kSuspendedTaskCount + kCancelledTaskCount; ++index) {
+    (void)objc3_runtime_spawn_async_frame_task_i32(kTaskKindDetached,
+                                                   NewParkFrame(index), 0);
+  }
+  WaitUntil(g_parked_count, kSuspendedTaskCount + kCancelledTaskCount);
+  WaitUntilSuspended(kCancelledTaskCount);
+  int cancel_accepted = 0;
+  for (int offset = 0; offset < kCancelledTaskCount; ++offset) {
+    const int handle =
+        g_handles[static_cast<std::size_t>(kSuspendedTaskCount + offset)];
+    if (offset % 2 == 0) {
+      cancel_accepted += objc3_runtime_cancel_async_continuation_i32(handle);
+    } else {
+      (void)objc3_runtime_resume_async_continuation_i32(handle, 2);
+    }
+  }
+  WaitUntil(g_finished_count, kSuspendedTaskCount + kCancelledTaskCount);
+  const long long mixed_sum = g_result_sum.load();
+
+  // A joined child task that awaits onto a serial executor yields its worker
+  // at each hop.
+  std::vector<int> hop_tasks;
+  for (int index = 0; index < kHopTaskCount; ++index) {
+    hop_tasks.push_back(objc3_runtime_spawn_async_frame_task_i32(
+        kTaskKindChild,
+        objc3_runtime_allocate_async_frame(&HopResume, sizeof(HopFrame)), 0));
+  }
+  int hop_result_mismatch_count = 0;
+  for (int task : hop_tasks) {
+    hop_result_mismatch_count += objc3_runtime_join_task_i32(task) == 2 ? 0 : 1;
+  }
+  // A synchronous caller gets the same result through the run entry.
+  const int sync_hop_result = objc3_runtime_run_async_frame_i32(
+      objc3_runtime_allocate_async_frame(&HopResume, sizeof(HopFrame)));
+  const objc3_runtime_async_frame_state_snapshot finished = CopyFrameState();
+
+  // A reset cancels anything still parked and recycles every record.
+  g_result_sum.store(0);
+  (void)objc3_runtime_spawn_async_frame_task_i32(kTaskKindDetached,
+                                                 NewParkFrame(0), 0);
+  WaitUntilSuspended(1u);
+  objc3_runtime_reset_for_testing();
+  const objc3_runtime_async_frame_state_snapshot after_reset =
+      CopyFrameState();
+  const int first_handle_after_reset =
+      objc3_runtime_allocate_async_continuation_i32(kResumeEntryTag, 0);
+  const int handle_resumed_inline =
+      objc3_runtime_resume_async_continuation_i32(first_handle_after_reset, 9);
+  objc3_runtime_reset_for_testing();
+
+  const double frame_bytes_per_task =
+      static_cast<double>(suspended.suspended_frame_bytes) /
+      kSuspendedTaskCount;
+  const double pooled_bytes_per_task =
+      static_cast<double>(suspended.pooled_frame_bytes +
+                          suspended.continuation_capacity *
+                              suspended.continuation_record_bytes) /
+      kSuspendedTaskCount;
+  const double resident_bytes_per_task =
+      resident_suspended > resident_before
+          ? static_cast<double>(resident_suspended - resident_before) /
+                kSuspendedTaskCount
+          : 0.0;
+
+  std::printf("{");
+  std::printf("\"suspended_task_count\":%d,", kSuspendedTaskCount);
+  std::printf("\"worker_count\":%llu,", static_cast<unsigned long long>(
+                                            suspended_executor.worker_count));
+  std::printf("\"in_flight_task_count\":%llu,",
+              static_cast<unsigned long long>(
+                  suspended_executor.in_flight_task_count));
+  std::printf("\"suspended_frame_count\":%llu,",
+              static_cast<unsigned long long>(suspended.suspended_frame_count));
+  std::printf("\"frame_bytes_per_suspended_task\":%.1f,",
+              frame_bytes_per_task);
+  std::printf("\"continuation_record_bytes\":%llu,",
+              static_cast<unsigned long long>(
+                  suspended.continuation_record_bytes));
+  std::printf("\"pooled_bytes_per_suspended_task\":%.1f,",
+              pooled_bytes_per_task);
+  std::printf("\"resident_bytes_per_suspended_task\":%.1f,",
+              resident_bytes_per_task);
+  std::printf("\"suspend_ms\":%.3f,", suspend_ms);
+  std::printf("\"resume_ms\":%.3f,", resume_ms);
+  std::printf("\"resumes_per_second\":%.0f,",
+              resume_ms > 0.0 ? kSuspendedTaskCount * 1000.0 / resume_ms : 0.0);
+  std::printf("\"resumed_sum\":%lld,", resumed_sum);
+  std::printf("\"stale_resume\":%d,", stale_resume);
+  std::printf("\"stale_cancel\":%d,", stale_cancel);
+  std::printf("\"cancel_accepted\":%d,", cancel_accepted);
+  std::printf("\"cancelled_observed_count\":%d,",
+              g_cancelled_observed_count.load());
+  std::printf("\"mixed_sum\":%lld,", mixed_sum);
+  std::printf("\"hop_result_mismatch_count\":%d,", hop_result_mismatch_count);
+  std::printf("\"hop_overlap_count\":%d,", g_hop_overlap_count.load());
+  std::printf("\"sync_hop_result\":%d,", sync_hop_result);
+  std::printf("\"suspension_count\":%llu,",
+              static_cast<unsigned long long>(finished.suspension_count));
+  std::printf("\"inline_await_count\":%llu,",
+              static_cast<unsigned long long>(finished.inline_await_count));
+  std::printf("\"live_frame_count\":%llu,",
+              static_cast<unsigned long long>(finished.live_frame_count));
+  std::printf("\"reset_live_frame_count\":%llu,",
+              static_cast<unsigned long long>(after_reset.live_frame_count));
+  std::printf("\"reset_live_continuation_count\":%llu,",
+              static_cast<unsigned long long>(
+                  after_reset.live_continuation_count));
+  std::printf("\"first_handle_after_reset\":%d,", first_handle_after_reset);
+  std::printf("\"handle_resumed_inline\":%d", handle_resumed_inline);
+  std::printf("}\n");
+
+  const std::uint64_t expected_suspensions =
+      static_cast<std::uint64_t>(kSuspendedTaskCount + kCancelledTaskCount) +
+      kHopTaskCount + 1u;
+  const bool ok =
+      suspended.suspended_frame_count ==
+          static_cast<std::uint64_t>(kSuspendedTaskCount) &&
+      suspended_executor.in_flight_task_count ==
+          static_cast<std::uint64_t>(kSuspendedTaskCount) &&
+      suspended.live_continuation_count ==
+          static_cast<std::uint64_t>(kSuspendedTaskCount) &&
+      frame_bytes_per_task > 0.0 && frame_bytes_per_task <= 256.0 &&
+      resumed_sum == kSuspendedTaskCount && stale_resume == 0 &&
+      stale_cancel == 0 && cancel_accepted == kCancelledTaskCount / 2 &&
+      g_cancelled_observed_count.load() == kCancelledTaskCount / 2 &&
+      mixed_sum == kCancelledTaskCount &&
+      hop_result_mismatch_count == 0 && g_hop_overlap_count.load() == 0 &&
+      sync_hop_result == 2 &&
+      finished.suspension_count == expected_suspensions &&
+      finished.inline_await_count == kHopTaskCount + 1u &&
+      finished.live_frame_count == 0u &&
+      finished.live_continuation_count == 0u &&
+      after_reset.live_frame_count == 0u &&
+      after_reset.live_continuation_count == 0u &&
+      first_handle_after_reset == 1 && handle_resumed_inline == 9;
+  return ok ? 0 : 1;
+}
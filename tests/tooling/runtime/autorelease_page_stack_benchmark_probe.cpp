@@ -0,0 +1,236 @@
+#include "runtime/objc3_runtime.h"
+#include "runtime/objc3_runtime_bootstrap_internal.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+namespace {
+
+constexpr int kClassReceiver = 1024;
+constexpr int kWorkingSetSize = 64;
+constexpr int kTimedRoundCount = 500;
+constexpr int kInnerPoolsPerRound = 4;
+// Larger than one page's entry capacity, so every inner pool crosses a page
+// edge on push and walks back across it on pop.
+constexpr int kAutoreleasesPerInnerPool = 1024;
+constexpr int kAutoreleasesPerRound =
+    1 + kInnerPoolsPerRound * kAutoreleasesPerInnerPool;
+constexpr const char *kClassName = "PooledObject";
+constexpr const char *kImplementationIdentity = "implementation:PooledObject";
+constexpr const char *kClassIdentity = "class:PooledObject";
+constexpr const char *kMetaclassIdentity = "metaclass:PooledObject";
+
+// Mirror the emitted class-bundle and registration-table layouts for one
+// image holding a single root class with no methods.
+struct SyntheticClassRecord {
+  const char *class_name;
+  const char *bundle_owner_identity;
+  const char *object_owner_identity;
+  const char *super_owner_identity;
+  const void *super_bundle;
+  const void *method_list_ref;
+  const objc3_runtime_pointer_aggregate *adopted_protocol_refs;
+  bool objc_final_declared;
+  bool objc_sealed_declared;
+};
+
+struct SyntheticClassBundle {
+  SyntheticClassRecord class_record;
+  SyntheticClassRecord metaclass_record;
+};
+
+template <std::size_t EntryCount>
+struct PointerAggregateStorage {
+  std::uint64_t count;
+  const void *entries[EntryCount];
+};
+
+const objc3_runtime_pointer_aggregate *AsAggregate(const void *storage) {
+  return static_cast<const objc3_runtime_pointer_aggregate *>(storage);
+}
+
+SyntheticClassBundle g_bundle{
+    {kClassName, kImplementationIdentity, kClassIdentity, nullptr, nullptr,
+     nullptr, nullptr, false, false},
+    {kClassName, kImplementationIdentity, kMetaclassIdentity, nullptr, nullptr,
+     nullptr, nullptr, false, false}};
+PointerAggregateStorage<1> g_class_root{1, {&g_bundle}};
+PointerAggregateStorage<1> g_empty_root{0, {nullptr}};
+PointerAggregateStorage<6> g_discovery_root{
+    6,
+    {&g_class_root, &g_empty_root, &g_empty_root, &g_empty_root, &g_empty_root,
+     &g_empty_root}};
+const void *g_linker_anchor = &g_discovery_root;
+unsigned char g_image_local_init_state = 0;
+objc3_runtime_image_descriptor g_descriptor{
+    "autorelease-pages", "autorelease-pages::image", 1, 1, 0, 0, 0, 0};
+objc3_runtime_registration_table g_table{
+    2,
+    12,
+    &g_descriptor,
+    AsAggregate(&g_discovery_root),
+    &g_linker_anchor,
+    AsAggregate(&g_class_root),
+    AsAggregate(&g_empty_root),
+    AsAggregate(&g_empty_root),
+    AsAggregate(&g_empty_root),
+    AsAggregate(&g_empty_root),
+    AsAggregate(&g_empty_root),
+    nullptr,
+    nullptr,
+    &g_image_local_init_state};
+
+objc3_runtime_autorelease_page_state_snapshot CopyPageState() {
+  objc3_runtime_autorelease_page_state_snapshot snapshot{};
+  (void)objc3_runtime_copy_autorelease_page_state_for_testing(&snapshot);
+  return snapshot;
+}
+
+objc3_runtime_memory_management_state_snapshot CopyMemoryState() {
+  objc3_runtime_memory_management_state_snapshot snapshot{};
+  (void)objc3_runtime_copy_memory_management_state_for_testing(&snapshot);
+  return snapshot;
+}
+
+// One outer pool holds a value across several inner pools, each of which
+// retains and autoreleases a working-set object in a tight loop.
+void RunRound(const std::vector<int> &live) {
+  objc3_runtime_push_autoreleasepool_scope();
+  (void)objc3_runtime_autorelease_i32(objc3_runtime_retain_i32(live[0]));
+  for (int pool = 0; pool < kInnerPoolsPerRound; ++pool) {
+    objc3_runtime_push_autoreleasepool_scope();
+    for (int index = 0; index < kAutoreleasesPerInnerPool; ++index) {
+      const int value =
+          live[static_cast<std::size_t>(index % kWorkingSetSize)];
+      (void)objc3_runtime_autorelease_i32(objc3_runtime_retain_i32(value));
+    }
+    objc3_runtime_pop_autoreleasepool_scope();
+  }
+  objc3_runtime_pop_autoreleasepool_scope();
+}
+
+}  // namespace
+
+int main() {
+  objc3_runtime_reset_for_testing();
+  objc3_runtime_stage_registration_table_for_bootstrap(&g_table);
+  const int registration_status = objc3_runtime_register_image(&g_descriptor);
+
+  std::vector<int> live(kWorkingSetSize, 0);
+  bool allocations_ok = true;
+  for (int index = 0; index < kWorkingSetSize; ++index) {
+    live[static_cast<std::size_t>(index)] =
+        objc3_runtime_dispatch_i32(kClassReceiver, "alloc", 0, 0, 0, 0);
+    allocations_ok =
+        allocations_ok && live[static_cast<std::size_t>(index)] != 0;
+  }
+
+  // A warm round sizes the page chain; timed rounds must reuse it.
+  RunRound(live);
+  const objc3_runtime_autorelease_page_state_snapshot warm = CopyPageState();
+  const objc3_runtime_memory_management_state_snapshot before =
+      CopyMemoryState();
+
+  const auto started = std::chrono::steady_clock::now();
+  for (int round = 0; round < kTimedRoundCount; ++round) {
+    RunRound(live);
+  }
+  const auto finished = std::chrono::steady_clock::now();
+  const objc3_runtime_autorelease_page_state_snapshot timed = CopyPageState();
+  const objc3_runtime_memory_management_state_snapshot after =
+      CopyMemoryState();
+  const double elapsed_ms =
+      std::chrono::duration<double, std::milli>(finished - started).count();
+
+  // Pools drain newest-first: the last value released is the first pushed.
+  objc3_runtime_push_autoreleasepool_scope();
+  (void)objc3_runtime_autorelease_i32(objc3_runtime_retain_i32(live[1]));
+  (void)objc3_runtime_autorelease_i32(objc3_runtime_retain_i32(live[2]));
+  (void)objc3_runtime_autorelease_i32(objc3_runtime_retain_i32(live[3]));
+  objc3_runtime_pop_autoreleasepool_scope();
+  const objc3_runtime_memory_management_state_snapshot lifo = CopyMemoryState();
+
+  // Dropping the working set must free every instance: each timed
+  // autorelease was balanced by exactly one drain-time release.
+  for (int value : live) {
+    (void)objc3_runtime_release_i32(value);
+  }
+  const objc3_runtime_memory_management_state_snapshot released =
+      CopyMemoryState();
+
+  const std::uint64_t timed_autorelease_count =
+      static_cast<std::uint64_t>(kTimedRoundCount) * kAutoreleasesPerRound;
+  // Outer boundary, the outer value, one inner boundary, and its values.
+  const std::uint64_t expected_high_water =
+      3u + static_cast<std::uint64_t>(kAutoreleasesPerInnerPool);
+
+  std::printf("{");
+  std::printf("\"registration_status\":%d,", registration_status);
+  std::printf("\"timed_autorelease_count\":%llu,",
+              static_cast<unsigned long long>(timed_autorelease_count));
+  std::printf("\"elapsed_ms\":%.3f,", elapsed_ms);
+  std::printf("\"autoreleases_per_second\":%.0f,",
+              elapsed_ms > 0.0 ? static_cast<double>(timed_autorelease_count) *
+                                     1000.0 / elapsed_ms
+                               : 0.0);
+  std::printf("\"page_size_bytes\":%llu,",
+              static_cast<unsigned long long>(timed.page_size_bytes));
+  std::printf("\"entries_per_page\":%llu,",
+              static_cast<unsigned long long>(timed.entries_per_page));
+  std::printf("\"allocated_page_count\":%llu,",
+              static_cast<unsigned long long>(timed.allocated_page_count));
+  std::printf("\"timed_page_allocation_count\":%llu,",
+              static_cast<unsigned long long>(timed.page_allocation_count -
+                                              warm.page_allocation_count));
+  std::printf("\"high_water_entry_count\":%llu,",
+              static_cast<unsigned long long>(timed.high_water_entry_count));
+  std::printf("\"live_entry_count\":%llu,",
+              static_cast<unsigned long long>(timed.live_entry_count));
+  std::printf("\"timed_drained_value_count\":%llu,",
+              static_cast<unsigned long long>(
+                  after.drained_autorelease_value_count -
+                  before.drained_autorelease_value_count));
+  std::printf("\"autoreleasepool_depth\":%llu,",
+              static_cast<unsigned long long>(after.autoreleasepool_depth));
+  std::printf("\"autoreleasepool_max_depth\":%llu,",
+              static_cast<unsigned long long>(after.autoreleasepool_max_depth));
+  std::printf("\"queued_autorelease_value_count\":%llu,",
+              static_cast<unsigned long long>(
+                  after.queued_autorelease_value_count));
+  std::printf("\"lifo_last_drained_matches\":%d,",
+              lifo.last_drained_autorelease_value == live[1] ? 1 : 0);
+  std::printf("\"live_instance_count_after_timed\":%llu,",
+              static_cast<unsigned long long>(
+                  after.live_runtime_instance_count));
+  std::printf("\"live_instance_count_after_release\":%llu,",
+              static_cast<unsigned long long>(
+                  released.live_runtime_instance_count));
+  std::printf("\"allocations_ok\":%d", allocations_ok ? 1 : 0);
+  std::printf("}\n");
+
+  const std::uint64_t pages_for_high_water =
+      (expected_high_water + timed.entries_per_page - 1u) /
+      timed.entries_per_page;
+  const bool ok =
+      registration_status == OBJC3_RUNTIME_REGISTRATION_STATUS_OK &&
+      allocations_ok && timed.page_size_bytes == 4096u &&
+      timed.entries_per_page > 0u &&
+      timed.entries_per_page < static_cast<std::uint64_t>(
+                                   kAutoreleasesPerInnerPool) &&
+      timed.high_water_entry_count == expected_high_water &&
+      timed.allocated_page_count <= pages_for_high_water + 1u &&
+      timed.page_allocation_count == warm.page_allocation_count &&
+      timed.live_entry_count == 0u &&
+      after.drained_autorelease_value_count -
+              before.drained_autorelease_value_count ==
+          timed_autorelease_count &&
+      after.autoreleasepool_depth == 0u &&
+      after.autoreleasepool_max_depth == 2u &&
+      after.queued_autorelease_value_count == 0u &&
+      lifo.last_drained_autorelease_value == live[1] &&
+      after.live_runtime_instance_count == kWorkingSetSize &&
+      released.live_runtime_instance_count == 0u;
+  return ok ? 0 : 1;
+}
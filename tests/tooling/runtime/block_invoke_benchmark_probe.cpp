@@ -0,0 +1,232 @@
+#include "runtime/objc3_runtime.h"
+#include "runtime/objc3_runtime_bootstrap_internal.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr int kTimedInvokeCount = 1000000;
+constexpr int kChurnCount = 100000;
+constexpr int kThreadCount = 4;
+constexpr int kInvokesPerThread = 250000;
+
+std::atomic<std::uint64_t> g_heap_allocation_count{0};
+
+int g_copy_count = 0;
+int g_dispose_count = 0;
+int g_self_handle = 0;
+int g_dispose_count_seen_after_self_release = -1;
+
+// Mirrors the pointer-capture block layout: invoke, copy, dispose, then one
+// captured cell, which promotion moves onto a runtime-owned heap cell.
+struct ProbeBlockStorage {
+  int (*invoke)(void *, int, int, int, int) = nullptr;
+  void (*copy)(void *) = nullptr;
+  void (*dispose)(void *) = nullptr;
+  int *capture_cell = nullptr;
+};
+
+// A non-pointer-capture block: the invoke thunk followed by by-value captures.
+struct ValueBlockStorage {
+  int (*invoke)(void *, int, int, int, int) = nullptr;
+  int addend = 0;
+};
+
+extern "C" int ValueInvoke(void *storage, int a0, int a1, int a2, int a3) {
+  return static_cast<ValueBlockStorage *>(storage)->addend + a0 + a1 + a2 + a3;
+}
+
+extern "C" int CaptureInvoke(void *storage, int a0, int, int, int) {
+  return *static_cast<ProbeBlockStorage *>(storage)->capture_cell + a0;
+}
+
+extern "C" void ProbeCopy(void *) { ++g_copy_count; }
+
+extern "C" void ProbeDispose(void *) { ++g_dispose_count; }
+
+// Drops the caller's last reference from inside the call; the pin held by
+// invoke must keep the storage alive until the thunk returns.
+extern "C" int SelfReleasingInvoke(void *storage, int a0, int, int, int) {
+  (void)objc3_runtime_release_i32(g_self_handle);
+  g_dispose_count_seen_after_self_release = g_dispose_count;
+  return *static_cast<ProbeBlockStorage *>(storage)->capture_cell + a0;
+}
+
+objc3_runtime_block_slab_state_snapshot CopyBlockSlabState() {
+  objc3_runtime_block_slab_state_snapshot snapshot{};
+  (void)objc3_runtime_copy_block_slab_state_for_testing(&snapshot);
+  return snapshot;
+}
+
+double InvokesPerSecond(std::uint64_t count,
+                        std::chrono::steady_clock::time_point started) {
+  const double elapsed_ms = std::chrono::duration<double, std::milli>(
+                                std::chrono::steady_clock::now() - started)
+                                .count();
+  return elapsed_ms > 0.0 ? static_cast<double>(count) * 1000.0 / elapsed_ms
+                          : 0.0;
+}
+
+}  // namespace
+
+// Counts every heap allocation in the process so the timed invoke loop can
+// prove it allocates nothing.
+void *operator new(std::size_t size) {
+  g_heap_allocation_count.fetch_add(1u, std::memory_order_relaxed);
+  if (void *memory = std::malloc(size == 0u ? 1u : size)) {
+    return memory;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void *memory) noexcept { std::free(memory); }
+
+void operator delete(void *memory, std::size_t) noexcept { std::free(memory); }
+
+int main() {
+  objc3_runtime_reset_for_testing();
+
+  ValueBlockStorage value_block{&ValueInvoke, 5};
+  const int value_handle =
+      objc3_runtime_promote_block_i32(&value_block, sizeof(value_block), 0);
+  value_block.addend = 1000;  // promotion copied the storage
+
+  // Warm the thread-local counters before counting allocations.
+  (void)objc3_runtime_invoke_block_i32(value_handle, 0, 0, 0, 0);
+  const std::uint64_t allocations_before =
+      g_heap_allocation_count.load(std::memory_order_relaxed);
+  std::int64_t checksum = 0;
+  auto started = std::chrono::steady_clock::now();
+  for (int index = 0; index < kTimedInvokeCount; ++index) {
+    checksum += objc3_runtime_invoke_block_i32(value_handle, index & 7, 1, 0, 0);
+  }
+  const double single_thread_invokes_per_second =
+      InvokesPerSecond(kTimedInvokeCount, started);
+  const std::uint64_t invoke_allocations =
+      g_heap_allocation_count.load(std::memory_order_relaxed) -
+      allocations_before;
+  std::int64_t expected_checksum = 0;
+  for (int index = 0; index < kTimedInvokeCount; ++index) {
+    expected_checksum += 5 + (index & 7) + 1;
+  }
+
+  // Concurrent invokes of one shared block.
+  std::vector<std::int64_t> thread_checksums(kThreadCount, 0);
+  std::vector<std::thread> threads;
+  started = std::chrono::steady_clock::now();
+  for (int thread_index = 0; thread_index < kThreadCount; ++thread_index) {
+    threads.emplace_back([&thread_checksums, thread_index, value_handle]() {
+      std::int64_t sum = 0;
+      for (int index = 0; index < kInvokesPerThread; ++index) {
+        sum += objc3_runtime_invoke_block_i32(value_handle, 1, 0, 0, 0);
+      }
+      thread_checksums[static_cast<std::size_t>(thread_index)] = sum;
+    });
+  }
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+  const double multi_thread_invokes_per_second =
+      InvokesPerSecond(static_cast<std::uint64_t>(kThreadCount) *
+                           kInvokesPerThread,
+                       started);
+  bool threads_matched = true;
+  for (std::int64_t sum : thread_checksums) {
+    threads_matched = threads_matched && sum == 6LL * kInvokesPerThread;
+  }
+  (void)objc3_runtime_release_i32(value_handle);
+  const int dead_handle_result =
+      objc3_runtime_invoke_block_i32(value_handle, 1, 0, 0, 0);
+
+  // Promote/invoke/release churn recycles one slot, moving to a fresh slot
+  // only when the generation range runs out; stale handles stay dead.
+  int churn_cell = 3;
+  ProbeBlockStorage churn_block{&CaptureInvoke, &ProbeCopy, &ProbeDispose,
+                                &churn_cell};
+  const objc3_runtime_block_slab_state_snapshot before_churn =
+      CopyBlockSlabState();
+  int previous_handle = 0;
+  bool churn_ok = true;
+  for (int index = 0; index < kChurnCount; ++index) {
+    const int handle =
+        objc3_runtime_promote_block_i32(&churn_block, sizeof(churn_block), 1);
+    churn_ok = churn_ok && handle > 0 && handle != previous_handle &&
+               objc3_runtime_invoke_block_i32(handle, 2, 0, 0, 0) == 5 &&
+               (previous_handle == 0 ||
+                objc3_runtime_invoke_block_i32(previous_handle, 2, 0, 0, 0) ==
+                    0);
+    (void)objc3_runtime_release_i32(handle);
+    previous_handle = handle;
+  }
+  const objc3_runtime_block_slab_state_snapshot after_churn =
+      CopyBlockSlabState();
+  const int churn_copy_count = g_copy_count;
+  const int churn_dispose_count = g_dispose_count;
+
+  // A block that releases its own last reference while running.
+  int self_cell = 40;
+  ProbeBlockStorage self_block{&SelfReleasingInvoke, &ProbeCopy, &ProbeDispose,
+                               &self_cell};
+  g_dispose_count = 0;
+  g_self_handle =
+      objc3_runtime_promote_block_i32(&self_block, sizeof(self_block), 1);
+  const int self_release_result =
+      objc3_runtime_invoke_block_i32(g_self_handle, 2, 0, 0, 0);
+  const objc3_runtime_block_slab_state_snapshot after_self_release =
+      CopyBlockSlabState();
+
+  std::printf("{");
+  std::printf("\"timed_invoke_count\":%d,", kTimedInvokeCount);
+  std::printf("\"single_thread_invokes_per_second\":%.0f,",
+              single_thread_invokes_per_second);
+  std::printf("\"multi_thread_invokes_per_second\":%.0f,",
+              multi_thread_invokes_per_second);
+  std::printf("\"thread_count\":%d,", kThreadCount);
+  std::printf("\"invoke_heap_allocations\":%llu,",
+              static_cast<unsigned long long>(invoke_allocations));
+  std::printf("\"checksum_matched\":%d,",
+              checksum == expected_checksum ? 1 : 0);
+  std::printf("\"threads_matched\":%d,", threads_matched ? 1 : 0);
+  std::printf("\"dead_handle_result\":%d,", dead_handle_result);
+  std::printf("\"churn_count\":%d,", kChurnCount);
+  std::printf("\"churn_ok\":%d,", churn_ok ? 1 : 0);
+  std::printf("\"churn_slot_capacity_growth\":%llu,",
+              static_cast<unsigned long long>(after_churn.slot_capacity -
+                                              before_churn.slot_capacity));
+  std::printf("\"churn_reused_slot_count\":%llu,",
+              static_cast<unsigned long long>(after_churn.reused_slot_count -
+                                              before_churn.reused_slot_count));
+  std::printf("\"churn_wrapped_slot_count\":%llu,",
+              static_cast<unsigned long long>(after_churn.wrapped_slot_count -
+                                              before_churn.wrapped_slot_count));
+  std::printf("\"churn_copy_count\":%d,", churn_copy_count);
+  std::printf("\"churn_dispose_count\":%d,", churn_dispose_count);
+  std::printf("\"self_release_result\":%d,", self_release_result);
+  std::printf("\"dispose_count_seen_inside_self_release\":%d,",
+              g_dispose_count_seen_after_self_release);
+  std::printf("\"self_release_dispose_count\":%d,", g_dispose_count);
+  std::printf("\"live_block_count\":%llu",
+              static_cast<unsigned long long>(
+                  after_self_release.live_block_count));
+  std::printf("}\n");
+
+  const bool ok =
+      value_handle > 0 && invoke_allocations == 0u &&
+      checksum == expected_checksum && threads_matched &&
+      dead_handle_result == 0 && churn_ok &&
+      after_churn.slot_capacity - before_churn.slot_capacity <=
+          kChurnCount / 2000u + 1u &&
+      after_churn.wrapped_slot_count > before_churn.wrapped_slot_count &&
+      churn_copy_count == kChurnCount && churn_dispose_count == kChurnCount &&
+      self_release_result == 42 &&
+      g_dispose_count_seen_after_self_release == 0 && g_dispose_count == 1 &&
+      after_self_release.live_block_count == 0u;
+  return ok ? 0 : 1;
+}
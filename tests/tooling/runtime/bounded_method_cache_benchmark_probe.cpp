@@ -0,0 +1,214 @@
+#include "runtime/objc3_runtime.h"
+#include "runtime/objc3_runtime_bootstrap_internal.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+extern "C" int pingWorker(void);
+
+namespace {
+
+// Links against the bounded-method-cache fixture: Worker's class methods are
+// plain dynamic sends, so every first send fills the cache from the slow path.
+constexpr int kReceiverIdentityBase = 1024;
+constexpr int kReceiverIdentityStride = 17;
+constexpr std::uint64_t kDefaultResolvedCapacity = 8192;
+constexpr std::uint64_t kDefaultNegativeCapacity = 1024;
+constexpr int kFloodSendCount = 200000;
+constexpr int kFloodSelectorCount = 64;
+constexpr int kFloodOrdinalBase = 64;
+constexpr int kFloodOrdinalSpan = 100000;
+
+using Clock = std::chrono::steady_clock;
+
+double ElapsedMs(Clock::time_point started) {
+  return std::chrono::duration<double, std::milli>(Clock::now() - started)
+      .count();
+}
+
+objc3_runtime_method_cache_state_snapshot CopyMethodCacheState() {
+  objc3_runtime_method_cache_state_snapshot snapshot{};
+  (void)objc3_runtime_copy_method_cache_state_for_testing(&snapshot);
+  return snapshot;
+}
+
+bool IsCached(int receiver, const char *selector) {
+  objc3_runtime_method_cache_entry_snapshot entry{};
+  (void)objc3_runtime_copy_method_cache_entry_for_testing(receiver, selector,
+                                                          &entry);
+  return entry.found != 0 && entry.resolved != 0;
+}
+
+int ClassReceiver(const char *class_name) {
+  objc3_runtime_realized_class_entry_snapshot entry{};
+  (void)objc3_runtime_copy_realized_class_entry_for_testing(class_name, &entry);
+  return entry.found != 0 ? static_cast<int>(entry.base_identity + 2u) : 0;
+}
+
+// A fresh thread starts with an empty thread-local hit cache, so its sends
+// reach the shared cache and mark what they hit.
+int SendOnFreshThread(int receiver, const char *selector) {
+  int result = 0;
+  std::thread sender([&] {
+    result = objc3_runtime_dispatch_i32(receiver, selector, 0, 0, 0, 0);
+  });
+  sender.join();
+  return result;
+}
+
+}  // namespace
+
+int main() {
+  const int worker = ClassReceiver("Worker");
+  const int fixture_result = pingWorker();
+
+  // CLOCK eviction: with room for two resolved fills, the third evicts the
+  // one no send has touched since it was filled.
+  const int shrink_status =
+      objc3_runtime_set_method_cache_capacity_for_testing(2, 4);
+  (void)objc3_runtime_dispatch_i32(worker, "ping", 0, 0, 0, 0);
+  (void)objc3_runtime_dispatch_i32(worker, "pong", 0, 0, 0, 0);
+  const int referenced_result = SendOnFreshThread(worker, "ping");
+  const int third_result =
+      objc3_runtime_dispatch_i32(worker, "hot", 0, 0, 0, 0);
+  const objc3_runtime_method_cache_state_snapshot clock_state =
+      CopyMethodCacheState();
+  const bool referenced_kept = IsCached(worker, "ping");
+  const bool cold_evicted = !IsCached(worker, "pong");
+  const bool third_cached = IsCached(worker, "hot");
+
+  // Plugin-server shape: a warm resolved working set, then a flood of
+  // fallback sends over receivers and selectors no image implements.
+  const int restore_status = objc3_runtime_set_method_cache_capacity_for_testing(
+      kDefaultResolvedCapacity, kDefaultNegativeCapacity);
+  const char *const warm_selectors[] = {"ping", "pong", "hot"};
+  int warm_total = 0;
+  for (const char *selector : warm_selectors) {
+    warm_total += objc3_runtime_dispatch_i32(worker, selector, 0, 0, 0, 0);
+  }
+  const objc3_runtime_method_cache_state_snapshot before_flood =
+      CopyMethodCacheState();
+
+  std::vector<std::string> flood_selectors;
+  flood_selectors.reserve(kFloodSelectorCount);
+  for (int index = 0; index < kFloodSelectorCount; ++index) {
+    flood_selectors.push_back("floodProbe" + std::to_string(index) + ":");
+  }
+  std::vector<int> flood_receivers(kFloodSendCount, 0);
+  std::vector<int> flood_selector_indices(kFloodSendCount, 0);
+  std::unordered_set<std::uint64_t> flood_keys;
+  std::uint32_t seed = 0x2545f491u;
+  for (int index = 0; index < kFloodSendCount; ++index) {
+    seed = seed * 1664525u + 1013904223u;
+    const int ordinal =
+        kFloodOrdinalBase + static_cast<int>((seed >> 8) % kFloodOrdinalSpan);
+    seed = seed * 1664525u + 1013904223u;
+    const int selector_index =
+        static_cast<int>((seed >> 8) % kFloodSelectorCount);
+    flood_receivers[index] =
+        kReceiverIdentityBase + ordinal * kReceiverIdentityStride + 2;
+    flood_selector_indices[index] = selector_index;
+    flood_keys.insert(static_cast<std::uint64_t>(ordinal) *
+                          kFloodSelectorCount +
+                      static_cast<std::uint64_t>(selector_index));
+  }
+
+  const Clock::time_point flood_started = Clock::now();
+  for (int index = 0; index < kFloodSendCount; ++index) {
+    (void)objc3_runtime_dispatch_i32(
+        flood_receivers[index],
+        flood_selectors[flood_selector_indices[index]].c_str(), index, 0, 0, 0);
+  }
+  const double flood_ms = ElapsedMs(flood_started);
+  const objc3_runtime_method_cache_state_snapshot after_flood =
+      CopyMethodCacheState();
+
+  int warm_after_total = 0;
+  for (const char *selector : warm_selectors) {
+    warm_after_total += SendOnFreshThread(worker, selector);
+  }
+  const objc3_runtime_method_cache_state_snapshot after_warm =
+      CopyMethodCacheState();
+  const std::uint64_t warm_miss_count =
+      after_warm.cache_miss_count - after_flood.cache_miss_count;
+  const bool warm_entries_cached = IsCached(worker, "ping") &&
+                                   IsCached(worker, "pong") &&
+                                   IsCached(worker, "hot");
+  const std::uint64_t resolved_eviction_count =
+      after_flood.eviction_count - before_flood.eviction_count;
+  const std::uint64_t entry_bound = before_flood.cache_entry_count +
+                                    kDefaultNegativeCapacity;
+
+  std::printf("{");
+  std::printf("\"fixture_result\":%d,", fixture_result);
+  std::printf("\"shrink_status\":%d,", shrink_status);
+  std::printf("\"referenced_result\":%d,", referenced_result);
+  std::printf("\"third_result\":%d,", third_result);
+  std::printf("\"clock_eviction_count\":%llu,",
+              static_cast<unsigned long long>(clock_state.eviction_count));
+  std::printf("\"clock_resolved_entry_count\":%llu,",
+              static_cast<unsigned long long>(clock_state.resolved_entry_count));
+  std::printf("\"referenced_kept\":%d,", referenced_kept ? 1 : 0);
+  std::printf("\"cold_evicted\":%d,", cold_evicted ? 1 : 0);
+  std::printf("\"third_cached\":%d,", third_cached ? 1 : 0);
+  std::printf("\"restore_status\":%d,", restore_status);
+  std::printf("\"resolved_entry_capacity\":%llu,",
+              static_cast<unsigned long long>(
+                  after_flood.resolved_entry_capacity));
+  std::printf("\"negative_entry_capacity\":%llu,",
+              static_cast<unsigned long long>(
+                  after_flood.negative_entry_capacity));
+  std::printf("\"warm_total\":%d,", warm_total);
+  std::printf("\"flood_send_count\":%d,", kFloodSendCount);
+  std::printf("\"flood_distinct_key_count\":%llu,",
+              static_cast<unsigned long long>(flood_keys.size()));
+  std::printf("\"flood_ms\":%.3f,", flood_ms);
+  std::printf("\"flood_sends_per_second\":%.0f,",
+              flood_ms > 0.0 ? kFloodSendCount * 1000.0 / flood_ms : 0.0);
+  std::printf("\"entries_before_flood\":%llu,",
+              static_cast<unsigned long long>(before_flood.cache_entry_count));
+  std::printf("\"entries_after_flood\":%llu,",
+              static_cast<unsigned long long>(after_flood.cache_entry_count));
+  std::printf("\"entry_bound\":%llu,",
+              static_cast<unsigned long long>(entry_bound));
+  std::printf("\"resolved_entries_after_flood\":%llu,",
+              static_cast<unsigned long long>(after_flood.resolved_entry_count));
+  std::printf("\"negative_entries_after_flood\":%llu,",
+              static_cast<unsigned long long>(after_flood.negative_entry_count));
+  std::printf("\"negative_eviction_count\":%llu,",
+              static_cast<unsigned long long>(
+                  after_flood.negative_eviction_count));
+  std::printf("\"resolved_eviction_count\":%llu,",
+              static_cast<unsigned long long>(resolved_eviction_count));
+  std::printf("\"warm_after_total\":%d,", warm_after_total);
+  std::printf("\"warm_miss_count\":%llu,",
+              static_cast<unsigned long long>(warm_miss_count));
+  std::printf("\"warm_entries_cached\":%d", warm_entries_cached ? 1 : 0);
+  std::printf("}\n");
+
+  const bool ok =
+      worker != 0 && fixture_result == 11 &&
+      shrink_status == OBJC3_RUNTIME_REGISTRATION_STATUS_OK &&
+      referenced_result == 11 && third_result == 17 &&
+      clock_state.eviction_count == 1u &&
+      clock_state.resolved_entry_count == 2u && referenced_kept &&
+      cold_evicted && third_cached &&
+      restore_status == OBJC3_RUNTIME_REGISTRATION_STATUS_OK &&
+      after_flood.resolved_entry_capacity == kDefaultResolvedCapacity &&
+      after_flood.negative_entry_capacity == kDefaultNegativeCapacity &&
+      warm_total == 41 &&
+      flood_keys.size() > static_cast<std::size_t>(kDefaultNegativeCapacity) &&
+      after_flood.cache_entry_count <= entry_bound &&
+      before_flood.resolved_entry_count == 3u &&
+      after_flood.resolved_entry_count == before_flood.resolved_entry_count &&
+      after_flood.negative_entry_count == kDefaultNegativeCapacity &&
+      after_flood.negative_eviction_count > 0u &&
+      resolved_eviction_count == 0u && warm_after_total == 41 &&
+      warm_miss_count == 0u && warm_entries_cached;
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,179 @@
+#include "runtime/objc3_runtime.h"
+#include "runtime/objc3_runtime_bootstrap_internal.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+namespace {
+
+// Links against the weak/autoreleasepool fixture, whose Box class is the
+// image's first class and carries a strong `currentValue` property.
+constexpr int kBoxClassReceiver = 1024;
+constexpr int kReplayCycleCount = 2000;
+constexpr int kQueryCount = 200000;
+
+using Clock = std::chrono::steady_clock;
+
+double ElapsedMs(Clock::time_point started) {
+  return std::chrono::duration<double, std::milli>(Clock::now() - started)
+      .count();
+}
+
+double PerSecond(std::uint64_t count, double elapsed_ms) {
+  return elapsed_ms > 0.0 ? static_cast<double>(count) * 1000.0 / elapsed_ms
+                          : 0.0;
+}
+
+bool Equals(const char *text, const char *expected) {
+  return text != nullptr && std::strcmp(text, expected) == 0;
+}
+
+objc3_runtime_realized_class_graph_state_snapshot CopyGraphState() {
+  objc3_runtime_realized_class_graph_state_snapshot snapshot{};
+  (void)objc3_runtime_copy_realized_class_graph_state_for_testing(&snapshot);
+  return snapshot;
+}
+
+objc3_runtime_property_registry_state_snapshot CopyPropertyRegistryState() {
+  objc3_runtime_property_registry_state_snapshot snapshot{};
+  (void)objc3_runtime_copy_property_registry_state_for_testing(&snapshot);
+  return snapshot;
+}
+
+}  // namespace
+
+int main() {
+  // Replay cycles: each one re-realizes the image, interning its class and
+  // property names afresh, then takes the slow path for alloc and a getter.
+  int replay_failures = 0;
+  const Clock::time_point replay_started = Clock::now();
+  for (int cycle = 0; cycle < kReplayCycleCount; ++cycle) {
+    objc3_runtime_reset_for_testing();
+    replay_failures +=
+        objc3_runtime_replay_registered_images_for_testing() ==
+                OBJC3_RUNTIME_REGISTRATION_STATUS_OK
+            ? 0
+            : 1;
+    const int box =
+        objc3_runtime_dispatch_i32(kBoxClassReceiver, "alloc", 0, 0, 0, 0);
+    replay_failures += box != 0 ? 0 : 1;
+    replay_failures +=
+        objc3_runtime_dispatch_i32(box, "currentValue", 0, 0, 0, 0) == 0 ? 0
+                                                                         : 1;
+    (void)objc3_runtime_release_i32(box);
+  }
+  const double replay_ms = ElapsedMs(replay_started);
+  const objc3_runtime_realized_class_graph_state_snapshot graph =
+      CopyGraphState();
+
+  // Name-keyed reflection: every query hashes its names into the symbol
+  // table once and then follows ids.
+  objc3_runtime_realized_class_entry_snapshot class_entry{};
+  objc3_runtime_property_entry_snapshot property_entry{};
+  objc3_runtime_protocol_conformance_query_snapshot conformance{};
+  int query_failures = 0;
+  const Clock::time_point query_started = Clock::now();
+  for (int index = 0; index < kQueryCount; ++index) {
+    (void)objc3_runtime_copy_realized_class_entry_for_testing("Box",
+                                                              &class_entry);
+    (void)objc3_runtime_copy_property_entry_for_testing("Box", "currentValue",
+                                                        &property_entry);
+    (void)objc3_runtime_copy_protocol_conformance_query_for_testing(
+        "Box", "NSCopying", &conformance);
+    query_failures += class_entry.found != 0 && property_entry.found != 0 &&
+                              conformance.class_found != 0
+                          ? 0
+                          : 1;
+  }
+  const double query_ms = ElapsedMs(query_started);
+  // Snapshot names point at runtime-owned strings the next query rewrites.
+  const bool class_entry_is_box = Equals(class_entry.class_name, "Box");
+  const bool property_resolved_to_box =
+      Equals(property_entry.resolved_class_name, "Box");
+
+  // A name nobody declares misses once and then hits the negative entry; an
+  // unknown class never reaches the property cache at all.
+  const objc3_runtime_property_registry_state_snapshot before_negative =
+      CopyPropertyRegistryState();
+  objc3_runtime_property_entry_snapshot missing_property{};
+  (void)objc3_runtime_copy_property_entry_for_testing("Box", "missingValue",
+                                                      &missing_property);
+  (void)objc3_runtime_copy_property_entry_for_testing("Box", "missingValue",
+                                                      &missing_property);
+  const objc3_runtime_property_registry_state_snapshot after_negative =
+      CopyPropertyRegistryState();
+  objc3_runtime_realized_class_entry_snapshot missing_class{};
+  (void)objc3_runtime_copy_realized_class_entry_for_testing("NoSuchClass",
+                                                            &missing_class);
+  objc3_runtime_property_entry_snapshot missing_class_property{};
+  (void)objc3_runtime_copy_property_entry_for_testing(
+      "NoSuchClass", "currentValue", &missing_class_property);
+  const std::uint64_t negative_hit_count =
+      after_negative.property_lookup_cache_hit_count -
+      before_negative.property_lookup_cache_hit_count;
+  const std::uint64_t negative_miss_count =
+      after_negative.property_lookup_cache_miss_count -
+      before_negative.property_lookup_cache_miss_count;
+
+  // Resolved cache entries carry a class id; snapshots still read the name.
+  objc3_runtime_method_cache_entry_snapshot cache_entry{};
+  const int box = objc3_runtime_dispatch_i32(kBoxClassReceiver, "alloc", 0, 0,
+                                             0, 0);
+  (void)objc3_runtime_dispatch_i32(box, "currentValue", 0, 0, 0, 0);
+  (void)objc3_runtime_copy_method_cache_entry_for_testing(box, "currentValue",
+                                                          &cache_entry);
+  const bool cache_entry_is_box = Equals(cache_entry.resolved_class_name, "Box");
+  (void)objc3_runtime_release_i32(box);
+
+  objc3_runtime_reset_for_testing();
+  const std::uint64_t reset_symbol_count =
+      CopyGraphState().interned_symbol_count;
+  (void)objc3_runtime_replay_registered_images_for_testing();
+  const std::uint64_t replayed_symbol_count =
+      CopyGraphState().interned_symbol_count;
+
+  std::printf("{");
+  std::printf("\"replay_cycle_count\":%d,", kReplayCycleCount);
+  std::printf("\"replay_ms\":%.3f,", replay_ms);
+  std::printf("\"replay_cycles_per_second\":%.0f,",
+              PerSecond(static_cast<std::uint64_t>(kReplayCycleCount),
+                        replay_ms));
+  std::printf("\"replay_failure_count\":%d,", replay_failures);
+  std::printf("\"query_count\":%d,", kQueryCount);
+  std::printf("\"query_ms\":%.3f,", query_ms);
+  std::printf("\"query_rounds_per_second\":%.0f,",
+              PerSecond(static_cast<std::uint64_t>(kQueryCount), query_ms));
+  std::printf("\"query_failure_count\":%d,", query_failures);
+  std::printf("\"interned_symbol_count\":%llu,",
+              static_cast<unsigned long long>(graph.interned_symbol_count));
+  std::printf("\"class_entry_is_box\":%d,", class_entry_is_box ? 1 : 0);
+  std::printf("\"property_resolved_to_box\":%d,",
+              property_resolved_to_box ? 1 : 0);
+  std::printf("\"negative_hit_count\":%llu,",
+              static_cast<unsigned long long>(negative_hit_count));
+  std::printf("\"negative_miss_count\":%llu,",
+              static_cast<unsigned long long>(negative_miss_count));
+  std::printf("\"missing_class_found\":%d,", missing_class.found);
+  std::printf("\"missing_class_property_found\":%d,",
+              missing_class_property.found);
+  std::printf("\"cache_entry_is_box\":%d,", cache_entry_is_box ? 1 : 0);
+  std::printf("\"reset_symbol_count\":%llu,",
+              static_cast<unsigned long long>(reset_symbol_count));
+  std::printf("\"replayed_symbol_count\":%llu",
+              static_cast<unsigned long long>(replayed_symbol_count));
+  std::printf("}\n");
+
+  const bool ok =
+      replay_failures == 0 && query_failures == 0 &&
+      graph.interned_symbol_count > 0u &&
+      class_entry_is_box && property_resolved_to_box &&
+      missing_property.found == 0 && negative_hit_count == 1u &&
+      negative_miss_count == 1u && missing_class.found == 0 &&
+      missing_class_property.found == 0 &&
+      cache_entry_is_box &&
+      reset_symbol_count == 0u &&
+      replayed_symbol_count == graph.interned_symbol_count;
+  return ok ? 0 : 1;
+}
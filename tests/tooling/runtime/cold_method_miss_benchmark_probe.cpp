@@ -0,0 +1,357 @@
+#include "runtime/objc3_runtime.h"
+#include "runtime/objc3_runtime_bootstrap_internal.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr int kReceiverIdentityBase = 1024;
+constexpr int kReceiverIdentityStride = 17;
+constexpr int kMethodsPerClass = 200;
+constexpr int kDepths[] = {1, 8, 32, 64};
+constexpr int kMaxDepth = 64;
+constexpr int kWarmRounds = 20;
+
+int RootValue() { return 7; }
+
+int LevelValue() { return 3; }
+
+// Mirror the emitted method-list, class-bundle, and registration-table
+// layouts that lowering publishes for one image.
+struct SyntheticMethodListEntry {
+  const char *selector;
+  const char *owner_identity;
+  const char *return_type_name;
+  std::uint64_t parameter_count;
+  const void *implementation;
+  std::uint64_t has_body;
+  bool effective_direct_dispatch;
+  bool objc_final_declared;
+};
+
+struct SyntheticMethodList {
+  std::uint64_t count;
+  const char *declaration_owner_identity;
+  const char *export_owner_identity;
+  SyntheticMethodListEntry entries[kMethodsPerClass];
+};
+
+struct SyntheticMethodListRef {
+  std::uint64_t count;
+  const char *owner_identity;
+  const void *method_list;
+};
+
+struct SyntheticClassRecord {
+  const char *class_name;
+  const char *bundle_owner_identity;
+  const char *object_owner_identity;
+  const char *super_owner_identity;
+  const void *super_bundle;
+  const SyntheticMethodListRef *method_list_ref;
+  const objc3_runtime_pointer_aggregate *adopted_protocol_refs;
+  bool objc_final_declared;
+  bool objc_sealed_declared;
+};
+
+struct SyntheticClassBundle {
+  SyntheticClassRecord class_record;
+  SyntheticClassRecord metaclass_record;
+};
+
+template <std::size_t EntryCount>
+struct PointerAggregateStorage {
+  std::uint64_t count;
+  const void *entries[EntryCount];
+};
+
+const objc3_runtime_pointer_aggregate *AsAggregate(const void *storage) {
+  return static_cast<const objc3_runtime_pointer_aggregate *>(storage);
+}
+
+// One image holding a single-inheritance chain: class 0 is the root and every
+// class overrides nothing, so a root selector sent to the deepest class misses
+// every level above it. Each level owns kMethodsPerClass distinct selectors.
+struct SyntheticHierarchy {
+  int depth = 0;
+  std::string module_name;
+  std::string identity_key;
+  std::vector<std::string> class_names;
+  std::vector<std::string> implementation_identities;
+  std::vector<std::string> class_identities;
+  std::vector<std::string> metaclass_identities;
+  std::vector<std::string> selectors;
+  std::vector<SyntheticMethodList> method_lists;
+  std::vector<SyntheticMethodListRef> method_list_refs;
+  std::vector<SyntheticClassBundle> bundles;
+  PointerAggregateStorage<kMaxDepth> class_root{};
+  PointerAggregateStorage<1> empty_root{};
+  std::vector<const void *> selector_pool_storage;
+  PointerAggregateStorage<6> discovery_root{};
+  const void *linker_anchor = nullptr;
+  unsigned char image_local_init_state = 0;
+  objc3_runtime_image_descriptor descriptor{};
+  objc3_runtime_registration_table table{};
+};
+
+std::string LevelSelector(int level, int index) {
+  return "level" + std::to_string(level) + "Method" + std::to_string(index);
+}
+
+void BuildSyntheticHierarchy(SyntheticHierarchy &hierarchy, int depth) {
+  hierarchy.depth = depth;
+  hierarchy.module_name = "cold-miss-" + std::to_string(depth);
+  hierarchy.identity_key = "cold-miss::depth-" + std::to_string(depth);
+  const std::size_t class_count = static_cast<std::size_t>(depth);
+  hierarchy.class_names.reserve(class_count);
+  hierarchy.implementation_identities.reserve(class_count);
+  hierarchy.class_identities.reserve(class_count);
+  hierarchy.metaclass_identities.reserve(class_count);
+  hierarchy.selectors.reserve(class_count * kMethodsPerClass);
+  hierarchy.method_lists.resize(class_count);
+  hierarchy.method_list_refs.resize(class_count);
+  hierarchy.bundles.resize(class_count);
+  for (int level = 0; level < depth; ++level) {
+    char class_name[32];
+    std::snprintf(class_name, sizeof(class_name), "Deep%03d", level);
+    hierarchy.class_names.emplace_back(class_name);
+    hierarchy.implementation_identities.push_back(
+        "implementation:" + hierarchy.class_names.back());
+    hierarchy.class_identities.push_back("class:" + hierarchy.class_names.back());
+    hierarchy.metaclass_identities.push_back("metaclass:" +
+                                             hierarchy.class_names.back());
+    for (int index = 0; index < kMethodsPerClass; ++index) {
+      hierarchy.selectors.push_back(LevelSelector(level, index));
+    }
+  }
+  for (int level = 0; level < depth; ++level) {
+    const std::size_t slot = static_cast<std::size_t>(level);
+    const char *implementation_identity =
+        hierarchy.implementation_identities[slot].c_str();
+    SyntheticMethodList &method_list = hierarchy.method_lists[slot];
+    method_list.count = kMethodsPerClass;
+    method_list.declaration_owner_identity = implementation_identity;
+    method_list.export_owner_identity = implementation_identity;
+    for (int index = 0; index < kMethodsPerClass; ++index) {
+      method_list.entries[index] = SyntheticMethodListEntry{
+          hierarchy.selectors[slot * kMethodsPerClass + index].c_str(),
+          implementation_identity,
+          "i32",
+          0,
+          level == 0 ? reinterpret_cast<const void *>(&RootValue)
+                     : reinterpret_cast<const void *>(&LevelValue),
+          1,
+          false,
+          false};
+    }
+    hierarchy.method_list_refs[slot] = SyntheticMethodListRef{
+        kMethodsPerClass, implementation_identity, &method_list};
+    const SyntheticClassBundle *super_bundle =
+        level > 0 ? &hierarchy.bundles[slot - 1] : nullptr;
+    const char *super_identity =
+        level > 0 ? hierarchy.class_identities[slot - 1].c_str() : nullptr;
+    hierarchy.bundles[slot].class_record = SyntheticClassRecord{
+        hierarchy.class_names[slot].c_str(),
+        implementation_identity,
+        hierarchy.class_identities[slot].c_str(),
+        super_identity,
+        super_bundle,
+        &hierarchy.method_list_refs[slot],
+        nullptr,
+        false,
+        false};
+    hierarchy.bundles[slot].metaclass_record = SyntheticClassRecord{
+        hierarchy.class_names[slot].c_str(),
+        implementation_identity,
+        hierarchy.metaclass_identities[slot].c_str(),
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        false,
+        false};
+    hierarchy.class_root.entries[slot] = &hierarchy.bundles[slot];
+  }
+  hierarchy.class_root.count = class_count;
+  hierarchy.empty_root = {0, {nullptr}};
+  // Pointer aggregates are a count followed by inline entries.
+  hierarchy.selector_pool_storage.push_back(
+      reinterpret_cast<const void *>(hierarchy.selectors.size()));
+  for (const std::string &selector : hierarchy.selectors) {
+    hierarchy.selector_pool_storage.push_back(selector.c_str());
+  }
+  const void *selector_pool_root = hierarchy.selector_pool_storage.data();
+  hierarchy.discovery_root = {
+      6,
+      {&hierarchy.class_root, &hierarchy.empty_root, &hierarchy.empty_root,
+       &hierarchy.empty_root, &hierarchy.empty_root, selector_pool_root}};
+  hierarchy.linker_anchor = &hierarchy.discovery_root;
+  hierarchy.descriptor = objc3_runtime_image_descriptor{
+      hierarchy.module_name.c_str(),
+      hierarchy.identity_key.c_str(),
+      1,
+      class_count,
+      0,
+      0,
+      0,
+      0};
+  hierarchy.table = objc3_runtime_registration_table{
+      2,
+      12,
+      &hierarchy.descriptor,
+      AsAggregate(&hierarchy.discovery_root),
+      &hierarchy.linker_anchor,
+      AsAggregate(&hierarchy.class_root),
+      AsAggregate(&hierarchy.empty_root),
+      AsAggregate(&hierarchy.empty_root),
+      AsAggregate(&hierarchy.empty_root),
+      AsAggregate(&hierarchy.empty_root),
+      AsAggregate(selector_pool_root),
+      nullptr,
+      nullptr,
+      &hierarchy.image_local_init_state};
+}
+
+int InstanceReceiver(int ordinal) {
+  return kReceiverIdentityBase + ordinal * kReceiverIdentityStride + 1;
+}
+
+struct ColdMissSample {
+  int depth = 0;
+  int registration_status = 0;
+  double cold_miss_us = 0.0;
+  double warm_hit_us = 0.0;
+  bool results_ok = true;
+  objc3_runtime_method_table_state_snapshot tables{};
+  objc3_runtime_method_cache_state_snapshot cache{};
+};
+
+// Every root selector is sent once to the deepest class, so each send is a
+// first-time miss that walks the whole chain before resolving at the root.
+ColdMissSample RunSample(const SyntheticHierarchy &hierarchy) {
+  ColdMissSample sample;
+  sample.depth = hierarchy.depth;
+  objc3_runtime_reset_for_testing();
+  objc3_runtime_stage_registration_table_for_bootstrap(&hierarchy.table);
+  sample.registration_status = objc3_runtime_register_image(&hierarchy.descriptor);
+  const int receiver = InstanceReceiver(hierarchy.depth - 1);
+
+  auto started = std::chrono::steady_clock::now();
+  for (int index = 0; index < kMethodsPerClass; ++index) {
+    sample.results_ok =
+        objc3_runtime_dispatch_i32(
+            receiver, hierarchy.selectors[static_cast<std::size_t>(index)].c_str(),
+            0, 0, 0, 0) == 7 &&
+        sample.results_ok;
+  }
+  sample.cold_miss_us = std::chrono::duration<double, std::micro>(
+                            std::chrono::steady_clock::now() - started)
+                            .count() /
+                        kMethodsPerClass;
+
+  started = std::chrono::steady_clock::now();
+  for (int round = 0; round < kWarmRounds; ++round) {
+    for (int index = 0; index < kMethodsPerClass; ++index) {
+      sample.results_ok =
+          objc3_runtime_dispatch_i32(
+              receiver,
+              hierarchy.selectors[static_cast<std::size_t>(index)].c_str(), 0,
+              0, 0, 0) == 7 &&
+          sample.results_ok;
+    }
+  }
+  sample.warm_hit_us = std::chrono::duration<double, std::micro>(
+                           std::chrono::steady_clock::now() - started)
+                           .count() /
+                       (kWarmRounds * kMethodsPerClass);
+
+  // The deepest class's own selectors resolve at the first level.
+  const std::size_t own_selector =
+      static_cast<std::size_t>(hierarchy.depth - 1) * kMethodsPerClass;
+  const int own_expected = hierarchy.depth == 1 ? 7 : 3;
+  sample.results_ok =
+      objc3_runtime_dispatch_i32(receiver,
+                                 hierarchy.selectors[own_selector].c_str(), 0, 0,
+                                 0, 0) == own_expected &&
+      sample.results_ok;
+  (void)objc3_runtime_copy_method_table_state_for_testing(&sample.tables);
+  (void)objc3_runtime_copy_method_cache_state_for_testing(&sample.cache);
+  return sample;
+}
+
+}  // namespace
+
+int main() {
+  // Reset rewinds every staged image's init state, so all hierarchies must
+  // outlive the runtime's retained registration tables.
+  std::vector<std::unique_ptr<SyntheticHierarchy>> hierarchies;
+  std::vector<ColdMissSample> samples;
+  bool samples_ok = true;
+  for (int depth : kDepths) {
+    hierarchies.push_back(std::make_unique<SyntheticHierarchy>());
+    BuildSyntheticHierarchy(*hierarchies.back(), depth);
+    samples.push_back(RunSample(*hierarchies.back()));
+    const ColdMissSample &sample = samples.back();
+    // Class and metaclass lists are all indexed, and no miss falls back to a
+    // linear scan; a root-selector miss probes one table per level. With a
+    // single level the own-selector send was already a root-selector hit.
+    const std::uint64_t own_selector_miss_count = depth > 1 ? 1u : 0u;
+    samples_ok =
+        samples_ok &&
+        sample.registration_status == OBJC3_RUNTIME_REGISTRATION_STATUS_OK &&
+        sample.results_ok &&
+        sample.tables.indexed_method_list_count ==
+            static_cast<std::uint64_t>(depth) * 2u &&
+        sample.tables.indexed_method_entry_count ==
+            static_cast<std::uint64_t>(depth) * kMethodsPerClass &&
+        sample.tables.unindexed_method_list_count == 0 &&
+        sample.tables.method_list_scan_count == 0 &&
+        sample.tables.method_table_probe_count ==
+            static_cast<std::uint64_t>(depth) * kMethodsPerClass +
+                own_selector_miss_count &&
+        sample.cache.cache_miss_count ==
+            kMethodsPerClass + own_selector_miss_count;
+  }
+  objc3_runtime_reset_for_testing();
+  objc3_runtime_method_table_state_snapshot after_reset{};
+  (void)objc3_runtime_copy_method_table_state_for_testing(&after_reset);
+
+  std::printf("{\"samples\":[");
+  for (std::size_t index = 0; index < samples.size(); ++index) {
+    const ColdMissSample &sample = samples[index];
+    std::printf("%s{\"depth\":%d,\"cold_miss_us\":%.3f,\"warm_hit_us\":%.3f,"
+                "\"cold_to_warm_ratio\":%.3f,\"method_table_probe_count\":%llu,"
+                "\"method_table_slot_count\":%llu,\"cache_miss_count\":%llu}",
+                index == 0 ? "" : ",", sample.depth, sample.cold_miss_us,
+                sample.warm_hit_us,
+                sample.warm_hit_us > 0.0
+                    ? sample.cold_miss_us / sample.warm_hit_us
+                    : 0.0,
+                static_cast<unsigned long long>(
+                    sample.tables.method_table_probe_count),
+                static_cast<unsigned long long>(
+                    sample.tables.method_table_slot_count),
+                static_cast<unsigned long long>(sample.cache.cache_miss_count));
+  }
+  std::printf("]");
+  const ColdMissSample &shallowest = samples.front();
+  const ColdMissSample &deepest = samples.back();
+  std::printf(",\"methods_per_class\":%d", kMethodsPerClass);
+  std::printf(",\"deepest_to_shallowest_cold_miss_ratio\":%.3f",
+              shallowest.cold_miss_us > 0.0
+                  ? deepest.cold_miss_us / shallowest.cold_miss_us
+                  : 0.0);
+  std::printf(",\"samples_ok\":%d", samples_ok ? 1 : 0);
+  std::printf(",\"indexed_method_list_count_after_reset\":%llu",
+              static_cast<unsigned long long>(
+                  after_reset.indexed_method_list_count));
+  std::printf("}\n");
+
+  const bool ok = samples_ok && after_reset.indexed_method_list_count == 0;
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,197 @@
+#include "runtime/objc3_runtime.h"
+#include "runtime/objc3_runtime_bootstrap_internal.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+
+extern "C" int bumpCountLoop(int receiver, int rounds);
+extern "C" int toggleEnabled(int receiver);
+extern "C" int swapValue(int receiver, int next);
+extern "C" int swapGuarded(int receiver, int next);
+extern "C" int swapObserver(int receiver, int next);
+
+namespace {
+
+// Links against the direct-property-access fixture: Counter is objc_final,
+// PlainCounter declares the same `count` property without it.
+constexpr int kBumpRoundCount = 500000;
+constexpr int kStrongSwapCount = 100000;
+
+using Clock = std::chrono::steady_clock;
+
+double ElapsedMs(Clock::time_point started) {
+  return std::chrono::duration<double, std::milli>(Clock::now() - started)
+      .count();
+}
+
+double PerSecond(std::uint64_t count, double elapsed_ms) {
+  return elapsed_ms > 0.0 ? static_cast<double>(count) * 1000.0 / elapsed_ms
+                          : 0.0;
+}
+
+objc3_runtime_property_registry_state_snapshot CopyPropertyRegistryState() {
+  objc3_runtime_property_registry_state_snapshot snapshot{};
+  (void)objc3_runtime_copy_property_registry_state_for_testing(&snapshot);
+  return snapshot;
+}
+
+int DirectAccess(const char *class_name, const char *property_name) {
+  objc3_runtime_property_entry_snapshot entry{};
+  (void)objc3_runtime_copy_property_entry_for_testing(class_name, property_name,
+                                                      &entry);
+  return entry.found != 0 ? entry.direct_access : -1;
+}
+
+int Alloc(const char *class_name) {
+  objc3_runtime_realized_class_entry_snapshot entry{};
+  (void)objc3_runtime_copy_realized_class_entry_for_testing(class_name, &entry);
+  return entry.found != 0
+             ? objc3_runtime_dispatch_i32(
+                   static_cast<int>(entry.base_identity + 2u), "alloc", 0, 0,
+                   0, 0)
+             : 0;
+}
+
+std::uint64_t LiveInstanceCount() {
+  objc3_runtime_memory_management_state_snapshot snapshot{};
+  (void)objc3_runtime_copy_memory_management_state_for_testing(&snapshot);
+  return snapshot.live_runtime_instance_count;
+}
+
+}  // namespace
+
+int main() {
+  const objc3_runtime_property_registry_state_snapshot registry =
+      CopyPropertyRegistryState();
+  const int count_access = DirectAccess("Counter", "count");
+  const int enabled_access = DirectAccess("Counter", "enabled");
+  const int value_access = DirectAccess("Counter", "value");
+  const int guarded_access = DirectAccess("Counter", "guarded");
+  const int observer_access = DirectAccess("Counter", "observer");
+  const int plain_count_access = DirectAccess("PlainCounter", "count");
+
+  const int counter = Alloc("Counter");
+  const int plain = Alloc("PlainCounter");
+
+  // Scalar get/set pairs: the final class reads and writes its slot in
+  // place, the plain class takes the locked builtin accessors.
+  const objc3_runtime_property_registry_state_snapshot before_direct =
+      CopyPropertyRegistryState();
+  const Clock::time_point direct_started = Clock::now();
+  const int direct_result = bumpCountLoop(counter, kBumpRoundCount);
+  const double direct_ms = ElapsedMs(direct_started);
+  const objc3_runtime_property_registry_state_snapshot after_direct =
+      CopyPropertyRegistryState();
+  const Clock::time_point locked_started = Clock::now();
+  const int locked_result = bumpCountLoop(plain, kBumpRoundCount);
+  const double locked_ms = ElapsedMs(locked_started);
+  const objc3_runtime_property_registry_state_snapshot after_locked =
+      CopyPropertyRegistryState();
+  const std::uint64_t direct_get_count =
+      after_direct.direct_access_get_count - before_direct.direct_access_get_count;
+  const std::uint64_t direct_set_count =
+      after_direct.direct_access_set_count - before_direct.direct_access_set_count;
+  const std::uint64_t locked_direct_count =
+      (after_locked.direct_access_get_count -
+       after_direct.direct_access_get_count) +
+      (after_locked.direct_access_set_count -
+       after_direct.direct_access_set_count);
+
+  const int enabled_result = toggleEnabled(counter);
+
+  // Strong swaps: the nonatomic property retains and releases around its
+  // in-place exchange, the atomic one keeps the locked path; both leave the
+  // same ownership behind.
+  const int item = Alloc("PlainCounter");
+  objc3_runtime_push_autoreleasepool_scope();
+  int strong_failures = 0;
+  const Clock::time_point strong_started = Clock::now();
+  for (int index = 0; index < kStrongSwapCount; ++index) {
+    strong_failures += swapValue(counter, item) == item ? 0 : 1;
+  }
+  const double strong_ms = ElapsedMs(strong_started);
+  const int guarded_result = swapGuarded(counter, item);
+  const int observer_result = swapObserver(counter, item);
+  objc3_runtime_pop_autoreleasepool_scope();
+  const int cleared_value = swapValue(counter, 0);
+  const int cleared_guarded = swapGuarded(counter, 0);
+  (void)objc3_runtime_release_i32(item);
+  const int zeroed_observer = swapObserver(counter, 0);
+
+  (void)objc3_runtime_release_i32(counter);
+  (void)objc3_runtime_release_i32(plain);
+  const std::uint64_t live_instance_count = LiveInstanceCount();
+
+  // A released receiver never reaches its old slot.
+  const objc3_runtime_property_registry_state_snapshot before_stale =
+      CopyPropertyRegistryState();
+  (void)bumpCountLoop(counter, 1);
+  const objc3_runtime_property_registry_state_snapshot after_stale =
+      CopyPropertyRegistryState();
+  const std::uint64_t stale_direct_count =
+      (after_stale.direct_access_get_count -
+       before_stale.direct_access_get_count) +
+      (after_stale.direct_access_set_count -
+       before_stale.direct_access_set_count);
+
+  std::printf("{");
+  std::printf("\"direct_access_property_count\":%llu,",
+              static_cast<unsigned long long>(
+                  registry.direct_access_property_count));
+  std::printf("\"count_direct_access\":%d,", count_access);
+  std::printf("\"enabled_direct_access\":%d,", enabled_access);
+  std::printf("\"value_direct_access\":%d,", value_access);
+  std::printf("\"guarded_direct_access\":%d,", guarded_access);
+  std::printf("\"observer_direct_access\":%d,", observer_access);
+  std::printf("\"plain_count_direct_access\":%d,", plain_count_access);
+  std::printf("\"bump_round_count\":%d,", kBumpRoundCount);
+  std::printf("\"direct_ms\":%.3f,", direct_ms);
+  std::printf("\"direct_get_set_pairs_per_second\":%.0f,",
+              PerSecond(static_cast<std::uint64_t>(kBumpRoundCount), direct_ms));
+  std::printf("\"locked_ms\":%.3f,", locked_ms);
+  std::printf("\"locked_get_set_pairs_per_second\":%.0f,",
+              PerSecond(static_cast<std::uint64_t>(kBumpRoundCount), locked_ms));
+  std::printf("\"direct_speedup_ratio\":%.2f,",
+              direct_ms > 0.0 ? locked_ms / direct_ms : 0.0);
+  std::printf("\"direct_result\":%d,", direct_result);
+  std::printf("\"locked_result\":%d,", locked_result);
+  std::printf("\"direct_get_count\":%llu,",
+              static_cast<unsigned long long>(direct_get_count));
+  std::printf("\"direct_set_count\":%llu,",
+              static_cast<unsigned long long>(direct_set_count));
+  std::printf("\"locked_direct_count\":%llu,",
+              static_cast<unsigned long long>(locked_direct_count));
+  std::printf("\"enabled_result\":%d,", enabled_result);
+  std::printf("\"strong_swap_count\":%d,", kStrongSwapCount);
+  std::printf("\"strong_ms\":%.3f,", strong_ms);
+  std::printf("\"strong_swaps_per_second\":%.0f,",
+              PerSecond(static_cast<std::uint64_t>(kStrongSwapCount),
+                        strong_ms));
+  std::printf("\"strong_failure_count\":%d,", strong_failures);
+  std::printf("\"guarded_result_matches\":%d,", guarded_result == item ? 1 : 0);
+  std::printf("\"observer_result_matches\":%d,",
+              observer_result == item ? 1 : 0);
+  std::printf("\"cleared_value\":%d,", cleared_value);
+  std::printf("\"cleared_guarded\":%d,", cleared_guarded);
+  std::printf("\"zeroed_observer\":%d,", zeroed_observer);
+  std::printf("\"live_instance_count\":%llu,",
+              static_cast<unsigned long long>(live_instance_count));
+  std::printf("\"stale_direct_count\":%llu",
+              static_cast<unsigned long long>(stale_direct_count));
+  std::printf("}\n");
+
+  const bool ok =
+      registry.direct_access_property_count == 3u && count_access == 1 &&
+      enabled_access == 1 && value_access == 2 && guarded_access == 0 &&
+      observer_access == 0 && plain_count_access == 0 && counter != 0 &&
+      plain != 0 && direct_result == kBumpRoundCount &&
+      locked_result == kBumpRoundCount &&
+      direct_get_count == static_cast<std::uint64_t>(kBumpRoundCount) + 1u &&
+      direct_set_count == static_cast<std::uint64_t>(kBumpRoundCount) &&
+      locked_direct_count == 0u && enabled_result == 1 &&
+      strong_failures == 0 && guarded_result == item &&
+      observer_result == item && cleared_value == 0 && cleared_guarded == 0 &&
+      zeroed_observer == 0 && live_instance_count == 0u && stale_direct_count == 0u;
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,200 @@
+#include "runtime/objc3_runtime.h"
+#include "runtime/objc3_runtime_bootstrap_internal.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr std::int64_t kDispatchModulus = 2147483629LL;
+constexpr int kReceiverIdentityBase = 1024;
+constexpr int kReceiverIdentityStride = 17;
+constexpr int kReceiverCount = 4;
+constexpr int kSendsPerThread = 200000;
+constexpr int kThreadCounts[] = {1, 2, 4, 8};
+constexpr const char *kSelector = "contentionProbe:";
+
+std::int64_t ComputeSelectorScore(const char *selector) {
+  std::int64_t score = 0;
+  std::int64_t index = 1;
+  const unsigned char *cursor =
+      reinterpret_cast<const unsigned char *>(selector);
+  while (*cursor != 0U) {
+    score = (score + (static_cast<std::int64_t>(*cursor) * index)) %
+            kDispatchModulus;
+    ++cursor;
+    ++index;
+  }
+  return score;
+}
+
+int ExpectedDispatch(int receiver, int a0) {
+  std::int64_t value = 41;
+  value += static_cast<std::int64_t>(receiver) * 97;
+  value += static_cast<std::int64_t>(a0) * 7;
+  value += ComputeSelectorScore(kSelector) * 19;
+  value %= kDispatchModulus;
+  return static_cast<int>(value);
+}
+
+int ReceiverForThread(int thread_index) {
+  // Instance-family arithmetic receivers decode without registered images, so
+  // the first send per receiver publishes a fallback cache entry and every
+  // later send exercises the cache-hit path.
+  return kReceiverIdentityBase +
+         (thread_index % kReceiverCount) * kReceiverIdentityStride + 1;
+}
+
+struct ContentionSample {
+  int thread_count = 0;
+  std::uint64_t total_sends = 0;
+  double elapsed_ms = 0.0;
+  double sends_per_second = 0.0;
+  // Per-thread metric deltas across the sample: each thread's warm-up send
+  // resolves under the mutex and every timed send must be a thread-cache hit.
+  std::uint64_t locked_resolve_count = 0;
+  std::uint64_t thread_cache_hit_count = 0;
+  bool results_match = true;
+};
+
+ContentionSample RunSample(int thread_count) {
+  objc3_runtime_metrics_snapshot metrics_before{};
+  (void)objc3_runtime_copy_metrics(&metrics_before);
+  std::atomic<int> ready{0};
+  std::atomic<bool> go{false};
+  std::vector<int> mismatches(static_cast<std::size_t>(thread_count), 0);
+  std::vector<std::thread> threads;
+  threads.reserve(static_cast<std::size_t>(thread_count));
+  for (int thread_index = 0; thread_index < thread_count; ++thread_index) {
+    threads.emplace_back([&, thread_index]() {
+      const int receiver = ReceiverForThread(thread_index);
+      const int expected = ExpectedDispatch(receiver, 3);
+      (void)objc3_runtime_dispatch_i32(receiver, kSelector, 3, 0, 0, 0);
+      ready.fetch_add(1);
+      while (!go.load(std::memory_order_acquire)) {
+        std::this_thread::yield();
+      }
+      int local_mismatches = 0;
+      for (int send = 0; send < kSendsPerThread; ++send) {
+        if (objc3_runtime_dispatch_i32(receiver, kSelector, 3, 0, 0, 0) !=
+            expected) {
+          ++local_mismatches;
+        }
+      }
+      mismatches[static_cast<std::size_t>(thread_index)] = local_mismatches;
+    });
+  }
+  while (ready.load() != thread_count) {
+    std::this_thread::yield();
+  }
+  const auto started = std::chrono::steady_clock::now();
+  go.store(true, std::memory_order_release);
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+  const auto finished = std::chrono::steady_clock::now();
+  objc3_runtime_metrics_snapshot metrics_after{};
+  (void)objc3_runtime_copy_metrics(&metrics_after);
+
+  ContentionSample sample;
+  sample.locked_resolve_count = metrics_after.dispatch_locked_resolve_count -
+                                metrics_before.dispatch_locked_resolve_count;
+  sample.thread_cache_hit_count = metrics_after.dispatch_cache_hit_count -
+                                  metrics_before.dispatch_cache_hit_count;
+  sample.thread_count = thread_count;
+  sample.total_sends =
+      static_cast<std::uint64_t>(thread_count) * kSendsPerThread;
+  sample.elapsed_ms =
+      std::chrono::duration<double, std::milli>(finished - started).count();
+  sample.sends_per_second =
+      sample.elapsed_ms > 0.0
+          ? static_cast<double>(sample.total_sends) * 1000.0 / sample.elapsed_ms
+          : 0.0;
+  for (int mismatch_count : mismatches) {
+    sample.results_match = sample.results_match && mismatch_count == 0;
+  }
+  return sample;
+}
+
+}  // namespace
+
+int main() {
+  objc3_runtime_reset_for_testing();
+
+  std::vector<ContentionSample> samples;
+  std::uint64_t expected_send_count = 0;
+  for (int thread_count : kThreadCounts) {
+    samples.push_back(RunSample(thread_count));
+    expected_send_count +=
+        static_cast<std::uint64_t>(thread_count) * (kSendsPerThread + 1u);
+  }
+
+  objc3_runtime_method_cache_state_snapshot cache_state{};
+  const int cache_status =
+      objc3_runtime_copy_method_cache_state_for_testing(&cache_state);
+
+  bool results_match = true;
+  bool hits_stay_unlocked = true;
+  const double single_thread_rate = samples.front().sends_per_second;
+  double peak_rate = 0.0;
+  std::printf("{\"samples\":[");
+  for (std::size_t index = 0; index < samples.size(); ++index) {
+    const ContentionSample &sample = samples[index];
+    results_match = results_match && sample.results_match;
+    hits_stay_unlocked =
+        hits_stay_unlocked &&
+        sample.locked_resolve_count ==
+            static_cast<std::uint64_t>(sample.thread_count) &&
+        sample.thread_cache_hit_count == sample.total_sends;
+    if (sample.sends_per_second > peak_rate) {
+      peak_rate = sample.sends_per_second;
+    }
+    std::printf("%s{\"thread_count\":%d,\"total_sends\":%llu,"
+                "\"elapsed_ms\":%.3f,\"sends_per_second\":%.0f,"
+                "\"scaling_ratio\":%.3f,\"locked_resolve_count\":%llu,"
+                "\"thread_cache_hit_count\":%llu}",
+                index == 0 ? "" : ",", sample.thread_count,
+                static_cast<unsigned long long>(sample.total_sends),
+                sample.elapsed_ms, sample.sends_per_second,
+                single_thread_rate > 0.0
+                    ? sample.sends_per_second / single_thread_rate
+                    : 0.0,
+                static_cast<unsigned long long>(sample.locked_resolve_count),
+                static_cast<unsigned long long>(sample.thread_cache_hit_count));
+  }
+  std::printf("]");
+  std::printf(",\"hardware_threads\":%u",
+              std::thread::hardware_concurrency());
+  std::printf(",\"hits_stay_unlocked\":%d", hits_stay_unlocked ? 1 : 0);
+  std::printf(",\"sends_per_thread\":%d", kSendsPerThread);
+  std::printf(",\"receiver_count\":%d", kReceiverCount);
+  std::printf(",\"peak_scaling_ratio\":%.3f",
+              single_thread_rate > 0.0 ? peak_rate / single_thread_rate : 0.0);
+  std::printf(",\"results_match\":%d", results_match ? 1 : 0);
+  std::printf(",\"cache_status\":%d", cache_status);
+  std::printf(",\"cache_entry_count\":%llu",
+              static_cast<unsigned long long>(cache_state.cache_entry_count));
+  std::printf(",\"cache_hit_count\":%llu",
+              static_cast<unsigned long long>(cache_state.cache_hit_count));
+  std::printf(",\"cache_miss_count\":%llu",
+              static_cast<unsigned long long>(cache_state.cache_miss_count));
+  std::printf(",\"fallback_dispatch_count\":%llu",
+              static_cast<unsigned long long>(cache_state.fallback_dispatch_count));
+  std::printf(",\"expected_send_count\":%llu",
+              static_cast<unsigned long long>(expected_send_count));
+  std::printf("}\n");
+
+  const bool ok =
+      cache_status == OBJC3_RUNTIME_REGISTRATION_STATUS_OK && results_match &&
+      hits_stay_unlocked &&
+      cache_state.cache_entry_count == kReceiverCount &&
+      cache_state.cache_miss_count == kReceiverCount &&
+      cache_state.cache_hit_count + cache_state.cache_miss_count ==
+          expected_send_count &&
+      cache_state.fallback_dispatch_count == expected_send_count;
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,267 @@
+#include "runtime/objc3_runtime.h"
+#include "runtime/objc3_runtime_bootstrap_internal.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <latch>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+extern "C" int sendHot(void);
+
+namespace {
+
+// Links against the dispatch-profile fixture: Profiled's class methods
+// resolve live, and a static receiver no image describes supplies fallback
+// sends.
+constexpr int kReceiverIdentityBase = 1024;
+constexpr int kReceiverIdentityStride = 17;
+constexpr int kFallbackReceiver =
+    kReceiverIdentityBase + 900 * kReceiverIdentityStride + 1;
+constexpr std::uint64_t kSamplePeriod = 61;
+constexpr int kMixSendCount = 2000000;
+constexpr int kThreadCount = 2;
+constexpr int kThreadSendCount = static_cast<int>(kSamplePeriod) * 1000;
+
+using Clock = std::chrono::steady_clock;
+
+double ElapsedMs(Clock::time_point started) {
+  return std::chrono::duration<double, std::milli>(Clock::now() - started)
+      .count();
+}
+
+int ClassReceiver(const char *class_name) {
+  objc3_runtime_realized_class_entry_snapshot entry{};
+  (void)objc3_runtime_copy_realized_class_entry_for_testing(class_name, &entry);
+  return entry.found != 0 ? static_cast<int>(entry.base_identity + 2u) : 0;
+}
+
+objc3_runtime_dispatch_profile_state_snapshot CopyProfileState() {
+  objc3_runtime_dispatch_profile_state_snapshot snapshot{};
+  (void)objc3_runtime_copy_dispatch_profile_state_for_testing(&snapshot);
+  return snapshot;
+}
+
+objc3_runtime_dispatch_profile_entry_snapshot CopyProfileEntry(
+    int receiver, const char *selector) {
+  objc3_runtime_dispatch_profile_entry_snapshot snapshot{};
+  (void)objc3_runtime_copy_dispatch_profile_entry_for_testing(receiver,
+                                                              selector,
+                                                              &snapshot);
+  return snapshot;
+}
+
+// 90% hot, 9% warm, 1% cold, in a fixed pseudo-random order so the sample
+// period cannot alias with the mix.
+std::vector<const char *> BuildSendMix() {
+  std::vector<const char *> mix(kMixSendCount, nullptr);
+  std::uint32_t seed = 0x5bd1e995u;
+  for (const char *&selector : mix) {
+    seed = seed * 1664525u + 1013904223u;
+    const std::uint32_t bucket = (seed >> 8) % 100u;
+    selector = bucket < 90u ? "hot" : bucket < 99u ? "warm" : "cold";
+  }
+  return mix;
+}
+
+double RunSendMix(int receiver, const std::vector<const char *> &mix,
+                  int &total) {
+  const Clock::time_point started = Clock::now();
+  for (const char *selector : mix) {
+    total += objc3_runtime_dispatch_i32(receiver, selector, 0, 0, 0, 0);
+  }
+  return ElapsedMs(started);
+}
+
+}  // namespace
+
+int main() {
+  const int profiled = ClassReceiver("Profiled");
+  const int fixture_result = sendHot();
+
+  // Sampling every send: the first send of each key resolves on the slow
+  // path and is timed; the repeat is a thread-cache hit.
+  const int every_send_status =
+      objc3_runtime_set_dispatch_profile_period_for_testing(1);
+  const int first_cold = objc3_runtime_dispatch_i32(profiled, "cold", 0, 0, 0, 0);
+  const int second_cold =
+      objc3_runtime_dispatch_i32(profiled, "cold", 0, 0, 0, 0);
+  (void)objc3_runtime_dispatch_i32(kFallbackReceiver, "missingProbe:", 1, 0, 0,
+                                   0);
+  (void)objc3_runtime_dispatch_i32(kFallbackReceiver, "missingProbe:", 2, 0, 0,
+                                   0);
+  (void)objc3_runtime_dispatch_i32(0, "cold", 0, 0, 0, 0);
+  const objc3_runtime_dispatch_profile_entry_snapshot cold_entry =
+      CopyProfileEntry(profiled, "cold");
+  const objc3_runtime_dispatch_profile_entry_snapshot fallback_entry =
+      CopyProfileEntry(kFallbackReceiver, "missingProbe:");
+  const objc3_runtime_dispatch_profile_state_snapshot every_send_state =
+      CopyProfileState();
+
+  // Sampling cost: the same send mix with the profiler off and at the
+  // sample period.
+  const std::vector<const char *> mix = BuildSendMix();
+  int off_total = 0;
+  int sampled_total = 0;
+  const int off_status = objc3_runtime_set_dispatch_profile_period_for_testing(0);
+  (void)RunSendMix(profiled, mix, off_total);
+  const double off_ms = RunSendMix(profiled, mix, off_total);
+  const objc3_runtime_dispatch_profile_state_snapshot off_state =
+      CopyProfileState();
+  const int sampled_status =
+      objc3_runtime_set_dispatch_profile_period_for_testing(kSamplePeriod);
+  const double sampled_ms = RunSendMix(profiled, mix, sampled_total);
+  const objc3_runtime_dispatch_profile_state_snapshot sampled_state =
+      CopyProfileState();
+  const objc3_runtime_dispatch_profile_entry_snapshot hot_entry =
+      CopyProfileEntry(profiled, "hot");
+  const double hot_share =
+      sampled_state.sample_count != 0
+          ? static_cast<double>(hot_entry.sample_count) /
+                static_cast<double>(sampled_state.sample_count)
+          : 0.0;
+
+  // Other threads sample into their own tables; the totals survive their
+  // exit. The latch keeps both senders alive at once so neither inherits
+  // the other's recycled table.
+  std::vector<std::thread> senders;
+  std::latch senders_started(kThreadCount);
+  for (int index = 0; index < kThreadCount; ++index) {
+    senders.emplace_back([profiled, &senders_started] {
+      (void)objc3_runtime_dispatch_i32(profiled, "warm", 0, 0, 0, 0);
+      senders_started.arrive_and_wait();
+      for (int send = 1; send < kThreadSendCount; ++send) {
+        (void)objc3_runtime_dispatch_i32(profiled, "warm", 0, 0, 0, 0);
+      }
+    });
+  }
+  for (std::thread &sender : senders) {
+    sender.join();
+  }
+  const objc3_runtime_dispatch_profile_state_snapshot threaded_state =
+      CopyProfileState();
+
+  const std::filesystem::path folded_path =
+      std::filesystem::temp_directory_path() /
+      ("objc3_dispatch_profile_" + std::to_string(getpid()) + ".folded");
+  const int write_status =
+      objc3_runtime_write_dispatch_profile(folded_path.c_str());
+  std::ifstream folded(folded_path);
+  std::string line;
+  int folded_line_count = 0;
+  std::uint64_t folded_sample_count = 0;
+  std::uint64_t folded_hot_hit_count = 0;
+  while (std::getline(folded, line)) {
+    const std::size_t space = line.rfind(' ');
+    if (space == std::string::npos) {
+      continue;
+    }
+    const std::uint64_t count =
+        std::strtoull(line.c_str() + space + 1, nullptr, 10);
+    ++folded_line_count;
+    folded_sample_count += count;
+    if (line.rfind("dispatch;Profiled;+hot;cache-hit", 0) == 0) {
+      folded_hot_hit_count += count;
+    }
+  }
+  folded.close();
+  std::error_code ignored;
+  std::filesystem::remove(folded_path, ignored);
+  (void)objc3_runtime_set_dispatch_profile_period_for_testing(0);
+
+  const std::uint64_t expected_sampled_count = kMixSendCount / kSamplePeriod;
+  const std::uint64_t expected_threaded_count =
+      expected_sampled_count +
+      static_cast<std::uint64_t>(kThreadCount) * kThreadSendCount /
+          kSamplePeriod;
+
+  std::printf("{");
+  std::printf("\"fixture_result\":%d,", fixture_result);
+  std::printf("\"every_send_status\":%d,", every_send_status);
+  std::printf("\"cold_results\":%d,", first_cold + second_cold);
+  std::printf("\"cold_sample_count\":%llu,",
+              static_cast<unsigned long long>(cold_entry.sample_count));
+  std::printf("\"cold_slow_path_count\":%llu,",
+              static_cast<unsigned long long>(cold_entry.slow_path_count));
+  std::printf("\"cold_cache_hit_count\":%llu,",
+              static_cast<unsigned long long>(cold_entry.cache_hit_count));
+  std::printf("\"cold_slow_path_ns\":%llu,",
+              static_cast<unsigned long long>(cold_entry.slow_path_ns));
+  std::printf("\"fallback_sample_count\":%llu,",
+              static_cast<unsigned long long>(fallback_entry.sample_count));
+  std::printf("\"fallback_fallback_count\":%llu,",
+              static_cast<unsigned long long>(fallback_entry.fallback_count));
+  std::printf("\"every_send_sample_count\":%llu,",
+              static_cast<unsigned long long>(every_send_state.sample_count));
+  std::printf("\"off_status\":%d,", off_status);
+  std::printf("\"off_sample_count\":%llu,",
+              static_cast<unsigned long long>(off_state.sample_count));
+  std::printf("\"sampled_status\":%d,", sampled_status);
+  std::printf("\"mix_send_count\":%d,", kMixSendCount);
+  std::printf("\"sample_period\":%llu,",
+              static_cast<unsigned long long>(sampled_state.sample_period));
+  std::printf("\"off_ms\":%.3f,", off_ms);
+  std::printf("\"sampled_ms\":%.3f,", sampled_ms);
+  std::printf("\"off_sends_per_second\":%.0f,",
+              off_ms > 0.0 ? kMixSendCount * 1000.0 / off_ms : 0.0);
+  std::printf("\"sampled_sends_per_second\":%.0f,",
+              sampled_ms > 0.0 ? kMixSendCount * 1000.0 / sampled_ms : 0.0);
+  std::printf("\"totals_match\":%d,", off_total == sampled_total * 2 ? 1 : 0);
+  std::printf("\"sampled_count\":%llu,",
+              static_cast<unsigned long long>(sampled_state.sample_count));
+  std::printf("\"expected_sampled_count\":%llu,",
+              static_cast<unsigned long long>(expected_sampled_count));
+  std::printf("\"profiled_key_count\":%llu,",
+              static_cast<unsigned long long>(
+                  sampled_state.profiled_key_count));
+  std::printf("\"hot_share\":%.3f,", hot_share);
+  std::printf("\"threaded_sample_count\":%llu,",
+              static_cast<unsigned long long>(threaded_state.sample_count));
+  std::printf("\"expected_threaded_count\":%llu,",
+              static_cast<unsigned long long>(expected_threaded_count));
+  std::printf("\"table_count\":%llu,",
+              static_cast<unsigned long long>(threaded_state.table_count));
+  std::printf("\"dropped_sample_count\":%llu,",
+              static_cast<unsigned long long>(
+                  threaded_state.dropped_sample_count));
+  std::printf("\"write_status\":%d,", write_status);
+  std::printf("\"folded_line_count\":%d,", folded_line_count);
+  std::printf("\"folded_sample_count\":%llu,",
+              static_cast<unsigned long long>(folded_sample_count));
+  std::printf("\"folded_hot_hit_count\":%llu",
+              static_cast<unsigned long long>(folded_hot_hit_count));
+  std::printf("}\n");
+
+  const bool ok =
+      profiled != 0 && fixture_result == 3 &&
+      every_send_status == OBJC3_RUNTIME_REGISTRATION_STATUS_OK &&
+      first_cold + second_cold == 14 && cold_entry.found != 0 &&
+      cold_entry.sample_count == 2u && cold_entry.slow_path_count == 1u &&
+      cold_entry.cache_hit_count == 1u && cold_entry.slow_path_ns > 0u &&
+      fallback_entry.sample_count == 2u &&
+      fallback_entry.fallback_count == 2u &&
+      every_send_state.sample_count == 4u &&
+      off_status == OBJC3_RUNTIME_REGISTRATION_STATUS_OK &&
+      off_state.sample_count == 0u &&
+      sampled_status == OBJC3_RUNTIME_REGISTRATION_STATUS_OK &&
+      sampled_state.sample_period == kSamplePeriod &&
+      off_total == sampled_total * 2 &&
+      sampled_state.sample_count == expected_sampled_count &&
+      sampled_state.profiled_key_count == 3u && hot_share > 0.85 &&
+      hot_share < 0.95 &&
+      threaded_state.sample_count == expected_threaded_count &&
+      threaded_state.table_count ==
+          static_cast<std::uint64_t>(kThreadCount) + 1u &&
+      threaded_state.dropped_sample_count == 0u &&
+      write_status == OBJC3_RUNTIME_REGISTRATION_STATUS_OK &&
+      folded_sample_count == threaded_state.sample_count &&
+      folded_hot_hit_count == hot_entry.sample_count;
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,152 @@
+#include "runtime/objc3_runtime.h"
+#include "runtime/objc3_runtime_bootstrap_internal.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+
+namespace {
+
+constexpr int kReceiverIdentityBase = 1024;
+constexpr int kReceiverIdentityStride = 17;
+constexpr int kTimedSendCount = 1000000;
+constexpr int kPolymorphicReceiverCount = 12;
+constexpr const char *kSelector = "siteCacheProbe:";
+
+// Mirrors the zero-initialized cell that site-cache lowering emits per send.
+objc3_runtime_dispatch_site_cache g_send_site{};
+objc3_runtime_dispatch_site_cache g_polymorphic_site{};
+
+int InstanceReceiver(int index) {
+  return kReceiverIdentityBase + index * kReceiverIdentityStride + 1;
+}
+
+struct SendSample {
+  double sends_per_second = 0.0;
+  std::int64_t checksum = 0;
+};
+
+template <typename Send>
+SendSample TimeSends(Send send) {
+  SendSample sample;
+  const auto started = std::chrono::steady_clock::now();
+  for (int index = 0; index < kTimedSendCount; ++index) {
+    sample.checksum += send(index & 7);
+  }
+  const auto finished = std::chrono::steady_clock::now();
+  const double elapsed_ms =
+      std::chrono::duration<double, std::milli>(finished - started).count();
+  sample.sends_per_second =
+      elapsed_ms > 0.0
+          ? static_cast<double>(kTimedSendCount) * 1000.0 / elapsed_ms
+          : 0.0;
+  return sample;
+}
+
+}  // namespace
+
+int main() {
+  objc3_runtime_reset_for_testing();
+  const int receiver = InstanceReceiver(0);
+
+  // Old lowering: every send goes through the canonical entrypoint and its
+  // hashed thread-local hit cache.
+  (void)objc3_runtime_dispatch_i32(receiver, kSelector, 0, 0, 0, 0);
+  const SendSample canonical = TimeSends([receiver](int a0) {
+    return objc3_runtime_dispatch_i32(receiver, kSelector, a0, 0, 0, 0);
+  });
+
+  // New lowering: the same send routed through one call-site cache cell.
+  const SendSample site_cached = TimeSends([receiver](int a0) {
+    return objc3_runtime_dispatch_site_cached_i32(&g_send_site, receiver,
+                                                  kSelector, a0, 0, 0, 0);
+  });
+  objc3_runtime_dispatch_site_cache_state_snapshot warm_state{};
+  const int warm_status =
+      objc3_runtime_copy_dispatch_site_cache_state_for_testing(&warm_state);
+
+  // A receiver change at the same site rebinds the slot instead of serving the
+  // stale binding, and a nil receiver still short-circuits to zero.
+  const int rebound_result = objc3_runtime_dispatch_site_cached_i32(
+      &g_send_site, InstanceReceiver(1), kSelector, 1, 0, 0, 0);
+  const int rebound_expected =
+      objc3_runtime_dispatch_i32(InstanceReceiver(1), kSelector, 1, 0, 0, 0);
+  const int nil_result = objc3_runtime_dispatch_site_cached_i32(
+      &g_send_site, 0, kSelector, 1, 0, 0, 0);
+  const int null_site_result = objc3_runtime_dispatch_site_cached_i32(
+      nullptr, receiver, kSelector, 1, 0, 0, 0);
+  const int null_site_expected =
+      objc3_runtime_dispatch_i32(receiver, kSelector, 1, 0, 0, 0);
+  objc3_runtime_dispatch_site_cache_state_snapshot final_state{};
+  (void)objc3_runtime_copy_dispatch_site_cache_state_for_testing(&final_state);
+
+  // A site that keeps seeing new receivers stops rebinding and answers from
+  // the thread cache, still with canonical results. Each rebind rewrites the
+  // site's one binding, so both sites together own two.
+  bool polymorphic_matches = true;
+  for (int round = 0; round < 2; ++round) {
+    for (int index = 0; index < kPolymorphicReceiverCount; ++index) {
+      const int result = objc3_runtime_dispatch_site_cached_i32(
+          &g_polymorphic_site, InstanceReceiver(index), kSelector, index, 0, 0,
+          0);
+      polymorphic_matches =
+          polymorphic_matches &&
+          result == objc3_runtime_dispatch_i32(InstanceReceiver(index),
+                                               kSelector, index, 0, 0, 0);
+    }
+  }
+  objc3_runtime_dispatch_site_cache_state_snapshot polymorphic_state{};
+  (void)objc3_runtime_copy_dispatch_site_cache_state_for_testing(
+      &polymorphic_state);
+
+  const bool results_match = canonical.checksum == site_cached.checksum;
+  std::printf("{");
+  std::printf("\"timed_send_count\":%d,", kTimedSendCount);
+  std::printf("\"canonical_sends_per_second\":%.0f,",
+              canonical.sends_per_second);
+  std::printf("\"site_cached_sends_per_second\":%.0f,",
+              site_cached.sends_per_second);
+  std::printf("\"site_speedup_ratio\":%.3f,",
+              canonical.sends_per_second > 0.0
+                  ? site_cached.sends_per_second / canonical.sends_per_second
+                  : 0.0);
+  std::printf("\"results_match\":%d,", results_match ? 1 : 0);
+  std::printf("\"site_index\":%llu,",
+              static_cast<unsigned long long>(g_send_site.site_index));
+  std::printf("\"warm_status\":%d,", warm_status);
+  std::printf("\"warm_bound_site_count\":%llu,",
+              static_cast<unsigned long long>(warm_state.bound_site_count));
+  std::printf("\"warm_site_cache_hit_count\":%llu,",
+              static_cast<unsigned long long>(warm_state.site_cache_hit_count));
+  std::printf("\"warm_site_cache_miss_count\":%llu,",
+              static_cast<unsigned long long>(warm_state.site_cache_miss_count));
+  std::printf("\"final_site_cache_miss_count\":%llu,",
+              static_cast<unsigned long long>(final_state.site_cache_miss_count));
+  std::printf("\"rebound_matches\":%d,",
+              rebound_result == rebound_expected ? 1 : 0);
+  std::printf("\"nil_result\":%d,", nil_result);
+  std::printf("\"null_site_matches\":%d,",
+              null_site_result == null_site_expected ? 1 : 0);
+  std::printf("\"polymorphic_matches\":%d,", polymorphic_matches ? 1 : 0);
+  std::printf("\"megamorphic_site_count\":%llu,",
+              static_cast<unsigned long long>(
+                  polymorphic_state.megamorphic_site_count));
+  std::printf("\"site_binding_count\":%llu",
+              static_cast<unsigned long long>(
+                  polymorphic_state.site_binding_count));
+  std::printf("}\n");
+
+  const bool ok =
+      warm_status == OBJC3_RUNTIME_REGISTRATION_STATUS_OK && results_match &&
+      g_send_site.site_index == 1 && warm_state.bound_site_count == 1 &&
+      warm_state.site_cache_miss_count == 1 &&
+      warm_state.site_cache_hit_count ==
+          static_cast<std::uint64_t>(kTimedSendCount) - 1u &&
+      final_state.site_cache_miss_count == 3 &&
+      rebound_result == rebound_expected && nil_result == 0 &&
+      null_site_result == null_site_expected && polymorphic_matches &&
+      final_state.megamorphic_site_count == 0 &&
+      polymorphic_state.megamorphic_site_count == 1 &&
+      polymorphic_state.site_binding_count == 2;
+  return ok ? 0 : 1;
+}
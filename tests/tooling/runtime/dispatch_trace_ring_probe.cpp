@@ -0,0 +1,140 @@
+#include "runtime/objc3_runtime.h"
+#include "runtime/objc3_runtime_bootstrap_internal.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+namespace {
+
+constexpr int kReceiverIdentityBase = 1024;
+constexpr int kReceiverIdentityStride = 17;
+constexpr int kTimedSendCount = 500000;
+constexpr const char *kSelector = "traceProbe:";
+
+int InstanceReceiver(int index) {
+  return kReceiverIdentityBase + index * kReceiverIdentityStride + 1;
+}
+
+double TimeCacheHitSends(int receiver) {
+  const auto started = std::chrono::steady_clock::now();
+  int sink = 0;
+  for (int send = 0; send < kTimedSendCount; ++send) {
+    sink ^= objc3_runtime_dispatch_i32(receiver, kSelector, send, 0, 0, 0);
+  }
+  const auto finished = std::chrono::steady_clock::now();
+  const double elapsed_ms =
+      std::chrono::duration<double, std::milli>(finished - started).count();
+  if (sink == -1) {
+    std::printf("%d", sink);
+  }
+  return elapsed_ms > 0.0
+             ? static_cast<double>(kTimedSendCount) * 1000.0 / elapsed_ms
+             : 0.0;
+}
+
+void PrintJsonStringOrNull(const char *value) {
+  if (value == nullptr) {
+    std::printf("null");
+    return;
+  }
+  std::printf("\"%s\"", value);
+}
+
+void PrintTraceState(const char *name,
+                     const objc3_runtime_dispatch_trace_state_snapshot &state) {
+  std::printf("\"%s\":{\"trace_enabled\":%d,\"ring_capacity\":%llu,"
+              "\"recorded_event_count\":%llu,\"retained_event_count\":%llu}",
+              name, state.trace_enabled,
+              static_cast<unsigned long long>(state.ring_capacity),
+              static_cast<unsigned long long>(state.recorded_event_count),
+              static_cast<unsigned long long>(state.retained_event_count));
+}
+
+void PrintTraceEvent(const char *name,
+                     const objc3_runtime_dispatch_trace_event_snapshot &event) {
+  std::printf("\"%s\":{\"found\":%d,\"sequence\":%llu,"
+              "\"normalized_receiver_identity\":%llu,\"used_cache\":%d,"
+              "\"fell_back\":%d,\"selector\":",
+              name, event.found,
+              static_cast<unsigned long long>(event.sequence),
+              static_cast<unsigned long long>(event.normalized_receiver_identity),
+              event.used_cache, event.fell_back);
+  PrintJsonStringOrNull(event.selector);
+  std::printf(",\"dispatch_path\":");
+  PrintJsonStringOrNull(event.dispatch_path);
+  std::printf(",\"implementation_kind\":");
+  PrintJsonStringOrNull(event.implementation_kind);
+  std::printf("}");
+}
+
+}  // namespace
+
+int main() {
+  objc3_runtime_reset_for_testing();
+  const int previous_enabled =
+      objc3_runtime_set_dispatch_trace_enabled_for_testing(0);
+
+  const int receiver = InstanceReceiver(0);
+  (void)objc3_runtime_dispatch_i32(receiver, kSelector, 1, 0, 0, 0);
+  const double untraced_sends_per_second = TimeCacheHitSends(receiver);
+  objc3_runtime_dispatch_trace_state_snapshot untraced_state{};
+  (void)objc3_runtime_copy_dispatch_trace_state_for_testing(&untraced_state);
+  objc3_runtime_dispatch_state_snapshot untraced_dispatch{};
+  (void)objc3_runtime_copy_dispatch_state_for_testing(&untraced_dispatch);
+
+  (void)objc3_runtime_set_dispatch_trace_enabled_for_testing(1);
+  const double traced_sends_per_second = TimeCacheHitSends(receiver);
+  (void)objc3_runtime_dispatch_i32(InstanceReceiver(1), kSelector, 2, 0, 0, 0);
+  (void)objc3_runtime_dispatch_i32(0, kSelector, 3, 0, 0, 0);
+  objc3_runtime_dispatch_trace_state_snapshot traced_state{};
+  (void)objc3_runtime_copy_dispatch_trace_state_for_testing(&traced_state);
+  objc3_runtime_dispatch_trace_event_snapshot newest_event{};
+  (void)objc3_runtime_copy_dispatch_trace_event_for_testing(0, &newest_event);
+  objc3_runtime_dispatch_trace_event_snapshot miss_event{};
+  (void)objc3_runtime_copy_dispatch_trace_event_for_testing(1, &miss_event);
+  objc3_runtime_dispatch_trace_event_snapshot hit_event{};
+  (void)objc3_runtime_copy_dispatch_trace_event_for_testing(2, &hit_event);
+  objc3_runtime_dispatch_trace_event_snapshot expired_event{};
+  (void)objc3_runtime_copy_dispatch_trace_event_for_testing(
+      traced_state.retained_event_count, &expired_event);
+  (void)objc3_runtime_set_dispatch_trace_enabled_for_testing(previous_enabled);
+
+  std::printf("{");
+  std::printf("\"timed_send_count\":%d,", kTimedSendCount);
+  std::printf("\"untraced_sends_per_second\":%.0f,", untraced_sends_per_second);
+  std::printf("\"traced_sends_per_second\":%.0f,", traced_sends_per_second);
+  PrintTraceState("untraced_state", untraced_state);
+  std::printf(",\"untraced_last_dispatch_path\":");
+  PrintJsonStringOrNull(untraced_dispatch.last_dispatch_path);
+  std::printf(",\"untraced_last_selector\":");
+  PrintJsonStringOrNull(untraced_dispatch.last_selector);
+  std::printf(",");
+  PrintTraceState("traced_state", traced_state);
+  std::printf(",");
+  PrintTraceEvent("newest_event", newest_event);
+  std::printf(",");
+  PrintTraceEvent("miss_event", miss_event);
+  std::printf(",");
+  PrintTraceEvent("hit_event", hit_event);
+  std::printf(",\"expired_event_found\":%d", expired_event.found);
+  std::printf("}\n");
+
+  const bool ok =
+      untraced_state.retained_event_count == 1 &&
+      untraced_state.recorded_event_count ==
+          static_cast<std::uint64_t>(kTimedSendCount) + 1u &&
+      untraced_dispatch.last_dispatch_path != nullptr &&
+      std::strcmp(untraced_dispatch.last_dispatch_path, "cache-hit-fallback") ==
+          0 &&
+      traced_state.retained_event_count == traced_state.ring_capacity &&
+      newest_event.found == 1 && newest_event.dispatch_path != nullptr &&
+      std::strcmp(newest_event.dispatch_path, "nil-short-circuit") == 0 &&
+      miss_event.found == 1 && miss_event.dispatch_path != nullptr &&
+      std::strcmp(miss_event.dispatch_path, "slow-path-fallback") == 0 &&
+      hit_event.found == 1 && hit_event.used_cache == 1 &&
+      hit_event.sequence + 2u == newest_event.sequence &&
+      expired_event.found == 0;
+  return ok ? 0 : 1;
+}
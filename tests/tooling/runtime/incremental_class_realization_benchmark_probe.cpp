@@ -0,0 +1,337 @@
+#include "runtime/objc3_runtime.h"
+#include "runtime/objc3_runtime_bootstrap_internal.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr int kReceiverIdentityBase = 1024;
+constexpr int kReceiverIdentityStride = 17;
+constexpr int kClassesPerImage = 4;
+constexpr int kImageCounts[] = {1, 10, 100, 1000};
+constexpr int kMaxImageCount = 1000;
+constexpr const char *kSelector = "startupValue";
+// Never seeded, so sends take the slow path and publish a resolved entry.
+constexpr const char *kProbeSelector = "startupProbe:";
+
+int StartupValue() { return 7; }
+
+// Mirror the emitted method-list, class-bundle, and registration-table
+// layouts that lowering publishes for one image.
+struct SyntheticMethodListEntry {
+  const char *selector;
+  const char *owner_identity;
+  const char *return_type_name;
+  std::uint64_t parameter_count;
+  const void *implementation;
+  std::uint64_t has_body;
+  bool effective_direct_dispatch;
+  bool objc_final_declared;
+};
+
+struct SyntheticMethodList {
+  std::uint64_t count;
+  const char *declaration_owner_identity;
+  const char *export_owner_identity;
+  SyntheticMethodListEntry entries[1];
+};
+
+struct SyntheticMethodListRef {
+  std::uint64_t count;
+  const char *owner_identity;
+  const void *method_list;
+};
+
+struct SyntheticClassRecord {
+  const char *class_name;
+  const char *bundle_owner_identity;
+  const char *object_owner_identity;
+  const char *super_owner_identity;
+  const void *super_bundle;
+  const SyntheticMethodListRef *method_list_ref;
+  const objc3_runtime_pointer_aggregate *adopted_protocol_refs;
+  bool objc_final_declared;
+  bool objc_sealed_declared;
+};
+
+struct SyntheticClassBundle {
+  SyntheticClassRecord class_record;
+  SyntheticClassRecord metaclass_record;
+};
+
+template <std::size_t EntryCount>
+struct PointerAggregateStorage {
+  std::uint64_t count;
+  const void *entries[EntryCount];
+};
+
+const objc3_runtime_pointer_aggregate *AsAggregate(const void *storage) {
+  return static_cast<const objc3_runtime_pointer_aggregate *>(storage);
+}
+
+struct SyntheticImage {
+  std::string module_name;
+  std::string identity_key;
+  std::string class_names[kClassesPerImage];
+  std::string implementation_identities[kClassesPerImage];
+  std::string class_identities[kClassesPerImage];
+  std::string metaclass_identities[kClassesPerImage];
+  SyntheticMethodList method_lists[kClassesPerImage];
+  SyntheticMethodListRef method_list_refs[kClassesPerImage];
+  SyntheticClassBundle bundles[kClassesPerImage];
+  PointerAggregateStorage<kClassesPerImage> class_root;
+  PointerAggregateStorage<1> empty_root;
+  PointerAggregateStorage<1> selector_pool_root;
+  PointerAggregateStorage<6> discovery_root;
+  const void *linker_anchor = nullptr;
+  unsigned char image_local_init_state = 0;
+  objc3_runtime_image_descriptor descriptor{};
+  objc3_runtime_registration_table table{};
+};
+
+// Image N's first class inherits from image 1's root, so every image after
+// the first links a super edge against an earlier image.
+void BuildSyntheticImage(SyntheticImage &image, int ordinal,
+                         const SyntheticClassBundle *shared_root) {
+  image.module_name = "startup-image-" + std::to_string(ordinal);
+  image.identity_key = "startup::image-" + std::to_string(ordinal);
+  for (int index = 0; index < kClassesPerImage; ++index) {
+    const std::string class_name = "Startup" + std::to_string(ordinal) + "_" +
+                                   std::to_string(index);
+    image.class_names[index] = class_name;
+    image.implementation_identities[index] = "implementation:" + class_name;
+    image.class_identities[index] = "class:" + class_name;
+    image.metaclass_identities[index] = "metaclass:" + class_name;
+    const char *implementation_identity =
+        image.implementation_identities[index].c_str();
+    image.method_lists[index] = SyntheticMethodList{
+        1,
+        implementation_identity,
+        implementation_identity,
+        {{kSelector, implementation_identity, "i32", 0,
+          reinterpret_cast<const void *>(&StartupValue), 1, true, false}}};
+    image.method_list_refs[index] =
+        SyntheticMethodListRef{1, implementation_identity,
+                               &image.method_lists[index]};
+    const SyntheticClassBundle *super_bundle =
+        index > 0 ? &image.bundles[index - 1] : shared_root;
+    const char *super_identity =
+        index > 0 ? image.class_identities[index - 1].c_str()
+                  : (shared_root != nullptr
+                         ? shared_root->class_record.object_owner_identity
+                         : nullptr);
+    image.bundles[index].class_record = SyntheticClassRecord{
+        image.class_names[index].c_str(),
+        implementation_identity,
+        image.class_identities[index].c_str(),
+        super_identity,
+        super_bundle,
+        &image.method_list_refs[index],
+        nullptr,
+        false,
+        false};
+    image.bundles[index].metaclass_record = SyntheticClassRecord{
+        image.class_names[index].c_str(),
+        implementation_identity,
+        image.metaclass_identities[index].c_str(),
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        false,
+        false};
+    image.class_root.entries[index] = &image.bundles[index];
+  }
+  image.class_root.count = kClassesPerImage;
+  image.empty_root = {0, {nullptr}};
+  image.selector_pool_root = {1, {kSelector}};
+  image.discovery_root = {
+      6,
+      {&image.class_root, &image.empty_root, &image.empty_root,
+       &image.empty_root, &image.empty_root, &image.selector_pool_root}};
+  image.linker_anchor = &image.discovery_root;
+  image.descriptor = objc3_runtime_image_descriptor{
+      image.module_name.c_str(),
+      image.identity_key.c_str(),
+      static_cast<std::uint64_t>(ordinal),
+      kClassesPerImage,
+      0,
+      0,
+      0,
+      0};
+  image.table = objc3_runtime_registration_table{
+      2,
+      12,
+      &image.descriptor,
+      AsAggregate(&image.discovery_root),
+      &image.linker_anchor,
+      AsAggregate(&image.class_root),
+      AsAggregate(&image.empty_root),
+      AsAggregate(&image.empty_root),
+      AsAggregate(&image.empty_root),
+      AsAggregate(&image.empty_root),
+      AsAggregate(&image.selector_pool_root),
+      nullptr,
+      nullptr,
+      &image.image_local_init_state};
+}
+
+int RegisterSyntheticImage(const SyntheticImage &image) {
+  objc3_runtime_stage_registration_table_for_bootstrap(&image.table);
+  return objc3_runtime_register_image(&image.descriptor);
+}
+
+int InstanceReceiver(int ordinal) {
+  return kReceiverIdentityBase + ordinal * kReceiverIdentityStride + 1;
+}
+
+struct StartupSample {
+  int image_count = 0;
+  double elapsed_ms = 0.0;
+  double per_image_us = 0.0;
+  double first_tenth_per_image_us = 0.0;
+  double last_tenth_per_image_us = 0.0;
+  bool statuses_ok = true;
+  objc3_runtime_realized_class_graph_state_snapshot graph{};
+};
+
+StartupSample RunSample(const std::vector<std::unique_ptr<SyntheticImage>> &images,
+                        int image_count) {
+  StartupSample sample;
+  sample.image_count = image_count;
+  objc3_runtime_reset_for_testing();
+  const int tenth = image_count >= 10 ? image_count / 10 : image_count;
+  std::vector<double> per_image_us(static_cast<std::size_t>(image_count), 0.0);
+  const auto started = std::chrono::steady_clock::now();
+  for (int index = 0; index < image_count; ++index) {
+    const auto image_started = std::chrono::steady_clock::now();
+    sample.statuses_ok =
+        RegisterSyntheticImage(*images[static_cast<std::size_t>(index)]) ==
+            OBJC3_RUNTIME_REGISTRATION_STATUS_OK &&
+        sample.statuses_ok;
+    per_image_us[static_cast<std::size_t>(index)] =
+        std::chrono::duration<double, std::micro>(
+            std::chrono::steady_clock::now() - image_started)
+            .count();
+  }
+  const auto finished = std::chrono::steady_clock::now();
+  sample.elapsed_ms =
+      std::chrono::duration<double, std::milli>(finished - started).count();
+  sample.per_image_us = sample.elapsed_ms * 1000.0 / image_count;
+  for (int index = 0; index < tenth; ++index) {
+    sample.first_tenth_per_image_us +=
+        per_image_us[static_cast<std::size_t>(index)] / tenth;
+    sample.last_tenth_per_image_us +=
+        per_image_us[static_cast<std::size_t>(image_count - 1 - index)] / tenth;
+  }
+  (void)objc3_runtime_copy_realized_class_graph_state_for_testing(&sample.graph);
+  return sample;
+}
+
+}  // namespace
+
+int main() {
+  std::vector<std::unique_ptr<SyntheticImage>> images;
+  images.reserve(kMaxImageCount + 2);
+  for (int ordinal = 1; ordinal <= kMaxImageCount + 2; ++ordinal) {
+    images.push_back(std::make_unique<SyntheticImage>());
+    BuildSyntheticImage(*images.back(), ordinal,
+                        ordinal == 1 ? nullptr : &images.front()->bundles[0]);
+  }
+
+  std::vector<StartupSample> samples;
+  bool samples_ok = true;
+  for (int image_count : kImageCounts) {
+    samples.push_back(RunSample(images, image_count));
+    const StartupSample &sample = samples.back();
+    samples_ok =
+        samples_ok && sample.statuses_ok &&
+        sample.graph.realized_class_count ==
+            static_cast<std::uint64_t>(image_count) * kClassesPerImage &&
+        sample.graph.root_class_count == 1 &&
+        sample.graph.metaclass_edge_count ==
+            static_cast<std::uint64_t>(image_count) * kClassesPerImage - 1u &&
+        sample.graph.last_registration_realized_class_count ==
+            static_cast<std::uint64_t>(kClassesPerImage) &&
+        sample.graph.full_class_graph_invalidation_count == 0;
+  }
+
+  // A receiver whose ordinal no image binds keeps its cached resolution
+  // across the next registration; a receiver on a rebound ordinal loses it.
+  const int unbound_receiver = InstanceReceiver(kClassesPerImage + 5);
+  const int unbound_first = objc3_runtime_dispatch_i32(
+      unbound_receiver, kProbeSelector, 0, 0, 0, 0);
+  const int rebound_status =
+      RegisterSyntheticImage(*images[static_cast<std::size_t>(kMaxImageCount)]);
+  objc3_runtime_realized_class_graph_state_snapshot unaffected_graph{};
+  (void)objc3_runtime_copy_realized_class_graph_state_for_testing(
+      &unaffected_graph);
+  const int unbound_second = objc3_runtime_dispatch_i32(
+      unbound_receiver, kProbeSelector, 0, 0, 0, 0);
+  objc3_runtime_method_cache_state_snapshot retained_cache{};
+  (void)objc3_runtime_copy_method_cache_state_for_testing(&retained_cache);
+
+  (void)objc3_runtime_dispatch_i32(InstanceReceiver(0), kProbeSelector, 0, 0,
+                                   0, 0);
+  const int affected_status = RegisterSyntheticImage(
+      *images[static_cast<std::size_t>(kMaxImageCount + 1)]);
+  objc3_runtime_realized_class_graph_state_snapshot affected_graph{};
+  (void)objc3_runtime_copy_realized_class_graph_state_for_testing(
+      &affected_graph);
+
+  std::printf("{\"samples\":[");
+  for (std::size_t index = 0; index < samples.size(); ++index) {
+    const StartupSample &sample = samples[index];
+    std::printf("%s{\"image_count\":%d,\"elapsed_ms\":%.3f,"
+                "\"per_image_us\":%.3f,\"first_tenth_per_image_us\":%.3f,"
+                "\"last_tenth_per_image_us\":%.3f,\"realized_class_count\":%llu,"
+                "\"metaclass_edge_count\":%llu}",
+                index == 0 ? "" : ",", sample.image_count, sample.elapsed_ms,
+                sample.per_image_us, sample.first_tenth_per_image_us,
+                sample.last_tenth_per_image_us,
+                static_cast<unsigned long long>(sample.graph.realized_class_count),
+                static_cast<unsigned long long>(sample.graph.metaclass_edge_count));
+  }
+  std::printf("]");
+  const StartupSample &largest = samples.back();
+  std::printf(",\"classes_per_image\":%d", kClassesPerImage);
+  std::printf(",\"late_to_early_per_image_ratio\":%.3f",
+              largest.first_tenth_per_image_us > 0.0
+                  ? largest.last_tenth_per_image_us /
+                        largest.first_tenth_per_image_us
+                  : 0.0);
+  std::printf(",\"samples_ok\":%d", samples_ok ? 1 : 0);
+  std::printf(",\"unaffected_registration_status\":%d", rebound_status);
+  std::printf(",\"unaffected_invalidated_cache_entry_count\":%llu",
+              static_cast<unsigned long long>(
+                  unaffected_graph.last_registration_invalidated_cache_entry_count));
+  std::printf(",\"unaffected_cache_hit_count\":%llu",
+              static_cast<unsigned long long>(retained_cache.cache_hit_count));
+  std::printf(",\"unaffected_cache_miss_count\":%llu",
+              static_cast<unsigned long long>(retained_cache.cache_miss_count));
+  std::printf(",\"unbound_results_match\":%d",
+              unbound_first == unbound_second ? 1 : 0);
+  std::printf(",\"affected_registration_status\":%d", affected_status);
+  std::printf(",\"affected_invalidated_cache_entry_count\":%llu",
+              static_cast<unsigned long long>(
+                  affected_graph.last_registration_invalidated_cache_entry_count));
+  std::printf(",\"full_class_graph_invalidation_count\":%llu",
+              static_cast<unsigned long long>(
+                  affected_graph.full_class_graph_invalidation_count));
+  std::printf("}\n");
+
+  const bool ok =
+      samples_ok && rebound_status == OBJC3_RUNTIME_REGISTRATION_STATUS_OK &&
+      unaffected_graph.last_registration_invalidated_cache_entry_count == 0 &&
+      retained_cache.cache_hit_count == 1 &&
+      retained_cache.cache_miss_count == 0 && unbound_first == unbound_second &&
+      affected_status == OBJC3_RUNTIME_REGISTRATION_STATUS_OK &&
+      affected_graph.last_registration_invalidated_cache_entry_count == 1 &&
+      affected_graph.full_class_graph_invalidation_count == 0;
+  return ok ? 0 : 1;
+}
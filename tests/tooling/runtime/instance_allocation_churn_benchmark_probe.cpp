@@ -0,0 +1,196 @@
+#include "runtime/objc3_runtime.h"
+#include "runtime/objc3_runtime_bootstrap_internal.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#include <unistd.h>
+
+namespace {
+
+constexpr int kClassReceiver = 1024;
+constexpr int kWorkingSetSize = 256;
+constexpr int kTimedAllocationCount = 1000000;
+constexpr const char *kClassName = "ChurnObject";
+constexpr const char *kImplementationIdentity = "implementation:ChurnObject";
+constexpr const char *kClassIdentity = "class:ChurnObject";
+constexpr const char *kMetaclassIdentity = "metaclass:ChurnObject";
+
+// Mirror the emitted class-bundle and registration-table layouts for one
+// image holding a single root class with no methods.
+struct SyntheticClassRecord {
+  const char *class_name;
+  const char *bundle_owner_identity;
+  const char *object_owner_identity;
+  const char *super_owner_identity;
+  const void *super_bundle;
+  const void *method_list_ref;
+  const objc3_runtime_pointer_aggregate *adopted_protocol_refs;
+  bool objc_final_declared;
+  bool objc_sealed_declared;
+};
+
+struct SyntheticClassBundle {
+  SyntheticClassRecord class_record;
+  SyntheticClassRecord metaclass_record;
+};
+
+template <std::size_t EntryCount>
+struct PointerAggregateStorage {
+  std::uint64_t count;
+  const void *entries[EntryCount];
+};
+
+const objc3_runtime_pointer_aggregate *AsAggregate(const void *storage) {
+  return static_cast<const objc3_runtime_pointer_aggregate *>(storage);
+}
+
+SyntheticClassBundle g_bundle{
+    {kClassName, kImplementationIdentity, kClassIdentity, nullptr, nullptr,
+     nullptr, nullptr, false, false},
+    {kClassName, kImplementationIdentity, kMetaclassIdentity, nullptr, nullptr,
+     nullptr, nullptr, false, false}};
+PointerAggregateStorage<1> g_class_root{1, {&g_bundle}};
+PointerAggregateStorage<1> g_empty_root{0, {nullptr}};
+PointerAggregateStorage<6> g_discovery_root{
+    6,
+    {&g_class_root, &g_empty_root, &g_empty_root, &g_empty_root, &g_empty_root,
+     &g_empty_root}};
+const void *g_linker_anchor = &g_discovery_root;
+unsigned char g_image_local_init_state = 0;
+objc3_runtime_image_descriptor g_descriptor{
+    "instance-churn", "instance-churn::image", 1, 1, 0, 0, 0, 0};
+objc3_runtime_registration_table g_table{
+    2,
+    12,
+    &g_descriptor,
+    AsAggregate(&g_discovery_root),
+    &g_linker_anchor,
+    AsAggregate(&g_class_root),
+    AsAggregate(&g_empty_root),
+    AsAggregate(&g_empty_root),
+    AsAggregate(&g_empty_root),
+    AsAggregate(&g_empty_root),
+    AsAggregate(&g_empty_root),
+    nullptr,
+    nullptr,
+    &g_image_local_init_state};
+
+std::uint64_t CurrentRssKilobytes() {
+  std::FILE *statm = std::fopen("/proc/self/statm", "r");
+  if (statm == nullptr) {
+    return 0;
+  }
+  unsigned long long size_pages = 0;
+  unsigned long long resident_pages = 0;
+  const int read = std::fscanf(statm, "%llu %llu", &size_pages, &resident_pages);
+  std::fclose(statm);
+  if (read != 2) {
+    return 0;
+  }
+  return static_cast<std::uint64_t>(resident_pages) *
+         static_cast<std::uint64_t>(sysconf(_SC_PAGESIZE)) / 1024u;
+}
+
+objc3_runtime_instance_slab_state_snapshot CopySlabState() {
+  objc3_runtime_instance_slab_state_snapshot snapshot{};
+  (void)objc3_runtime_copy_instance_slab_state_for_testing(&snapshot);
+  return snapshot;
+}
+
+int Alloc() { return objc3_runtime_dispatch_i32(kClassReceiver, "alloc", 0, 0, 0, 0); }
+
+}  // namespace
+
+int main() {
+  objc3_runtime_reset_for_testing();
+  objc3_runtime_stage_registration_table_for_bootstrap(&g_table);
+  const int registration_status = objc3_runtime_register_image(&g_descriptor);
+
+  // Fill the working set, then churn: every timed allocation replaces the
+  // oldest live instance, so steady state should recycle slots and storage.
+  std::vector<int> live(kWorkingSetSize, 0);
+  bool allocations_ok = true;
+  for (int index = 0; index < kWorkingSetSize; ++index) {
+    live[static_cast<std::size_t>(index)] = Alloc();
+    allocations_ok = allocations_ok && live[static_cast<std::size_t>(index)] != 0;
+  }
+  const objc3_runtime_instance_slab_state_snapshot warm = CopySlabState();
+  const std::uint64_t rss_before_kb = CurrentRssKilobytes();
+
+  const auto started = std::chrono::steady_clock::now();
+  for (int index = 0; index < kTimedAllocationCount; ++index) {
+    int &slot = live[static_cast<std::size_t>(index % kWorkingSetSize)];
+    (void)objc3_runtime_release_i32(slot);
+    slot = Alloc();
+    allocations_ok = allocations_ok && slot != 0;
+  }
+  const auto finished = std::chrono::steady_clock::now();
+  const std::uint64_t rss_after_kb = CurrentRssKilobytes();
+  const objc3_runtime_instance_slab_state_snapshot churned = CopySlabState();
+  const double elapsed_ms =
+      std::chrono::duration<double, std::milli>(finished - started).count();
+
+  // A handle to a recycled slot must stay dead: releasing it again may not
+  // touch the slot's new occupant.
+  const int stale = live[0];
+  (void)objc3_runtime_release_i32(stale);
+  const int reused = Alloc();
+  (void)objc3_runtime_release_i32(stale);
+  const objc3_runtime_instance_slab_state_snapshot after_stale = CopySlabState();
+  const bool stale_handle_ignored =
+      reused != stale && after_stale.live_instance_count == kWorkingSetSize;
+
+  std::printf("{");
+  std::printf("\"registration_status\":%d,", registration_status);
+  std::printf("\"working_set_size\":%d,", kWorkingSetSize);
+  std::printf("\"timed_allocation_count\":%d,", kTimedAllocationCount);
+  std::printf("\"elapsed_ms\":%.3f,", elapsed_ms);
+  std::printf("\"allocations_per_second\":%.0f,",
+              elapsed_ms > 0.0
+                  ? static_cast<double>(kTimedAllocationCount) * 1000.0 /
+                        elapsed_ms
+                  : 0.0);
+  std::printf("\"rss_before_kb\":%llu,",
+              static_cast<unsigned long long>(rss_before_kb));
+  std::printf("\"rss_after_kb\":%llu,",
+              static_cast<unsigned long long>(rss_after_kb));
+  std::printf("\"warm_slot_capacity\":%llu,",
+              static_cast<unsigned long long>(warm.slot_capacity));
+  std::printf("\"churned_slot_capacity\":%llu,",
+              static_cast<unsigned long long>(churned.slot_capacity));
+  std::printf("\"churned_live_instance_count\":%llu,",
+              static_cast<unsigned long long>(churned.live_instance_count));
+  std::printf("\"reused_slot_count\":%llu,",
+              static_cast<unsigned long long>(churned.reused_slot_count));
+  std::printf("\"retired_slot_count\":%llu,",
+              static_cast<unsigned long long>(churned.retired_slot_count));
+  std::printf("\"wrapped_slot_count\":%llu,",
+              static_cast<unsigned long long>(churned.wrapped_slot_count));
+  std::printf("\"warm_reserved_storage_bytes\":%llu,",
+              static_cast<unsigned long long>(warm.reserved_storage_bytes));
+  std::printf("\"churned_reserved_storage_bytes\":%llu,",
+              static_cast<unsigned long long>(churned.reserved_storage_bytes));
+  std::printf("\"allocations_ok\":%d,", allocations_ok ? 1 : 0);
+  std::printf("\"stale_handle_ignored\":%d", stale_handle_ignored ? 1 : 0);
+  std::printf("}\n");
+
+  // Retired slots are bounded by how often the generation field wraps, so the
+  // slab grows by at most one slot per exhausted generation range.
+  const std::uint64_t max_retired =
+      static_cast<std::uint64_t>(kTimedAllocationCount) / 2000u + 1u;
+  const bool ok =
+      registration_status == OBJC3_RUNTIME_REGISTRATION_STATUS_OK &&
+      allocations_ok && warm.slot_capacity == kWorkingSetSize &&
+      churned.live_instance_count == kWorkingSetSize &&
+      churned.reused_slot_count + churned.retired_slot_count >=
+          static_cast<std::uint64_t>(kTimedAllocationCount) - max_retired &&
+      churned.retired_slot_count <= max_retired &&
+      churned.slot_capacity <= kWorkingSetSize + max_retired &&
+      churned.wrapped_slot_count > 0u &&
+      churned.reserved_storage_bytes == warm.reserved_storage_bytes &&
+      stale_handle_ignored;
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,329 @@
+#include "runtime/objc3_runtime.h"
+#include "runtime/objc3_runtime_bootstrap_internal.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+extern "C" int nodeValuePath();
+extern "C" int readNodeValue(int receiver);
+extern "C" int writeNodeValue(int receiver, int value);
+
+namespace {
+
+// Links against the keypath-chain-evaluation fixture: Node chains to the
+// next node through a strong `next`, Tail keeps its `value` behind a `tag`.
+// The fixture emits one single-component key path; the deeper ones come from
+// a second, key-path-only image registered below.
+constexpr int kReadCount = 1000000;
+constexpr int kMaxDepth = 5;
+constexpr int kPoolStride = 1000;
+constexpr std::uint64_t kFirstChainHandle = 101;
+constexpr std::uint64_t kRelinkHandle = 106;
+
+using Clock = std::chrono::steady_clock;
+
+double ElapsedMs(Clock::time_point started) {
+  return std::chrono::duration<double, std::milli>(Clock::now() - started)
+      .count();
+}
+
+double PerSecond(std::uint64_t count, double elapsed_ms) {
+  return elapsed_ms > 0.0 ? static_cast<double>(count) * 1000.0 / elapsed_ms
+                          : 0.0;
+}
+
+// Mirror the emitted key-path descriptor and registration-table layouts.
+struct SyntheticKeyPathDescriptor {
+  std::uint64_t stable_id;
+  const char *root_name;
+  const char *component_path;
+  const char *profile;
+  const char *generic_metadata_replay_key;
+  bool root_is_self;
+};
+
+template <std::size_t EntryCount>
+struct PointerAggregateStorage {
+  std::uint64_t count;
+  const void *entries[EntryCount];
+};
+
+const objc3_runtime_pointer_aggregate *AsAggregate(const void *storage) {
+  return static_cast<const objc3_runtime_pointer_aggregate *>(storage);
+}
+
+std::string ChainPath(int depth) {
+  std::string path;
+  for (int level = 1; level < depth; ++level) {
+    path += "next.";
+  }
+  return path + "value";
+}
+
+// Handles 101..105 read `value` through 0..4 `next` hops; 106 stores through
+// `next.next`.
+struct SyntheticKeyPathImage {
+  std::string paths[kMaxDepth + 1];
+  std::string profiles[kMaxDepth + 1];
+  SyntheticKeyPathDescriptor descriptors[kMaxDepth + 1]{};
+  PointerAggregateStorage<kMaxDepth + 1> keypath_root{};
+  PointerAggregateStorage<1> empty_root{};
+  PointerAggregateStorage<7> discovery_root{};
+  const void *linker_anchor = nullptr;
+  unsigned char image_local_init_state = 0;
+  objc3_runtime_image_descriptor descriptor{};
+  objc3_runtime_registration_table table{};
+};
+
+void BuildSyntheticKeyPathImage(SyntheticKeyPathImage &image,
+                                std::uint64_t registration_order_ordinal) {
+  for (int index = 0; index <= kMaxDepth; ++index) {
+    image.paths[index] = index < kMaxDepth ? ChainPath(index + 1) : "next.next";
+    image.profiles[index] =
+        "typed-keypath:root=Node;components=" + image.paths[index];
+    image.descriptors[index] = SyntheticKeyPathDescriptor{
+        kFirstChainHandle + static_cast<std::uint64_t>(index),
+        "Node",
+        image.paths[index].c_str(),
+        image.profiles[index].c_str(),
+        nullptr,
+        false};
+    image.keypath_root.entries[index] = &image.descriptors[index];
+  }
+  image.keypath_root.count = kMaxDepth + 1;
+  image.empty_root = {0, {nullptr}};
+  image.discovery_root = {
+      7,
+      {&image.empty_root, &image.empty_root, &image.empty_root,
+       &image.empty_root, &image.empty_root, &image.empty_root,
+       &image.keypath_root}};
+  image.linker_anchor = &image.discovery_root;
+  image.descriptor = objc3_runtime_image_descriptor{
+      "keypath-chains", "keypath-chains::depth-1-5", registration_order_ordinal,
+      0, 0, 0, 0, 0};
+  image.table = objc3_runtime_registration_table{
+      2,
+      12,
+      &image.descriptor,
+      AsAggregate(&image.discovery_root),
+      &image.linker_anchor,
+      AsAggregate(&image.empty_root),
+      AsAggregate(&image.empty_root),
+      AsAggregate(&image.empty_root),
+      AsAggregate(&image.empty_root),
+      AsAggregate(&image.empty_root),
+      nullptr,
+      nullptr,
+      AsAggregate(&image.keypath_root),
+      &image.image_local_init_state};
+}
+
+objc3_runtime_keypath_registry_state_snapshot CopyKeyPathState() {
+  objc3_runtime_keypath_registry_state_snapshot snapshot{};
+  (void)objc3_runtime_copy_keypath_registry_state_for_testing(&snapshot);
+  return snapshot;
+}
+
+int Alloc(const char *class_name) {
+  objc3_runtime_realized_class_entry_snapshot entry{};
+  (void)objc3_runtime_copy_realized_class_entry_for_testing(class_name, &entry);
+  return entry.found != 0
+             ? objc3_runtime_dispatch_i32(
+                   static_cast<int>(entry.base_identity + 2u), "alloc", 0, 0,
+                   0, 0)
+             : 0;
+}
+
+std::uint64_t LiveInstanceCount() {
+  objc3_runtime_memory_management_state_snapshot snapshot{};
+  (void)objc3_runtime_copy_memory_management_state_for_testing(&snapshot);
+  return snapshot.live_runtime_instance_count;
+}
+
+// The uncompiled baseline: split the dotted path and send each component's
+// getter by name, as string-keyed key-value code does.
+int ReadByComponentSends(int receiver, const std::string &path) {
+  int value = receiver;
+  std::size_t begin = 0;
+  while (value != 0 && begin <= path.size()) {
+    std::size_t end = path.find('.', begin);
+    if (end == std::string::npos) {
+      end = path.size();
+    }
+    const std::string component = path.substr(begin, end - begin);
+    value = objc3_runtime_dispatch_i32(value, component.c_str(), 0, 0, 0, 0);
+    begin = end + 1u;
+  }
+  return value;
+}
+
+struct DepthSample {
+  int expected = 0;
+  int compiled_failures = 0;
+  int send_failures = 0;
+  double compiled_ms = 0.0;
+  double send_ms = 0.0;
+};
+
+}  // namespace
+
+int main() {
+  objc3_runtime_registration_state_snapshot registration{};
+  (void)objc3_runtime_copy_registration_state_for_testing(&registration);
+  static SyntheticKeyPathImage image;
+  BuildSyntheticKeyPathImage(
+      image, registration.next_expected_registration_order_ordinal);
+  objc3_runtime_stage_registration_table_for_bootstrap(&image.table);
+  const int registration_status = objc3_runtime_register_image(&image.descriptor);
+
+  // nodes[0] -> nodes[1] -> ... -> nodes[4]; node i holds value 10 * (i + 1).
+  int nodes[kMaxDepth] = {};
+  for (int index = 0; index < kMaxDepth; ++index) {
+    nodes[index] = Alloc("Node");
+    (void)objc3_runtime_dispatch_i32(nodes[index], "setValue:",
+                                     10 * (index + 1), 0, 0, 0);
+  }
+  for (int index = 0; index + 1 < kMaxDepth; ++index) {
+    (void)objc3_runtime_dispatch_i32(nodes[index], "setNext:", nodes[index + 1],
+                                     0, 0, 0);
+  }
+
+  // The emitted single-component handle works from compiled code too.
+  const int emitted_handle = nodeValuePath();
+  const int emitted_write = writeNodeValue(nodes[0], 11);
+  const int emitted_read = readNodeValue(nodes[0]);
+  (void)writeNodeValue(nodes[0], 10);
+
+  const objc3_runtime_keypath_registry_state_snapshot before =
+      CopyKeyPathState();
+  DepthSample samples[kMaxDepth];
+  for (int depth = 1; depth <= kMaxDepth; ++depth) {
+    DepthSample &sample = samples[depth - 1];
+    const int handle = static_cast<int>(kFirstChainHandle) + depth - 1;
+    sample.expected = 10 * depth;
+    const Clock::time_point compiled_started = Clock::now();
+    for (int index = 0; index < kReadCount; ++index) {
+      sample.compiled_failures +=
+          objc3_runtime_keypath_get_i32(handle, nodes[0]) == sample.expected
+              ? 0
+              : 1;
+    }
+    sample.compiled_ms = ElapsedMs(compiled_started);
+
+    const std::string path = ChainPath(depth);
+    const Clock::time_point send_started = Clock::now();
+    for (int index = 0; index < kReadCount; index += kPoolStride) {
+      objc3_runtime_push_autoreleasepool_scope();
+      for (int inner = 0; inner < kPoolStride; ++inner) {
+        sample.send_failures +=
+            ReadByComponentSends(nodes[0], path) == sample.expected ? 0 : 1;
+      }
+      objc3_runtime_pop_autoreleasepool_scope();
+    }
+    sample.send_ms = ElapsedMs(send_started);
+  }
+  const objc3_runtime_keypath_registry_state_snapshot after = CopyKeyPathState();
+  const std::uint64_t read_build_count =
+      after.chain_build_count - before.chain_build_count;
+  const std::uint64_t read_hit_count =
+      after.chain_hit_count - before.chain_hit_count;
+
+  // A deep store lands in the last node; a nil hop, a foreign root, a dead
+  // receiver, and an unknown handle all read 0.
+  const int deep_handle = static_cast<int>(kFirstChainHandle) + kMaxDepth - 1;
+  const int deep_write = objc3_runtime_keypath_set_i32(deep_handle, nodes[0], 77);
+  const int deep_value =
+      objc3_runtime_dispatch_i32(nodes[kMaxDepth - 1], "value", 0, 0, 0, 0);
+  const int nil_hop_value =
+      objc3_runtime_keypath_get_i32(static_cast<int>(kFirstChainHandle) + 1,
+                                    nodes[kMaxDepth - 1]);
+  const int tail = Alloc("Tail");
+  (void)objc3_runtime_dispatch_i32(tail, "setTag:", 5, 0, 0, 0);
+  (void)objc3_runtime_dispatch_i32(tail, "setValue:", 99, 0, 0, 0);
+  const int foreign_root_value =
+      objc3_runtime_keypath_get_i32(static_cast<int>(kFirstChainHandle), tail);
+  const int unknown_handle_value = objc3_runtime_keypath_get_i32(999, nodes[0]);
+
+  // Relinking a strong hop through the key path moves ownership with it, and
+  // an intermediate of another class resolves its step by name: Tail's
+  // `value` sits at a different offset than Node's.
+  const std::uint64_t step_misses_before = CopyKeyPathState().chain_step_miss_count;
+  const int relink_write = objc3_runtime_keypath_set_i32(
+      static_cast<int>(kRelinkHandle), nodes[0], tail);
+  const int tail_value = objc3_runtime_keypath_get_i32(
+      static_cast<int>(kFirstChainHandle) + 2, nodes[0]);
+  const std::uint64_t step_miss_count =
+      CopyKeyPathState().chain_step_miss_count - step_misses_before;
+
+  (void)objc3_runtime_release_i32(tail);
+  for (int index = 0; index < kMaxDepth; ++index) {
+    (void)objc3_runtime_release_i32(nodes[index]);
+  }
+  const std::uint64_t live_instance_count = LiveInstanceCount();
+  const int stale_value =
+      objc3_runtime_keypath_get_i32(static_cast<int>(kFirstChainHandle), nodes[0]);
+  const objc3_runtime_keypath_registry_state_snapshot final_state =
+      CopyKeyPathState();
+
+  std::printf("{");
+  std::printf("\"registration_status\":%d,", registration_status);
+  std::printf("\"keypath_table_entry_count\":%llu,",
+              static_cast<unsigned long long>(
+                  final_state.keypath_table_entry_count));
+  std::printf("\"emitted_handle\":%d,", emitted_handle);
+  std::printf("\"emitted_write\":%d,", emitted_write);
+  std::printf("\"emitted_read\":%d,", emitted_read);
+  std::printf("\"read_count_per_depth\":%d,", kReadCount);
+  bool samples_ok = true;
+  for (int depth = 1; depth <= kMaxDepth; ++depth) {
+    const DepthSample &sample = samples[depth - 1];
+    std::printf("\"depth_%d_compiled_ms\":%.3f,", depth, sample.compiled_ms);
+    std::printf("\"depth_%d_compiled_reads_per_second\":%.0f,", depth,
+                PerSecond(static_cast<std::uint64_t>(kReadCount),
+                          sample.compiled_ms));
+    std::printf("\"depth_%d_send_ms\":%.3f,", depth, sample.send_ms);
+    std::printf("\"depth_%d_send_reads_per_second\":%.0f,", depth,
+                PerSecond(static_cast<std::uint64_t>(kReadCount),
+                          sample.send_ms));
+    std::printf("\"depth_%d_speedup_ratio\":%.2f,", depth,
+                sample.compiled_ms > 0.0 ? sample.send_ms / sample.compiled_ms
+                                         : 0.0);
+    std::printf("\"depth_%d_failure_count\":%d,", depth,
+                sample.compiled_failures + sample.send_failures);
+    samples_ok = samples_ok && sample.compiled_failures == 0 &&
+                 sample.send_failures == 0;
+  }
+  std::printf("\"read_chain_build_count\":%llu,",
+              static_cast<unsigned long long>(read_build_count));
+  std::printf("\"read_chain_hit_count\":%llu,",
+              static_cast<unsigned long long>(read_hit_count));
+  std::printf("\"deep_write\":%d,", deep_write);
+  std::printf("\"deep_value\":%d,", deep_value);
+  std::printf("\"nil_hop_value\":%d,", nil_hop_value);
+  std::printf("\"foreign_root_value\":%d,", foreign_root_value);
+  std::printf("\"unknown_handle_value\":%d,", unknown_handle_value);
+  std::printf("\"relink_write\":%d,", relink_write);
+  std::printf("\"tail_value\":%d,", tail_value);
+  std::printf("\"step_miss_count\":%llu,",
+              static_cast<unsigned long long>(step_miss_count));
+  std::printf("\"live_instance_count\":%llu,",
+              static_cast<unsigned long long>(live_instance_count));
+  std::printf("\"stale_value\":%d", stale_value);
+  std::printf("}\n");
+
+  const bool ok =
+      registration_status == OBJC3_RUNTIME_REGISTRATION_STATUS_OK &&
+      final_state.keypath_table_entry_count ==
+          static_cast<std::uint64_t>(kMaxDepth) + 2u &&
+      emitted_handle == 1 && emitted_write == 1 && emitted_read == 11 &&
+      samples_ok && read_build_count == static_cast<std::uint64_t>(kMaxDepth) &&
+      read_hit_count == static_cast<std::uint64_t>(kMaxDepth) *
+                            (static_cast<std::uint64_t>(kReadCount) - 1u) &&
+      deep_write == 1 && deep_value == 77 && nil_hop_value == 0 &&
+      foreign_root_value == 0 && unknown_handle_value == 0 &&
+      relink_write == 1 && tail_value == 99 && step_miss_count == 1u &&
+      live_instance_count == 0u && stale_value == 0;
+  return ok ? 0 : 1;
+}
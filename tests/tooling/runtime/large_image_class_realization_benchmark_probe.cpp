@@ -0,0 +1,304 @@
+#include "runtime/objc3_runtime.h"
+#include "runtime/objc3_runtime_bootstrap_internal.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr int kReceiverIdentityBase = 1024;
+constexpr int kReceiverIdentityStride = 17;
+constexpr int kMethodsPerClass = 4;
+constexpr int kClassesPerRoot = 16;
+constexpr int kClassCounts[] = {256, 1024, 4096};
+constexpr int kRegistrationRepeats = 3;
+
+int StartupValue() { return 7; }
+
+// Mirror the emitted method-list, class-bundle, and registration-table
+// layouts that lowering publishes for one image.
+struct SyntheticMethodListEntry {
+  const char *selector;
+  const char *owner_identity;
+  const char *return_type_name;
+  std::uint64_t parameter_count;
+  const void *implementation;
+  std::uint64_t has_body;
+  bool effective_direct_dispatch;
+  bool objc_final_declared;
+};
+
+struct SyntheticMethodList {
+  std::uint64_t count;
+  const char *declaration_owner_identity;
+  const char *export_owner_identity;
+  SyntheticMethodListEntry entries[kMethodsPerClass];
+};
+
+struct SyntheticMethodListRef {
+  std::uint64_t count;
+  const char *owner_identity;
+  const void *method_list;
+};
+
+struct SyntheticClassRecord {
+  const char *class_name;
+  const char *bundle_owner_identity;
+  const char *object_owner_identity;
+  const char *super_owner_identity;
+  const void *super_bundle;
+  const SyntheticMethodListRef *method_list_ref;
+  const objc3_runtime_pointer_aggregate *adopted_protocol_refs;
+  bool objc_final_declared;
+  bool objc_sealed_declared;
+};
+
+struct SyntheticClassBundle {
+  SyntheticClassRecord class_record;
+  SyntheticClassRecord metaclass_record;
+};
+
+const objc3_runtime_pointer_aggregate *AsAggregate(
+    const std::vector<const void *> &storage) {
+  return reinterpret_cast<const objc3_runtime_pointer_aggregate *>(
+      storage.data());
+}
+
+// One image holding every class, as a large single-module program links.
+// Aggregates are count-prefixed pointer arrays, matching the emitted roots.
+struct SyntheticImage {
+  std::string module_name;
+  std::string identity_key;
+  std::vector<std::string> selectors;
+  std::vector<std::string> class_names;
+  std::vector<std::string> implementation_identities;
+  std::vector<std::string> class_identities;
+  std::vector<std::string> metaclass_identities;
+  std::vector<SyntheticMethodList> method_lists;
+  std::vector<SyntheticMethodListRef> method_list_refs;
+  std::vector<SyntheticClassBundle> bundles;
+  std::vector<const void *> class_root;
+  std::vector<const void *> empty_root;
+  std::vector<const void *> selector_pool_root;
+  std::vector<const void *> discovery_root;
+  const void *linker_anchor = nullptr;
+  unsigned char image_local_init_state = 0;
+  objc3_runtime_image_descriptor descriptor{};
+  objc3_runtime_registration_table table{};
+};
+
+std::string ZeroPadded(int value) {
+  std::string digits = std::to_string(value);
+  return std::string(digits.size() < 5 ? 5 - digits.size() : 0, '0') + digits;
+}
+
+// Class names are zero-padded so the name-ordered receiver ordinal equals the
+// declaration index. Every kClassesPerRoot-th class is a root and the rest
+// chain to their predecessor.
+void BuildSyntheticImage(SyntheticImage &image, int class_count) {
+  const std::size_t classes = static_cast<std::size_t>(class_count);
+  image.module_name = "large-image-" + std::to_string(class_count);
+  image.identity_key = "large::image-" + std::to_string(class_count);
+  image.selectors.resize(classes * kMethodsPerClass);
+  image.class_names.resize(classes);
+  image.implementation_identities.resize(classes);
+  image.class_identities.resize(classes);
+  image.metaclass_identities.resize(classes);
+  image.method_lists.resize(classes);
+  image.method_list_refs.resize(classes);
+  image.bundles.resize(classes);
+  image.selector_pool_root.assign(1, reinterpret_cast<const void *>(
+                                         static_cast<std::uintptr_t>(
+                                             image.selectors.size())));
+  image.class_root.assign(1, reinterpret_cast<const void *>(
+                                 static_cast<std::uintptr_t>(classes)));
+  for (std::size_t index = 0; index < image.selectors.size(); ++index) {
+    image.selectors[index] = "largeValue" + std::to_string(index);
+    image.selector_pool_root.push_back(image.selectors[index].c_str());
+  }
+  for (std::size_t index = 0; index < classes; ++index) {
+    image.class_names[index] = "Large" + ZeroPadded(static_cast<int>(index));
+    image.implementation_identities[index] =
+        "implementation:" + image.class_names[index];
+    image.class_identities[index] = "class:" + image.class_names[index];
+    image.metaclass_identities[index] = "metaclass:" + image.class_names[index];
+  }
+  for (std::size_t index = 0; index < classes; ++index) {
+    const char *implementation_identity =
+        image.implementation_identities[index].c_str();
+    SyntheticMethodList &method_list = image.method_lists[index];
+    method_list.count = kMethodsPerClass;
+    method_list.declaration_owner_identity = implementation_identity;
+    method_list.export_owner_identity = implementation_identity;
+    for (int method = 0; method < kMethodsPerClass; ++method) {
+      method_list.entries[method] = SyntheticMethodListEntry{
+          image.selectors[index * kMethodsPerClass +
+                          static_cast<std::size_t>(method)]
+              .c_str(),
+          implementation_identity,
+          "i32",
+          0,
+          reinterpret_cast<const void *>(&StartupValue),
+          1,
+          false,
+          false};
+    }
+    image.method_list_refs[index] = SyntheticMethodListRef{
+        kMethodsPerClass, implementation_identity, &method_list};
+    const bool is_root = index % kClassesPerRoot == 0;
+    image.bundles[index].class_record = SyntheticClassRecord{
+        image.class_names[index].c_str(),
+        implementation_identity,
+        image.class_identities[index].c_str(),
+        is_root ? nullptr : image.class_identities[index - 1].c_str(),
+        is_root ? nullptr : &image.bundles[index - 1],
+        &image.method_list_refs[index],
+        nullptr,
+        false,
+        false};
+    image.bundles[index].metaclass_record = SyntheticClassRecord{
+        image.class_names[index].c_str(),
+        implementation_identity,
+        image.metaclass_identities[index].c_str(),
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        false,
+        false};
+    image.class_root.push_back(&image.bundles[index]);
+  }
+  image.empty_root.assign(2, nullptr);
+  image.discovery_root = {
+      reinterpret_cast<const void *>(static_cast<std::uintptr_t>(6)),
+      image.class_root.data(),
+      image.empty_root.data(),
+      image.empty_root.data(),
+      image.empty_root.data(),
+      image.empty_root.data(),
+      image.selector_pool_root.data()};
+  image.linker_anchor = image.discovery_root.data();
+  image.descriptor = objc3_runtime_image_descriptor{
+      image.module_name.c_str(),
+      image.identity_key.c_str(),
+      1,
+      static_cast<std::uint64_t>(class_count),
+      0,
+      0,
+      0,
+      0};
+  image.table = objc3_runtime_registration_table{
+      2,
+      12,
+      &image.descriptor,
+      AsAggregate(image.discovery_root),
+      &image.linker_anchor,
+      AsAggregate(image.class_root),
+      AsAggregate(image.empty_root),
+      AsAggregate(image.empty_root),
+      AsAggregate(image.empty_root),
+      AsAggregate(image.empty_root),
+      AsAggregate(image.selector_pool_root),
+      nullptr,
+      nullptr,
+      &image.image_local_init_state};
+}
+
+int InstanceReceiver(int ordinal) {
+  return kReceiverIdentityBase + ordinal * kReceiverIdentityStride + 1;
+}
+
+struct StartupSample {
+  int class_count = 0;
+  double register_ms = 0.0;
+  double per_class_us = 0.0;
+  bool statuses_ok = true;
+  int last_class_result = 0;
+  objc3_runtime_realized_class_graph_state_snapshot graph{};
+};
+
+// Cold start is one registration into a freshly reset runtime; the best of a
+// few repeats filters scheduler noise without warming anything the next
+// repeat could reuse.
+StartupSample RunSample(int class_count) {
+  StartupSample sample;
+  sample.class_count = class_count;
+  SyntheticImage image;
+  BuildSyntheticImage(image, class_count);
+  for (int repeat = 0; repeat < kRegistrationRepeats; ++repeat) {
+    objc3_runtime_reset_for_testing();
+    image.image_local_init_state = 0;
+    const auto started = std::chrono::steady_clock::now();
+    objc3_runtime_stage_registration_table_for_bootstrap(&image.table);
+    const int status = objc3_runtime_register_image(&image.descriptor);
+    const double elapsed_ms = std::chrono::duration<double, std::milli>(
+                                  std::chrono::steady_clock::now() - started)
+                                  .count();
+    sample.statuses_ok =
+        status == OBJC3_RUNTIME_REGISTRATION_STATUS_OK && sample.statuses_ok;
+    if (repeat == 0 || elapsed_ms < sample.register_ms) {
+      sample.register_ms = elapsed_ms;
+    }
+  }
+  sample.per_class_us = sample.register_ms * 1000.0 / class_count;
+  (void)objc3_runtime_copy_realized_class_graph_state_for_testing(&sample.graph);
+  // The last class inherits its chain's root selectors, so a send of the
+  // root's first selector walks the realized super edges.
+  const int last_class = class_count - 1;
+  const int last_root = last_class - last_class % kClassesPerRoot;
+  sample.last_class_result = objc3_runtime_dispatch_i32(
+      InstanceReceiver(last_class),
+      image.selectors[static_cast<std::size_t>(last_root) * kMethodsPerClass]
+          .c_str(),
+      0, 0, 0, 0);
+  objc3_runtime_reset_for_testing();
+  return sample;
+}
+
+}  // namespace
+
+int main() {
+  std::vector<StartupSample> samples;
+  bool samples_ok = true;
+  for (int class_count : kClassCounts) {
+    samples.push_back(RunSample(class_count));
+    const StartupSample &sample = samples.back();
+    const std::uint64_t classes = static_cast<std::uint64_t>(class_count);
+    const std::uint64_t roots = classes / kClassesPerRoot;
+    samples_ok = samples_ok && sample.statuses_ok &&
+                 sample.graph.realized_class_count == classes &&
+                 sample.graph.root_class_count == roots &&
+                 sample.graph.metaclass_edge_count == classes - roots &&
+                 sample.graph.last_registration_realized_class_count ==
+                     classes &&
+                 sample.last_class_result == StartupValue();
+  }
+
+  std::printf("{\"samples\":[");
+  for (std::size_t index = 0; index < samples.size(); ++index) {
+    const StartupSample &sample = samples[index];
+    std::printf("%s{\"class_count\":%d,\"register_ms\":%.3f,"
+                "\"per_class_us\":%.3f,\"realized_class_count\":%llu,"
+                "\"metaclass_edge_count\":%llu,\"last_class_result\":%d}",
+                index == 0 ? "" : ",", sample.class_count, sample.register_ms,
+                sample.per_class_us,
+                static_cast<unsigned long long>(sample.graph.realized_class_count),
+                static_cast<unsigned long long>(sample.graph.metaclass_edge_count),
+                sample.last_class_result);
+  }
+  std::printf("]");
+  const StartupSample &smallest = samples.front();
+  const StartupSample &largest = samples.back();
+  std::printf(",\"methods_per_class\":%d", kMethodsPerClass);
+  std::printf(",\"classes_per_root\":%d", kClassesPerRoot);
+  std::printf(",\"large_to_small_per_class_ratio\":%.3f",
+              smallest.per_class_us > 0.0
+                  ? largest.per_class_us / smallest.per_class_us
+                  : 0.0);
+  std::printf(",\"samples_ok\":%d", samples_ok ? 1 : 0);
+  std::printf("}\n");
+  return samples_ok ? 0 : 1;
+}
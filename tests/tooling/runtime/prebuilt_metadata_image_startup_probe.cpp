@@ -0,0 +1,327 @@
+#include "runtime/objc3_runtime.h"
+#include "runtime/objc3_runtime_bootstrap_internal.h"
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#ifndef OBJC3_PREBUILT_IMAGE_FIXTURE_CLASS_NAME
+#error "OBJC3_PREBUILT_IMAGE_FIXTURE_CLASS_NAME must be provided by the generated fixture config"
+#endif
+
+#ifndef OBJC3_PREBUILT_IMAGE_FIXTURE_CLASS_SELECTOR
+#error "OBJC3_PREBUILT_IMAGE_FIXTURE_CLASS_SELECTOR must be provided by the generated fixture config"
+#endif
+
+#ifndef OBJC3_PREBUILT_IMAGE_FIXTURE_CLASS_RESULT
+#error "OBJC3_PREBUILT_IMAGE_FIXTURE_CLASS_RESULT must be provided by the generated fixture config"
+#endif
+
+namespace {
+
+constexpr int kColdRegistrationCycles = 400;
+constexpr char kDynamicSelector[] = "prebuiltImageProbeDynamicSelector:";
+
+// Mirror the emitted prebuilt image header: magic, version, word count,
+// selector count, class descriptor count, class ordinal count, hash seed,
+// group count, bucket count, and the group/bucket/class-ordinal offsets.
+constexpr std::uint32_t kPrebuiltImageMagic = 0x4950334Fu;
+constexpr std::uint32_t kPrebuiltImageVersion = 1u;
+constexpr std::uint32_t kPrebuiltImageHeaderWordCount = 12u;
+
+int ClassReceiver(const char *class_name) {
+  objc3_runtime_realized_class_entry_snapshot entry{};
+  (void)objc3_runtime_copy_realized_class_entry_for_testing(class_name, &entry);
+  return entry.found != 0 ? static_cast<int>(entry.base_identity + 2u) : 0;
+}
+
+int SendFixtureSelector() {
+  return objc3_runtime_dispatch_i32(
+      ClassReceiver(OBJC3_PREBUILT_IMAGE_FIXTURE_CLASS_NAME),
+      OBJC3_PREBUILT_IMAGE_FIXTURE_CLASS_SELECTOR, 0, 0, 0, 0);
+}
+
+struct RegistrationShape {
+  std::uint64_t selector_table_entry_count = 0;
+  std::uint64_t metadata_backed_selector_count = 0;
+  std::uint64_t realized_class_count = 0;
+  std::uint64_t receiver_binding_count = 0;
+  int class_result = 0;
+};
+
+RegistrationShape CaptureShape() {
+  RegistrationShape shape;
+  objc3_runtime_selector_lookup_table_state_snapshot table{};
+  objc3_runtime_realized_class_graph_state_snapshot graph{};
+  (void)objc3_runtime_copy_selector_lookup_table_state_for_testing(&table);
+  (void)objc3_runtime_copy_realized_class_graph_state_for_testing(&graph);
+  shape.selector_table_entry_count = table.selector_table_entry_count;
+  shape.metadata_backed_selector_count = table.metadata_backed_selector_count;
+  shape.realized_class_count = graph.realized_class_count;
+  shape.receiver_binding_count = graph.receiver_class_binding_count;
+  shape.class_result = SendFixtureSelector();
+  return shape;
+}
+
+// One cold re-registration of the linked image from the retained bootstrap
+// catalog. A dynamic selector interned after the reset leaves the selector
+// table non-empty, which is the one state where the runtime must walk the
+// selector pool even though the image carries a prebuilt table.
+double TimeColdReplay(bool force_walk, int &status) {
+  objc3_runtime_reset_for_testing();
+  if (force_walk) {
+    (void)objc3_runtime_lookup_selector(kDynamicSelector);
+  }
+  const auto started = std::chrono::steady_clock::now();
+  status = objc3_runtime_replay_registered_images_for_testing();
+  return std::chrono::duration<double, std::micro>(
+             std::chrono::steady_clock::now() - started)
+      .count();
+}
+
+// A one-selector image registered by hand, so a prebuilt blob can be placed
+// in a file mapping the runtime has never seen and a mismatched blob can be
+// staged on purpose.
+template <std::size_t EntryCount>
+struct PointerAggregateStorage {
+  std::uint64_t count;
+  const void *entries[EntryCount];
+};
+
+constexpr char kManualModuleName[] = "prebuilt_image_probe-manual-image";
+constexpr char kManualIdentityKey[] = "prebuilt_image_probe::manual-image";
+constexpr char kManualSelector[] = "prebuiltImageProbeManualValue";
+
+const objc3_runtime_image_descriptor kManualImageDescriptor{
+    kManualModuleName, kManualIdentityKey, 1, 0, 0, 0, 0, 0};
+const PointerAggregateStorage<1> kManualEmptyRootStorage = {0, {nullptr}};
+const PointerAggregateStorage<1> kManualSelectorPoolRootStorage = {
+    1, {kManualSelector}};
+const PointerAggregateStorage<6> kManualDiscoveryRootStorage = {
+    6,
+    {&kManualEmptyRootStorage, &kManualEmptyRootStorage,
+     &kManualEmptyRootStorage, &kManualEmptyRootStorage,
+     &kManualEmptyRootStorage, &kManualSelectorPoolRootStorage}};
+
+const objc3_runtime_pointer_aggregate *AsAggregate(const void *storage) {
+  return reinterpret_cast<const objc3_runtime_pointer_aggregate *>(storage);
+}
+
+const void *kManualDiscoveryRootAnchor = &kManualDiscoveryRootStorage;
+unsigned char kManualImageLocalInitState = 0;
+const objc3_runtime_registration_table kManualRegistrationTable = {
+    2,
+    12,
+    &kManualImageDescriptor,
+    AsAggregate(&kManualDiscoveryRootStorage),
+    &kManualDiscoveryRootAnchor,
+    AsAggregate(&kManualEmptyRootStorage),
+    AsAggregate(&kManualEmptyRootStorage),
+    AsAggregate(&kManualEmptyRootStorage),
+    AsAggregate(&kManualEmptyRootStorage),
+    AsAggregate(&kManualEmptyRootStorage),
+    AsAggregate(&kManualSelectorPoolRootStorage),
+    nullptr,
+    nullptr,
+    &kManualImageLocalInitState};
+
+// One group, two buckets: the lone selector sits in the bucket its seeded
+// FNV-1a hash selects with displacement zero.
+std::vector<std::uint32_t> BuildManualPrebuiltImage(std::uint32_t version) {
+  std::uint64_t hash = 14695981039346656037ull;
+  for (const char *cursor = kManualSelector; *cursor != '\0'; ++cursor) {
+    hash ^= static_cast<unsigned char>(*cursor);
+    hash *= 1099511628211ull;
+  }
+  std::vector<std::uint32_t> words = {
+      kPrebuiltImageMagic, version, kPrebuiltImageHeaderWordCount + 3u, 1u, 0u,
+      0u, 0u, 1u, 2u, kPrebuiltImageHeaderWordCount,
+      kPrebuiltImageHeaderWordCount + 1u, kPrebuiltImageHeaderWordCount + 3u,
+      0u, 0u, 0u};
+  words[kPrebuiltImageHeaderWordCount + 1u + (static_cast<std::uint32_t>(hash) & 1u)] =
+      1u;
+  return words;
+}
+
+// Copies the blob into a temporary file and maps it read-only, so the
+// runtime adopts words it can only have reached through mmap.
+const std::uint32_t *MapPrebuiltImage(const std::vector<std::uint32_t> &words,
+                                      std::size_t &byte_count) {
+  byte_count = words.size() * sizeof(std::uint32_t);
+  char path[] = "/tmp/objc3_prebuilt_image_probe_XXXXXX";
+  const int fd = mkstemp(path);
+  if (fd < 0) {
+    return nullptr;
+  }
+  unlink(path);
+  const bool written =
+      write(fd, words.data(), byte_count) == static_cast<ssize_t>(byte_count);
+  void *mapping =
+      written ? mmap(nullptr, byte_count, PROT_READ, MAP_PRIVATE, fd, 0)
+              : MAP_FAILED;
+  close(fd);
+  return mapping == MAP_FAILED ? nullptr
+                               : static_cast<const std::uint32_t *>(mapping);
+}
+
+int RegisterManualImage(const std::uint32_t *image, std::size_t byte_count,
+                        objc3_runtime_prebuilt_image_state_snapshot &state) {
+  objc3_runtime_reset_for_testing();
+  kManualImageLocalInitState = 0;
+  objc3_runtime_stage_prebuilt_image_for_bootstrap(image, byte_count);
+  objc3_runtime_stage_registration_table_for_bootstrap(&kManualRegistrationTable);
+  const int status = objc3_runtime_register_image(&kManualImageDescriptor);
+  (void)objc3_runtime_copy_prebuilt_image_state_for_testing(&state);
+  return status;
+}
+
+}  // namespace
+
+int main() {
+  // The linked fixture's constructor already registered its image.
+  objc3_runtime_prebuilt_image_state_snapshot startup{};
+  objc3_runtime_image_walk_state_snapshot startup_walk{};
+  (void)objc3_runtime_copy_prebuilt_image_state_for_testing(&startup);
+  (void)objc3_runtime_copy_image_walk_state_for_testing(&startup_walk);
+  objc3_runtime_selector_lookup_table_state_snapshot startup_table{};
+  (void)objc3_runtime_copy_selector_lookup_table_state_for_testing(
+      &startup_table);
+  const std::string last_pool_selector =
+      startup_table.last_materialized_selector != nullptr
+          ? startup_table.last_materialized_selector
+          : "";
+  objc3_runtime_selector_lookup_entry_snapshot last_pool_entry{};
+  (void)objc3_runtime_copy_selector_lookup_entry_for_testing(
+      last_pool_selector.c_str(), &last_pool_entry);
+  const RegistrationShape startup_shape = CaptureShape();
+  const objc3_runtime_selector_handle *dynamic_handle =
+      objc3_runtime_lookup_selector(kDynamicSelector);
+  const std::uint64_t dynamic_stable_id =
+      dynamic_handle != nullptr ? dynamic_handle->stable_id : 0;
+
+  // Alternate the two paths so drift in machine load hits both equally.
+  double adopted_total_us = 0.0;
+  double walked_total_us = 0.0;
+  double adopted_best_us = 0.0;
+  double walked_best_us = 0.0;
+  bool replays_ok = true;
+  for (int cycle = 0; cycle < kColdRegistrationCycles; ++cycle) {
+    int status = 0;
+    const double adopted_us = TimeColdReplay(false, status);
+    replays_ok = replays_ok && status == OBJC3_RUNTIME_REGISTRATION_STATUS_OK;
+    const double walked_us = TimeColdReplay(true, status);
+    replays_ok = replays_ok && status == OBJC3_RUNTIME_REGISTRATION_STATUS_OK;
+    adopted_total_us += adopted_us;
+    walked_total_us += walked_us;
+    if (cycle == 0 || adopted_us < adopted_best_us) {
+      adopted_best_us = adopted_us;
+    }
+    if (cycle == 0 || walked_us < walked_best_us) {
+      walked_best_us = walked_us;
+    }
+  }
+  objc3_runtime_prebuilt_image_state_snapshot walked{};
+  (void)objc3_runtime_copy_prebuilt_image_state_for_testing(&walked);
+  const RegistrationShape walked_shape = CaptureShape();
+  int status = 0;
+  (void)TimeColdReplay(false, status);
+  objc3_runtime_prebuilt_image_state_snapshot adopted{};
+  (void)objc3_runtime_copy_prebuilt_image_state_for_testing(&adopted);
+  const RegistrationShape adopted_shape = CaptureShape();
+
+  // A version the runtime does not know falls back to the walk; the same
+  // image with the current version adopts from a read-only file mapping.
+  std::size_t mismatched_bytes = 0;
+  const std::uint32_t *mismatched_image = MapPrebuiltImage(
+      BuildManualPrebuiltImage(kPrebuiltImageVersion + 1u), mismatched_bytes);
+  objc3_runtime_prebuilt_image_state_snapshot mismatched{};
+  const int mismatched_status =
+      RegisterManualImage(mismatched_image, mismatched_bytes, mismatched);
+  objc3_runtime_selector_lookup_entry_snapshot mismatched_entry{};
+  (void)objc3_runtime_copy_selector_lookup_entry_for_testing(kManualSelector,
+                                                             &mismatched_entry);
+  std::size_t mapped_bytes = 0;
+  const std::uint32_t *mapped_image = MapPrebuiltImage(
+      BuildManualPrebuiltImage(kPrebuiltImageVersion), mapped_bytes);
+  objc3_runtime_prebuilt_image_state_snapshot mapped{};
+  const int mapped_status =
+      RegisterManualImage(mapped_image, mapped_bytes, mapped);
+  const objc3_runtime_selector_handle *mapped_handle =
+      objc3_runtime_lookup_selector(kManualSelector);
+  const bool mapped_handle_is_pool_string =
+      mapped_handle != nullptr && mapped_handle->selector == kManualSelector &&
+      mapped_handle->stable_id == 1u;
+  objc3_runtime_reset_for_testing();
+
+  const bool startup_ok =
+      startup.adopted_image_count == 1 && startup.fallback_image_count == 0 &&
+      startup.last_status == 1 &&
+      startup.adopted_selector_table_size ==
+          startup_walk.last_walked_selector_pool_count &&
+      startup.prebuilt_class_ordinal_image_count == 1 &&
+      last_pool_entry.found == 1 && last_pool_entry.metadata_backed == 1 &&
+      last_pool_entry.stable_id == startup_walk.last_walked_selector_pool_count &&
+      last_pool_entry.first_selector_pool_index ==
+          startup_walk.last_walked_selector_pool_count &&
+      startup_shape.class_result == OBJC3_PREBUILT_IMAGE_FIXTURE_CLASS_RESULT &&
+      dynamic_stable_id == startup_walk.last_walked_selector_pool_count + 1u;
+  const bool paths_agree =
+      replays_ok && walked.last_status == 4 &&
+      walked.fallback_image_count == 1 && adopted.last_status == 1 &&
+      adopted.adopted_image_count == 1 &&
+      walked_shape.metadata_backed_selector_count ==
+          adopted_shape.metadata_backed_selector_count &&
+      walked_shape.selector_table_entry_count ==
+          adopted_shape.selector_table_entry_count + 1u &&
+      walked_shape.realized_class_count == adopted_shape.realized_class_count &&
+      walked_shape.receiver_binding_count ==
+          adopted_shape.receiver_binding_count &&
+      walked_shape.class_result == OBJC3_PREBUILT_IMAGE_FIXTURE_CLASS_RESULT &&
+      adopted_shape.class_result == OBJC3_PREBUILT_IMAGE_FIXTURE_CLASS_RESULT;
+  const bool fallback_ok =
+      mismatched_image != nullptr &&
+      mismatched_status == OBJC3_RUNTIME_REGISTRATION_STATUS_OK &&
+      mismatched.last_status == 2 && mismatched.fallback_image_count == 1 &&
+      mismatched.adopted_image_count == 0 && mismatched_entry.found == 1 &&
+      mismatched_entry.stable_id == 1u;
+  const bool mapped_ok =
+      mapped_image != nullptr &&
+      mapped_status == OBJC3_RUNTIME_REGISTRATION_STATUS_OK &&
+      mapped.last_status == 1 && mapped.adopted_image_count == 1 &&
+      mapped.last_image_byte_count == mapped_bytes &&
+      mapped_handle_is_pool_string;
+
+  std::printf("{\"startup_adopted_image_count\":%llu",
+              static_cast<unsigned long long>(startup.adopted_image_count));
+  std::printf(",\"startup_adopted_selector_count\":%llu",
+              static_cast<unsigned long long>(startup.adopted_selector_table_size));
+  std::printf(",\"startup_image_byte_count\":%llu",
+              static_cast<unsigned long long>(startup.last_image_byte_count));
+  std::printf(",\"realized_class_count\":%llu",
+              static_cast<unsigned long long>(adopted_shape.realized_class_count));
+  std::printf(",\"class_result\":%d", adopted_shape.class_result);
+  std::printf(",\"cold_registration_cycles\":%d", kColdRegistrationCycles);
+  std::printf(",\"adopted_mean_us\":%.3f",
+              adopted_total_us / kColdRegistrationCycles);
+  std::printf(",\"walked_mean_us\":%.3f",
+              walked_total_us / kColdRegistrationCycles);
+  std::printf(",\"adopted_best_us\":%.3f", adopted_best_us);
+  std::printf(",\"walked_best_us\":%.3f", walked_best_us);
+  std::printf(",\"walked_to_adopted_ratio\":%.3f",
+              adopted_total_us > 0.0 ? walked_total_us / adopted_total_us : 0.0);
+  std::printf(",\"walked_last_status\":%d", walked.last_status);
+  std::printf(",\"mismatched_last_status\":%d", mismatched.last_status);
+  std::printf(",\"mapped_last_status\":%d", mapped.last_status);
+  std::printf(",\"startup_ok\":%d", startup_ok ? 1 : 0);
+  std::printf(",\"paths_agree\":%d", paths_agree ? 1 : 0);
+  std::printf(",\"fallback_ok\":%d", fallback_ok ? 1 : 0);
+  std::printf(",\"mapped_ok\":%d", mapped_ok ? 1 : 0);
+  std::printf("}\n");
+  return startup_ok && paths_agree && fallback_ok && mapped_ok ? 0 : 1;
+}
@@ -0,0 +1,184 @@
+#include "runtime/objc3_runtime.h"
+#include "runtime/objc3_runtime_bootstrap_internal.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+namespace {
+
+// Links against the canonical runnable sample set: Widget adopts Worker
+// directly and Tracer (which inherits Worker) through its Tracing category;
+// its superclass Base adopts nothing.
+constexpr int kQueryCount = 100000;
+constexpr int kCastCheckCount = 1000000;
+
+using Clock = std::chrono::steady_clock;
+
+double ElapsedMs(Clock::time_point started) {
+  return std::chrono::duration<double, std::milli>(Clock::now() - started)
+      .count();
+}
+
+double PerSecond(std::uint64_t count, double elapsed_ms) {
+  return elapsed_ms > 0.0 ? static_cast<double>(count) * 1000.0 / elapsed_ms
+                          : 0.0;
+}
+
+bool Equals(const char *text, const char *expected) {
+  return text != nullptr && std::strcmp(text, expected) == 0;
+}
+
+objc3_runtime_realized_class_graph_state_snapshot CopyGraphState() {
+  objc3_runtime_realized_class_graph_state_snapshot snapshot{};
+  (void)objc3_runtime_copy_realized_class_graph_state_for_testing(&snapshot);
+  return snapshot;
+}
+
+int ClassReceiver(const char *class_name) {
+  objc3_runtime_realized_class_entry_snapshot entry{};
+  (void)objc3_runtime_copy_realized_class_entry_for_testing(class_name, &entry);
+  return entry.found != 0 ? static_cast<int>(entry.base_identity + 2u) : 0;
+}
+
+objc3_runtime_protocol_conformance_query_snapshot Query(
+    const char *class_name, const char *protocol_name) {
+  objc3_runtime_protocol_conformance_query_snapshot snapshot{};
+  (void)objc3_runtime_copy_protocol_conformance_query_for_testing(
+      class_name, protocol_name, &snapshot);
+  return snapshot;
+}
+
+}  // namespace
+
+int main() {
+  const std::uint64_t builds_before = CopyGraphState()
+                                          .conformance_bitset_build_count;
+
+  // Reflection queries: the first query per class builds its closure; every
+  // later one is a bit test plus, on a hit, a scan for the walk position.
+  int query_failures = 0;
+  const Clock::time_point query_started = Clock::now();
+  for (int index = 0; index < kQueryCount; ++index) {
+    const objc3_runtime_protocol_conformance_query_snapshot worker =
+        Query("Widget", "Worker");
+    const objc3_runtime_protocol_conformance_query_snapshot tracer =
+        Query("Widget", "Tracer");
+    const objc3_runtime_protocol_conformance_query_snapshot base =
+        Query("Base", "Worker");
+    const objc3_runtime_protocol_conformance_query_snapshot missing =
+        Query("Widget", "NoSuchProtocol");
+    query_failures += worker.conforms == 1 && tracer.conforms == 1 &&
+                              base.conforms == 0 && missing.conforms == 0
+                          ? 0
+                          : 1;
+  }
+  const double query_ms = ElapsedMs(query_started);
+  const std::uint64_t query_build_count =
+      CopyGraphState().conformance_bitset_build_count - builds_before;
+
+  // Visit counts and owners match what the name walk reported: Worker is
+  // the first protocol reached, Tracer the second, through the category; a
+  // class-record adoption leaves the attachment owner unset.
+  const objc3_runtime_protocol_conformance_query_snapshot worker =
+      Query("Widget", "Worker");
+  const std::uint64_t worker_visited = worker.visited_protocol_count;
+  const bool worker_owner_ok =
+      Equals(worker.matched_protocol_owner_identity, "protocol:Worker") &&
+      worker.matched_attachment_owner_identity == nullptr;
+  const objc3_runtime_protocol_conformance_query_snapshot tracer =
+      Query("Widget", "Tracer");
+  const std::uint64_t tracer_visited = tracer.visited_protocol_count;
+  const bool tracer_owner_ok =
+      Equals(tracer.matched_protocol_owner_identity, "protocol:Tracer") &&
+      Equals(tracer.matched_attachment_owner_identity,
+             "category:Widget(Tracing)");
+  const std::uint64_t missing_visited =
+      Query("Widget", "NoSuchProtocol").visited_protocol_count;
+  const std::uint64_t base_visited =
+      Query("Base", "Worker").visited_protocol_count;
+
+  // `id<Proto>` checks on live receivers: one bit test per check.
+  const int widget_class = ClassReceiver("Widget");
+  const int base_class = ClassReceiver("Base");
+  const int widget =
+      objc3_runtime_dispatch_i32(widget_class, "alloc", 0, 0, 0, 0);
+  const std::uint64_t tests_before =
+      CopyGraphState().conformance_bitset_test_count;
+  int cast_conforming_count = 0;
+  const Clock::time_point cast_started = Clock::now();
+  for (int index = 0; index < kCastCheckCount; ++index) {
+    cast_conforming_count +=
+        objc3_runtime_receiver_conforms_to_protocol_i32(widget, "Tracer");
+  }
+  const double cast_ms = ElapsedMs(cast_started);
+  const std::uint64_t cast_test_count =
+      CopyGraphState().conformance_bitset_test_count - tests_before;
+  const int class_conforms =
+      objc3_runtime_receiver_conforms_to_protocol_i32(widget_class, "Worker");
+  const int base_conforms =
+      objc3_runtime_receiver_conforms_to_protocol_i32(base_class, "Worker");
+  const int invalid_conforms =
+      objc3_runtime_receiver_conforms_to_protocol_i32(0, "Worker");
+  (void)objc3_runtime_release_i32(widget);
+  const int released_conforms =
+      objc3_runtime_receiver_conforms_to_protocol_i32(widget, "Worker");
+
+  // Reset drops every closure; replay re-attaches categories and the next
+  // query rebuilds only the class it reaches.
+  objc3_runtime_reset_for_testing();
+  const std::uint64_t reset_build_count =
+      CopyGraphState().conformance_bitset_build_count;
+  (void)objc3_runtime_replay_registered_images_for_testing();
+  const int replayed_tracer = Query("Widget", "Tracer").conforms;
+  const std::uint64_t replayed_build_count =
+      CopyGraphState().conformance_bitset_build_count;
+
+  std::printf("{");
+  std::printf("\"query_count\":%d,", kQueryCount);
+  std::printf("\"query_ms\":%.3f,", query_ms);
+  std::printf("\"query_rounds_per_second\":%.0f,",
+              PerSecond(static_cast<std::uint64_t>(kQueryCount), query_ms));
+  std::printf("\"query_failure_count\":%d,", query_failures);
+  std::printf("\"query_build_count\":%llu,",
+              static_cast<unsigned long long>(query_build_count));
+  std::printf("\"worker_visited_protocol_count\":%llu,",
+              static_cast<unsigned long long>(worker_visited));
+  std::printf("\"tracer_visited_protocol_count\":%llu,",
+              static_cast<unsigned long long>(tracer_visited));
+  std::printf("\"missing_visited_protocol_count\":%llu,",
+              static_cast<unsigned long long>(missing_visited));
+  std::printf("\"base_visited_protocol_count\":%llu,",
+              static_cast<unsigned long long>(base_visited));
+  std::printf("\"worker_owner_ok\":%d,", worker_owner_ok ? 1 : 0);
+  std::printf("\"tracer_owner_ok\":%d,", tracer_owner_ok ? 1 : 0);
+  std::printf("\"cast_check_count\":%d,", kCastCheckCount);
+  std::printf("\"cast_ms\":%.3f,", cast_ms);
+  std::printf("\"cast_checks_per_second\":%.0f,",
+              PerSecond(static_cast<std::uint64_t>(kCastCheckCount), cast_ms));
+  std::printf("\"cast_conforming_count\":%d,", cast_conforming_count);
+  std::printf("\"cast_bitset_test_count\":%llu,",
+              static_cast<unsigned long long>(cast_test_count));
+  std::printf("\"class_conforms\":%d,", class_conforms);
+  std::printf("\"base_conforms\":%d,", base_conforms);
+  std::printf("\"invalid_conforms\":%d,", invalid_conforms);
+  std::printf("\"released_conforms\":%d,", released_conforms);
+  std::printf("\"reset_build_count\":%llu,",
+              static_cast<unsigned long long>(reset_build_count));
+  std::printf("\"replayed_tracer_conforms\":%d,", replayed_tracer);
+  std::printf("\"replayed_build_count\":%llu",
+              static_cast<unsigned long long>(replayed_build_count));
+  std::printf("}\n");
+
+  const bool ok =
+      query_failures == 0 && query_build_count == 2u &&
+      worker_visited == 1u && tracer_visited == 2u && missing_visited == 2u &&
+      base_visited == 0u && worker_owner_ok && tracer_owner_ok &&
+      widget != 0 && cast_conforming_count == kCastCheckCount &&
+      cast_test_count == static_cast<std::uint64_t>(kCastCheckCount) &&
+      class_conforms == 1 && base_conforms == 0 && invalid_conforms == 0 &&
+      released_conforms == 0 && reset_build_count == 0u &&
+      replayed_tracer == 1 && replayed_build_count == 1u;
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,162 @@
+#include "runtime/objc3_runtime.h"
+#include "runtime/objc3_runtime_bootstrap_internal.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+namespace {
+
+// Links against the weak/autoreleasepool fixture, whose Box class is the
+// image's first class and carries a strong `currentValue` property.
+constexpr int kBoxClassReceiver = 1024;
+constexpr int kAllocChurnCount = 200000;
+// Far more receivers than the per-thread dispatch hit cache holds, so each
+// send decodes its receiver handle before probing the shared method cache.
+constexpr int kSpreadInstanceCount = 4096;
+constexpr int kSpreadRoundCount = 64;
+constexpr int kHandleKindShift = 29;
+
+using Clock = std::chrono::steady_clock;
+
+double ElapsedMs(Clock::time_point started) {
+  return std::chrono::duration<double, std::milli>(Clock::now() - started)
+      .count();
+}
+
+double PerSecond(std::uint64_t count, double elapsed_ms) {
+  return elapsed_ms > 0.0 ? static_cast<double>(count) * 1000.0 / elapsed_ms
+                          : 0.0;
+}
+
+struct ValueBlockStorage {
+  int (*invoke)(void *, int, int, int, int) = nullptr;
+  int payload = 0;
+};
+
+extern "C" int ValueInvoke(void *storage, int, int, int, int) {
+  return static_cast<ValueBlockStorage *>(storage)->payload;
+}
+
+int AllocBox() {
+  return objc3_runtime_dispatch_i32(kBoxClassReceiver, "alloc", 0, 0, 0, 0);
+}
+
+int CurrentValue(int receiver) {
+  return objc3_runtime_dispatch_i32(receiver, "currentValue", 0, 0, 0, 0);
+}
+
+std::uint64_t FallbackDispatchCount() {
+  objc3_runtime_method_cache_state_snapshot snapshot{};
+  (void)objc3_runtime_copy_method_cache_state_for_testing(&snapshot);
+  return snapshot.fallback_dispatch_count;
+}
+
+int HandleKind(int handle) {
+  return static_cast<int>(static_cast<std::uint32_t>(handle) >>
+                          kHandleKindShift);
+}
+
+}  // namespace
+
+int main() {
+  // Alloc churn: every alloc and final release resolves the Box class node
+  // from the receiver's ordinal.
+  int churn_failures = 0;
+  const Clock::time_point churn_started = Clock::now();
+  for (int index = 0; index < kAllocChurnCount; ++index) {
+    const int box = AllocBox();
+    churn_failures += box != 0 ? 0 : 1;
+    (void)objc3_runtime_release_i32(box);
+  }
+  const double churn_ms = ElapsedMs(churn_started);
+
+  // Spread sends: round-robin over thousands of live instances.
+  std::vector<int> boxes(kSpreadInstanceCount, 0);
+  for (int &box : boxes) {
+    box = AllocBox();
+  }
+  const std::uint64_t fallbacks_before_spread = FallbackDispatchCount();
+  int spread_nonzero_count = 0;
+  const Clock::time_point spread_started = Clock::now();
+  for (int round = 0; round < kSpreadRoundCount; ++round) {
+    for (int box : boxes) {
+      spread_nonzero_count += CurrentValue(box) != 0 ? 1 : 0;
+    }
+  }
+  const double spread_ms = ElapsedMs(spread_started);
+  const std::uint64_t spread_fallback_count =
+      FallbackDispatchCount() - fallbacks_before_spread;
+  const std::uint64_t spread_send_count =
+      static_cast<std::uint64_t>(kSpreadInstanceCount) * kSpreadRoundCount;
+
+  // Handle kinds: instances and blocks sit under distinct tags, so a block
+  // handle never decodes as an instance receiver and a freed instance handle
+  // decodes as nothing at all.
+  ValueBlockStorage storage{&ValueInvoke, 5};
+  const int block = objc3_runtime_promote_block_i32(&storage, sizeof(storage), 0);
+  const int stale_box = AllocBox();
+  (void)objc3_runtime_release_i32(stale_box);
+  const std::uint64_t fallbacks_before_kinds = FallbackDispatchCount();
+  (void)CurrentValue(block);
+  (void)CurrentValue(stale_box);
+  const std::uint64_t kind_fallback_count =
+      FallbackDispatchCount() - fallbacks_before_kinds;
+  const int block_invoke_result =
+      objc3_runtime_invoke_block_i32(block, 0, 0, 0, 0);
+
+  objc3_runtime_realized_class_graph_state_snapshot graph{};
+  (void)objc3_runtime_copy_realized_class_graph_state_for_testing(&graph);
+  const bool allocated_box = graph.last_allocated_class_name != nullptr &&
+                             std::strcmp(graph.last_allocated_class_name,
+                                         "Box") == 0;
+
+  for (int box : boxes) {
+    (void)objc3_runtime_release_i32(box);
+  }
+  (void)objc3_runtime_release_i32(block);
+  objc3_runtime_memory_management_state_snapshot memory{};
+  (void)objc3_runtime_copy_memory_management_state_for_testing(&memory);
+
+  std::printf("{");
+  std::printf("\"alloc_churn_count\":%d,", kAllocChurnCount);
+  std::printf("\"alloc_churn_ms\":%.3f,", churn_ms);
+  std::printf("\"alloc_release_pairs_per_second\":%.0f,",
+              PerSecond(static_cast<std::uint64_t>(kAllocChurnCount),
+                        churn_ms));
+  std::printf("\"churn_failure_count\":%d,", churn_failures);
+  std::printf("\"spread_instance_count\":%d,", kSpreadInstanceCount);
+  std::printf("\"spread_send_count\":%llu,",
+              static_cast<unsigned long long>(spread_send_count));
+  std::printf("\"spread_ms\":%.3f,", spread_ms);
+  std::printf("\"spread_sends_per_second\":%.0f,",
+              PerSecond(spread_send_count, spread_ms));
+  std::printf("\"spread_nonzero_count\":%d,", spread_nonzero_count);
+  std::printf("\"spread_fallback_count\":%llu,",
+              static_cast<unsigned long long>(spread_fallback_count));
+  std::printf("\"instance_handle_kind\":%d,", HandleKind(boxes.front()));
+  std::printf("\"block_handle_kind\":%d,", HandleKind(block));
+  std::printf("\"class_handle_kind\":%d,", HandleKind(kBoxClassReceiver));
+  std::printf("\"kind_fallback_count\":%llu,",
+              static_cast<unsigned long long>(kind_fallback_count));
+  std::printf("\"block_invoke_result\":%d,", block_invoke_result);
+  std::printf("\"receiver_class_binding_count\":%llu,",
+              static_cast<unsigned long long>(
+                  graph.receiver_class_binding_count));
+  std::printf("\"allocated_box\":%d,", allocated_box ? 1 : 0);
+  std::printf("\"live_instance_count\":%llu",
+              static_cast<unsigned long long>(
+                  memory.live_runtime_instance_count));
+  std::printf("}\n");
+
+  const bool ok = churn_failures == 0 && spread_nonzero_count == 0 &&
+                  spread_fallback_count == 0u &&
+                  HandleKind(boxes.front()) >= 2 && HandleKind(block) == 1 &&
+                  HandleKind(kBoxClassReceiver) == 0 &&
+                  kind_fallback_count == 2u && block_invoke_result == 5 &&
+                  graph.receiver_class_binding_count > 0u && allocated_box &&
+                  memory.live_runtime_instance_count == 0u;
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,146 @@
+#include "runtime/objc3_runtime.h"
+#include "runtime/objc3_runtime_bootstrap_internal.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+namespace {
+
+// Links against the weak/autoreleasepool fixture, whose Box class is the
+// image's first class and carries a strong `currentValue` property.
+constexpr int kBoxClassReceiver = 1024;
+// Deep enough that a recursive dealloc cascade would exhaust the stack.
+constexpr int kChainLength = 1000000;
+constexpr int kPoolObjectCount = 100000;
+constexpr int kPoolDuplicateCount = 4;
+
+using Clock = std::chrono::steady_clock;
+
+double ElapsedMs(Clock::time_point started) {
+  return std::chrono::duration<double, std::milli>(Clock::now() - started)
+      .count();
+}
+
+double PerSecond(std::uint64_t count, double elapsed_ms) {
+  return elapsed_ms > 0.0 ? static_cast<double>(count) * 1000.0 / elapsed_ms
+                          : 0.0;
+}
+
+int AllocBox() {
+  return objc3_runtime_dispatch_i32(kBoxClassReceiver, "alloc", 0, 0, 0, 0);
+}
+
+void SetStrong(int owner, int value) {
+  (void)objc3_runtime_dispatch_i32(owner, "setCurrentValue:", value, 0, 0, 0);
+}
+
+objc3_runtime_release_batch_state_snapshot CopyBatchState() {
+  objc3_runtime_release_batch_state_snapshot snapshot{};
+  (void)objc3_runtime_copy_release_batch_state_for_testing(&snapshot);
+  return snapshot;
+}
+
+std::uint64_t LiveInstanceCount() {
+  objc3_runtime_memory_management_state_snapshot snapshot{};
+  (void)objc3_runtime_copy_memory_management_state_for_testing(&snapshot);
+  return snapshot.live_runtime_instance_count;
+}
+
+}  // namespace
+
+int main() {
+  // Chain teardown: each box strongly owns the previous one, so releasing the
+  // head frees the whole chain through one cascade.
+  int head = 0;
+  for (int index = 0; index < kChainLength; ++index) {
+    const int box = AllocBox();
+    if (head != 0) {
+      SetStrong(box, head);
+      (void)objc3_runtime_release_i32(head);
+    }
+    head = box;
+  }
+  const std::uint64_t chain_live_count = LiveInstanceCount();
+  const objc3_runtime_release_batch_state_snapshot before_chain =
+      CopyBatchState();
+  const Clock::time_point chain_started = Clock::now();
+  (void)objc3_runtime_release_i32(head);
+  const double chain_teardown_ms = ElapsedMs(chain_started);
+  const objc3_runtime_release_batch_state_snapshot after_chain =
+      CopyBatchState();
+  const std::uint64_t live_after_chain = LiveInstanceCount();
+
+  // Pool drain: every box is autoreleased several times, so the drain batch
+  // coalesces each box's entries into one decrement that frees it.
+  std::vector<int> boxes(kPoolObjectCount, 0);
+  for (int &box : boxes) {
+    box = AllocBox();
+    for (int copy = 1; copy < kPoolDuplicateCount; ++copy) {
+      (void)objc3_runtime_retain_i32(box);
+    }
+  }
+  objc3_runtime_push_autoreleasepool_scope();
+  for (int copy = 0; copy < kPoolDuplicateCount; ++copy) {
+    for (int box : boxes) {
+      (void)objc3_runtime_autorelease_i32(box);
+    }
+  }
+  const objc3_runtime_release_batch_state_snapshot before_pool =
+      CopyBatchState();
+  const Clock::time_point pool_started = Clock::now();
+  objc3_runtime_pop_autoreleasepool_scope();
+  const double pool_drain_ms = ElapsedMs(pool_started);
+  const objc3_runtime_release_batch_state_snapshot after_pool =
+      CopyBatchState();
+  const std::uint64_t live_after_pool = LiveInstanceCount();
+
+  const std::uint64_t pool_value_count =
+      static_cast<std::uint64_t>(kPoolObjectCount) * kPoolDuplicateCount;
+  const std::uint64_t chain_cascade_count =
+      after_chain.cascade_release_count - before_chain.cascade_release_count;
+  const std::uint64_t pool_coalesced_count =
+      after_pool.coalesced_release_value_count -
+      before_pool.coalesced_release_value_count;
+
+  std::printf("{");
+  std::printf("\"chain_length\":%d,", kChainLength);
+  std::printf("\"chain_live_count\":%llu,",
+              static_cast<unsigned long long>(chain_live_count));
+  std::printf("\"chain_teardown_ms\":%.3f,", chain_teardown_ms);
+  std::printf("\"chain_teardown_objects_per_second\":%.0f,",
+              PerSecond(static_cast<std::uint64_t>(kChainLength),
+                        chain_teardown_ms));
+  std::printf("\"chain_cascade_release_count\":%llu,",
+              static_cast<unsigned long long>(chain_cascade_count));
+  std::printf("\"max_pending_release_count\":%llu,",
+              static_cast<unsigned long long>(
+                  after_chain.max_pending_release_count));
+  std::printf("\"live_after_chain\":%llu,",
+              static_cast<unsigned long long>(live_after_chain));
+  std::printf("\"pool_value_count\":%llu,",
+              static_cast<unsigned long long>(pool_value_count));
+  std::printf("\"pool_drain_ms\":%.3f,", pool_drain_ms);
+  std::printf("\"pool_drained_values_per_second\":%.0f,",
+              PerSecond(pool_value_count, pool_drain_ms));
+  std::printf("\"pool_batch_count\":%llu,",
+              static_cast<unsigned long long>(after_pool.release_batch_count -
+                                              before_pool.release_batch_count));
+  std::printf("\"pool_coalesced_value_count\":%llu,",
+              static_cast<unsigned long long>(pool_coalesced_count));
+  std::printf("\"pending_release_count\":%llu,",
+              static_cast<unsigned long long>(after_pool.pending_release_count));
+  std::printf("\"live_after_pool\":%llu", static_cast<unsigned long long>(
+                                             live_after_pool));
+  std::printf("}\n");
+
+  const bool ok =
+      chain_live_count == static_cast<std::uint64_t>(kChainLength) &&
+      chain_cascade_count == static_cast<std::uint64_t>(kChainLength - 1) &&
+      after_chain.max_pending_release_count == 1u && live_after_chain == 0u &&
+      after_pool.release_batch_count - before_pool.release_batch_count == 1u &&
+      pool_coalesced_count == pool_value_count - kPoolObjectCount &&
+      after_pool.pending_release_count == 0u && live_after_pool == 0u;
+  return ok ? 0 : 1;
+}
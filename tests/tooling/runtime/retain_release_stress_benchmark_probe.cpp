@@ -0,0 +1,211 @@
+#include "runtime/objc3_runtime.h"
+#include "runtime/objc3_runtime_bootstrap_internal.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr int kClassReceiver = 1024;
+constexpr int kPairsPerThread = 200000;
+constexpr int kThreadCounts[] = {1, 2, 4, 8};
+constexpr const char *kClassName = "RetainObject";
+constexpr const char *kImplementationIdentity = "implementation:RetainObject";
+constexpr const char *kClassIdentity = "class:RetainObject";
+constexpr const char *kMetaclassIdentity = "metaclass:RetainObject";
+
+// Mirror the emitted class-bundle and registration-table layouts for one
+// image holding a single root class with no methods.
+struct SyntheticClassRecord {
+  const char *class_name;
+  const char *bundle_owner_identity;
+  const char *object_owner_identity;
+  const char *super_owner_identity;
+  const void *super_bundle;
+  const void *method_list_ref;
+  const objc3_runtime_pointer_aggregate *adopted_protocol_refs;
+  bool objc_final_declared;
+  bool objc_sealed_declared;
+};
+
+struct SyntheticClassBundle {
+  SyntheticClassRecord class_record;
+  SyntheticClassRecord metaclass_record;
+};
+
+template <std::size_t EntryCount>
+struct PointerAggregateStorage {
+  std::uint64_t count;
+  const void *entries[EntryCount];
+};
+
+const objc3_runtime_pointer_aggregate *AsAggregate(const void *storage) {
+  return static_cast<const objc3_runtime_pointer_aggregate *>(storage);
+}
+
+SyntheticClassBundle g_bundle{
+    {kClassName, kImplementationIdentity, kClassIdentity, nullptr, nullptr,
+     nullptr, nullptr, false, false},
+    {kClassName, kImplementationIdentity, kMetaclassIdentity, nullptr, nullptr,
+     nullptr, nullptr, false, false}};
+PointerAggregateStorage<1> g_class_root{1, {&g_bundle}};
+PointerAggregateStorage<1> g_empty_root{0, {nullptr}};
+PointerAggregateStorage<6> g_discovery_root{
+    6,
+    {&g_class_root, &g_empty_root, &g_empty_root, &g_empty_root, &g_empty_root,
+     &g_empty_root}};
+const void *g_linker_anchor = &g_discovery_root;
+unsigned char g_image_local_init_state = 0;
+objc3_runtime_image_descriptor g_descriptor{
+    "retain-release", "retain-release::image", 1, 1, 0, 0, 0, 0};
+objc3_runtime_registration_table g_table{
+    2,
+    12,
+    &g_descriptor,
+    AsAggregate(&g_discovery_root),
+    &g_linker_anchor,
+    AsAggregate(&g_class_root),
+    AsAggregate(&g_empty_root),
+    AsAggregate(&g_empty_root),
+    AsAggregate(&g_empty_root),
+    AsAggregate(&g_empty_root),
+    AsAggregate(&g_empty_root),
+    nullptr,
+    nullptr,
+    &g_image_local_init_state};
+
+int Alloc() { return objc3_runtime_dispatch_i32(kClassReceiver, "alloc", 0, 0, 0, 0); }
+
+std::uint64_t LiveInstanceCount() {
+  objc3_runtime_instance_slab_state_snapshot snapshot{};
+  (void)objc3_runtime_copy_instance_slab_state_for_testing(&snapshot);
+  return snapshot.live_instance_count;
+}
+
+struct StressSample {
+  int thread_count = 0;
+  double shared_pairs_per_second = 0.0;
+  double private_pairs_per_second = 0.0;
+};
+
+// Every thread retains and releases |receivers[thread % receivers.size()]|, so
+// one receiver measures a contended count and one per thread measures the
+// uncontended fast path.
+double TimePairs(int thread_count, const std::vector<int> &receivers) {
+  std::atomic<int> ready{0};
+  std::atomic<bool> go{false};
+  std::vector<std::thread> threads;
+  threads.reserve(static_cast<std::size_t>(thread_count));
+  for (int thread_index = 0; thread_index < thread_count; ++thread_index) {
+    threads.emplace_back([&, thread_index]() {
+      const int receiver =
+          receivers[static_cast<std::size_t>(thread_index) % receivers.size()];
+      ready.fetch_add(1);
+      while (!go.load(std::memory_order_acquire)) {
+        std::this_thread::yield();
+      }
+      for (int pair = 0; pair < kPairsPerThread; ++pair) {
+        (void)objc3_runtime_retain_i32(receiver);
+        (void)objc3_runtime_release_i32(receiver);
+      }
+    });
+  }
+  while (ready.load() != thread_count) {
+    std::this_thread::yield();
+  }
+  const auto started = std::chrono::steady_clock::now();
+  go.store(true, std::memory_order_release);
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+  const auto finished = std::chrono::steady_clock::now();
+  const double elapsed_ms =
+      std::chrono::duration<double, std::milli>(finished - started).count();
+  return elapsed_ms > 0.0 ? static_cast<double>(thread_count) *
+                                kPairsPerThread * 1000.0 / elapsed_ms
+                          : 0.0;
+}
+
+}  // namespace
+
+int main() {
+  objc3_runtime_reset_for_testing();
+  objc3_runtime_stage_registration_table_for_bootstrap(&g_table);
+  const int registration_status = objc3_runtime_register_image(&g_descriptor);
+
+  const int shared = Alloc();
+  std::vector<int> private_receivers;
+  for (int index = 0; index < 8; ++index) {
+    private_receivers.push_back(Alloc());
+  }
+  const std::uint64_t live_before = LiveInstanceCount();
+
+  std::vector<StressSample> samples;
+  for (int thread_count : kThreadCounts) {
+    StressSample sample;
+    sample.thread_count = thread_count;
+    sample.shared_pairs_per_second = TimePairs(thread_count, {shared});
+    sample.private_pairs_per_second = TimePairs(thread_count, private_receivers);
+    samples.push_back(sample);
+  }
+  const std::uint64_t live_after_stress = LiveInstanceCount();
+
+  // Balanced traffic must leave every count at one: a single release now
+  // destroys each instance, and a second release of the dead handle is ignored.
+  (void)objc3_runtime_release_i32(shared);
+  const std::uint64_t live_after_final_release = LiveInstanceCount();
+  (void)objc3_runtime_release_i32(shared);
+  const std::uint64_t live_after_stale_release = LiveInstanceCount();
+  for (int receiver : private_receivers) {
+    (void)objc3_runtime_release_i32(receiver);
+  }
+  const std::uint64_t live_after_cleanup = LiveInstanceCount();
+
+  double single_thread_shared = 0.0;
+  double single_thread_private = 0.0;
+  double peak_private = 0.0;
+  std::printf("{\"samples\":[");
+  for (std::size_t index = 0; index < samples.size(); ++index) {
+    const StressSample &sample = samples[index];
+    if (sample.thread_count == 1) {
+      single_thread_shared = sample.shared_pairs_per_second;
+      single_thread_private = sample.private_pairs_per_second;
+    }
+    if (sample.private_pairs_per_second > peak_private) {
+      peak_private = sample.private_pairs_per_second;
+    }
+    std::printf("%s{\"thread_count\":%d,\"shared_pairs_per_second\":%.0f,"
+                "\"private_pairs_per_second\":%.0f}",
+                index == 0 ? "" : ",", sample.thread_count,
+                sample.shared_pairs_per_second, sample.private_pairs_per_second);
+  }
+  std::printf("]");
+  std::printf(",\"registration_status\":%d", registration_status);
+  std::printf(",\"pairs_per_thread\":%d", kPairsPerThread);
+  std::printf(",\"single_thread_shared_pairs_per_second\":%.0f",
+              single_thread_shared);
+  std::printf(",\"private_peak_scaling_ratio\":%.3f",
+              single_thread_private > 0.0 ? peak_private / single_thread_private
+                                          : 0.0);
+  std::printf(",\"live_before\":%llu",
+              static_cast<unsigned long long>(live_before));
+  std::printf(",\"live_after_stress\":%llu",
+              static_cast<unsigned long long>(live_after_stress));
+  std::printf(",\"live_after_final_release\":%llu",
+              static_cast<unsigned long long>(live_after_final_release));
+  std::printf(",\"live_after_stale_release\":%llu",
+              static_cast<unsigned long long>(live_after_stale_release));
+  std::printf(",\"live_after_cleanup\":%llu",
+              static_cast<unsigned long long>(live_after_cleanup));
+  std::printf("}\n");
+
+  const bool ok = registration_status == OBJC3_RUNTIME_REGISTRATION_STATUS_OK &&
+                  shared != 0 && live_before == 9 && live_after_stress == 9 &&
+                  live_after_final_release == 8 &&
+                  live_after_stale_release == 8 && live_after_cleanup == 0;
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,220 @@
+#include "runtime/objc3_runtime.h"
+#include "runtime/objc3_runtime_bootstrap_internal.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+namespace {
+
+// Static receivers decode without a registered image, so each thread's first
+// send resolves under the mutex and every later send is a thread-cache hit
+// that falls back to the formula result. The closing nil send also resolves
+// under the mutex.
+constexpr int kReceiverIdentityBase = 1024;
+constexpr int kReceiverIdentityStride = 17;
+constexpr int kThreadCount = 4;
+constexpr int kSendsPerThread = 250000;
+constexpr int kRetainPairsPerThread = 1000;
+constexpr const char *kSelector = "metricsProbe:";
+constexpr const char *kDumpIntervalMs = "20";
+
+using Clock = std::chrono::steady_clock;
+
+// Workers whose testing snapshot disagrees with their own calls. The
+// snapshot's per-thread counts read the thread's metrics block, so a block
+// recycled from the first wave must not leak its counts into the second.
+std::atomic<int> g_thread_snapshot_mismatch_count{0};
+
+objc3_runtime_metrics_snapshot CopyMetrics() {
+  objc3_runtime_metrics_snapshot snapshot{};
+  (void)objc3_runtime_copy_metrics(&snapshot);
+  return snapshot;
+}
+
+void RunWorker(int thread_index) {
+  const int receiver =
+      kReceiverIdentityBase + thread_index * kReceiverIdentityStride + 1;
+  for (int index = 0; index < kSendsPerThread; ++index) {
+    (void)objc3_runtime_dispatch_i32(receiver, kSelector, index, 0, 0, 0);
+  }
+  (void)objc3_runtime_dispatch_i32(0, kSelector, 0, 0, 0, 0);
+  objc3_runtime_push_autoreleasepool_scope();
+  for (int index = 0; index < kRetainPairsPerThread; ++index) {
+    (void)objc3_runtime_retain_i32(receiver);
+    (void)objc3_runtime_release_i32(receiver);
+  }
+  objc3_runtime_pop_autoreleasepool_scope();
+  objc3_runtime_arc_debug_state_snapshot arc{};
+  if (objc3_runtime_copy_arc_debug_state_for_testing(&arc) != 0 ||
+      arc.retain_call_count != kRetainPairsPerThread ||
+      arc.release_call_count != kRetainPairsPerThread ||
+      arc.autoreleasepool_push_count != 1u ||
+      arc.autoreleasepool_pop_count != 1u) {
+    g_thread_snapshot_mismatch_count.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+double RunWave() {
+  const Clock::time_point started = Clock::now();
+  std::vector<std::thread> workers;
+  workers.reserve(kThreadCount);
+  for (int index = 0; index < kThreadCount; ++index) {
+    workers.emplace_back(RunWorker, index);
+  }
+  for (std::thread &worker : workers) {
+    worker.join();
+  }
+  return std::chrono::duration<double, std::milli>(Clock::now() - started)
+      .count();
+}
+
+std::uint64_t ReadDumpField(const std::string &dump, const char *field) {
+  const std::string key = std::string("\"") + field + "\":";
+  const std::size_t at = dump.find(key);
+  return at == std::string::npos
+             ? 0u
+             : std::strtoull(dump.c_str() + at + key.size(), nullptr, 10);
+}
+
+std::string ReadFile(const std::filesystem::path &path) {
+  std::ifstream input(path);
+  std::ostringstream contents;
+  contents << input.rdbuf();
+  return contents.str();
+}
+
+}  // namespace
+
+int main() {
+  // The dump thread starts with the first counter block, so the environment
+  // has to be in place before any runtime call.
+  const std::filesystem::path dump_path =
+      std::filesystem::temp_directory_path() /
+      ("objc3_runtime_metrics_" + std::to_string(getpid()) + ".json");
+  setenv("OBJC3_RUNTIME_METRICS_DUMP", dump_path.c_str(), 1);
+  setenv("OBJC3_RUNTIME_METRICS_DUMP_INTERVAL_MS", kDumpIntervalMs, 1);
+
+  const objc3_runtime_metrics_snapshot before = CopyMetrics();
+  const double first_wave_ms = RunWave();
+  const objc3_runtime_metrics_snapshot first = CopyMetrics();
+  const double second_wave_ms = RunWave();
+  const objc3_runtime_metrics_snapshot second = CopyMetrics();
+
+  const std::uint64_t wave_sends =
+      static_cast<std::uint64_t>(kThreadCount) * (kSendsPerThread + 1);
+  const std::uint64_t dispatch_count =
+      first.dispatch_count - before.dispatch_count;
+  const std::uint64_t cache_hit_count =
+      first.dispatch_cache_hit_count - before.dispatch_cache_hit_count;
+  const std::uint64_t locked_resolve_count =
+      first.dispatch_locked_resolve_count - before.dispatch_locked_resolve_count;
+  const std::uint64_t fallback_count =
+      first.fallback_dispatch_count - before.fallback_dispatch_count;
+  const std::uint64_t nil_count = first.nil_dispatch_count - before.nil_dispatch_count;
+  const std::uint64_t retain_count = first.retain_count - before.retain_count;
+  const std::uint64_t release_count = first.release_count - before.release_count;
+  const std::uint64_t pool_push_count =
+      first.autoreleasepool_push_count - before.autoreleasepool_push_count;
+  const std::uint64_t pool_pop_count =
+      first.autoreleasepool_pop_count - before.autoreleasepool_pop_count;
+  const std::uint64_t second_dispatch_count =
+      second.dispatch_count - first.dispatch_count;
+
+  // Wait for a periodic dump that has seen both waves.
+  std::string dump;
+  const Clock::time_point dump_wait_started = Clock::now();
+  while (Clock::now() - dump_wait_started < std::chrono::seconds(5)) {
+    dump = ReadFile(dump_path);
+    if (ReadDumpField(dump, "dispatch_count") >= second.dispatch_count &&
+        ReadDumpField(dump, "dump_sequence") > 0u) {
+      break;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  const std::uint64_t dump_sequence = ReadDumpField(dump, "dump_sequence");
+  const std::uint64_t dump_dispatch_count =
+      ReadDumpField(dump, "dispatch_count");
+  const std::uint64_t dump_retain_count = ReadDumpField(dump, "retain_count");
+  std::error_code ignored;
+  std::filesystem::remove(dump_path, ignored);
+
+  const double sends_per_second =
+      first_wave_ms > 0.0
+          ? static_cast<double>(wave_sends) * 1000.0 / first_wave_ms
+          : 0.0;
+
+  std::printf("{");
+  std::printf("\"thread_count\":%d,", kThreadCount);
+  std::printf("\"sends_per_thread\":%d,", kSendsPerThread);
+  std::printf("\"first_wave_ms\":%.3f,", first_wave_ms);
+  std::printf("\"second_wave_ms\":%.3f,", second_wave_ms);
+  std::printf("\"sends_per_second\":%.0f,", sends_per_second);
+  std::printf("\"dispatch_count\":%llu,",
+              static_cast<unsigned long long>(dispatch_count));
+  std::printf("\"cache_hit_count\":%llu,",
+              static_cast<unsigned long long>(cache_hit_count));
+  std::printf("\"locked_resolve_count\":%llu,",
+              static_cast<unsigned long long>(locked_resolve_count));
+  std::printf("\"fallback_count\":%llu,",
+              static_cast<unsigned long long>(fallback_count));
+  std::printf("\"nil_count\":%llu,", static_cast<unsigned long long>(nil_count));
+  std::printf("\"retain_count\":%llu,",
+              static_cast<unsigned long long>(retain_count));
+  std::printf("\"release_count\":%llu,",
+              static_cast<unsigned long long>(release_count));
+  std::printf("\"pool_push_count\":%llu,",
+              static_cast<unsigned long long>(pool_push_count));
+  std::printf("\"pool_pop_count\":%llu,",
+              static_cast<unsigned long long>(pool_pop_count));
+  std::printf("\"first_thread_block_count\":%llu,",
+              static_cast<unsigned long long>(first.thread_block_count));
+  std::printf("\"second_thread_block_count\":%llu,",
+              static_cast<unsigned long long>(second.thread_block_count));
+  std::printf("\"active_thread_block_count\":%llu,",
+              static_cast<unsigned long long>(second.active_thread_block_count));
+  std::printf("\"second_dispatch_count\":%llu,",
+              static_cast<unsigned long long>(second_dispatch_count));
+  std::printf("\"dump_sequence\":%llu,",
+              static_cast<unsigned long long>(dump_sequence));
+  std::printf("\"dump_dispatch_count\":%llu,",
+              static_cast<unsigned long long>(dump_dispatch_count));
+  std::printf("\"dump_retain_count\":%llu,",
+              static_cast<unsigned long long>(dump_retain_count));
+  std::printf("\"thread_snapshot_mismatch_count\":%d",
+              g_thread_snapshot_mismatch_count.load());
+  std::printf("}\n");
+
+  const bool ok =
+      dispatch_count == wave_sends &&
+      cache_hit_count ==
+          static_cast<std::uint64_t>(kThreadCount) * (kSendsPerThread - 1) &&
+      locked_resolve_count == static_cast<std::uint64_t>(kThreadCount) * 2u &&
+      cache_hit_count + locked_resolve_count == dispatch_count &&
+      fallback_count ==
+          static_cast<std::uint64_t>(kThreadCount) * kSendsPerThread &&
+      nil_count == static_cast<std::uint64_t>(kThreadCount) &&
+      retain_count ==
+          static_cast<std::uint64_t>(kThreadCount) * kRetainPairsPerThread &&
+      release_count == retain_count &&
+      pool_push_count == static_cast<std::uint64_t>(kThreadCount) &&
+      pool_pop_count == pool_push_count &&
+      first.thread_block_count == static_cast<std::uint64_t>(kThreadCount) &&
+      second.thread_block_count == first.thread_block_count &&
+      second.active_thread_block_count == 0u &&
+      second_dispatch_count == wave_sends && dump_sequence > 0u &&
+      dump_dispatch_count == second.dispatch_count &&
+      dump_retain_count == second.retain_count &&
+      g_thread_snapshot_mismatch_count.load() == 0;
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,164 @@
+#include "runtime/objc3_runtime.h"
+#include "runtime/objc3_runtime_bootstrap_internal.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+
+// Provided by sealed_dispatch_table_positive.objc3 compiled with
+// --objc3-sealed-dispatch-tables.
+extern "C" int sealedStepLoop(int count);
+extern "C" int canonicalStepLoop(int receiver, int count);
+extern "C" int sealedScale(int value, int factor);
+extern "C" int sealedReady(void);
+extern "C" int sealedEscape(void);
+extern "C" int sealedSelfSteps(int count);
+
+namespace {
+
+// Meter is the fixture's only class, so its class receiver is the first
+// known-class identity the emitter hands out.
+constexpr int kMeterClassReceiver = 1024;
+constexpr int kStepsPerLoop = 10000;
+constexpr int kTimedLoopCount = 200;
+
+objc3_runtime_sealed_dispatch_table_state_snapshot CopyTableState() {
+  objc3_runtime_sealed_dispatch_table_state_snapshot snapshot{};
+  (void)objc3_runtime_copy_sealed_dispatch_table_state_for_testing(&snapshot);
+  return snapshot;
+}
+
+objc3_runtime_method_cache_state_snapshot CopyMethodCacheState() {
+  objc3_runtime_method_cache_state_snapshot snapshot{};
+  (void)objc3_runtime_copy_method_cache_state_for_testing(&snapshot);
+  return snapshot;
+}
+
+struct LoopSample {
+  double sends_per_second = 0.0;
+  std::int64_t checksum = 0;
+};
+
+template <typename Loop>
+LoopSample TimeLoops(Loop loop) {
+  LoopSample sample;
+  const auto started = std::chrono::steady_clock::now();
+  for (int index = 0; index < kTimedLoopCount; ++index) {
+    sample.checksum += loop();
+  }
+  const double elapsed_ms = std::chrono::duration<double, std::milli>(
+                                std::chrono::steady_clock::now() - started)
+                                .count();
+  sample.sends_per_second =
+      elapsed_ms > 0.0 ? static_cast<double>(kTimedLoopCount) * kStepsPerLoop *
+                             1000.0 / elapsed_ms
+                       : 0.0;
+  return sample;
+}
+
+}  // namespace
+
+int main() {
+  // The first sealed send binds Meter's table; the canonical loop warms the
+  // thread hit cache so the comparison is table call versus cache hit.
+  const int first_result = sealedStepLoop(1);
+  const objc3_runtime_sealed_dispatch_table_state_snapshot after_bind =
+      CopyTableState();
+  (void)canonicalStepLoop(kMeterClassReceiver, kStepsPerLoop);
+
+  const objc3_runtime_method_cache_state_snapshot before_sealed =
+      CopyMethodCacheState();
+  const LoopSample sealed =
+      TimeLoops([]() { return sealedStepLoop(kStepsPerLoop); });
+  const objc3_runtime_method_cache_state_snapshot after_sealed =
+      CopyMethodCacheState();
+  const objc3_runtime_sealed_dispatch_table_state_snapshot after_sealed_loop =
+      CopyTableState();
+  const LoopSample canonical = TimeLoops(
+      []() { return canonicalStepLoop(kMeterClassReceiver, kStepsPerLoop); });
+
+  // Slots the table cannot call in place, dynamic selectors, and self sends
+  // inside class methods keep their canonical results.
+  const int scale_result = sealedScale(6, 7);
+  const int ready_before = sealedReady();
+  const int ready_after = sealedReady();
+  const objc3_runtime_sealed_dispatch_table_state_snapshot after_ready =
+      CopyTableState();
+  const int escape_result = sealedEscape();
+  const int self_steps_result = sealedSelfSteps(4);
+
+  // Reset retires the bound table; after replay the next send rebinds it.
+  objc3_runtime_reset_for_testing();
+  const objc3_runtime_sealed_dispatch_table_state_snapshot after_reset =
+      CopyTableState();
+  const int replay_status = objc3_runtime_replay_registered_images_for_testing();
+  const int rebound_result = sealedScale(2, 5);
+  const objc3_runtime_sealed_dispatch_table_state_snapshot after_rebind =
+      CopyTableState();
+
+  const std::int64_t expected_loop_checksum =
+      static_cast<std::int64_t>(kTimedLoopCount) *
+      (static_cast<std::int64_t>(kStepsPerLoop) * (kStepsPerLoop - 1) / 2 +
+       3LL * kStepsPerLoop);
+  const double speedup_ratio =
+      canonical.sends_per_second > 0.0
+          ? sealed.sends_per_second / canonical.sends_per_second
+          : 0.0;
+
+  std::printf("{");
+  std::printf("\"timed_send_count\":%d,", kTimedLoopCount * kStepsPerLoop);
+  std::printf("\"sealed_sends_per_second\":%.0f,", sealed.sends_per_second);
+  std::printf("\"canonical_sends_per_second\":%.0f,",
+              canonical.sends_per_second);
+  std::printf("\"sealed_speedup_ratio\":%.2f,", speedup_ratio);
+  std::printf("\"results_match\":%d,",
+              sealed.checksum == expected_loop_checksum &&
+                      canonical.checksum == expected_loop_checksum
+                  ? 1
+                  : 0);
+  std::printf("\"first_result\":%d,", first_result);
+  std::printf("\"bound_table_count\":%llu,",
+              static_cast<unsigned long long>(after_bind.bound_table_count));
+  std::printf("\"bound_slot_count\":%llu,",
+              static_cast<unsigned long long>(after_bind.bound_slot_count));
+  std::printf("\"bind_miss_count\":%llu,",
+              static_cast<unsigned long long>(after_bind.table_miss_count));
+  std::printf("\"timed_table_miss_count\":%llu,",
+              static_cast<unsigned long long>(
+                  after_sealed_loop.table_miss_count -
+                  after_bind.table_miss_count));
+  std::printf("\"timed_method_cache_hit_count\":%llu,",
+              static_cast<unsigned long long>(after_sealed.cache_hit_count -
+                                              before_sealed.cache_hit_count));
+  std::printf("\"scale_result\":%d,", scale_result);
+  std::printf("\"ready_result\":%d,",
+              ready_before == 1 && ready_after == 1 ? 1 : 0);
+  std::printf("\"ready_table_miss_count\":%llu,",
+              static_cast<unsigned long long>(
+                  after_ready.table_miss_count -
+                  after_sealed_loop.table_miss_count));
+  std::printf("\"escape_result\":%d,", escape_result);
+  std::printf("\"self_steps_result\":%d,", self_steps_result);
+  std::printf("\"bound_table_count_after_reset\":%llu,",
+              static_cast<unsigned long long>(after_reset.bound_table_count));
+  std::printf("\"replay_status\":%d,", replay_status);
+  std::printf("\"rebound_result\":%d,", rebound_result);
+  std::printf("\"rebind_count\":%llu",
+              static_cast<unsigned long long>(after_rebind.table_bind_count));
+  std::printf("}\n");
+
+  const bool ok =
+      sealed.checksum == expected_loop_checksum &&
+      canonical.checksum == expected_loop_checksum && first_result == 3 &&
+      after_bind.bound_table_count == 1u && after_bind.bound_slot_count == 3u &&
+      after_bind.table_bind_count == 1u && after_bind.table_miss_count == 1u &&
+      after_sealed_loop.table_miss_count == after_bind.table_miss_count &&
+      after_sealed.cache_hit_count == before_sealed.cache_hit_count &&
+      scale_result == 42 && ready_before == 1 && ready_after == 1 &&
+      after_ready.table_miss_count - after_sealed_loop.table_miss_count == 1u &&
+      escape_result == 9 && self_steps_result == 18 &&
+      after_reset.bound_table_count == 0u && replay_status == 0 &&
+      rebound_result == 10 && after_rebind.table_bind_count == 1u &&
+      after_rebind.bound_table_count == 1u;
+  return ok ? 0 : 1;
+}
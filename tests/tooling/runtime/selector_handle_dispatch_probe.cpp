@@ -0,0 +1,150 @@
+#include "runtime/objc3_runtime.h"
+#include "runtime/objc3_runtime_bootstrap_internal.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+
+namespace {
+
+constexpr int kReceiverIdentityBase = 1024;
+constexpr int kReceiverIdentityStride = 17;
+// More receivers than thread hit-cache slots, so most sends take the locked
+// method-cache path where the spelling entrypoint hashes the selector.
+constexpr int kReceiverCount = 256;
+constexpr int kTimedRoundCount = 400;
+constexpr const char *kSelector = "selectorHandleProbe:";
+
+// Mirrors the selector reference that selector-handle lowering emits.
+objc3_runtime_selector_reference g_selector_reference{kSelector, nullptr, 0};
+
+int InstanceReceiver(int index) {
+  return kReceiverIdentityBase + index * kReceiverIdentityStride + 1;
+}
+
+struct SendSample {
+  double sends_per_second = 0.0;
+  std::int64_t checksum = 0;
+};
+
+template <typename Send>
+SendSample TimeSends(Send send) {
+  SendSample sample;
+  const auto started = std::chrono::steady_clock::now();
+  for (int round = 0; round < kTimedRoundCount; ++round) {
+    for (int index = 0; index < kReceiverCount; ++index) {
+      sample.checksum += send(InstanceReceiver(index), round & 7);
+    }
+  }
+  const auto finished = std::chrono::steady_clock::now();
+  const double elapsed_ms =
+      std::chrono::duration<double, std::milli>(finished - started).count();
+  sample.sends_per_second =
+      elapsed_ms > 0.0 ? static_cast<double>(kTimedRoundCount) *
+                             kReceiverCount * 1000.0 / elapsed_ms
+                       : 0.0;
+  return sample;
+}
+
+objc3_runtime_selector_lookup_table_state_snapshot CopyTableState() {
+  objc3_runtime_selector_lookup_table_state_snapshot snapshot{};
+  (void)objc3_runtime_copy_selector_lookup_table_state_for_testing(&snapshot);
+  return snapshot;
+}
+
+}  // namespace
+
+int main() {
+  objc3_runtime_reset_for_testing();
+  for (int index = 0; index < kReceiverCount; ++index) {
+    (void)objc3_runtime_dispatch_i32(InstanceReceiver(index), kSelector, 0, 0,
+                                     0, 0);
+  }
+
+  const objc3_runtime_selector_lookup_table_state_snapshot before_spelling =
+      CopyTableState();
+  const SendSample spelling = TimeSends([](int receiver, int a0) {
+    return objc3_runtime_dispatch_i32(receiver, kSelector, a0, 0, 0, 0);
+  });
+  const objc3_runtime_selector_lookup_table_state_snapshot after_spelling =
+      CopyTableState();
+
+  (void)objc3_runtime_dispatch_sel_i32(InstanceReceiver(0),
+                                       &g_selector_reference, 0, 0, 0, 0);
+  const objc3_runtime_selector_lookup_table_state_snapshot before_handle =
+      CopyTableState();
+  const SendSample handle = TimeSends([](int receiver, int a0) {
+    return objc3_runtime_dispatch_sel_i32(receiver, &g_selector_reference, a0,
+                                          0, 0, 0);
+  });
+  const objc3_runtime_selector_lookup_table_state_snapshot after_handle =
+      CopyTableState();
+
+  const objc3_runtime_selector_handle *canonical =
+      objc3_runtime_lookup_selector(kSelector);
+  const bool bound_to_canonical =
+      canonical != nullptr && g_selector_reference.handle == canonical;
+
+  // A reset discards the selector table; the emitted reference must rebind
+  // under the new generation instead of reusing the discarded handle.
+  const std::uint64_t generation_before_reset =
+      g_selector_reference.selector_table_generation;
+  objc3_runtime_reset_for_testing();
+  const int rebound_result = objc3_runtime_dispatch_sel_i32(
+      InstanceReceiver(3), &g_selector_reference, 5, 0, 0, 0);
+  const int rebound_expected =
+      objc3_runtime_dispatch_i32(InstanceReceiver(3), kSelector, 5, 0, 0, 0);
+  const objc3_runtime_selector_lookup_table_state_snapshot after_reset =
+      CopyTableState();
+  const int nil_result = objc3_runtime_dispatch_sel_i32(
+      0, &g_selector_reference, 1, 0, 0, 0);
+
+  const std::uint64_t spelling_lookups =
+      after_spelling.selector_spelling_lookup_count -
+      before_spelling.selector_spelling_lookup_count;
+  const std::uint64_t handle_lookups =
+      after_handle.selector_spelling_lookup_count -
+      before_handle.selector_spelling_lookup_count;
+  const bool results_match = spelling.checksum == handle.checksum;
+
+  std::printf("{");
+  std::printf("\"timed_send_count\":%d,", kTimedRoundCount * kReceiverCount);
+  std::printf("\"receiver_count\":%d,", kReceiverCount);
+  std::printf("\"spelling_sends_per_second\":%.0f,", spelling.sends_per_second);
+  std::printf("\"handle_sends_per_second\":%.0f,", handle.sends_per_second);
+  std::printf("\"handle_speedup_ratio\":%.3f,",
+              spelling.sends_per_second > 0.0
+                  ? handle.sends_per_second / spelling.sends_per_second
+                  : 0.0);
+  std::printf("\"results_match\":%d,", results_match ? 1 : 0);
+  std::printf("\"spelling_selector_lookups\":%llu,",
+              static_cast<unsigned long long>(spelling_lookups));
+  std::printf("\"handle_selector_lookups\":%llu,",
+              static_cast<unsigned long long>(handle_lookups));
+  std::printf("\"bound_selector_reference_count\":%llu,",
+              static_cast<unsigned long long>(
+                  after_handle.bound_selector_reference_count));
+  std::printf("\"bound_to_canonical\":%d,", bound_to_canonical ? 1 : 0);
+  std::printf("\"generation_before_reset\":%llu,",
+              static_cast<unsigned long long>(generation_before_reset));
+  std::printf("\"generation_after_reset\":%llu,",
+              static_cast<unsigned long long>(
+                  g_selector_reference.selector_table_generation));
+  std::printf("\"rebound_selector_reference_count\":%llu,",
+              static_cast<unsigned long long>(
+                  after_reset.bound_selector_reference_count));
+  std::printf("\"rebound_matches\":%d,",
+              rebound_result == rebound_expected ? 1 : 0);
+  std::printf("\"nil_result\":%d", nil_result);
+  std::printf("}\n");
+
+  const bool ok =
+      results_match && spelling_lookups > 0 && handle_lookups == 0 &&
+      after_handle.bound_selector_reference_count == 1 && bound_to_canonical &&
+      g_selector_reference.selector_table_generation ==
+          after_reset.selector_table_generation &&
+      generation_before_reset != after_reset.selector_table_generation &&
+      after_reset.bound_selector_reference_count == 1 &&
+      rebound_result == rebound_expected && nil_result == 0;
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,273 @@
+#include "runtime/objc3_runtime.h"
+#include "runtime/objc3_runtime_bootstrap_internal.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+namespace {
+
+constexpr int kCpuTaskCount = 64;
+constexpr int kCpuTaskIterations = 400000;
+constexpr int kSmallTaskCount = 100000;
+constexpr int kFanOutDepth = 10;
+constexpr int kSerialTaskCount = 2000;
+constexpr int kCancelTaskCount = 32;
+constexpr int kMainExecutorTag = 1;
+// StablePositiveAsyncTag("executor:com.example.signalmesh"), as lowered for
+// `objc_executor(named("com.example.signalmesh"))`.
+constexpr int kNamedExecutorTag = 1761204479;
+
+using Clock = std::chrono::steady_clock;
+
+// A non-pointer-capture block: the invoke thunk followed by by-value captures.
+struct ValueBlockStorage {
+  int (*invoke)(void *, int, int, int, int) = nullptr;
+  int payload = 0;
+};
+
+int PromoteValueBlock(int (*invoke)(void *, int, int, int, int), int payload) {
+  ValueBlockStorage storage{invoke, payload};
+  return objc3_runtime_promote_block_i32(&storage, sizeof(storage), 0);
+}
+
+extern "C" int SpinInvoke(void *, int iterations, int, int, int) {
+  std::uint32_t value = static_cast<std::uint32_t>(iterations);
+  for (int index = 0; index < iterations; ++index) {
+    value = value * 1664525u + 1013904223u;
+  }
+  return static_cast<int>(value & 0xffu);
+}
+
+extern "C" int AddPayloadInvoke(void *storage, int argument, int, int, int) {
+  return static_cast<ValueBlockStorage *>(storage)->payload + argument;
+}
+
+int g_fan_out_block = 0;
+
+// Spawns two child tasks from inside the pool and joins them, so the children
+// land on the worker's own deque and idle workers must steal them.
+extern "C" int FanOutInvoke(void *, int depth, int, int, int) {
+  if (depth == 0) {
+    return 1;
+  }
+  const int left = objc3_runtime_spawn_block_task_i32(1, g_fan_out_block,
+                                                      depth - 1, 0);
+  const int right = objc3_runtime_spawn_block_task_i32(1, g_fan_out_block,
+                                                       depth - 1, 0);
+  return objc3_runtime_join_task_i32(left) + objc3_runtime_join_task_i32(right);
+}
+
+std::atomic<int> g_serial_inside{0};
+std::atomic<int> g_serial_overlap_count{0};
+int g_serial_next_expected = 0;
+int g_serial_order_breaks = 0;
+
+// Serial executors must run one task at a time in submission order; the
+// unsynchronized order check is only safe if they do.
+extern "C" int SerialInvoke(void *, int sequence, int, int, int) {
+  if (g_serial_inside.fetch_add(1) != 0) {
+    g_serial_overlap_count.fetch_add(1);
+  }
+  if (sequence != g_serial_next_expected) {
+    ++g_serial_order_breaks;
+  }
+  g_serial_next_expected = sequence + 1;
+  g_serial_inside.fetch_sub(1);
+  return sequence;
+}
+
+std::atomic<int> g_cancel_started{0};
+
+// Polls for cooperative cancellation the way lowered
+// `task_runtime_cancelled_value()` does.
+extern "C" int CancellableInvoke(void *, int, int, int, int) {
+  g_cancel_started.fetch_add(1);
+  const auto deadline = Clock::now() + std::chrono::seconds(10);
+  while (Clock::now() < deadline) {
+    if (objc3_runtime_task_is_cancelled_i32(0) != 0) {
+      return -1;
+    }
+  }
+  return 0;
+}
+
+double ElapsedMs(Clock::time_point started) {
+  return std::chrono::duration<double, std::milli>(Clock::now() - started)
+      .count();
+}
+
+objc3_runtime_task_executor_state_snapshot CopyExecutorState() {
+  objc3_runtime_task_executor_state_snapshot snapshot{};
+  (void)objc3_runtime_copy_task_executor_state_for_testing(&snapshot);
+  return snapshot;
+}
+
+}  // namespace
+
+int main() {
+  objc3_runtime_reset_for_testing();
+
+  // CPU-bound tasks: the same work inline and then spread over the pool.
+  const int spin_block = PromoteValueBlock(&SpinInvoke, 0);
+  auto started = Clock::now();
+  std::int64_t inline_checksum = 0;
+  for (int index = 0; index < kCpuTaskCount; ++index) {
+    inline_checksum +=
+        objc3_runtime_invoke_block_i32(spin_block, kCpuTaskIterations + index,
+                                       0, 0, 0);
+  }
+  const double inline_ms = ElapsedMs(started);
+  started = Clock::now();
+  std::vector<int> cpu_tasks(kCpuTaskCount, 0);
+  for (int index = 0; index < kCpuTaskCount; ++index) {
+    cpu_tasks[static_cast<std::size_t>(index)] =
+        objc3_runtime_spawn_block_task_i32(1, spin_block,
+                                           kCpuTaskIterations + index, 0);
+  }
+  std::int64_t pool_checksum = 0;
+  for (int task : cpu_tasks) {
+    pool_checksum += objc3_runtime_join_task_i32(task);
+  }
+  const double pool_ms = ElapsedMs(started);
+  const objc3_runtime_task_executor_state_snapshot after_cpu =
+      CopyExecutorState();
+
+  // Small tasks through a group: spawn throughput plus completion-order next.
+  const int add_block = PromoteValueBlock(&AddPayloadInvoke, 3);
+  started = Clock::now();
+  const int group = objc3_runtime_create_task_group_i32(0);
+  for (int index = 0; index < kSmallTaskCount; ++index) {
+    (void)objc3_runtime_task_group_spawn_block_i32(group, add_block, index);
+  }
+  std::int64_t group_sum = 0;
+  int group_result_count = 0;
+  int next_result = 0;
+  while (objc3_runtime_task_group_next_i32(group, &next_result) != 0) {
+    group_sum += next_result;
+    ++group_result_count;
+  }
+  const double small_task_ms = ElapsedMs(started);
+  const int drained_group_next = objc3_runtime_task_group_next_i32(group, nullptr);
+  const int group_discarded = objc3_runtime_join_task_group_i32(group);
+  const std::int64_t expected_group_sum =
+      3LL * kSmallTaskCount +
+      static_cast<std::int64_t>(kSmallTaskCount) * (kSmallTaskCount - 1) / 2;
+
+  // Recursive fan-out spawned from inside the pool.
+  g_fan_out_block = PromoteValueBlock(&FanOutInvoke, 0);
+  const std::uint64_t stolen_before = CopyExecutorState().stolen_job_count;
+  const int fan_out_root =
+      objc3_runtime_spawn_block_task_i32(1, g_fan_out_block, kFanOutDepth, 0);
+  const int fan_out_leaves = objc3_runtime_join_task_i32(fan_out_root);
+  const std::uint64_t fan_out_stolen =
+      CopyExecutorState().stolen_job_count - stolen_before;
+
+  // `main` and a named executor are serial: ordered and never overlapping.
+  const int serial_block = PromoteValueBlock(&SerialInvoke, 0);
+  int serial_order_breaks = 0;
+  int serial_overlaps = 0;
+  for (int tag : {kMainExecutorTag, kNamedExecutorTag}) {
+    g_serial_next_expected = 0;
+    g_serial_order_breaks = 0;
+    g_serial_overlap_count.store(0);
+    std::vector<int> serial_tasks(kSerialTaskCount, 0);
+    for (int index = 0; index < kSerialTaskCount; ++index) {
+      serial_tasks[static_cast<std::size_t>(index)] =
+          objc3_runtime_spawn_block_task_i32(1, serial_block, index, tag);
+    }
+    for (int task : serial_tasks) {
+      (void)objc3_runtime_join_task_i32(task);
+    }
+    serial_order_breaks += g_serial_order_breaks;
+    serial_overlaps += g_serial_overlap_count.load();
+  }
+
+  // Cooperative cancellation of a group's pending tasks.
+  const int cancel_block = PromoteValueBlock(&CancellableInvoke, 0);
+  const int cancel_group = objc3_runtime_create_task_group_i32(0);
+  for (int index = 0; index < kCancelTaskCount; ++index) {
+    (void)objc3_runtime_task_group_spawn_block_i32(cancel_group, cancel_block, 0);
+  }
+  while (g_cancel_started.load() == 0) {
+  }
+  started = Clock::now();
+  const int cancelled_pending =
+      objc3_runtime_cancel_task_group_tasks_i32(cancel_group);
+  int cancelled_results = 0;
+  while (objc3_runtime_task_group_next_i32(cancel_group, &next_result) != 0) {
+    cancelled_results += next_result == -1 ? 1 : 0;
+  }
+  const double cancel_ms = ElapsedMs(started);
+  (void)objc3_runtime_join_task_group_i32(cancel_group);
+  const int outside_task_cancelled = objc3_runtime_task_is_cancelled_i32(0);
+
+  // A detached task retires its handle on completion; dead blocks never spawn.
+  const int detached =
+      objc3_runtime_spawn_block_task_i32(2, add_block, 1, kMainExecutorTag);
+  const int detached_join_result = objc3_runtime_join_task_i32(detached);
+  for (int block : {spin_block, add_block, g_fan_out_block, serial_block,
+                    cancel_block}) {
+    (void)objc3_runtime_release_i32(block);
+  }
+  const int dead_block_spawn =
+      objc3_runtime_spawn_block_task_i32(1, spin_block, 1, 0);
+  objc3_runtime_reset_for_testing();
+  const objc3_runtime_task_executor_state_snapshot after_reset =
+      CopyExecutorState();
+
+  std::printf("{");
+  std::printf("\"worker_count\":%llu,",
+              static_cast<unsigned long long>(after_cpu.worker_count));
+  std::printf("\"cpu_task_count\":%d,", kCpuTaskCount);
+  std::printf("\"cpu_inline_ms\":%.3f,", inline_ms);
+  std::printf("\"cpu_pool_ms\":%.3f,", pool_ms);
+  std::printf("\"cpu_parallel_speedup\":%.2f,",
+              pool_ms > 0.0 ? inline_ms / pool_ms : 0.0);
+  std::printf("\"cpu_checksum_matched\":%d,",
+              inline_checksum == pool_checksum ? 1 : 0);
+  std::printf("\"small_task_count\":%d,", kSmallTaskCount);
+  std::printf("\"small_tasks_per_second\":%.0f,",
+              small_task_ms > 0.0 ? kSmallTaskCount * 1000.0 / small_task_ms
+                                  : 0.0);
+  std::printf("\"group_result_count\":%d,", group_result_count);
+  std::printf("\"group_sum_matched\":%d,",
+              group_sum == expected_group_sum ? 1 : 0);
+  std::printf("\"drained_group_next\":%d,", drained_group_next);
+  std::printf("\"group_discarded\":%d,", group_discarded);
+  std::printf("\"fan_out_leaves\":%d,", fan_out_leaves);
+  std::printf("\"fan_out_stolen_job_count\":%llu,",
+              static_cast<unsigned long long>(fan_out_stolen));
+  std::printf("\"serial_order_breaks\":%d,", serial_order_breaks);
+  std::printf("\"serial_overlaps\":%d,", serial_overlaps);
+  std::printf("\"cancelled_pending\":%d,", cancelled_pending);
+  std::printf("\"cancelled_results\":%d,", cancelled_results);
+  std::printf("\"cancel_ms\":%.3f,", cancel_ms);
+  std::printf("\"outside_task_cancelled\":%d,", outside_task_cancelled);
+  std::printf("\"detached_join_result\":%d,", detached_join_result);
+  std::printf("\"dead_block_spawn\":%d,", dead_block_spawn);
+  std::printf("\"reset_in_flight_task_count\":%llu,",
+              static_cast<unsigned long long>(after_reset.in_flight_task_count));
+  std::printf("\"reset_live_task_handle_count\":%llu,",
+              static_cast<unsigned long long>(
+                  after_reset.live_task_handle_count));
+  std::printf("\"reset_live_task_group_count\":%llu",
+              static_cast<unsigned long long>(after_reset.live_task_group_count));
+  std::printf("}\n");
+
+  const bool ok =
+      after_cpu.worker_count > 0u && inline_checksum == pool_checksum &&
+      group_result_count == kSmallTaskCount &&
+      group_sum == expected_group_sum && drained_group_next == 0 &&
+      group_discarded == 0 && fan_out_leaves == (1 << kFanOutDepth) &&
+      serial_order_breaks == 0 && serial_overlaps == 0 &&
+      cancelled_pending == kCancelTaskCount &&
+      cancelled_results == kCancelTaskCount && outside_task_cancelled == 0 &&
+      detached > 0 && detached_join_result == 0 && dead_block_spawn == 0 &&
+      after_reset.in_flight_task_count == 0u &&
+      after_reset.live_task_handle_count == 0u &&
+      after_reset.live_task_group_count == 0u;
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,222 @@
+#include "runtime/objc3_runtime.h"
+#include "runtime/objc3_runtime_bootstrap_internal.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+namespace {
+
+// Links against the weak/autoreleasepool fixture, whose Box class is the
+// image's first class and carries a `weakValue` property.
+constexpr int kBoxClassReceiver = 1024;
+constexpr int kFanInReferrerCount = 10000;
+constexpr int kFanInLoadRoundCount = 20;
+constexpr int kFanOutObjectCount = 1000000;
+
+using Clock = std::chrono::steady_clock;
+
+double ElapsedMs(Clock::time_point started) {
+  return std::chrono::duration<double, std::milli>(Clock::now() - started)
+      .count();
+}
+
+double PerSecond(std::uint64_t count, double elapsed_ms) {
+  return elapsed_ms > 0.0 ? static_cast<double>(count) * 1000.0 / elapsed_ms
+                          : 0.0;
+}
+
+int AllocBox() {
+  return objc3_runtime_dispatch_i32(kBoxClassReceiver, "alloc", 0, 0, 0, 0);
+}
+
+int SetWeak(int owner, int target) {
+  return objc3_runtime_dispatch_i32(owner, "setWeakValue:", target, 0, 0, 0);
+}
+
+int GetWeak(int owner) {
+  return objc3_runtime_dispatch_i32(owner, "weakValue", 0, 0, 0, 0);
+}
+
+objc3_runtime_weak_side_table_state_snapshot CopySideTableState() {
+  objc3_runtime_weak_side_table_state_snapshot snapshot{};
+  (void)objc3_runtime_copy_weak_side_table_state_for_testing(&snapshot);
+  return snapshot;
+}
+
+void PrintSideTableState(
+    const char *name,
+    const objc3_runtime_weak_side_table_state_snapshot &snapshot) {
+  std::printf("\"%s\":{\"stripe_count\":%llu,\"weak_target_count\":%llu,"
+              "\"weak_slot_ref_count\":%llu,\"occupied_stripe_count\":%llu,"
+              "\"max_stripe_slot_ref_count\":%llu}",
+              name, static_cast<unsigned long long>(snapshot.stripe_count),
+              static_cast<unsigned long long>(snapshot.weak_target_count),
+              static_cast<unsigned long long>(snapshot.weak_slot_ref_count),
+              static_cast<unsigned long long>(snapshot.occupied_stripe_count),
+              static_cast<unsigned long long>(
+                  snapshot.max_stripe_slot_ref_count));
+}
+
+}  // namespace
+
+int main() {
+  objc3_runtime_reset_for_testing();
+  (void)objc3_runtime_replay_registered_images_for_testing();
+
+  // Fan-in: many owners weakly reference one target. Retargeting every owner
+  // unregisters from one long referrer list, and destroying the target zeroes
+  // all of them in one pass.
+  const int target = AllocBox();
+  const int retarget = AllocBox();
+  std::vector<int> owners(kFanInReferrerCount, 0);
+  bool fan_in_ok = target != 0 && retarget != 0;
+  for (int &owner : owners) {
+    owner = AllocBox();
+    fan_in_ok = fan_in_ok && owner != 0;
+  }
+
+  auto started = Clock::now();
+  for (int owner : owners) {
+    (void)SetWeak(owner, target);
+  }
+  const double fan_in_register_ms = ElapsedMs(started);
+  const objc3_runtime_weak_side_table_state_snapshot fan_in_registered =
+      CopySideTableState();
+
+  started = Clock::now();
+  std::int64_t fan_in_loaded = 0;
+  for (int round = 0; round < kFanInLoadRoundCount; ++round) {
+    for (int owner : owners) {
+      fan_in_loaded += GetWeak(owner) == target ? 1 : 0;
+    }
+  }
+  const double fan_in_load_ms = ElapsedMs(started);
+
+  started = Clock::now();
+  for (int owner : owners) {
+    (void)SetWeak(owner, retarget);
+  }
+  for (int owner : owners) {
+    (void)SetWeak(owner, target);
+  }
+  const double fan_in_retarget_ms = ElapsedMs(started);
+
+  started = Clock::now();
+  (void)objc3_runtime_release_i32(target);
+  const double fan_in_zero_ms = ElapsedMs(started);
+  const objc3_runtime_weak_side_table_state_snapshot fan_in_zeroed =
+      CopySideTableState();
+  bool fan_in_all_zeroed = true;
+  for (int owner : owners) {
+    fan_in_all_zeroed = fan_in_all_zeroed && GetWeak(owner) == 0;
+  }
+  for (int owner : owners) {
+    (void)objc3_runtime_release_i32(owner);
+  }
+  (void)objc3_runtime_release_i32(retarget);
+
+  // Fan-out: a ring of objects where each holds one weak reference to the
+  // next, so every object is both a referrer and a target.
+  std::vector<int> ring(kFanOutObjectCount, 0);
+  bool fan_out_ok = true;
+  for (int &object : ring) {
+    object = AllocBox();
+    fan_out_ok = fan_out_ok && object != 0;
+  }
+
+  started = Clock::now();
+  for (int index = 0; index < kFanOutObjectCount; ++index) {
+    (void)SetWeak(ring[static_cast<std::size_t>(index)],
+                  ring[static_cast<std::size_t>((index + 1) %
+                                                kFanOutObjectCount)]);
+  }
+  const double fan_out_register_ms = ElapsedMs(started);
+  const objc3_runtime_weak_side_table_state_snapshot fan_out_registered =
+      CopySideTableState();
+
+  started = Clock::now();
+  std::int64_t fan_out_loaded = 0;
+  for (int index = 0; index < kFanOutObjectCount; ++index) {
+    fan_out_loaded +=
+        GetWeak(ring[static_cast<std::size_t>(index)]) ==
+                ring[static_cast<std::size_t>((index + 1) % kFanOutObjectCount)]
+            ? 1
+            : 0;
+  }
+  const double fan_out_load_ms = ElapsedMs(started);
+
+  // Releasing every other object zeroes its predecessor's slot and drops its
+  // own registration, so half the ring empties the side table entirely.
+  started = Clock::now();
+  for (int index = 1; index < kFanOutObjectCount; index += 2) {
+    (void)objc3_runtime_release_i32(ring[static_cast<std::size_t>(index)]);
+  }
+  const double fan_out_half_release_ms = ElapsedMs(started);
+  const objc3_runtime_weak_side_table_state_snapshot fan_out_half_released =
+      CopySideTableState();
+  bool fan_out_survivors_zeroed = true;
+  for (int index = 0; index < kFanOutObjectCount; index += 2) {
+    fan_out_survivors_zeroed =
+        fan_out_survivors_zeroed &&
+        GetWeak(ring[static_cast<std::size_t>(index)]) == 0;
+  }
+  for (int index = 0; index < kFanOutObjectCount; index += 2) {
+    (void)objc3_runtime_release_i32(ring[static_cast<std::size_t>(index)]);
+  }
+  const objc3_runtime_weak_side_table_state_snapshot fan_out_released =
+      CopySideTableState();
+
+  const std::uint64_t fan_in_load_count =
+      static_cast<std::uint64_t>(kFanInLoadRoundCount) * kFanInReferrerCount;
+  std::printf("{");
+  std::printf("\"fan_in_referrer_count\":%d,", kFanInReferrerCount);
+  std::printf("\"fan_in_registers_per_second\":%.0f,",
+              PerSecond(kFanInReferrerCount, fan_in_register_ms));
+  std::printf("\"fan_in_loads_per_second\":%.0f,",
+              PerSecond(fan_in_load_count, fan_in_load_ms));
+  std::printf("\"fan_in_retargets_per_second\":%.0f,",
+              PerSecond(2u * kFanInReferrerCount, fan_in_retarget_ms));
+  std::printf("\"fan_in_zero_ms\":%.3f,", fan_in_zero_ms);
+  std::printf("\"fan_in_loads_matched\":%d,",
+              fan_in_loaded == static_cast<std::int64_t>(fan_in_load_count)
+                  ? 1
+                  : 0);
+  std::printf("\"fan_in_all_zeroed\":%d,", fan_in_all_zeroed ? 1 : 0);
+  PrintSideTableState("fan_in_registered", fan_in_registered);
+  std::printf(",");
+  PrintSideTableState("fan_in_zeroed", fan_in_zeroed);
+  std::printf(",\"fan_out_object_count\":%d,", kFanOutObjectCount);
+  std::printf("\"fan_out_registers_per_second\":%.0f,",
+              PerSecond(kFanOutObjectCount, fan_out_register_ms));
+  std::printf("\"fan_out_loads_per_second\":%.0f,",
+              PerSecond(kFanOutObjectCount, fan_out_load_ms));
+  std::printf("\"fan_out_half_release_ms\":%.3f,", fan_out_half_release_ms);
+  std::printf("\"fan_out_loads_matched\":%d,",
+              fan_out_loaded == kFanOutObjectCount ? 1 : 0);
+  std::printf("\"fan_out_survivors_zeroed\":%d,",
+              fan_out_survivors_zeroed ? 1 : 0);
+  PrintSideTableState("fan_out_registered", fan_out_registered);
+  std::printf(",");
+  PrintSideTableState("fan_out_half_released", fan_out_half_released);
+  std::printf(",");
+  PrintSideTableState("fan_out_released", fan_out_released);
+  std::printf("}\n");
+
+  const bool ok =
+      fan_in_ok && fan_out_ok &&
+      fan_in_loaded == static_cast<std::int64_t>(fan_in_load_count) &&
+      fan_in_registered.weak_target_count == 1 &&
+      fan_in_registered.weak_slot_ref_count == kFanInReferrerCount &&
+      fan_in_zeroed.weak_slot_ref_count == 0 && fan_in_all_zeroed &&
+      fan_out_loaded == kFanOutObjectCount &&
+      fan_out_registered.weak_target_count == kFanOutObjectCount &&
+      fan_out_registered.weak_slot_ref_count == kFanOutObjectCount &&
+      fan_out_registered.occupied_stripe_count ==
+          fan_out_registered.stripe_count &&
+      fan_out_half_released.weak_slot_ref_count == 0 &&
+      fan_out_survivors_zeroed && fan_out_released.weak_slot_ref_count == 0 &&
+      fan_out_released.weak_target_count == 0;
+  return ok ? 0 : 1;
+}